@@ -123,6 +123,16 @@ IF ( LIBMMG_STATIC OR LIBMMG_SHARED )
     ${PROJECT_BINARY_DIR}/include/mmg/libmmg.h
     ${PROJECT_BINARY_DIR}/include/mmg/mmg3d/libmmgtypes.h )
 
+  # Benchmark of the mmg2d, mmgs and mmg3d libraries
+  IF ( LIBMMG_STATIC )
+    SET ( lib_name lib${PROJECT_NAME}_a )
+  ELSE ( )
+    SET ( lib_name lib${PROJECT_NAME}_so )
+  ENDIF ( )
+  ADD_LIBRARY_TEST ( mmg_bench
+    ${PROJECT_SOURCE_DIR}/libexamples/mmg/benchmark/main.c
+    copy_mmg_headers ${lib_name} )
+
 ENDIF()
 
 ############################################################################
@@ -175,6 +185,13 @@ IF ( BUILD_TESTING )
       ENDIF()
     ENDIF ()
 
+    # Small run of the benchmark: checks that all the cases succeed
+    IF ( LIBMMG_STATIC OR LIBMMG_SHARED )
+      ADD_TEST(NAME mmg_bench_small
+        COMMAND ${EXECUTABLE_OUTPUT_PATH}/mmg_bench -n 4
+        -o ${CTEST_OUTPUT_DIR}/mmg_bench_small.json)
+    ENDIF ( )
+
   ENDIF( MMG_CI )
 
 ENDIF ( BUILD_TESTING )
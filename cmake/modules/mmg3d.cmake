@@ -204,6 +204,7 @@ IF ( BUILD_TESTING )
       SET(LIBMMG3D_EXEC2   ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example2)
       SET(LIBMMG3D_EXEC4   ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example4)
       SET(LIBMMG3D_EXEC5   ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example5)
+      SET(LIBMMG3D_EXEC7   ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example7)
 
       ADD_TEST(NAME libmmg3d_example0_a COMMAND ${LIBMMG3D_EXEC0_a}
         "${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh"
@@ -230,6 +231,13 @@ IF ( BUILD_TESTING )
         "${PROJECT_SOURCE_DIR}/libexamples/mmg3d/IsosurfDiscretization_example0/test"
         "${CTEST_OUTPUT_DIR}/libmmg3d-IsosurfDiscretization_0-test.o"
         )
+      ADD_TEST(NAME libmmg3d_example7   COMMAND ${LIBMMG3D_EXEC7} 20)
+      IF ( CMAKE_USE_PTHREADS_INIT )
+        SET(LIBMMG3D_EXEC6   ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example6)
+        ADD_TEST(NAME libmmg3d_example6   COMMAND ${LIBMMG3D_EXEC6}
+          "${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh"
+          )
+      ENDIF ()
 
       IF ( CMAKE_Fortran_COMPILER)
         SET(LIBMMG3D_EXECFORTRAN_a ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_fortran_a )
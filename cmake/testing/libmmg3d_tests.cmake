@@ -33,6 +33,7 @@ SET ( MMG3D_LIB_TESTS
   libmmg3d_example2
   libmmg3d_example4
   libmmg3d_example5
+  libmmg3d_example7
   )
 SET ( MMG3D_LIB_TESTS_MAIN_PATH
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_a/main.c
@@ -41,6 +42,7 @@ SET ( MMG3D_LIB_TESTS_MAIN_PATH
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example2/main.c
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/LagrangianMotion_example0/main.c
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/IsosurfDiscretization_example0/main.c
+  ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adjacency_example0/main.c
   )
 
 IF ( LIBMMG3D_STATIC )
@@ -78,3 +80,13 @@ FOREACH ( test_idx RANGE ${nbTests} )
   ADD_LIBRARY_TEST ( ${test_name} ${main_path} copy_3d_headers ${lib_name} )
 
 ENDFOREACH ( )
+
+#####         Multithreaded Test
+FIND_PACKAGE ( Threads )
+
+IF ( CMAKE_USE_PTHREADS_INIT )
+  ADD_LIBRARY_TEST ( libmmg3d_example6
+    ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/multithread_example0/main.c
+    copy_3d_headers ${lib_name} )
+  TARGET_LINK_LIBRARIES ( libmmg3d_example6 ${CMAKE_THREAD_LIBS_INIT} )
+ENDIF ( )
@@ -73,6 +73,18 @@ ADD_TEST(NAME mmg2d_SquareIso_nonConstant2
   ${MMG2D_CI_TESTS}/SquareIso/non-constant-2
   -out ${CTEST_OUTPUT_DIR}/mmg2d_non-constant-2.o.meshb)
 
+####### space filling curve renumbering
+ADD_TEST(NAME mmg2d_Renum_SquareIso_nonConstant
+  COMMAND ${EXECUT_MMG2D} -v 5 -rnit 1
+  ${MMG2D_CI_TESTS}/SquareIso/non-constant
+  -out ${CTEST_OUTPUT_DIR}/mmg2d_Renum_non-constant.o.meshb)
+
+####### performance counters output
+ADD_TEST(NAME mmg2d_Stats_SquareIso_nonConstant
+  COMMAND ${EXECUT_MMG2D} -v 5 -stats
+  ${MMG2D_CI_TESTS}/SquareIso/non-constant
+  -out ${CTEST_OUTPUT_DIR}/mmg2d_Stats_non-constant.o.meshb)
+
 ####### -nosurf option
 ADD_TEST(NAME mmg2d_2squares
   COMMAND ${EXECUT_MMG2D} -msh 2 -hmax 1 -nosurf -v 5
@@ -402,6 +402,75 @@ ADD_TEST(NAME mmg3d_OpnBdy_ref_island
   -in ${MMG3D_CI_TESTS}/OpnBdy_island/island
   -out ${CTEST_OUTPUT_DIR}/mmg3d_OpnBdy_island.o.meshb)
 
+###############################################################################
+#####
+#####         Check space filling curve renumbering
+#####
+###############################################################################
+#####
+ADD_TEST(NAME mmg3d_Renum_multidomCube
+  COMMAND ${EXECUT_MMG3D} -v 5 -hmax 0.1 -rn 1 -rnit 1
+  ${MMG3D_CI_TESTS}/ChkBdry_multidomCube/c
+  ${CTEST_OUTPUT_DIR}/mmg3d_Renum_multidomCube-cube.o
+  )
+
+###############################################################################
+#####
+#####         Check the performance counters output
+#####
+###############################################################################
+#####
+ADD_TEST(NAME mmg3d_Stats_multidomCube
+  COMMAND ${EXECUT_MMG3D} -v 5 -hmax 0.1 -stats
+  ${MMG3D_CI_TESTS}/ChkBdry_multidomCube/c
+  ${CTEST_OUTPUT_DIR}/mmg3d_Stats_multidomCube-cube.o
+  )
+
+###############################################################################
+#####
+#####         Check the batched Delaunay insertion
+#####
+###############################################################################
+#####
+ADD_TEST(NAME mmg3d_BatchIns_multidomCube
+  COMMAND ${EXECUT_MMG3D} -v 5 -hmax 0.1 -batchins
+  ${MMG3D_CI_TESTS}/ChkBdry_multidomCube/c
+  ${CTEST_OUTPUT_DIR}/mmg3d_BatchIns_multidomCube-cube.o
+  )
+
+ADD_TEST(NAME mmg3d_ColMove_multidomCube
+  COMMAND ${EXECUT_MMG3D} -v 5 -hmax 0.1 -colmove
+  ${MMG3D_CI_TESTS}/ChkBdry_multidomCube/c
+  ${CTEST_OUTPUT_DIR}/mmg3d_ColMove_multidomCube-cube.o
+  )
+
+ADD_TEST(NAME mmg3d_ParSwap_multidomCube
+  COMMAND ${EXECUT_MMG3D} -v 5 -hmax 0.1 -parswap
+  ${MMG3D_CI_TESTS}/ChkBdry_multidomCube/c
+  ${CTEST_OUTPUT_DIR}/mmg3d_ParSwap_multidomCube-cube.o
+  )
+
+ADD_TEST(NAME mmg3d_NThreads_multidomCube
+  COMMAND ${EXECUT_MMG3D} -v 5 -hmax 0.1 -nthreads 4
+  ${MMG3D_CI_TESTS}/ChkBdry_multidomCube/c
+  ${CTEST_OUTPUT_DIR}/mmg3d_NThreads_multidomCube-cube.o
+  )
+
+ADD_TEST(NAME mmg3d_ActSet_multidomCube
+  COMMAND ${EXECUT_MMG3D} -v 5 -hmax 0.1 -actset
+  ${MMG3D_CI_TESTS}/ChkBdry_multidomCube/c
+  ${CTEST_OUTPUT_DIR}/mmg3d_ActSet_multidomCube-cube.o
+  )
+
+ADD_TEST(NAME mmg3d_TimeBudget_multidomCube
+  COMMAND ${EXECUT_MMG3D} -v 5 -hmax 0.02 -tbudget 0.01
+  ${MMG3D_CI_TESTS}/ChkBdry_multidomCube/c
+  ${CTEST_OUTPUT_DIR}/mmg3d_TimeBudget_multidomCube-cube.o
+  )
+SET(passRegex "Remeshing interrupted")
+SET_PROPERTY(TEST mmg3d_TimeBudget_multidomCube
+  PROPERTY PASS_REGULAR_EXPRESSION "${passRegex}")
+
 ###############################################################################
 #####
 #####         Check Lagrangian motion option
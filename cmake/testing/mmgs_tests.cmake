@@ -82,6 +82,18 @@ ADD_TEST(NAME mmgs_Rhino_M
   ${MMGS_CI_TESTS}/Rhino_M/rhino -hausd 1
   -out ${CTEST_OUTPUT_DIR}/mmgs_Rhino_M-rhino.d.meshb)
 
+####### space filling curve renumbering
+ADD_TEST(NAME mmgs_Renum_Rhino_M
+  COMMAND ${EXECUT_MMGS} -v 5 -rn 1 -rnit 1
+  ${MMGS_CI_TESTS}/Rhino_M/rhino -hausd 1
+  -out ${CTEST_OUTPUT_DIR}/mmgs_Renum_Rhino_M-rhino.d.meshb)
+
+####### performance counters output
+ADD_TEST(NAME mmgs_Stats_Rhino_M
+  COMMAND ${EXECUT_MMGS} -v 5 -stats
+  ${MMGS_CI_TESTS}/Rhino_M/rhino -hausd 1
+  -out ${CTEST_OUTPUT_DIR}/mmgs_Stats_Rhino_M-rhino.d.meshb)
+
 ###############################################################################
 #####
 #####         Non manifold cases
@@ -0,0 +1,282 @@
+MeshVersionFormatted
+ 2
+
+Dimension
+ 3
+
+SolAtVertices
+270
+1 1
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+
+
+End
@@ -0,0 +1,985 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * Benchmark of the mmg2d, mmgs and mmg3d libraries on procedurally generated
+ * meshes: the inputs only depend on the size parameter, so two runs of the
+ * same build are comparable and the JSON report can be used to track the
+ * performance regressions.
+ *
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/** Include the mmg library hader file */
+// if the "include/mmg" dir is in your include path
+//#include "libmmg.h"
+// if your include path do not contain the "mmg" subdirectories
+#include "mmg/libmmg.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/** Result of a benchmark case */
+typedef struct {
+  int        status; /*!< Return value of the library call */
+  int        npi;    /*!< Number of input vertices */
+  int        nelti;  /*!< Number of input elements (tetra or triangles) */
+  int        np;     /*!< Number of output vertices */
+  int        nelt;   /*!< Number of output elements (tetra or triangles) */
+  double     wall;   /*!< Wall time of the library call (s) */
+  int        nstep;  /*!< Number of library calls (1 except for the loops) */
+  int        ntrans; /*!< Number of vertices of the solution transfer */
+  double     ttrans; /*!< Wall time of the solution transfer (s) */
+  MMG5_Stats stats;  /*!< Performance counters of the library call */
+} BenchResult;
+
+/** Number of library calls of the remeshing loops */
+#define NSTEP 20
+
+/** Benchmark case */
+typedef struct {
+  const char *name; /*!< Name of the case */
+  const char *func; /*!< Library function called by the case */
+  int        scale; /*!< Ratio between the resolution of the case and the size
+                         parameter */
+  int (*run)(int n,BenchResult *res); /*!< Build the input and run the case */
+} BenchCase;
+
+/** Names of the phases of the MMG5_Stats structure */
+static const char *phaseName[MMG5_NPHASES] = {
+  "total","inout","analysis","main","remesh" };
+
+/**
+ * \return the wall clock time in seconds.
+ */
+static double wtime(void) {
+  struct timespec ts;
+
+  timespec_get(&ts,TIME_UTC);
+  return((double)ts.tv_sec + 1e-9*(double)ts.tv_nsec);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param n number of cells along each side of the unit cube.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Mesh the unit cube with \f$n^3\f$ cells, each cell being split in 6
+ * tetrahedra (Kuhn subdivision, conforming between neighbouring cells).
+ *
+ */
+static int cubeMesh(MMG5_pMesh mesh,int n) {
+  static const int perm[6][3] = {
+    {0,1,2},{1,2,0},{2,0,1},{0,2,1},{2,1,0},{1,0,2} };
+  int i,j,k,l,m,v[4],c[3],np1,ne;
+
+  np1 = n+1;
+  if ( MMG3D_Set_meshSize(mesh,np1*np1*np1,6*n*n*n,0,0,0,0) != 1 )
+    return(0);
+
+  for ( k=0; k<np1; k++ )
+    for ( j=0; j<np1; j++ )
+      for ( i=0; i<np1; i++ )
+        if ( MMG3D_Set_vertex(mesh,(double)i/n,(double)j/n,(double)k/n,0,
+                              1+i+np1*(j+np1*k)) != 1 )
+          return(0);
+
+  ne = 0;
+  for ( k=0; k<n; k++ )
+    for ( j=0; j<n; j++ )
+      for ( i=0; i<n; i++ ) {
+        for ( l=0; l<6; l++ ) {
+          /* walk from the cell corner (i,j,k) toward (i+1,j+1,k+1) */
+          c[0] = i; c[1] = j; c[2] = k;
+          v[0] = 1+c[0]+np1*(c[1]+np1*c[2]);
+          for ( m=0; m<3; m++ ) {
+            c[perm[l][m]]++;
+            v[m+1] = 1+c[0]+np1*(c[1]+np1*c[2]);
+          }
+          /* the odd permutations give negative tetra */
+          if ( l > 2 ) {
+            m = v[2]; v[2] = v[3]; v[3] = m;
+          }
+          if ( MMG3D_Set_tetrahedron(mesh,v[0],v[1],v[2],v[3],0,++ne) != 1 )
+            return(0);
+        }
+      }
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the sol structure.
+ * \param res pointer toward the benchmark result.
+ * \param iso 1 to call the level-set discretization, 0 for the adaptation.
+ *
+ * Call the mmg3d library and fill the benchmark result.
+ *
+ */
+static void run3d(MMG5_pMesh mesh,MMG5_pSol met,BenchResult *res,int iso) {
+  int    np,ne,nprism,nt,nquad,na;
+  double t0;
+
+  MMG3D_Get_meshSize(mesh,&np,&ne,&nprism,&nt,&nquad,&na);
+  res->npi   = np;
+  res->nelti = ne;
+
+  t0 = wtime();
+  res->status = iso ? MMG3D_mmg3dls(mesh,met) : MMG3D_mmg3dlib(mesh,met);
+  res->wall   = wtime() - t0;
+
+  MMG3D_Get_stats(mesh,&res->stats);
+  MMG3D_Get_meshSize(mesh,&np,&ne,&nprism,&nt,&nquad,&na);
+  res->np    = np;
+  res->nelt  = ne;
+  res->nstep = 1;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the sol structure.
+ * \param n number of cells along each side of the unit cube.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Set on the mesh of \ref cubeMesh a size map refined around a point.
+ *
+ */
+static int cubeSol(MMG5_pMesh mesh,MMG5_pSol met,int n) {
+  double hmin,hmax,d;
+  int    i,j,k,np1;
+
+  np1  = n+1;
+  hmin = 0.4/n;
+  hmax = 2./n;
+  if ( MMG3D_Set_solSize(mesh,met,MMG5_Vertex,np1*np1*np1,MMG5_Scalar) != 1 )
+    return(0);
+  for ( k=0; k<np1; k++ )
+    for ( j=0; j<np1; j++ )
+      for ( i=0; i<np1; i++ ) {
+        d = sqrt( ((double)i/n-0.25)*((double)i/n-0.25)
+                  + ((double)j/n-0.25)*((double)j/n-0.25)
+                  + ((double)k/n-0.25)*((double)k/n-0.25) );
+        d = d < 0.75 ? d/0.75 : 1.;
+        MMG3D_Set_scalarSol(met,hmin+(hmax-hmin)*d,1+i+np1*(j+np1*k));
+      }
+  return(1);
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Isotropic adaptation of the unit cube toward a size map refined around a
+ * point.
+ *
+ */
+static int caseCube(int n,BenchResult *res) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+
+  mesh = NULL;
+  met  = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                  MMG5_ARG_end);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_verbose,0);
+
+  if ( !cubeMesh(mesh,n) ) return(0);
+  if ( !cubeSol(mesh,met,n) ) return(0);
+
+  run3d(mesh,met,res,0);
+
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                 MMG5_ARG_end);
+  return(1);
+}
+
+/**
+ * \param c coordinates of the point.
+ * \param l index of the component.
+ * \return the value of the component \a l of the user fields at \a c.
+ *
+ * Linear fields carried by the \a fields case.
+ *
+ */
+static double fieldVal(double c[3],int l) {
+  return( l + c[0] + (l+1)*c[1] - 0.5*l*c[2] );
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * The \a cube case carrying a scalar, a vector and a tensor user field through
+ * the adaptation. The fields are linear and the faces of the cube are planar so
+ * the interpolation must give the exact values at the output vertices: the case
+ * fails otherwise.
+ *
+ */
+static int caseFields(int n,BenchResult *res) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  double     *f,c[3],err;
+  int        typ[3] = { MMG5_Scalar, MMG5_Vector, MMG5_Tensor };
+  int        np,nf,size,k,l;
+
+  mesh = NULL;
+  met  = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                  MMG5_ARG_end);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_verbose,0);
+
+  if ( !cubeMesh(mesh,n) ) return(0);
+  if ( !cubeSol(mesh,met,n) ) return(0);
+
+  if ( MMG3D_Set_fieldsSize(mesh,3,typ) != 1 ) return(0);
+  MMG3D_Get_fieldsSize(mesh,&nf,&size);
+  MMG3D_Get_meshSize(mesh,&np,NULL,NULL,NULL,NULL,NULL);
+  f = (double*)calloc(size,sizeof(double));
+  if ( !f ) return(0);
+  for ( k=1; k<=np; k++ ) {
+    MMG3D_Get_vertex(mesh,&c[0],&c[1],&c[2],NULL,NULL,NULL);
+    for ( l=0; l<size; l++ )  f[l] = fieldVal(c,l);
+    if ( MMG3D_Set_fieldsAtVertex(mesh,f,k) != 1 ) return(0);
+  }
+
+  run3d(mesh,met,res,0);
+
+  err = 0.;
+  MMG3D_Get_meshSize(mesh,&np,NULL,NULL,NULL,NULL,NULL);
+  for ( k=1; k<=np; k++ ) {
+    MMG3D_Get_vertex(mesh,&c[0],&c[1],&c[2],NULL,NULL,NULL);
+    if ( MMG3D_Get_fieldsAtVertex(mesh,f,k) != 1 ) return(0);
+    for ( l=0; l<size; l++ )
+      err = fmax(err,fabs(f[l]-fieldVal(c,l)));
+  }
+  if ( err > 1.e-8 ) {
+    fprintf(stderr,"  ## Error: fields: interpolation error %e.\n",err);
+    res->status = MMG5_LOWFAILURE;
+  }
+  free(f);
+
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                 MMG5_ARG_end);
+  return(1);
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * The \a cube case followed by the transfer of a linear vector field from the
+ * input mesh onto the output mesh (\ref MMG3D_interpolate): the throughput
+ * of the transfer is given in points per second. The case fails if the
+ * interpolated values are not exact.
+ *
+ */
+static int caseTransfer(int n,BenchResult *res) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met,sol;
+  double     c[3],v[3],err,t0;
+  int        np,k,l;
+
+  mesh = NULL;
+  met  = NULL;
+  sol  = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                  MMG5_ARG_ppDisp,&sol,MMG5_ARG_end);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_verbose,0);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_keepsrc,1);
+
+  if ( !cubeMesh(mesh,n) ) return(0);
+  if ( !cubeSol(mesh,met,n) ) return(0);
+
+  MMG3D_Get_meshSize(mesh,&np,NULL,NULL,NULL,NULL,NULL);
+  if ( MMG3D_Set_solSize(mesh,sol,MMG5_Vertex,np,MMG5_Vector) != 1 )
+    return(0);
+  for ( k=1; k<=np; k++ ) {
+    MMG3D_Get_vertex(mesh,&c[0],&c[1],&c[2],NULL,NULL,NULL);
+    if ( MMG3D_Set_vectorSol(sol,fieldVal(c,0),fieldVal(c,1),fieldVal(c,2),
+                             k) != 1 )
+      return(0);
+  }
+
+  run3d(mesh,met,res,0);
+
+  /* the metric is no longer needed: it receives the interpolated field */
+  if ( res->status == MMG5_SUCCESS ) {
+    t0 = wtime();
+    if ( MMG3D_interpolate(mesh,sol,met) != 1 ) return(0);
+    res->ttrans = wtime() - t0;
+    res->ntrans = res->np;
+
+    err = 0.;
+    for ( k=1; k<=res->np; k++ ) {
+      MMG3D_Get_vertex(mesh,&c[0],&c[1],&c[2],NULL,NULL,NULL);
+      if ( MMG3D_Get_vectorSol(met,&v[0],&v[1],&v[2]) != 1 ) return(0);
+      for ( l=0; l<3; l++ )
+        err = fmax(err,fabs(v[l]-fieldVal(c,l)));
+    }
+    if ( err > 1.e-8 ) {
+      fprintf(stderr,"  ## Error: transfer: interpolation error %e.\n",err);
+      res->status = MMG5_LOWFAILURE;
+    }
+  }
+
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                 MMG5_ARG_ppDisp,&sol,MMG5_ARG_end);
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the sol structure.
+ * \param n size parameter.
+ * \param t position of the refined zone (between 0 and 1).
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Set a size map refined around a point that moves along the diagonal of the
+ * unit cube with \a t.
+ *
+ */
+static int loopSol(MMG5_pMesh mesh,MMG5_pSol met,int n,double t) {
+  double hmin,hmax,c,x,y,z,d;
+  int    np,k;
+
+  MMG3D_Get_meshSize(mesh,&np,NULL,NULL,NULL,NULL,NULL);
+  if ( MMG3D_Set_solSize(mesh,met,MMG5_Vertex,np,MMG5_Scalar) != 1 )
+    return(0);
+
+  hmin = 0.4/n;
+  hmax = 2./n;
+  c    = 0.25 + 0.5*t;
+  for ( k=1; k<=np; k++ ) {
+    if ( MMG3D_Get_vertex(mesh,&x,&y,&z,NULL,NULL,NULL) != 1 )  return(0);
+    d = sqrt( (x-c)*(x-c) + (y-c)*(y-c) + (z-c)*(z-c) );
+    d = d < 0.5 ? d/0.5 : 1.;
+    if ( MMG3D_Set_scalarSol(met,hmin+(hmax-hmin)*d,k) != 1 )  return(0);
+  }
+  return(1);
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \param warm 1 to restart each call from the previous analysis.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Loop of \ref NSTEP isotropic adaptations of the unit cube toward a size map
+ * refined around a moving point, as in an unsteady simulation: the result
+ * gathers the times of all the calls.
+ *
+ */
+static int runLoop(int n,BenchResult *res,int warm) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  MMG5_Stats stats;
+  double     t0;
+  int        np,ne,k,step;
+
+  mesh = NULL;
+  met  = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                  MMG5_ARG_end);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_verbose,0);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_warmstart,warm);
+
+  if ( !cubeMesh(mesh,n) ) return(0);
+
+  MMG3D_Get_meshSize(mesh,&np,&ne,NULL,NULL,NULL,NULL);
+  res->npi   = np;
+  res->nelti = ne;
+
+  for ( step=0; step<NSTEP; step++ ) {
+    if ( !loopSol(mesh,met,n,(double)step/(NSTEP-1)) )  return(0);
+
+    t0 = wtime();
+    res->status = MMG3D_mmg3dlib(mesh,met);
+    res->wall  += wtime() - t0;
+    res->nstep++;
+
+    MMG3D_Get_stats(mesh,&stats);
+    for ( k=0; k<MMG5_NPHASES; k++ )
+      res->stats.ptim[k] += stats.ptim[k];
+    if ( stats.memPeak > res->stats.memPeak )
+      res->stats.memPeak = stats.memPeak;
+
+    if ( res->status != MMG5_SUCCESS )  break;
+  }
+
+  MMG3D_Get_meshSize(mesh,&np,&ne,NULL,NULL,NULL,NULL);
+  res->np   = np;
+  res->nelt = ne;
+
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                 MMG5_ARG_end);
+  return(1);
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Remeshing loop, with a full analysis of the mesh at each call.
+ *
+ */
+static int caseLoop(int n,BenchResult *res) {
+  return(runLoop(n,res,0));
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Remeshing loop, each call restarting from the topology and the analysis of
+ * the previous one (MMG3D_IPARAM_warmstart).
+ *
+ */
+static int caseWarmLoop(int n,BenchResult *res) {
+  return(runLoop(n,res,1));
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Discretization of the zero level-set of a gyroid in the unit cube.
+ *
+ */
+static int caseGyroid(int n,BenchResult *res) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  double     w,x,y,z;
+  int        i,j,k,np1;
+
+  mesh = NULL;
+  met  = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                  MMG5_ARG_end);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_verbose,0);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_iso,1);
+  MMG3D_Set_dparameter(mesh,met,MMG3D_DPARAM_hmax,2./n);
+  MMG3D_Set_dparameter(mesh,met,MMG3D_DPARAM_hausd,0.5/n);
+
+  if ( !cubeMesh(mesh,n) ) return(0);
+
+  np1 = n+1;
+  w   = 2.*M_PI;
+  if ( MMG3D_Set_solSize(mesh,met,MMG5_Vertex,np1*np1*np1,MMG5_Scalar) != 1 )
+    return(0);
+  for ( k=0; k<np1; k++ )
+    for ( j=0; j<np1; j++ )
+      for ( i=0; i<np1; i++ ) {
+        /* shift the gyroid so the surface doesn't cross the vertices */
+        x = w*i/n + 0.3;
+        y = w*j/n + 0.2;
+        z = w*k/n + 0.1;
+        MMG3D_Set_scalarSol(met,sin(x)*cos(y)+sin(y)*cos(z)+sin(z)*cos(x),
+                            1+i+np1*(j+np1*k));
+      }
+
+  run3d(mesh,met,res,1);
+
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                 MMG5_ARG_end);
+  return(1);
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \param cache 1 to cache the factorisations of the metric at the vertices
+ * (MMG3D_IPARAM_metcache).
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Anisotropic adaptation of the unit cube toward a boundary layer metric
+ * (small sizes in the normal direction near the \f$z=0\f$ face).
+ *
+ */
+static int runBlayer(int n,BenchResult *res,int cache) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  double     ht,h0,h1,hn;
+  int        i,j,k,np1;
+
+  mesh = NULL;
+  met  = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                  MMG5_ARG_end);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_verbose,0);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_metcache,cache);
+
+  if ( !cubeMesh(mesh,n) ) return(0);
+
+  np1 = n+1;
+  ht  = 1.5/n;
+  h0  = 0.15/n;
+  h1  = 1.5/n;
+  if ( MMG3D_Set_solSize(mesh,met,MMG5_Vertex,np1*np1*np1,MMG5_Tensor) != 1 )
+    return(0);
+  for ( k=0; k<np1; k++ ) {
+    hn = h0 + (h1-h0)*k/n;
+    for ( j=0; j<np1; j++ )
+      for ( i=0; i<np1; i++ )
+        MMG3D_Set_tensorSol(met,1./(ht*ht),0.,0.,1./(ht*ht),0.,1./(hn*hn),
+                            1+i+np1*(j+np1*k));
+  }
+
+  run3d(mesh,met,res,0);
+
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                 MMG5_ARG_end);
+  return(1);
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Boundary layer adaptation.
+ *
+ */
+static int caseBlayer(int n,BenchResult *res) {
+  return(runBlayer(n,res,0));
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Boundary layer adaptation with the cache of the metric factorisations
+ * (MMG3D_IPARAM_metcache).
+ *
+ */
+static int caseBlayerCache(int n,BenchResult *res) {
+  return(runBlayer(n,res,1));
+}
+
+/**
+ * \param n number of cells along the side of the cube.
+ * \param i first index of the point on the cube surface.
+ * \param j second index of the point on the cube surface.
+ * \param k third index of the point on the cube surface.
+ * \return the index of the point in the surface mesh.
+ *
+ * Number the points of the surface of a \f$n^3\f$ lattice: the bottom layer,
+ * the rings of the intermediate layers and the top layer.
+ *
+ */
+static int shellIdx(int n,int i,int j,int k) {
+  int r;
+
+  if ( k == 0 )  return( 1 + i + (n+1)*j );
+  if ( k == n )  return( 1 + (n+1)*(n+1) + 4*n*(n-1) + i + (n+1)*j );
+
+  if ( j == 0 )       r = i;
+  else if ( i == n )  r = n + j;
+  else if ( j == n )  r = 3*n - i;
+  else                r = (4*n - j) % (4*n);
+
+  return( 1 + (n+1)*(n+1) + 4*n*(k-1) + r );
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Adaptation of the unit sphere (equiangular cubed sphere with \f$n^2\f$ quads
+ * per face) toward a size map growing along the z axis.
+ *
+ */
+static int caseShell(int n,BenchResult *res) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  double     c[3],d,h0,t0;
+  int        a,b,e,s,u,v,q[4],l[3],i,j,k,np,nt,na,ier;
+
+  mesh = NULL;
+  met  = NULL;
+  MMGS_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                 MMG5_ARG_end);
+  MMGS_Set_iparameter(mesh,met,MMGS_IPARAM_verbose,0);
+
+  np = 6*n*n+2;
+  if ( MMGS_Set_meshSize(mesh,np,12*n*n,0) != 1 )  return(0);
+  if ( MMGS_Set_solSize(mesh,met,MMG5_Vertex,np,MMG5_Scalar) != 1 )  return(0);
+
+  h0 = 0.5*M_PI/n;
+  for ( k=0; k<=n; k++ )
+    for ( j=0; j<=n; j++ )
+      for ( i=0; i<=n; i++ ) {
+        if ( i && j && k && i<n && j<n && k<n )  continue;
+        c[0] = tan(0.25*M_PI*(2.*i/n-1.));
+        c[1] = tan(0.25*M_PI*(2.*j/n-1.));
+        c[2] = tan(0.25*M_PI*(2.*k/n-1.));
+        d = sqrt(c[0]*c[0]+c[1]*c[1]+c[2]*c[2]);
+        c[0] /= d; c[1] /= d; c[2] /= d;
+        if ( MMGS_Set_vertex(mesh,c[0],c[1],c[2],0,shellIdx(n,i,j,k)) != 1 )
+          return(0);
+        MMGS_Set_scalarSol(met,h0*(0.5+0.75*(c[2]+1.)),shellIdx(n,i,j,k));
+      }
+
+  nt = 0;
+  for ( a=0; a<3; a++ ) {
+    b = (a+1)%3;
+    e = (a+2)%3;
+    for ( s=0; s<=n; s+=n ) {
+      for ( v=0; v<n; v++ )
+        for ( u=0; u<n; u++ ) {
+          /* corners of the quad in the (b,e) plane of the face a=s */
+          l[a] = s; l[b] = u;   l[e] = v;    q[0] = shellIdx(n,l[0],l[1],l[2]);
+          l[b] = u+1;                        q[1] = shellIdx(n,l[0],l[1],l[2]);
+          l[e] = v+1;                        q[2] = shellIdx(n,l[0],l[1],l[2]);
+          l[b] = u;                          q[3] = shellIdx(n,l[0],l[1],l[2]);
+          /* (e_b,e_e,e_a) is direct: the face a=n is seen from outside */
+          if ( s ) {
+            ier = MMGS_Set_triangle(mesh,q[0],q[1],q[2],0,++nt);
+            ier = ier && MMGS_Set_triangle(mesh,q[0],q[2],q[3],0,++nt);
+          }
+          else {
+            ier = MMGS_Set_triangle(mesh,q[0],q[2],q[1],0,++nt);
+            ier = ier && MMGS_Set_triangle(mesh,q[0],q[3],q[2],0,++nt);
+          }
+          if ( !ier )  return(0);
+        }
+    }
+  }
+
+  res->npi   = np;
+  res->nelti = nt;
+
+  t0 = wtime();
+  res->status = MMGS_mmgslib(mesh,met);
+  res->wall   = wtime() - t0;
+
+  MMGS_Get_stats(mesh,&res->stats);
+  MMGS_Get_meshSize(mesh,&res->np,&res->nelt,&na);
+  res->nstep = 1;
+
+  MMGS_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                MMG5_ARG_end);
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol pointer toward the sol structure.
+ * \param res pointer toward the benchmark result.
+ * \param gen 1 to call the mesh generation, 0 for the adaptation.
+ *
+ * Call the mmg2d library and fill the benchmark result.
+ *
+ */
+static void run2d(MMG5_pMesh mesh,MMG5_pSol sol,BenchResult *res,int gen) {
+  int    np,nt,na;
+  double t0;
+
+  MMG2D_Get_meshSize(mesh,&np,&nt,&na);
+  res->npi   = np;
+  res->nelti = gen ? na : nt;
+
+  t0 = wtime();
+  res->status = gen ? MMG2D_mmg2dmesh(mesh,sol) : MMG2D_mmg2dlib(mesh,sol);
+  res->wall   = wtime() - t0;
+
+  MMG2D_Get_stats(mesh,&res->stats);
+  MMG2D_Get_meshSize(mesh,&np,&nt,&na);
+  res->np    = np;
+  res->nelt  = nt;
+  res->nstep = 1;
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Isotropic adaptation of the unit square toward a size map refined along a
+ * circle.
+ *
+ */
+static int caseSquare(int n,BenchResult *res) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  sol;
+  double     hmin,hmax,x,y,d;
+  int        i,j,np1,nt,p;
+
+  mesh = NULL;
+  sol  = NULL;
+  MMG2D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&sol,
+                  MMG5_ARG_end);
+  MMG2D_Set_iparameter(mesh,sol,MMG2D_IPARAM_verbose,0);
+
+  np1 = n+1;
+  if ( MMG2D_Set_meshSize(mesh,np1*np1,2*n*n,0) != 1 )  return(0);
+  if ( MMG2D_Set_solSize(mesh,sol,MMG5_Vertex,np1*np1,MMG5_Scalar) != 1 )
+    return(0);
+
+  hmin = 0.25/n;
+  hmax = 2./n;
+  for ( j=0; j<np1; j++ )
+    for ( i=0; i<np1; i++ ) {
+      x = (double)i/n;
+      y = (double)j/n;
+      d = fabs(sqrt((x-0.5)*(x-0.5)+(y-0.5)*(y-0.5))-0.3);
+      d = d < 0.3 ? d/0.3 : 1.;
+      if ( MMG2D_Set_vertex(mesh,x,y,0,1+i+np1*j) != 1 )  return(0);
+      MMG2D_Set_scalarSol(sol,hmin+(hmax-hmin)*d,1+i+np1*j);
+    }
+
+  nt = 0;
+  for ( j=0; j<n; j++ )
+    for ( i=0; i<n; i++ ) {
+      p = 1+i+np1*j;
+      if ( MMG2D_Set_triangle(mesh,p,p+1,p+np1+1,0,++nt) != 1 )  return(0);
+      if ( MMG2D_Set_triangle(mesh,p,p+np1+1,p+np1,0,++nt) != 1 )  return(0);
+    }
+
+  run2d(mesh,sol,res,0);
+
+  MMG2D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&sol,
+                 MMG5_ARG_end);
+  return(1);
+}
+
+/**
+ * \param n size parameter.
+ * \param res pointer toward the benchmark result.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Generation of a mesh of the unit square from its discretized boundary.
+ *
+ */
+static int caseSquareGen(int n,BenchResult *res) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  sol;
+  int        k;
+
+  mesh = NULL;
+  sol  = NULL;
+  MMG2D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&sol,
+                  MMG5_ARG_end);
+  MMG2D_Set_iparameter(mesh,sol,MMG2D_IPARAM_verbose,0);
+  MMG2D_Set_dparameter(mesh,sol,MMG2D_DPARAM_hmax,1./n);
+
+  if ( MMG2D_Set_meshSize(mesh,4*n,0,4*n) != 1 )  return(0);
+
+  /* counterclockwise boundary, starting at the origin */
+  for ( k=0; k<n; k++ ) {
+    if ( MMG2D_Set_vertex(mesh,(double)k/n,0.,0,1+k) != 1 )          return(0);
+    if ( MMG2D_Set_vertex(mesh,1.,(double)k/n,0,1+n+k) != 1 )        return(0);
+    if ( MMG2D_Set_vertex(mesh,1.-(double)k/n,1.,0,1+2*n+k) != 1 )   return(0);
+    if ( MMG2D_Set_vertex(mesh,0.,1.-(double)k/n,0,1+3*n+k) != 1 )   return(0);
+  }
+  for ( k=0; k<4*n; k++ )
+    if ( MMG2D_Set_edge(mesh,1+k,1+(k+1)%(4*n),1,1+k) != 1 )  return(0);
+
+  run2d(mesh,sol,res,1);
+
+  MMG2D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&sol,
+                 MMG5_ARG_end);
+  return(1);
+}
+
+/** Benchmark cases */
+static const BenchCase benchCases[] = {
+  { "cube",      "MMG3D_mmg3dlib",  1, caseCube      },
+  { "fields",    "MMG3D_mmg3dlib",  1, caseFields    },
+  { "transfer",  "MMG3D_interpolate",1, caseTransfer },
+  { "gyroid",    "MMG3D_mmg3dls",   1, caseGyroid    },
+  { "blayer",    "MMG3D_mmg3dlib",  1, caseBlayer    },
+  { "blayercache","MMG3D_mmg3dlib", 1, caseBlayerCache },
+  { "loop",      "MMG3D_mmg3dlib",  1, caseLoop      },
+  { "warmloop",  "MMG3D_mmg3dlib",  1, caseWarmLoop  },
+  { "shell",     "MMGS_mmgslib",    4, caseShell     },
+  { "square",    "MMG2D_mmg2dlib",  4, caseSquare    },
+  { "squaregen", "MMG2D_mmg2dmesh", 4, caseSquareGen },
+};
+#define NCASES (int)(sizeof(benchCases)/sizeof(BenchCase))
+
+/**
+ * \param out pointer toward the output file.
+ * \param bc pointer toward the benchmark case.
+ * \param res pointer toward the (best) result of the case.
+ * \param n size parameter of the run.
+ * \param last 1 if this is the last case of the report.
+ *
+ * Print the result of a case in the JSON report.
+ *
+ */
+static void printCase(FILE *out,const BenchCase *bc,BenchResult *res,int n,
+                      int last) {
+  int k;
+
+  fprintf(out,"    {\n");
+  fprintf(out,"      \"name\": \"%s\",\n",bc->name);
+  fprintf(out,"      \"function\": \"%s\",\n",bc->func);
+  fprintf(out,"      \"resolution\": %d,\n",n*bc->scale);
+  fprintf(out,"      \"status\": %d,\n",res->status);
+  fprintf(out,"      \"input\": { \"np\": %d, \"nelt\": %d },\n",
+          res->npi,res->nelti);
+  fprintf(out,"      \"output\": { \"np\": %d, \"nelt\": %d },\n",
+          res->np,res->nelt);
+  fprintf(out,"      \"wall_time\": %.6f,\n",res->wall);
+  fprintf(out,"      \"calls\": %d,\n",res->nstep);
+  fprintf(out,"      \"phases\": {");
+  for ( k=0; k<MMG5_NPHASES; k++ )
+    fprintf(out,"%s \"%s\": %.6f",k ? "," : "",phaseName[k],
+            res->stats.ptim[k]);
+  fprintf(out," },\n");
+  fprintf(out,"      \"elements_per_second\": %.1f,\n",
+          res->wall > 0. ? res->nelt/res->wall : 0.);
+  if ( res->ntrans )
+    fprintf(out,"      \"transfer\": { \"np\": %d, \"time\": %.6f,"
+            " \"points_per_second\": %.1f },\n",res->ntrans,res->ttrans,
+            res->ttrans > 0. ? res->ntrans/res->ttrans : 0.);
+  fprintf(out,"      \"memory_peak\": %lld\n",res->stats.memPeak);
+  fprintf(out,"    }%s\n",last ? "" : ",");
+}
+
+static void usage(char *prog) {
+  int k;
+
+  fprintf(stdout,"\nUsage: %s [-n size] [-r repeats] [-c case[,case..]]"
+          " [-o file.json]\n\n",prog);
+  fprintf(stdout,"-n size     number of cells along a side of the input volume"
+          " meshes (default 16,\n            4 times more for the surface and"
+          " 2D meshes)\n");
+  fprintf(stdout,"-r repeats  run each case several times and report the"
+          " fastest run (default 1)\n");
+  fprintf(stdout,"-c cases    comma separated list of cases (default all):");
+  for ( k=0; k<NCASES; k++ )
+    fprintf(stdout," %s",benchCases[k].name);
+  fprintf(stdout,"\n-o file     name of the JSON report (default"
+          " mmg_bench.json)\n");
+}
+
+int main(int argc,char *argv[]) {
+  BenchResult res,best;
+  FILE        *out;
+  char        *cases,*outname;
+  const char  *ptr;
+  size_t      len;
+  int         n,nrep,k,i,r,nsel,last,ier,sel[NCASES];
+
+  n       = 16;
+  nrep    = 1;
+  cases   = NULL;
+  outname = "mmg_bench.json";
+
+  for ( i=1; i<argc; i++ ) {
+    if ( !strcmp(argv[i],"-n") && i+1 < argc )       n       = atoi(argv[++i]);
+    else if ( !strcmp(argv[i],"-r") && i+1 < argc )  nrep    = atoi(argv[++i]);
+    else if ( !strcmp(argv[i],"-c") && i+1 < argc )  cases   = argv[++i];
+    else if ( !strcmp(argv[i],"-o") && i+1 < argc )  outname = argv[++i];
+    else {
+      usage(argv[0]);
+      return(strcmp(argv[i],"-h") ? EXIT_FAILURE : EXIT_SUCCESS);
+    }
+  }
+  if ( n < 2 || nrep < 1 ) {
+    fprintf(stderr,"  ## Error: the size must be at least 2 and the number of"
+            " repeats at least 1.\n");
+    return(EXIT_FAILURE);
+  }
+
+  /* Selection of the cases */
+  nsel = 0;
+  for ( k=0; k<NCASES; k++ ) {
+    sel[k] = 0;
+    if ( !cases ) {
+      sel[k] = 1;
+    }
+    else {
+      ptr = cases;
+      len = strlen(benchCases[k].name);
+      while ( (ptr = strstr(ptr,benchCases[k].name)) ) {
+        if ( (ptr == cases || ptr[-1] == ',')
+             && (ptr[len] == '\0' || ptr[len] == ',') ) {
+          sel[k] = 1;
+          break;
+        }
+        ptr += len;
+      }
+    }
+    nsel += sel[k];
+  }
+  if ( !nsel ) {
+    fprintf(stderr,"  ## Error: no benchmark case matches %s.\n",cases);
+    usage(argv[0]);
+    return(EXIT_FAILURE);
+  }
+
+  /* the library banners go to the standard output: keep the report apart */
+  if ( !(out = fopen(outname,"w")) ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",outname);
+    return(EXIT_FAILURE);
+  }
+
+  fprintf(out,"{\n  \"program\": \"mmg_bench\",\n");
+  fprintf(out,"  \"size\": %d,\n  \"repeats\": %d,\n  \"cases\": [\n",n,nrep);
+
+  ier  = EXIT_SUCCESS;
+  last = nsel;
+  for ( k=0; k<NCASES; k++ ) {
+    if ( !sel[k] )  continue;
+
+    memset(&best,0,sizeof(BenchResult));
+    for ( r=0; r<nrep; r++ ) {
+      memset(&res,0,sizeof(BenchResult));
+      if ( !benchCases[k].run(n*benchCases[k].scale,&res) ) {
+        fprintf(stderr,"  ## Error: unable to build the input of the %s"
+                " case.\n",benchCases[k].name);
+        res.status = MMG5_STRONGFAILURE;
+      }
+      if ( !r || res.wall < best.wall )  best = res;
+    }
+    if ( best.status != MMG5_SUCCESS )  ier = EXIT_FAILURE;
+
+    fprintf(stdout,"  %-11s %-16s %9d elts  %8.3fs\n",benchCases[k].name,
+            benchCases[k].func,best.nelt,best.wall);
+    printCase(out,&benchCases[k],&best,n,!(--last));
+  }
+
+  fprintf(out,"  ]\n}\n");
+  fclose(out);
+
+  return(ier);
+}
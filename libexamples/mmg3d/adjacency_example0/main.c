@@ -0,0 +1,247 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * Benchmark of the two builders of the tetra adjacency of the mmg3d library
+ * (hash table or sorting of the faces, see the MMG3D_IPARAM_sortadja
+ * parameter) on a structured mesh of a cube: the timings are printed and
+ * the adjacencies computed by the two builders are compared.
+ *
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+/** Include the mmg3d library hader file */
+// if the header file is in the "include" directory
+// #include "libmmg3d.h"
+// if the header file is in "include/mmg/mmg3d"
+#include "mmg/mmg3d/libmmg3d.h"
+
+/** Default number of cells in each direction (6 tetra per cell) */
+#define NCELLS 20
+
+/**
+ * \return the wall clock time in seconds.
+ */
+static double wtime(void) {
+  struct timeval tv;
+
+  gettimeofday(&tv,NULL);
+  return(tv.tv_sec + 1.e-6*tv.tv_usec);
+}
+
+/**
+ * \param n number of cells in each direction.
+ * \param shuffle 1 to randomly renumber the vertices.
+ * \param vert pointer toward the vertices coordinates (allocated here).
+ * \param tetra pointer toward the tetra vertices (allocated here).
+ * \param np pointer toward the number of vertices.
+ * \param ne pointer toward the number of tetra.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Split each cell of a \a n^3 grid of the unit cube in 6 positively
+ * oriented tetra. The structured numbering is very favourable to the memory
+ * accesses: the vertices can be shuffled to mimic unsorted meshes.
+ *
+ */
+static int buildCube(int n,int shuffle,double **vert,int **tetra,int *np,int *ne) {
+  /* Vertices of the 6 tetra of a cell (Kuhn splitting along the 0-7 diagonal) */
+  static const int kuhn[6][4] = { {0,1,3,7},{0,1,5,7},{0,2,3,7},
+                                  {0,2,6,7},{0,4,5,7},{0,4,6,7} };
+  double           *c,u[3],v[3],w[3],vol;
+  int              i,j,k,l,m,d,cell[8],*t,*perm,aux;
+  unsigned int     seed;
+
+  *np = (n+1)*(n+1)*(n+1);
+  *ne = 6*n*n*n;
+
+  *vert  = (double*)malloc(3*(*np)*sizeof(double));
+  *tetra = (int*)malloc(4*(*ne)*sizeof(int));
+  if ( !*vert || !*tetra )  return(0);
+
+  /* New index of each vertex of the grid */
+  perm = (int*)malloc((*np)*sizeof(int));
+  if ( !perm )  return(0);
+  for (l=0; l<*np; l++)  perm[l] = l+1;
+  if ( shuffle ) {
+    seed = 12345u;
+    for (l=*np-1; l>0; l--) {
+      seed = 1103515245u*seed + 12345u;
+      m    = (int)((seed >> 8) % (unsigned int)(l+1));
+      aux     = perm[l];
+      perm[l] = perm[m];
+      perm[m] = aux;
+    }
+  }
+
+  for (k=0; k<=n; k++)
+    for (j=0; j<=n; j++)
+      for (i=0; i<=n; i++) {
+        c = &(*vert)[3*(perm[i+(n+1)*(j+(n+1)*k)]-1)];
+        c[0] = (double)i/n;
+        c[1] = (double)j/n;
+        c[2] = (double)k/n;
+      }
+
+  t = *tetra;
+  for (k=0; k<n; k++)
+    for (j=0; j<n; j++)
+      for (i=0; i<n; i++) {
+        for (l=0; l<8; l++)
+          cell[l] = perm[(i+(l&1)) + (n+1)*((j+((l>>1)&1)) + (n+1)*(k+((l>>2)&1)))];
+
+        for (l=0; l<6; l++) {
+          for (m=0; m<4; m++)  t[m] = cell[kuhn[l][m]];
+
+          /* Orientation */
+          for (d=0; d<3; d++) {
+            u[d] = (*vert)[3*(t[1]-1)+d]-(*vert)[3*(t[0]-1)+d];
+            v[d] = (*vert)[3*(t[2]-1)+d]-(*vert)[3*(t[0]-1)+d];
+            w[d] = (*vert)[3*(t[3]-1)+d]-(*vert)[3*(t[0]-1)+d];
+          }
+          vol = u[0]*(v[1]*w[2]-v[2]*w[1]) - u[1]*(v[0]*w[2]-v[2]*w[0])
+            + u[2]*(v[0]*w[1]-v[1]*w[0]);
+          if ( vol < 0. ) {
+            aux  = t[2];
+            t[2] = t[3];
+            t[3] = aux;
+          }
+          t += 4;
+        }
+      }
+  free(perm);
+
+  return(1);
+}
+
+/**
+ * \param sortadja value of the MMG3D_IPARAM_sortadja parameter.
+ * \param vert vertices coordinates.
+ * \param tetra tetra vertices.
+ * \param np number of vertices.
+ * \param ne number of tetra.
+ * \param adja adjacent of each tetra (filled here).
+ * \param time pointer toward the time spent to build the adjacency.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Build the adjacency of the mesh with the builder selected by \a sortadja.
+ *
+ */
+static int buildAdja(int sortadja,double *vert,int *tetra,int np,int ne,
+                     int *adja,double *time) {
+  MMG5_pMesh mmgMesh;
+  MMG5_pSol  mmgSol;
+  double     t0;
+  int        k,ier;
+
+  mmgMesh = NULL;
+  mmgSol  = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,
+                  MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                  MMG5_ARG_end);
+
+  ier = 0;
+  if ( MMG3D_Set_iparameter(mmgMesh,mmgSol,MMG3D_IPARAM_verbose,-1) != 1 )
+    goto end;
+  if ( MMG3D_Set_iparameter(mmgMesh,mmgSol,MMG3D_IPARAM_sortadja,sortadja) != 1 )
+    goto end;
+  if ( MMG3D_Set_meshSize(mmgMesh,np,ne,0,0,0,0) != 1 )  goto end;
+  if ( MMG3D_Set_vertices(mmgMesh,vert,NULL) != 1 )  goto end;
+  if ( MMG3D_Set_tetrahedra(mmgMesh,tetra,NULL) != 1 )  goto end;
+
+  t0 = wtime();
+  if ( MMG3D_hashTetra(mmgMesh,0) != 1 )  goto end;
+  *time = wtime()-t0;
+
+  for (k=1; k<=ne; k++)
+    if ( MMG3D_Get_adjaTet(mmgMesh,k,&adja[4*(k-1)]) != 1 )  goto end;
+
+  ier = 1;
+
+end:
+  MMG3D_Free_all(MMG5_ARG_start,
+                 MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                 MMG5_ARG_end);
+  return(ier);
+}
+
+int main(int argc,char *argv[]) {
+  double     *vert,thash,tsort;
+  int        *tetra,*adjaHash,*adjaSort,n,shuffle,np,ne,ier;
+
+  fprintf(stdout,"  -- TEST MMG3DLIB: tetra adjacency builders\n");
+
+  n       = NCELLS;
+  shuffle = 0;
+  if ( argc > 1 )  n       = atoi(argv[1]);
+  if ( argc > 2 )  shuffle = atoi(argv[2]);
+  if ( n < 1 ) {
+    printf(" Usage: %s [number of cells in each direction] [shuffle the"
+           " vertices 1/0]\n",argv[0]);
+    return(1);
+  }
+
+  if ( !buildCube(n,shuffle,&vert,&tetra,&np,&ne) ) {
+    fprintf(stderr,"  ## Error: unable to allocate the %d^3 cube.\n",n);
+    return(1);
+  }
+  fprintf(stdout,"  -- CUBE: %d VERTICES, %d TETRAHEDRA\n",np,ne);
+
+  adjaHash = (int*)malloc(4*ne*sizeof(int));
+  adjaSort = (int*)malloc(4*ne*sizeof(int));
+  if ( !adjaHash || !adjaSort ) {
+    fprintf(stderr,"  ## Error: unable to allocate the adjacencies.\n");
+    return(1);
+  }
+
+  if ( !buildAdja(0,vert,tetra,np,ne,adjaHash,&thash) ) {
+    fprintf(stderr,"  ## Error: hash builder failed.\n");
+    return(1);
+  }
+  fprintf(stdout,"     hash builder: %10.3fs\n",thash);
+
+  /* Force the sort builder, even on a single thread */
+  if ( !buildAdja(2,vert,tetra,np,ne,adjaSort,&tsort) ) {
+    fprintf(stderr,"  ## Error: sort builder failed.\n");
+    return(1);
+  }
+  fprintf(stdout,"     sort builder: %10.3fs (speedup %.2f)\n",tsort,
+          tsort > 0. ? thash/tsort : 0.);
+
+  ier = memcmp(adjaHash,adjaSort,4*ne*sizeof(int)) ? 1 : 0;
+  if ( ier )
+    fprintf(stderr,"  ## Error: the adjacencies of the two builders differ.\n");
+
+  free(vert);
+  free(tetra);
+  free(adjaHash);
+  free(adjaSort);
+
+  return(ier);
+}
@@ -0,0 +1,184 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * Example of use of the mmg3d library from several threads: each thread
+ * remeshes its own mesh and the results are compared with serial runs.
+ *
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/** Include the mmg3d library hader file */
+// if the header file is in the "include" directory
+// #include "libmmg3d.h"
+// if the header file is in "include/mmg/mmg3d"
+#include "mmg/mmg3d/libmmg3d.h"
+
+/** Number of meshes remeshed concurrently */
+#define NTHREADS 4
+
+/** Output of a remeshing: size, coordinates and connectivity of the mesh */
+typedef struct {
+  char   *filename;
+  int     aniso;
+  int     ier;
+  int     np,ne;
+  double *c;
+  int    *tetra;
+} Run;
+
+/**
+ * \param run pointer toward the run to perform.
+ * \return NULL.
+ *
+ * Load the input mesh, remesh it (isotropic run with the input metric or
+ * anisotropic run with a constant maximal size) and store the result.
+ *
+ */
+static void* remesh(void *arg) {
+  Run        *run = (Run*)arg;
+  MMG5_pMesh mmgMesh;
+  MMG5_pSol  mmgSol;
+  int        nprism,nt,nquad,na;
+
+  mmgMesh = NULL;
+  mmgSol  = NULL;
+  run->ier = MMG5_STRONGFAILURE;
+
+  MMG3D_Init_mesh(MMG5_ARG_start,
+                  MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                  MMG5_ARG_end);
+
+  if ( MMG3D_Set_iparameter(mmgMesh,mmgSol,MMG3D_IPARAM_verbose,-1) != 1 )
+    return(NULL);
+
+  if ( MMG3D_loadMesh(mmgMesh,run->filename) != 1 ) return(NULL);
+
+  if ( run->aniso ) {
+    /* Anisotropic metric computed from the maximal size */
+    if ( MMG3D_Set_solSize(mmgMesh,mmgSol,MMG5_Vertex,0,MMG5_Tensor) != 1 )
+      return(NULL);
+    if ( MMG3D_Set_dparameter(mmgMesh,mmgSol,MMG3D_DPARAM_hmax,0.2) != 1 )
+      return(NULL);
+  }
+  else {
+    if ( MMG3D_loadSol(mmgMesh,mmgSol,run->filename) != 1 ) return(NULL);
+  }
+
+  run->ier = MMG3D_mmg3dlib(mmgMesh,mmgSol);
+  if ( run->ier == MMG5_STRONGFAILURE ) return(NULL);
+
+  if ( MMG3D_Get_meshSize(mmgMesh,&run->np,&run->ne,&nprism,&nt,&nquad,&na) != 1 )
+    return(NULL);
+
+  run->c     = (double*)calloc(3*run->np,sizeof(double));
+  run->tetra = (int*)calloc(4*run->ne,sizeof(int));
+  assert ( run->c && run->tetra );
+
+  if ( MMG3D_Get_vertices(mmgMesh,run->c,NULL,NULL,NULL) != 1 )
+    run->ier = MMG5_STRONGFAILURE;
+  if ( MMG3D_Get_tetrahedra(mmgMesh,run->tetra,NULL,NULL) != 1 )
+    run->ier = MMG5_STRONGFAILURE;
+
+  MMG3D_Free_all(MMG5_ARG_start,
+                 MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                 MMG5_ARG_end);
+
+  return(NULL);
+}
+
+/**
+ * \param a pointer toward the first run.
+ * \param b pointer toward the second run.
+ * \return 1 if the two runs have produced exactly the same mesh, 0 otherwise.
+ */
+static int sameRun(Run *a,Run *b) {
+  if ( a->ier != b->ier || a->np != b->np || a->ne != b->ne ) return(0);
+  if ( memcmp(a->c,b->c,3*a->np*sizeof(double)) )             return(0);
+  if ( memcmp(a->tetra,b->tetra,4*a->ne*sizeof(int)) )         return(0);
+  return(1);
+}
+
+int main(int argc,char *argv[]) {
+  Run        serial[2],parallel[NTHREADS];
+  pthread_t  threads[NTHREADS];
+  int        i,ier;
+
+  fprintf(stdout,"  -- TEST MMG3DLIB FROM %d THREADS\n",NTHREADS);
+
+  if ( argc != 2 ) {
+    printf(" Usage: %s filein \n",argv[0]);
+    return(1);
+  }
+
+  /** 1) Reference runs: one isotropic and one anisotropic remeshing */
+  memset(serial,0,2*sizeof(Run));
+  for ( i=0; i<2; ++i ) {
+    serial[i].filename = argv[1];
+    serial[i].aniso    = i;
+    remesh(&serial[i]);
+    if ( serial[i].ier == MMG5_STRONGFAILURE ) {
+      fprintf(stdout,"BAD ENDING OF MMG3DLIB (SERIAL RUN %d)\n",i);
+      return(EXIT_FAILURE);
+    }
+  }
+
+  /** 2) Concurrent runs: isotropic and anisotropic remeshings are mixed to
+   * check that the function pointers of a thread are not modified by
+   * the other ones */
+  memset(parallel,0,NTHREADS*sizeof(Run));
+  for ( i=0; i<NTHREADS; ++i ) {
+    parallel[i].filename = argv[1];
+    parallel[i].aniso    = i%2;
+    if ( pthread_create(&threads[i],NULL,remesh,&parallel[i]) ) {
+      perror("  ## Thread problem: pthread_create");
+      return(EXIT_FAILURE);
+    }
+  }
+  for ( i=0; i<NTHREADS; ++i )
+    pthread_join(threads[i],NULL);
+
+  /** 3) Comparison */
+  ier = EXIT_SUCCESS;
+  for ( i=0; i<NTHREADS; ++i ) {
+    if ( !sameRun(&serial[i%2],&parallel[i]) ) {
+      fprintf(stdout,"THREAD %d: MESH DIFFERS FROM THE SERIAL RUN\n",i);
+      ier = EXIT_FAILURE;
+    }
+    free(parallel[i].c);
+    free(parallel[i].tetra);
+  }
+  for ( i=0; i<2; ++i ) {
+    free(serial[i].c);
+    free(serial[i].tetra);
+  }
+
+  return(ier);
+}
@@ -71,6 +71,8 @@ void _MMG5_Init_parameters(MMG5_pMesh mesh) {
   mesh->info.nomove   =  0;  /* [0/1]    ,avoid/allow point relocation */
   /** MMG5_IPARAM nmat = 0 */
   mesh->info.nmat = 0;  /* [n]    ,number of user-defined references */
+  /** MMG5_IPARAM_stats = 0 */
+  mesh->info.stats    =  0;  /* [0/1]    ,Turn on/off the output of the performance counters */
 
   /* default values for doubles */
   /** MMG5_DPARAM_angleDetection = \ref _MMG5_ANGEDG */
@@ -85,6 +87,8 @@ void _MMG5_Init_parameters(MMG5_pMesh mesh) {
   mesh->info.hausd    = 0.01;     /* control Hausdorff */
   /** MMG5_DPARAM_hgrad = 1.3 */
   mesh->info.hgrad    = 0.26236426446;      /* control gradation; */
+  /** MMG5_DPARAM_timeBudget = 0. */
+  mesh->info.tbudget  = 0.;       /* wall clock budget (s), 0: no budget */
 
   /* default values for pointers */
   /** MMG5_PPARAM = NULL */
@@ -356,6 +360,8 @@ void MMG5_Free_structures(MMG5_pMesh mesh,MMG5_pSol sol){
   if ( mesh->edge )
     _MMG5_DEL_MEM(mesh,mesh->edge,(mesh->na+1)*sizeof(MMG5_Edge));
 
+  _MMG5_freeArena(mesh);
+
   /* sol */
   if ( sol && sol->m )
     _MMG5_DEL_MEM(mesh,sol->m,(sol->size*(sol->npmax+1))*sizeof(double));
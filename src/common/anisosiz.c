@@ -49,7 +49,7 @@ double _MMG5_surf(MMG5_pMesh mesh,double m[3][6],MMG5_pTria ptt) {
   _MMG5_Bezier   b;
   double         surf,dens,J[3][2],mJ[3][2],tJmJ[2][2];
   char           i,nullDens;
-  static char    mmgErr=0;
+  static MMG5_THREAD_LOCAL char    mmgErr=0;
 
   surf = 0.0;
 
@@ -434,7 +434,7 @@ int _MMG5_solveDefmetregSys( MMG5_pMesh mesh, double r[3][3], double c[3],
                              double isqhmin, double isqhmax, double hausd)
 {
   double intm[3], kappa[2], vp[2][2], b0[3], b1[3], b2[3];
-  static int mmgWarn0=0;
+  static MMG5_THREAD_LOCAL int mmgWarn0=0;
 
   memset(intm,0x0,3*sizeof(double));
 
@@ -541,7 +541,7 @@ int _MMG5_solveDefmetrefSys( MMG5_pMesh mesh, MMG5_pPoint p0, int ipref[2],
   double       intm[3], kappa[2], vp[2][2], b0[3], b1[3], b2[3], kappacur;
   double       gammasec[3],tau[2], ux, uy, uz, ps1, l, ll, *t, *t1;
   int          i;
-  static char  mmgWarn=0;
+  static MMG5_THREAD_LOCAL char  mmgWarn=0;
 
   memset(intm,0x0,3*sizeof(double));
 
@@ -0,0 +1,350 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file common/binio.c
+ * \brief Buffered writing and 64 bits reading of the binary Medit files.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * The binary writer packs the records in a large buffer that is flushed by a
+ * single fwrite each time it is full, and computes itself the position of the
+ * next keyword from the size of the integers, positions and reals of the file
+ * version.
+ */
+
+#include "mmgcommon.h"
+
+/** Size (in bytes) of the buffer of the binary writer */
+#define _MMG5_BFILE_SIZ 4194304
+
+/**
+ * \param data pointer toward the value to swap.
+ * \param siz size of the value in bytes.
+ *
+ * Reverse the byte order of a value.
+ *
+ */
+static inline
+void _MMG5_bswap(void *data,int siz) {
+  unsigned char *p,tmp;
+  int            i;
+
+  p = (unsigned char*)data;
+  for ( i=0; i<siz/2; i++ ) {
+    tmp        = p[i];
+    p[i]       = p[siz-1-i];
+    p[siz-1-i] = tmp;
+  }
+}
+
+/**
+ * \param bf pointer toward the binary writer.
+ * \param out pointer toward the file opened in "wb" mode.
+ * \param ver version of the file (1 to 4).
+ * \return 1 if success, 0 if fail.
+ *
+ * Initialize the buffered writer of the binary file \a out.
+ *
+ */
+int _MMG5_bopen(_MMG5_pBfile bf,FILE *out,int ver) {
+
+  memset(bf,0,sizeof(_MMG5_Bfile));
+
+  bf->buf = (char*)malloc(_MMG5_BFILE_SIZ);
+  if ( !bf->buf ) {
+    fprintf(stderr,"  ## Error: %s: unable to allocate the output buffer.\n",
+            __func__);
+    return(0);
+  }
+  bf->siz  = _MMG5_BFILE_SIZ;
+  bf->out  = out;
+  bf->pos  = ftell(out);
+  bf->ver  = ver;
+  bf->isiz = ver < 4 ? 4 : 8;
+  bf->psiz = ver < 3 ? 4 : 8;
+  bf->rsiz = ver < 2 ? 4 : 8;
+
+  return(1);
+}
+
+/**
+ * \param bf pointer toward the binary writer.
+ *
+ * Write the content of the buffer in the file.
+ *
+ */
+static inline
+void _MMG5_bflush(_MMG5_pBfile bf) {
+
+  if ( bf->len && fwrite(bf->buf,1,bf->len,bf->out) != bf->len )
+    bf->err = 1;
+  bf->len = 0;
+}
+
+/**
+ * \param bf pointer toward the binary writer.
+ * \return 1 if all the data have been written, 0 otherwise.
+ *
+ * Flush the buffer and release the writer (the file is not closed).
+ *
+ */
+int _MMG5_bclose(_MMG5_pBfile bf) {
+
+  if ( !bf->buf ) return(0);
+
+  _MMG5_bflush(bf);
+  free(bf->buf);
+  bf->buf = NULL;
+
+  if ( bf->err ) {
+    fprintf(stderr,"  ## Error: %s: unable to write the binary file.\n",
+            __func__);
+    return(0);
+  }
+  return(1);
+}
+
+/**
+ * \param bf pointer toward the binary writer.
+ * \param data pointer toward the data to write.
+ * \param siz size of the data in bytes.
+ *
+ * Append \a siz bytes to the buffer.
+ *
+ */
+void _MMG5_bwrite(_MMG5_pBfile bf,const void *data,size_t siz) {
+
+  if ( bf->len + siz > bf->siz ) _MMG5_bflush(bf);
+
+  memcpy(bf->buf+bf->len,data,siz);
+  bf->len += siz;
+  bf->pos += siz;
+}
+
+/**
+ * \param bf pointer toward the binary writer.
+ * \param val integer to write.
+ *
+ * Write an integer on 32 or 64 bits depending on the file version.
+ *
+ */
+void _MMG5_bwriteInt(_MMG5_pBfile bf,long val) {
+  int32_t i32;
+  int64_t i64;
+
+  if ( bf->isiz == 4 ) {
+    i32 = (int32_t)val;
+    _MMG5_bwrite(bf,&i32,4);
+  }
+  else {
+    i64 = (int64_t)val;
+    _MMG5_bwrite(bf,&i64,8);
+  }
+}
+
+/**
+ * \param bf pointer toward the binary writer.
+ * \param val real to write.
+ *
+ * Write a real in simple (version 1) or double precision.
+ *
+ */
+void _MMG5_bwriteReal(_MMG5_pBfile bf,double val) {
+  float fc;
+
+  if ( bf->rsiz == 4 ) {
+    fc = (float)val;
+    _MMG5_bwrite(bf,&fc,4);
+  }
+  else
+    _MMG5_bwrite(bf,&val,8);
+}
+
+/**
+ * \param bf pointer toward the binary writer.
+ * \param val position to write.
+ *
+ * Write a position on 32 or 64 bits depending on the file version.
+ *
+ */
+static inline
+void _MMG5_bwritePos(_MMG5_pBfile bf,long val) {
+  int32_t i32;
+  int64_t i64;
+
+  if ( bf->psiz == 4 ) {
+    i32 = (int32_t)val;
+    _MMG5_bwrite(bf,&i32,4);
+  }
+  else {
+    i64 = (int64_t)val;
+    _MMG5_bwrite(bf,&i64,8);
+  }
+}
+
+/**
+ * \param bf pointer toward the binary writer.
+ * \param dim mesh dimension.
+ *
+ * Write the file encoding, the file version and the Dimension keyword.
+ *
+ */
+void _MMG5_bwriteHeader(_MMG5_pBfile bf,int dim) {
+  int32_t i32;
+
+  i32 = 1; //MeshVersionFormatted
+  _MMG5_bwrite(bf,&i32,4);
+  i32 = bf->ver;
+  _MMG5_bwrite(bf,&i32,4);
+  i32 = 3; //Dimension
+  _MMG5_bwrite(bf,&i32,4);
+  _MMG5_bwritePos(bf,bf->pos+bf->psiz+4);
+  i32 = dim;
+  _MMG5_bwrite(bf,&i32,4);
+}
+
+/**
+ * \param bf pointer toward the binary writer.
+ * \param kwd keyword code.
+ * \param nrec number of records of the keyword.
+ * \param siz size in bytes of the data that follows the number of records.
+ *
+ * Write a keyword code, the position of the next keyword and the number of
+ * records.
+ *
+ */
+void _MMG5_bwriteKwd(_MMG5_pBfile bf,int kwd,int nrec,long siz) {
+  int32_t i32;
+
+  i32 = kwd;
+  _MMG5_bwrite(bf,&i32,4);
+  _MMG5_bwritePos(bf,bf->pos+bf->psiz+bf->isiz+siz);
+  _MMG5_bwriteInt(bf,nrec);
+}
+
+/**
+ * \param inm pointer toward the binary file.
+ * \param iswp 1 if the bytes must be swapped.
+ * \param ver version of the file.
+ * \return the read position.
+ *
+ * Read a position stored on 32 or 64 bits depending on the file version.
+ *
+ */
+long _MMG5_breadPos(FILE *inm,int iswp,int ver) {
+  int32_t i32;
+  int64_t i64;
+
+  if ( ver < 3 ) {
+    i32 = 0;
+    fread(&i32,4,1,inm);
+    if ( iswp ) _MMG5_bswap(&i32,4);
+    return((long)i32);
+  }
+  i64 = 0;
+  fread(&i64,8,1,inm);
+  if ( iswp ) _MMG5_bswap(&i64,8);
+  return((long)i64);
+}
+
+/**
+ * \param inm pointer toward the binary file.
+ * \param iswp 1 if the bytes must be swapped.
+ * \param ver version of the file.
+ * \return the read integer (on 64 bits).
+ *
+ * Read an integer stored on 32 or 64 bits depending on the file version.
+ *
+ */
+static inline
+int64_t _MMG5_bread64(FILE *inm,int iswp,int ver) {
+  int32_t i32;
+  int64_t i64;
+
+  if ( ver < 4 ) {
+    i32 = 0;
+    fread(&i32,4,1,inm);
+    if ( iswp ) _MMG5_bswap(&i32,4);
+    return((int64_t)i32);
+  }
+  i64 = 0;
+  fread(&i64,8,1,inm);
+  if ( iswp ) _MMG5_bswap(&i64,8);
+  return(i64);
+}
+
+/**
+ * \param inm pointer toward the binary file.
+ * \param iswp 1 if the bytes must be swapped.
+ * \param ver version of the file.
+ * \param ovf pointer toward an overflow flag, set to 1 if the integer doesn't
+ * fit in an int (the flag is never reset).
+ * \return the read integer, 0 if it doesn't fit in an int (so it can still be
+ * used as an index until the flag is checked).
+ *
+ * Read an integer (index or reference) stored on 32 or 64 bits depending on
+ * the file version.
+ *
+ */
+int _MMG5_breadInt(FILE *inm,int iswp,int ver,int *ovf) {
+  int64_t i64;
+
+  i64 = _MMG5_bread64(inm,iswp,ver);
+  if ( i64 > INT_MAX || i64 < INT_MIN ) {
+    *ovf = 1;
+    return(0);
+  }
+  return((int)i64);
+}
+
+/**
+ * \param inm pointer toward the binary file.
+ * \param iswp 1 if the bytes must be swapped.
+ * \param ver version of the file.
+ * \param n pointer toward the read number of entities.
+ * \return 1 if success, 0 if the number is negative or too large.
+ *
+ * Read the number of entities of a keyword, stored on 32 or 64 bits
+ * depending on the file version. The entities are stored in int arrays, so
+ * the files of more than INT_MAX entities are rejected.
+ *
+ */
+int _MMG5_breadCount(FILE *inm,int iswp,int ver,int *n) {
+  int64_t i64;
+
+  i64 = _MMG5_bread64(inm,iswp,ver);
+  if ( i64 < 0 ) {
+    fprintf(stderr,"  ## Error: %s: invalid number of entities (%lld).\n",
+            __func__,(long long)i64);
+    return(0);
+  }
+  if ( i64 > INT_MAX ) {
+    fprintf(stderr,"  ## Error: %s: %lld entities in a keyword: mmg can't"
+            " load more than %d entities of each type.\n",
+            __func__,(long long)i64,INT_MAX);
+    return(0);
+  }
+  *n = (int)i64;
+  return(1);
+}
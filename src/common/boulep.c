@@ -34,7 +34,6 @@
 
 #include "mmgcommon.h"
 
-extern MMG5_Info  info;
 
 /**
  * \param mesh pointer toward the mesh structure.
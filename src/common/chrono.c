@@ -163,3 +163,24 @@ void printim(double elps,char *stim) {
     sprintf(stim,"%dh%dm%ds",hh,mm,ss);
   }
 }
+
+/**
+ * \return the elapsed time in seconds since an arbitrary origin.
+ *
+ * Monotonic wall clock used to time the local operators.
+ *
+ */
+double _MMG5_wtime(void) {
+#ifdef POSIX
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return((double)ts.tv_sec + (double)ts.tv_nsec*1e-9);
+#else
+  LARGE_INTEGER cnt,freq;
+
+  QueryPerformanceCounter(&cnt);
+  QueryPerformanceFrequency(&freq);
+  return((double)cnt.QuadPart/(double)freq.QuadPart);
+#endif
+}
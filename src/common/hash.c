@@ -335,3 +335,107 @@ int _MMG5_hashNew(MMG5_pMesh mesh,_MMG5_Hash *hash,int hsiz,int hmax) {
 
   return(1);
 }
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param hash pointer toward the hash table of edges.
+ * \param hsiz number of keys of the hash table.
+ * \param hmax maximal number of stored edges.
+ * \return 1 if success, 0 if fail.
+ *
+ * Build an empty hash table of edges over the hedg buffer of the mesh arena
+ * (the buffer is grown if needed). Only the keys are reset: the other items are
+ * taken in order by \ref _MMG5_hashEdgeDelone, which gives the table back to the
+ * arena with \ref _MMG5_arenaSaveHash when it reallocates it.
+ *
+ */
+int _MMG5_arenaHash(MMG5_pMesh mesh,_MMG5_Hash *hash,int hsiz,int hmax) {
+  MMG5_Arena *arena;
+  int        size;
+
+  arena = &mesh->arena;
+  size  = hmax + 2;
+
+  if ( arena->hmax < size ) {
+    if ( arena->hedg )
+      _MMG5_DEL_MEM(mesh,arena->hedg,(arena->hmax+1)*sizeof(_MMG5_hedge));
+    arena->hmax = 0;
+
+    /* leave room for the next cavities */
+    size = (int)(1.5*size);
+    _MMG5_ADD_MEM(mesh,(size+1)*sizeof(_MMG5_hedge),"delaunay hash table",
+                  return(0));
+    _MMG5_SAFE_MALLOC(arena->hedg,size+1,_MMG5_hedge,0);
+    arena->hmax = size;
+  }
+
+  hash->siz  = hsiz+1;
+  hash->max  = arena->hmax;
+  hash->nxt  = hash->siz;
+  hash->item = (_MMG5_hedge*)arena->hedg;
+  memset(hash->item,0,hash->siz*sizeof(_MMG5_hedge));
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param hash pointer toward the hash table built by \ref _MMG5_arenaHash.
+ *
+ * Give the (possibly reallocated) items of the hash table back to the mesh
+ * arena.
+ *
+ */
+void _MMG5_arenaSaveHash(MMG5_pMesh mesh,_MMG5_Hash *hash) {
+
+  mesh->arena.hedg = hash->item;
+  mesh->arena.hmax = hash->item ? hash->max : 0;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param size number of needed entries (entry 0 excluded).
+ * \return the ielnum buffer of the mesh arena, NULL if fail.
+ *
+ * Get an integer list of at least \a size+1 entries from the mesh arena.
+ *
+ */
+int *_MMG5_arenaList(MMG5_pMesh mesh,int size) {
+  MMG5_Arena *arena;
+
+  arena = &mesh->arena;
+
+  if ( arena->nmax < size ) {
+    if ( arena->ielnum )
+      _MMG5_DEL_MEM(mesh,arena->ielnum,(arena->nmax+1)*sizeof(int));
+    arena->nmax = 0;
+
+    size = (int)(1.5*size);
+    _MMG5_ADD_MEM(mesh,(size+1)*sizeof(int),"delaunay list",return(NULL));
+    _MMG5_SAFE_MALLOC(arena->ielnum,size+1,int,NULL);
+    arena->nmax = size;
+  }
+
+  return(arena->ielnum);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ *
+ * Free the buffers of the mesh arena.
+ *
+ */
+void _MMG5_freeArena(MMG5_pMesh mesh) {
+  MMG5_Arena *arena;
+
+  arena = &mesh->arena;
+
+  if ( arena->hedg )
+    _MMG5_DEL_MEM(mesh,arena->hedg,(arena->hmax+1)*sizeof(_MMG5_hedge));
+  if ( arena->ielnum )
+    _MMG5_DEL_MEM(mesh,arena->ielnum,(arena->nmax+1)*sizeof(int));
+  if ( arena->act )
+    _MMG5_DEL_MEM(mesh,arena->act,(arena->amax+1)*sizeof(int));
+  arena->hmax = arena->nmax = 0;
+  arena->nact = arena->amax = arena->aovf = 0;
+}
@@ -0,0 +1,507 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file common/hilbert.c
+ * \brief Space filling curve ordering of points and elements.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include "mmgcommon.h"
+
+/** Number of bits per coordinate used to compute the 2D Hilbert keys */
+#define _MMG5_HILBERT2D_ORDER 16
+
+/** Number of bits per coordinate used to compute the 3D Hilbert keys */
+#define _MMG5_HILBERT3D_ORDER 21
+
+/**
+ * \param x first integer coordinate (lower than \f^{order}\f$).
+ * \param y second integer coordinate (lower than \f^{order}\f$).
+ * \param order number of bits per coordinate.
+ * \return the index of the cell (x,y) along the 2D Hilbert curve.
+ *
+ * Compute the Hilbert index of a cell of a \f^{order}\f$ square grid.
+ *
+ */
+uint64_t _MMG5_hilbert2d(uint32_t x,uint32_t y,int order) {
+  uint64_t d;
+  uint32_t n,s,rx,ry,t;
+
+  n = 1u << order;
+  d = 0;
+  for (s=n/2; s>0; s/=2) {
+    rx = (x & s) > 0;
+    ry = (y & s) > 0;
+    d += (uint64_t)s*(uint64_t)s*((3*rx)^ry);
+
+    /* Rotate the quadrant */
+    if ( !ry ) {
+      if ( rx ) {
+        x = n-1-x;
+        y = n-1-y;
+      }
+      t = x;
+      x = y;
+      y = t;
+    }
+  }
+  return(d);
+}
+
+/**
+ * \param x first integer coordinate (lower than \f$2^{order}\f$).
+ * \param y second integer coordinate (lower than \f$2^{order}\f$).
+ * \param z third integer coordinate (lower than \f$2^{order}\f$).
+ * \param order number of bits per coordinate (at most 21).
+ * \return the index of the cell (x,y,z) along the 3D Hilbert curve.
+ *
+ * Compute the Hilbert index of a cell of a \f$2^{order}\f$ cubic grid
+ * (J. Skilling, Programming the Hilbert curve, 2004): the coordinates are
+ * transformed into the transposed Hilbert index whose bits are then
+ * interleaved.
+ *
+ */
+uint64_t _MMG5_hilbert3d(uint32_t x,uint32_t y,uint32_t z,int order) {
+  uint64_t d;
+  uint32_t X[3],m,p,q,t;
+  int      i,b;
+
+  X[0] = x;
+  X[1] = y;
+  X[2] = z;
+  m    = 1u << (order-1);
+
+  /* Inverse undo */
+  for (q=m; q>1; q>>=1) {
+    p = q-1;
+    for (i=0; i<3; i++) {
+      if ( X[i] & q )
+        X[0] ^= p;
+      else {
+        t     = (X[0]^X[i]) & p;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  /* Gray encode */
+  X[1] ^= X[0];
+  X[2] ^= X[1];
+  t = 0;
+  for (q=m; q>1; q>>=1)
+    if ( X[2] & q )  t ^= q-1;
+  for (i=0; i<3; i++)
+    X[i] ^= t;
+
+  /* Interleave the bits of the transposed index */
+  d = 0;
+  for (b=order-1; b>=0; b--)
+    for (i=0; i<3; i++)
+      d = (d << 1) | ((X[i] >> b) & 1u);
+
+  return(d);
+}
+
+/**
+ * \param dim space dimension (2 or 3).
+ * \param c point coordinates.
+ * \return the position of the point along the Hilbert curve.
+ *
+ * Compute the Hilbert key of a point of a scaled mesh (coordinates in the unit
+ * box, coordinates outside the box are projected on it).
+ *
+ */
+uint64_t _MMG5_sfcKeyCoor(int dim,double *c) {
+  uint32_t x[3],cmax;
+  double   dd;
+  int      i,order;
+
+  order = ( dim == 2 ) ? _MMG5_HILBERT2D_ORDER : _MMG5_HILBERT3D_ORDER;
+  cmax  = (1u << order) - 1;
+
+  for (i=0; i<dim; i++) {
+    dd   = c[i] * (double)cmax;
+    x[i] = dd <= 0. ? 0 : ( dd >= (double)cmax ? cmax : (uint32_t)dd );
+  }
+  if ( dim == 2 )
+    return(_MMG5_hilbert2d(x[0],x[1],order));
+
+  return(_MMG5_hilbert3d(x[0],x[1],x[2],order));
+}
+
+/**
+ * \param a pointer toward the first key.
+ * \param b pointer toward the second key.
+ * \return -1, 0 or 1 if the key \a a is lower, equal or greater than \a b.
+ *
+ * Comparison of two space filling curve keys (for qsort).
+ *
+ */
+int _MMG5_sfcCompare(const void *a,const void *b) {
+  const _MMG5_sfcKey *ka,*kb;
+
+  ka = (const _MMG5_sfcKey*)a;
+  kb = (const _MMG5_sfcKey*)b;
+
+  if ( ka->key < kb->key )  return(-1);
+  if ( ka->key > kb->key )  return(1);
+  return( (ka->idx > kb->idx) - (ka->idx < kb->idx) );
+}
+
+/**
+ * \param k point index.
+ * \return the round of the point \a k in a biased randomized insertion order.
+ *
+ * The round is the number of trailing zeros of a hash of \a k: half of the
+ * points are in round 0 (inserted last), a quarter in round 1... The hash
+ * is deterministic so the insertion order is reproducible.
+ *
+ */
+static inline
+int _MMG5_brioRound(int k) {
+  uint32_t h;
+  int      r;
+
+  h  = (uint32_t)k * 2654435761u;
+  h ^= h >> 16;
+  h *= 2246822519u;
+  h ^= h >> 13;
+
+  r = 0;
+  while ( r < 31 && !(h & 1u) ) {
+    h >>= 1;
+    ++r;
+  }
+  return(r);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param np number of points to sort (points 1 to \a np).
+ * \param brio 1 to use a biased randomized insertion order.
+ * \param perm table of size np (at least) filled with the sorted points.
+ * \return the number of sorted points, -1 if fail.
+ *
+ * Sort the valid points 1 to \a np along the 2D Hilbert curve. If \a brio is
+ * set, the points are first split into rounds of geometrically increasing
+ * size and each round is sorted along the curve (BRIO), which preserves the
+ * randomness needed by the incremental Delaunay insertion and the locality
+ * needed by the point location.
+ *
+ */
+int _MMG5_sfcSort2d(MMG5_pMesh mesh,int np,char brio,int *perm) {
+  MMG5_pPoint  ppt;
+  _MMG5_sfcKey *keys;
+  double       min[2],max[2],dd;
+  uint32_t     x,y,cmax;
+  int          k,n,i;
+
+  min[0] = min[1] =  DBL_MAX;
+  max[0] = max[1] = -DBL_MAX;
+  n = 0;
+  for (k=1; k<=np; k++) {
+    ppt = &mesh->point[k];
+    if ( !MG_VOK(ppt) )  continue;
+    for (i=0; i<2; i++) {
+      min[i] = MG_MIN(min[i],ppt->c[i]);
+      max[i] = MG_MAX(max[i],ppt->c[i]);
+    }
+    ++n;
+  }
+  if ( !n )  return(0);
+
+  _MMG5_ADD_MEM(mesh,n*sizeof(_MMG5_sfcKey),"space filling curve keys",
+                return(-1));
+  _MMG5_SAFE_MALLOC(keys,n,_MMG5_sfcKey,-1);
+
+  cmax = (1u << _MMG5_HILBERT2D_ORDER) - 1;
+  dd   = MG_MAX(max[0]-min[0],max[1]-min[1]);
+  dd   = dd > 0. ? (double)cmax / dd : 0.;
+
+  n = 0;
+  for (k=1; k<=np; k++) {
+    ppt = &mesh->point[k];
+    if ( !MG_VOK(ppt) )  continue;
+
+    x = (uint32_t)(dd*(ppt->c[0]-min[0]));
+    y = (uint32_t)(dd*(ppt->c[1]-min[1]));
+    x = MG_MIN(x,cmax);
+    y = MG_MIN(y,cmax);
+
+    keys[n].key = _MMG5_hilbert2d(x,y,_MMG5_HILBERT2D_ORDER);
+    if ( brio )
+      keys[n].key |= (uint64_t)(31-_MMG5_brioRound(k)) << 2*_MMG5_HILBERT2D_ORDER;
+    keys[n].idx = k;
+    ++n;
+  }
+
+  qsort(keys,n,sizeof(_MMG5_sfcKey),_MMG5_sfcCompare);
+  for (k=0; k<n; k++)
+    perm[k] = keys[k].idx;
+
+  _MMG5_DEL_MEM(mesh,keys,n*sizeof(_MMG5_sfcKey));
+
+  return(n);
+}
+
+/**
+ * \param keys curve keys of the valid entities (destroyed).
+ * \param nkey number of keys.
+ * \param n number of entities (valid or not).
+ * \param perm table of size \a n+1 filled with the new entity indices.
+ * \return the number of valid entities.
+ *
+ * Sort the keys and compute the new numbering of the entities: the valid
+ * entities are numbered from 1 to \a nkey along the curve, the invalid ones
+ * follow in their initial order. On output, \a keys[i].idx is the old index
+ * of the new entity \a i+1.
+ *
+ */
+int _MMG5_sfcPerm(_MMG5_sfcKey *keys,int nkey,int n,int *perm) {
+  int k,nv;
+
+  qsort(keys,nkey,sizeof(_MMG5_sfcKey),_MMG5_sfcCompare);
+
+  memset(perm,0,(n+1)*sizeof(int));
+  for (k=0; k<nkey; k++)
+    perm[keys[k].idx] = k+1;
+
+  nv = nkey;
+  for (k=1; k<=n; k++)
+    if ( !perm[k] )  perm[k] = ++nv;
+
+  return(nkey);
+}
+
+/**
+ * \param a pointer toward the first item.
+ * \param b pointer toward the second item.
+ * \param siz size of the items (in bytes).
+ *
+ * Swap two items of any size.
+ *
+ */
+static inline
+void _MMG5_sfcSwap(char *a,char *b,size_t siz) {
+  char   tmp[64];
+  size_t s;
+
+  while ( siz ) {
+    s = MG_MIN(siz,sizeof(tmp));
+    memcpy(tmp,a,s);
+    memcpy(a,b,s);
+    memcpy(b,tmp,s);
+    a   += s;
+    b   += s;
+    siz -= s;
+  }
+}
+
+/**
+ * \param n number of items.
+ * \param perm new index of the items 1 to \a n (reset to the identity).
+ * \param tab1 address of the first item of a table.
+ * \param siz1 size of the items of \a tab1.
+ * \param tab2 address of the first item of a second table (or NULL).
+ * \param siz2 size of the items of \a tab2.
+ *
+ * Apply in place the permutation \a perm (1 to \a n) to one or two tables: the
+ * item \a k is moved at position \a perm[k]. Each swap puts an item at its
+ * final position so the cost is linear and no copy of the tables is needed.
+ *
+ */
+void _MMG5_sfcPermute(int n,int *perm,char *tab1,size_t siz1,
+                      char *tab2,size_t siz2) {
+  int k,j;
+
+  for (k=1; k<=n; k++) {
+    while ( (j=perm[k]) != k ) {
+      _MMG5_sfcSwap(tab1+(size_t)(k-1)*siz1,tab1+(size_t)(j-1)*siz1,siz1);
+      if ( tab2 )
+        _MMG5_sfcSwap(tab2+(size_t)(k-1)*siz2,tab2+(size_t)(j-1)*siz2,siz2);
+      perm[k] = perm[j];
+      perm[j] = j;
+    }
+  }
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure (may be NULL).
+ * \return 1 if success or if the renumbering is skipped (unchanged mesh), 0 if
+ * fail.
+ *
+ * Renumber the points and the triangles of a surface or 2D mesh along the
+ * Hilbert curve and pack the point, xpoint and tria tables. The tables are
+ * permuted in place and the adjacency and the metric are updated. The mesh
+ * must be scaled.
+ *
+ */
+int _MMG5_sfcRenumberingTria(MMG5_pMesh mesh,MMG5_pSol met) {
+  MMG5_pPoint  ppt,p0;
+  MMG5_pTria   pt;
+  _MMG5_sfcKey *keys;
+  double       c[3];
+  int          *perm,*permel,*permx,*adja;
+  int          nkey,np,nt,nxp,k,i,j,dim;
+
+  if ( mesh->np < 2 || mesh->nt < 2 )  return(1);
+
+  dim  = mesh->dim;
+  nkey = MG_MAX(mesh->np,mesh->nt);
+
+  _MMG5_ADD_MEM(mesh,nkey*sizeof(_MMG5_sfcKey),"space filling curve keys",
+                return(1));
+  _MMG5_SAFE_MALLOC(keys,nkey,_MMG5_sfcKey,1);
+  _MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(int),"point permutation",
+                _MMG5_DEL_MEM(mesh,keys,nkey*sizeof(_MMG5_sfcKey));
+                return(1));
+  _MMG5_SAFE_MALLOC(perm,mesh->np+1,int,1);
+  _MMG5_ADD_MEM(mesh,(mesh->nt+1)*sizeof(int),"tria permutation",
+                _MMG5_DEL_MEM(mesh,keys,nkey*sizeof(_MMG5_sfcKey));
+                _MMG5_DEL_MEM(mesh,perm,(mesh->np+1)*sizeof(int));
+                return(1));
+  _MMG5_SAFE_MALLOC(permel,mesh->nt+1,int,1);
+  _MMG5_ADD_MEM(mesh,(mesh->xp+1)*sizeof(int),"xpoint permutation",
+                _MMG5_DEL_MEM(mesh,keys,nkey*sizeof(_MMG5_sfcKey));
+                _MMG5_DEL_MEM(mesh,perm,(mesh->np+1)*sizeof(int));
+                _MMG5_DEL_MEM(mesh,permel,(mesh->nt+1)*sizeof(int));
+                return(1));
+  _MMG5_SAFE_CALLOC(permx,mesh->xp+1,int,1);
+
+  /** Step 1: new numbering of the points and of the xpoints */
+  nkey = 0;
+  for (k=1; k<=mesh->np; k++) {
+    ppt = &mesh->point[k];
+    if ( !MG_VOK(ppt) )  continue;
+    keys[nkey].key = _MMG5_sfcKeyCoor(dim,ppt->c);
+    keys[nkey].idx = k;
+    ++nkey;
+  }
+  np = _MMG5_sfcPerm(keys,nkey,mesh->np,perm);
+
+  nxp = 0;
+  for (k=0; k<np; k++) {
+    ppt = &mesh->point[keys[k].idx];
+    if ( ppt->xp && !permx[ppt->xp] )  permx[ppt->xp] = ++nxp;
+  }
+  j = nxp;
+  for (k=1; k<=mesh->xp; k++)
+    if ( !permx[k] )  permx[k] = ++j;
+
+  for (k=1; k<=mesh->np; k++) {
+    ppt = &mesh->point[k];
+    if ( ppt->xp )  ppt->xp = permx[ppt->xp];
+  }
+  if ( mesh->xp ) {
+    _MMG5_sfcPermute(mesh->xp,permx,(char*)&mesh->xpoint[1],sizeof(MMG5_xPoint),
+                     NULL,0);
+    if ( mesh->xp > nxp )
+      memset(&mesh->xpoint[nxp+1],0,(mesh->xp-nxp)*sizeof(MMG5_xPoint));
+  }
+  _MMG5_DEL_MEM(mesh,permx,(mesh->xp+1)*sizeof(int));
+  if ( mesh->xp )  mesh->xp = nxp;
+
+  /** Step 2: new numbering of the triangles */
+  nkey = 0;
+  for (k=1; k<=mesh->nt; k++) {
+    pt = &mesh->tria[k];
+    if ( !MG_EOK(pt) )  continue;
+    c[0] = c[1] = c[2] = 0.;
+    for (i=0; i<3; i++) {
+      p0 = &mesh->point[pt->v[i]];
+      for (j=0; j<dim; j++)
+        c[j] += p0->c[j];
+    }
+    for (j=0; j<dim; j++)
+      c[j] /= 3.;
+    keys[nkey].key = _MMG5_sfcKeyCoor(dim,c);
+    keys[nkey].idx = k;
+    ++nkey;
+  }
+  nt = _MMG5_sfcPerm(keys,nkey,mesh->nt,permel);
+
+  _MMG5_DEL_MEM(mesh,keys,MG_MAX(mesh->np,mesh->nt)*sizeof(_MMG5_sfcKey));
+
+  /** Step 3: update the references toward the renumbered entities */
+  for (k=1; k<=mesh->nt; k++) {
+    pt = &mesh->tria[k];
+    if ( !MG_EOK(pt) )  continue;
+    for (i=0; i<3; i++)
+      pt->v[i] = perm[pt->v[i]];
+
+    if ( !mesh->adja )  continue;
+    adja = &mesh->adja[3*(k-1)+1];
+    for (i=0; i<3; i++)
+      if ( adja[i] )  adja[i] = 3*permel[adja[i]/3] + adja[i]%3;
+  }
+  if ( mesh->edge ) {
+    for (k=1; k<=mesh->na; k++) {
+      if ( !mesh->edge[k].a )  continue;
+      mesh->edge[k].a = perm[mesh->edge[k].a];
+      mesh->edge[k].b = perm[mesh->edge[k].b];
+    }
+  }
+
+  /** Step 4: in place permutation of the tables */
+  _MMG5_sfcPermute(mesh->np,perm,(char*)&mesh->point[1],sizeof(MMG5_Point),
+                   (met && met->m) ? (char*)&met->m[met->size] : NULL,
+                   met ? met->size*sizeof(double) : 0);
+
+  _MMG5_sfcPermute(mesh->nt,permel,(char*)&mesh->tria[1],sizeof(MMG5_Tria),
+                   mesh->adja ? (char*)&mesh->adja[1] : NULL,3*sizeof(int));
+
+  _MMG5_DEL_MEM(mesh,permel,(mesh->nt+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,perm,(mesh->np+1)*sizeof(int));
+
+  /** Step 5: rebuild the garbage collectors */
+  mesh->np = np;
+  mesh->nt = nt;
+
+  if ( mesh->np == mesh->npmax )
+    mesh->npnil = 0;
+  else
+    mesh->npnil = mesh->np + 1;
+
+  if ( mesh->nt == mesh->ntmax )
+    mesh->nenil = 0;
+  else
+    mesh->nenil = mesh->nt + 1;
+
+  if ( mesh->npnil ) {
+    for (k=mesh->npnil; k<mesh->npmax-1; k++)
+      mesh->point[k].tmp  = k+1;
+    mesh->point[MG_MAX(mesh->npnil,mesh->npmax-1)].tmp = 0;
+  }
+
+  if ( mesh->nenil ) {
+    for (k=mesh->nenil; k<mesh->ntmax-1; k++)
+      mesh->tria[k].v[2] = k+1;
+    mesh->tria[MG_MAX(mesh->nenil,mesh->ntmax-1)].v[2] = 0;
+  }
+
+  return(1);
+}
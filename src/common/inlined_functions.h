@@ -55,7 +55,7 @@ double _MMG5_lenEdg(MMG5_pMesh mesh,int np0,int np1,
                     double *m0,double *m1,char isedg) {
   MMG5_pPoint   p0,p1;
   double        gammaprim0[3],gammaprim1[3],t[3],*n1,*n2,ux,uy,uz,ps1,ps2,l0,l1;
-  static char   mmgWarn=0;
+  static MMG5_THREAD_LOCAL char   mmgWarn=0;
 
   p0 = &mesh->point[np0];
   p1 = &mesh->point[np1];
@@ -198,7 +198,7 @@ static inline
 double _MMG5_lenSurfEdg_ani(MMG5_pMesh mesh,MMG5_pSol met,int np0,int np1,char isedg) {
   MMG5_pPoint   p0,p1;
   double        *m0,*m1,met0[6],met1[6],ux,uy,uz;
-  static char   mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char   mmgWarn = 0;
 
   p0 = &mesh->point[np0];
   p1 = &mesh->point[np1];
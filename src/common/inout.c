@@ -93,7 +93,7 @@ int _MMG5_countBinaryElts(FILE **inm, const int nelts,const int iswp,
                           int *np, int *na, int* nt,int *nq, int *ne, int *npr)
 {
   int    typ,num,tagNum,i,k,l,idx;
-  static char mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn = 0;
 
   k = 0;
 
@@ -501,7 +501,7 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
   int         nbl_t,nbl_a,typ,tagNum,ref,idx,num;
   int         v[4],isol;
   char        chaine[128];
-  static char mmgWarn=0, mmgWarn1=0;
+  static MMG5_THREAD_LOCAL char mmgWarn=0, mmgWarn1=0;
 
   ina_t = ina_a = NULL;
 
@@ -1481,7 +1481,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
   int         bin,k,i,typ,nelts,word, header[3],iadr;
   int         nq,ne,npr,np,nt,na,isol;
   char        *ptr,*data;
-  static char mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn = 0;
 
   bin = 0;
 
@@ -1924,8 +1924,8 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
 int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
                         int *bin,int *iswp,int *np,int *dim,int *nsols,int **type,
                         long *posnp) {
-  int         binch,bdim;
-  int         bpos,i;
+  long        bpos;
+  int         binch,i,ovf;
   char        *ptr,*data,chaine[128];
 
   *posnp = 0;
@@ -2004,12 +2004,16 @@ int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
     }
     fread(ver,sw,1,*inm);
     if ( *iswp ) *ver = _MMG5_swapbin(*ver);
+    if ( *ver < 1 || *ver > 4 ) {
+      fprintf(stderr,"BAD FILE VERSION: %d\n",*ver);
+      fclose(*inm);
+      return -1;
+    }
     while(fread(&binch,sw,1,*inm)!=EOF && binch!=54 ) {
       if ( *iswp ) binch=_MMG5_swapbin(binch);
       if(binch==54) break;
       if(binch==3) {  //Dimension
-        fread(&bdim,sw,1,*inm);  //NulPos=>20
-        if ( *iswp ) bdim=_MMG5_swapbin(bdim);
+        _MMG5_breadPos(*inm,*iswp,*ver);  //NulPos=>20
         fread(dim,sw,1,*inm);
         if ( *iswp ) *dim=_MMG5_swapbin(*dim);
         if ( *dim!=meshDim ) {
@@ -2020,23 +2024,29 @@ int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
         }
         continue;
       } else if(binch==62) {  //SolAtVertices
-        fread(&binch,sw,1,*inm); //Pos
-        if ( *iswp ) binch=_MMG5_swapbin(binch);
-        fread(np,sw,1,*inm);
-        if ( *iswp ) *np=_MMG5_swapbin(*np);
-        fread(nsols,sw,1,*inm); //nb sol
-        if ( *iswp ) *nsols =_MMG5_swapbin(*nsols);
+        _MMG5_breadPos(*inm,*iswp,*ver); //Pos
+        if ( !_MMG5_breadCount(*inm,*iswp,*ver,np) ||
+             !_MMG5_breadCount(*inm,*iswp,*ver,nsols) ) { //nb sol
+          fclose(*inm);
+          return(-1);
+        }
 
         _MMG5_SAFE_CALLOC(*type,*nsols,int,-1); //typSol
+        ovf = 0;
         for ( i=0; i<*nsols; ++i ) {
-          fread(&((*type)[i]),sw,1,*inm);
-          if ( *iswp ) (*type)[i]=_MMG5_swapbin((*type)[i]);
+          (*type)[i] = _MMG5_breadInt(*inm,*iswp,*ver,&ovf);
+          if ( ovf ) {
+            fprintf(stderr,"  ## Error: %s: invalid solution type.\n",
+                    __func__);
+            _MMG5_SAFE_FREE(*type);
+            fclose(*inm);
+            return(-1);
+          }
         }
         *posnp = ftell(*inm);
         break;
       } else {
-        fread(&bpos,sw,1,*inm); //Pos
-        if ( *iswp ) bpos=_MMG5_swapbin(bpos);
+        bpos = _MMG5_breadPos(*inm,*iswp,*ver); //Pos
         rewind(*inm);
         fseek(*inm,bpos,SEEK_SET);
       }
@@ -2189,6 +2199,42 @@ void MMG5_writeDoubleSol3D(MMG5_pMesh mesh,MMG5_pSol sol,FILE *inm,int bin,
   }
 }
 
+/**
+ * \param mesh pointer toward the mesh structure
+ * \param sol pointer toward an allocatable sol structure.
+ * \param bf pointer toward the buffered writer of the solution file
+ * \param pos of the writted solution
+ * \param metricData 1 if the data saved is a metric (if only 1 data)
+ *
+ * Write the solution value for vertex of index pos in a binary file through
+ * the buffered writer \a bf.
+ *
+ */
+void MMG5_bwriteDoubleSol3D(MMG5_pMesh mesh,MMG5_pSol sol,_MMG5_pBfile bf,
+                            int pos,int metricData) {
+  double      dbuf[6],tmp;
+  int         i;
+
+  if ( sol->size == 6 ) {
+    /* tensor solution */
+    if ( metricData )
+      MMG5_build3DMetric(mesh,sol,pos,dbuf);
+    else
+      for (i=0; i<6; i++) dbuf[i] = sol->m[6*pos+i];
+
+    tmp = dbuf[2];
+    dbuf[2] = dbuf[3];
+    dbuf[3] = tmp;
+  }
+  else {
+    /* scalar or vector solution */
+    for (i=0; i<sol->size; i++) dbuf[i] = sol->m[sol->size*pos+i];
+  }
+
+  for (i=0; i<sol->size; i++)
+    _MMG5_bwriteReal(bf,dbuf[i]);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param filename name of file.
@@ -2210,7 +2256,8 @@ int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
                         FILE **inm,int ver,int *bin,int np,int dim,
                         int nsols,int *type,int *size) {
   MMG5_pPoint ppt;
-  int         binch,bpos;
+  _MMG5_Bfile bf;
+  long        bsiz;
   int         k;
   char        *ptr,*data,chaine[128];
 
@@ -2255,23 +2302,17 @@ int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
   _MMG5_SAFE_FREE(data);
 
   /*entete fichier*/
-  binch=bpos=0;
   if(!*bin) {
     strcpy(&chaine[0],"MeshVersionFormatted\n");
     fprintf(*inm,"%s %d",chaine,ver);
     strcpy(&chaine[0],"\n\nDimension\n");
     fprintf(*inm,"%s %d",chaine,dim);
   } else {
-    binch = 1; //MeshVersionFormatted
-    fwrite(&binch,sw,1,*inm);
-    binch = ver; //version
-    fwrite(&binch,sw,1,*inm);
-    binch = 3; //Dimension
-    fwrite(&binch,sw,1,*inm);
-    bpos = 20; //Pos
-    fwrite(&bpos,sw,1,*inm);
-    binch = dim;
-    fwrite(&binch,sw,1,*inm);
+    if ( !_MMG5_bopen(&bf,*inm,ver) ) {
+      fclose(*inm);
+      return(0);
+    }
+    _MMG5_bwriteHeader(&bf,dim);
   }
 
   np = 0;
@@ -2289,18 +2330,19 @@ int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
       fprintf(*inm," %d",type[k]);
     fprintf(*inm,"\n");
   } else {
-    binch = 62; //Vertices
-    fwrite(&binch,sw,1,*inm);
-    bpos += 16;
-
+    bsiz = (long)(nsols+1)*bf.isiz;
     for (k=0; k<nsols; ++k )
-      bpos += 4 + (size[k]*ver)*4*np; //Pos
-    fwrite(&bpos,sw,1,*inm);
+      bsiz += (long)size[k]*bf.rsiz*np;
 
-    fwrite(&np,sw,1,*inm);
-    fwrite(&nsols,sw,1,*inm);
+    _MMG5_bwriteKwd(&bf,62,np,bsiz); //SolAtVertices
+    _MMG5_bwriteInt(&bf,nsols);
     for (k=0; k<nsols; ++k )
-      fwrite(&type[k],sw,1,*inm);
+      _MMG5_bwriteInt(&bf,type[k]);
+
+    if ( !_MMG5_bclose(&bf) ) {
+      fclose(*inm);
+      return(0);
+    }
   }
 
   return 1;
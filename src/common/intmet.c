@@ -165,21 +165,20 @@
 
 /**
  * \param m input metric.
- * \param n input metric.
- * \param mr computed output metric.
- * \param s parameter coordinate for the interpolation of metrics \a m and \a n.
+ * \param is computed inverse of the square root of \a m.
  * \return 0 if fail, 1 otherwise.
  *
- * Compute the interpolated \f$(3 x 3)\f$ metric from metrics \a m and \a n, at
- * parameter \a s : \f$ mr = (1-s)*m +s*n \f$, both metrics being expressed in
- * the simultaneous reduction basis: linear interpolation of sizes.
+ * First step of the interpolation of the metrics \a m and \a n
+ * (\ref _MMG5_mmgIntmet33_ani): inverse of the square root of \a m. It only
+ * depends on \a m.
  *
  */
-int _MMG5_mmgIntmet33_ani(double *m,double *n,double *mr,double s) {
+static inline
+int _MMG5_mmgIntmet33Fac(double *m,double is[6]) {
   int     order;
-  double  lambda[3],vp[3][3],mu[3],is[6],isnis[6],mt[9],P[9],dd;
+  double  lambda[3],vp[3][3];
   char    i;
-  static char mmgWarn;
+  static MMG5_THREAD_LOCAL char mmgWarn;
 
   /* Compute inverse of square root of matrix M : is =
    * P*diag(1/sqrt(lambda))*{^t}P */
@@ -212,6 +211,28 @@ int _MMG5_mmgIntmet33_ani(double *m,double *n,double *mr,double s) {
   is[5] = lambda[0]*vp[0][2]*vp[0][2] + lambda[1]*vp[1][2]*vp[1][2]
     + lambda[2]*vp[2][2]*vp[2][2];
 
+  return(1);
+}
+
+/**
+ * \param is inverse of the square root of the first metric.
+ * \param n input metric.
+ * \param mr computed output metric.
+ * \param s parameter coordinate for the interpolation.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Second step of the interpolation of the metrics \a m and \a n
+ * (\ref _MMG5_mmgIntmet33_ani): simultaneous reduction of \a m and \a n from
+ * the inverse square root \a is of \a m and interpolation of the sizes.
+ *
+ */
+static inline
+int _MMG5_mmgIntmet33End(double is[6],double *n,double *mr,double s) {
+  int     order;
+  double  lambda[3],vp[3][3],mu[3],isnis[6],mt[9],P[9],dd;
+  char    i;
+  static MMG5_THREAD_LOCAL char mmgWarn;
+
   mt[0] = n[0]*is[0] + n[1]*is[1] + n[2]*is[2];
   mt[1] = n[0]*is[1] + n[1]*is[3] + n[2]*is[4];
   mt[2] = n[0]*is[2] + n[1]*is[4] + n[2]*is[5];
@@ -273,6 +294,63 @@ int _MMG5_mmgIntmet33_ani(double *m,double *n,double *mr,double s) {
   return(1);
 }
 
+/**
+ * \param m input metric.
+ * \param n input metric.
+ * \param mr computed output metric.
+ * \param s parameter coordinate for the interpolation of metrics \a m and \a n.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Compute the interpolated \f$(3 x 3)\f$ metric from metrics \a m and \a n, at
+ * parameter \a s : \f$ mr = (1-s)*m +s*n \f$, both metrics being expressed in
+ * the simultaneous reduction basis: linear interpolation of sizes.
+ *
+ */
+int _MMG5_mmgIntmet33_ani(double *m,double *n,double *mr,double s) {
+  double  is[6];
+
+  if ( !_MMG5_mmgIntmet33Fac(m,is) )  return(0);
+
+  return(_MMG5_mmgIntmet33End(is,n,mr,s));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ip index of the point of metric \a m.
+ * \param m input metric.
+ * \param n input metric.
+ * \param mr computed output metric.
+ * \param s parameter coordinate for the interpolation of metrics \a m and \a n.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Same as \ref _MMG5_mmgIntmet33_ani for the metric \a m of the point \a ip:
+ * the inverse square root of \a m is taken in the metric cache of the mesh if
+ * it is allocated. The entry of \a ip is computed again if the metric differs
+ * from the stored one.
+ *
+ * \warning the cache is not protected: the function must not be called
+ * concurrently on the same mesh.
+ *
+ */
+int _MMG5_mmgIntmet33Vert(MMG5_pMesh mesh,int ip,double *m,double *n,
+                          double *mr,double s) {
+  MMG5_pMetFac pf;
+
+  if ( !mesh->metfac || ip > mesh->nmetfac )
+    return(_MMG5_mmgIntmet33_ani(m,n,mr,s));
+
+  pf = &mesh->metfac[ip];
+  if ( memcmp(pf->m,m,6*sizeof(double)) ) {
+    memcpy(pf->m,m,6*sizeof(double));
+    pf->valid = 0;
+  }
+  if ( !(pf->valid & 2) ) {
+    if ( !_MMG5_mmgIntmet33Fac(m,pf->is) )  return(0);
+    pf->valid |= 2;
+  }
+  return(_MMG5_mmgIntmet33End(pf->is,n,mr,s));
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
@@ -633,7 +711,7 @@ int _MMG5_interpreg_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria pt,char i,
   double         *n1,*n2,step,u,r[3][3],dd;
   int            ip1,ip2,nstep,l;
   char           i1,i2;
-  static int     warn=0;
+  static MMG5_THREAD_LOCAL int     warn=0;
 
   /* Number of steps for parallel transport */
   nstep = 4;
@@ -695,7 +773,12 @@ int _MMG5_interpreg_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria pt,char i,
       n[1] *= dd;
       n[2] *= dd;
 
-      if ( !_MMG5_paratmet(cold,nold,m1old,c,n,m1) )  return(0);
+      /* The first step starts from the metric and the normal of p1: the
+       * factorisation of the metric is taken in the vertex cache */
+      if ( l == 1 ) {
+        if ( !_MMG5_paratmetVert(mesh,ip1,nold,m1old,n,m1) )  return(0);
+      }
+      else if ( !_MMG5_paratmet(cold,nold,m1old,c,n,m1) )  return(0);
 
       memcpy(cold,c,3*sizeof(double));
       memcpy(nold,n,3*sizeof(double));
@@ -750,7 +833,12 @@ int _MMG5_interpreg_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria pt,char i,
       n[1] *= dd;
       n[2] *= dd;
 
-      if ( !_MMG5_paratmet(cold,nold,m2old,c,n,m2) )  return(0);
+      /* The first step starts from the metric and the normal of p2: the
+       * factorisation of the metric is taken in the vertex cache */
+      if ( l == 1 ) {
+        if ( !_MMG5_paratmetVert(mesh,ip2,nold,m2old,n,m2) )  return(0);
+      }
+      else if ( !_MMG5_paratmet(cold,nold,m2old,c,n,m2) )  return(0);
 
       memcpy(cold,c,3*sizeof(double));
       memcpy(nold,n,3*sizeof(double));
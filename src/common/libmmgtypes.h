@@ -54,6 +54,14 @@
  *
  */
 #define MMG5_STRONGFAILURE 2
+/**
+ * \def MMG5_INTERRUPTED
+ *
+ * Return value if the remesh process has been interrupted by the time budget
+ * or by the user callback: the mesh is conform but partially remeshed.
+ *
+ */
+#define MMG5_INTERRUPTED   3
 
 /**
  * Implicite domain ref in iso mode
@@ -180,6 +188,32 @@ enum MMG5_entities {
   MMG5_Tetrahedron, /*!< Tetra entity */
 };
 
+/**
+ * \enum MMG5_phases
+ * \brief Steps of a remeshing run timed in the \ref MMG5_Stats structure.
+ */
+enum MMG5_phases {
+  MMG5_PhaseTotal,    /*!< Whole library call */
+  MMG5_PhaseInOut,    /*!< Data checking and mesh packing */
+  MMG5_PhaseAnalysis, /*!< Mesh analysis */
+  MMG5_PhaseMain,     /*!< Remeshing (or level-set discretization/motion) */
+  MMG5_PhaseRemesh,   /*!< Remeshing after a discretization or a motion */
+  MMG5_NPHASES
+};
+
+/**
+ * \enum MMG5_operators
+ * \brief Local operators instrumented in the \ref MMG5_Stats structure.
+ */
+enum MMG5_operators {
+  MMG5_OperSplit,    /*!< Edge splitting */
+  MMG5_OperCollapse, /*!< Edge collapse */
+  MMG5_OperSwap,     /*!< Edge/face swap */
+  MMG5_OperInsert,   /*!< Delaunay point insertion */
+  MMG5_OperMove,     /*!< Vertex relocation */
+  MMG5_NOPERATORS
+};
+
 /**
  * \struct MMG5_Par
  * number) associated to a specific reference.
@@ -437,6 +471,8 @@ typedef struct {
   int           mem,npar,npari;
   int           opnbdy;
   int           renum;
+  int           renumit; /*!< Renumber the mesh along a space filling curve
+                          every \a renumit iterations of the remeshing loop */
   int           octree;
   int           nmat;
   char          nreg;
@@ -445,6 +481,28 @@ typedef struct {
                           param are setted: if \f$tag = 1+2+4\f$ then the point
                           is \a MG_Vert, MG_Tria and MG_Tetra */
   unsigned char optim, optimLES, noinsert, noswap, nomove, nosurf;
+  unsigned char sortadja; /*!< Build the adjacency by sorting the faces */
+  unsigned char stats; /*!< Save the performance counters of the run */
+  unsigned char batchins; /*!< Insert the Delaunay points by batches sorted
+                            along a space filling curve */
+  unsigned char colmove; /*!< Move the internal points by independent sets
+                           (vertex coloring) */
+  unsigned char parswap; /*!< Swap the internal edges by independent sets */
+  int           nthreads; /*!< Number of threads of the multithreaded kernels
+                            (0: OpenMP default) */
+  int           npart; /*!< Number of partitions of the partitioned remeshing
+                         (0 or 1: no partitioning) */
+  unsigned char actset; /*!< Restrict the remeshing sweeps to the elements
+                          modified by the last iterations */
+  double        tbudget; /*!< Wall clock budget (s) of the remeshing (0: no
+                           budget) */
+  unsigned char warmstart; /*!< Keep the adjacency and the surface analysis
+                             at the end of a call to restart the next one
+                             from them */
+  unsigned char keepsrc; /*!< Keep a copy of the input mesh to interpolate
+                           solutions onto the output mesh */
+  unsigned char metcache; /*!< Cache the factorisations of the anisotropic
+                            metric at the vertices */
   MMG5_pMat     mat;
 } MMG5_Info;
 
@@ -465,6 +523,110 @@ typedef struct {
   int         siz,max,nxt;
 } MMG5_HGeom;
 
+/**
+ * \struct MMG5_Stats
+ * \brief Performance counters of the last remeshing run.
+ *
+ * The phase times and the memory high-water mark are always recorded. The
+ * operator, cavity and octree counters are only filled if the library is
+ * built with the USE_STATS option, otherwise they stay to 0. The counters of
+ * the batched Delaunay insertion and of the sweeps are always recorded.
+ */
+typedef struct {
+  double    ptim[MMG5_NPHASES]; /*!< Elapsed time (s) of each phase */
+  double    otim[MMG5_NOPERATORS]; /*!< Elapsed time (s) spent in each operator */
+  long long ncall[MMG5_NOPERATORS]; /*!< Number of calls of each operator */
+  long long nsucc[MMG5_NOPERATORS]; /*!< Number of successful calls */
+  long long ncav; /*!< Number of Delaunay cavities */
+  long long cavsiz; /*!< Sum of the cavity sizes (in tetrahedra) */
+  long long noctree; /*!< Number of octree queries */
+  long long memPeak; /*!< Memory high-water mark (bytes) */
+  long long nbcand; /*!< Number of candidates of the batched insertion */
+  long long nbstale; /*!< Candidates whose edge was destroyed by the batch */
+  long long nbfilt; /*!< Candidates filtered by the octree */
+  long long nbrej; /*!< Candidates rejected by the cavity or the kernel */
+  long long nbins; /*!< Number of points inserted by the batches */
+  double    btim; /*!< Elapsed time (s) of the batched insertion */
+  long long nsweep; /*!< Number of sweeps over the elements */
+  long long nvisit; /*!< Number of elements visited by the sweeps */
+  int       interrupted; /*!< 1 if the remeshing has been interrupted by the
+                           time budget or the callback */
+  int       cavmax; /*!< Size of the largest cavity */
+} MMG5_Stats;
+typedef MMG5_Stats * MMG5_pStats;
+
+/**
+ * \brief Progress/cancel callback of the remeshing.
+ *
+ * The callback is called between the sweeps of the remeshing with the user
+ * data and the elapsed time (s) of the library call. It returns 0 to continue
+ * the remeshing and a non zero value to interrupt it.
+ */
+typedef int (*MMG5_Interrupt)(void *data,double elapsed);
+
+/**
+ * \struct MMG5_Arena
+ * \brief Scratch buffers of the Delaunay insertion and of the remeshing
+ * sweeps.
+ *
+ * The buffers are reused by the successive insertions of a remeshing run and
+ * only grow when a cavity is larger than all the previous ones.
+ */
+typedef struct {
+  void  *hedg; /*!< Items of the hash table of the cavity edges */
+  int   *ielnum; /*!< Indices of the elements created by the insertion */
+  int   *act; /*!< Active set: elements marked since the last sweep (may
+                contain duplicates), NULL if the sweeps visit all the
+                elements */
+  int    hmax; /*!< Number of items of the hedg table (item 0 excluded) */
+  int    nmax; /*!< Size of the ielnum table (item 0 excluded) */
+  int    nact; /*!< Number of items of the act table */
+  int    amax; /*!< Size of the act table (item 0 excluded) */
+  char   aovf; /*!< 1 if the act table has overflowed since the last sweep */
+} MMG5_Arena;
+
+/**
+ * \struct MMG5_Source
+ * \brief Read-only copy of the input mesh of a remeshing call, used to
+ * transfer the solutions of the input mesh onto the output mesh.
+ *
+ * The tetra are located with a walk through the adjacency, starting from an
+ * element stored in a uniform grid of buckets.
+ */
+typedef struct {
+  double *c; /*!< Coordinates of the points: c[3*k+i] for the point k */
+  int    *v; /*!< Vertices of the tetra: v[4*k+i] for the tetra k */
+  int    *adja; /*!< Adjacency of the tetra (same encoding as mesh->adja) */
+  int    *cell; /*!< Buckets: a tetra close to each cell of the grid */
+  double  min[3]; /*!< Lower corner of the grid */
+  double  dh; /*!< Inverse of the size of the cells */
+  int     nc; /*!< Number of cells along each direction of the grid */
+  int     np; /*!< Number of points */
+  int     ne; /*!< Number of tetra (0 if no mesh is stored) */
+} MMG5_Source;
+
+/**
+ * \struct MMG5_MetFac
+ * \brief Factorisations of the anisotropic metric of a vertex: the tangential
+ * part used by the parallel transport of the metric and the inverse square
+ * root used by the interpolation of two metrics.
+ *
+ * The entry is valid only for the metric (and the normal for the tangential
+ * part) that are stored in it: it is computed again as soon as one of them is
+ * rewritten.
+ */
+typedef struct {
+  double m[6]; /*!< Metric used for the factorisations */
+  double n[3]; /*!< Normal used for the tangential factorisation */
+  double u[3]; /*!< First eigenvector of the tangential metric */
+  double lambda[3]; /*!< Eigenvalues of the tangential metric and normal
+                      component of the metric */
+  double is[6]; /*!< Inverse of the square root of the metric */
+  char   valid; /*!< 1 if the tangential factorisation has been computed, 2 if
+                  the inverse square root has been computed (bit field) */
+} MMG5_MetFac;
+typedef MMG5_MetFac * MMG5_pMetFac;
+
 /**
  * \struct MMG5_Mesh
  * \brief MMG mesh structure.
@@ -480,6 +642,8 @@ typedef struct {
   int       npi,nti,nai,nei,np,na,nt,ne,npmax,namax,ntmax,nemax,xpmax,xtmax;
   int       nquad,nprism; /* number of quadrangles and prisms */
   int       nsols; /* number of solutions in the solution file (mshmet/int) */
+  int       nfield; /*!< Number of user fields carried through the remeshing */
+  int       fsize; /*!< Number of values of the user fields by point */
   int       nc1;
 
   int       base; /*!< Used with \a flag to know if an entity has been
@@ -511,10 +675,24 @@ typedef struct {
   MMG5_pTria     tria; /*!< Pointer toward the \ref MMG5_Tria structure */
   MMG5_pQuad     quadra; /*!< Pointer toward the \ref MMG5_Quad structure */
   MMG5_pEdge     edge; /*!< Pointer toward the \ref MMG5_Edge structure */
+  double        *field; /*!< User fields: the \a fsize values of the point
+                        \a k are stored from field[fsize*k] */
   MMG5_HGeom     htab; /*!< \ref MMG5_HGeom structure */
   MMG5_Info      info; /*!< \ref MMG5_Info structure */
   char     *namein; /*!< Input mesh name */
   char     *nameout; /*!< Output mesh name */
+  MMG5_Stats     stats; /*!< \ref MMG5_Stats structure */
+  MMG5_Arena     arena; /*!< \ref MMG5_Arena structure */
+  MMG5_Source    src; /*!< \ref MMG5_Source structure */
+  MMG5_Interrupt interruptFunc; /*!< Progress/cancel callback (may be NULL) */
+  void          *interruptData; /*!< User data of the callback */
+  double         tstart; /*!< Wall clock time at the start of the library
+                           call */
+  char           warm; /*!< 1 if the adjacency and the surface analysis of
+                         the previous call are still valid */
+  int            nmetfac; /*!< Number of vertices of the metric cache */
+  MMG5_pMetFac   metfac; /*!< Cache of the metric factorisations (may be
+                           NULL) */
 
 } MMG5_Mesh;
 typedef MMG5_Mesh  * MMG5_pMesh;
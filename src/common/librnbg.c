@@ -186,15 +186,16 @@ void _MMG5_swapNod(MMG5_pPoint points, double* sols, int* perm,
  * (renumerotation success of renumerotation fail but the mesh is still
  *  conformal).
  *
- * Call scotch renumbering.
+ * Call scotch renumbering, or the space filling curve renumbering if
+ * scotch is not available.
  *
  **/
 int _MMG5_scotchCall(MMG5_pMesh mesh, MMG5_pSol met)
 {
 
 #ifdef USE_SCOTCH
-  static char mmgWarn  = 0;
-  static char mmgError = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn  = 0;
+  static MMG5_THREAD_LOCAL char mmgError = 0;
 
   /*check enough vertex to renum*/
   if ( mesh->info.renum && (mesh->np/2. > _MMG5_BOXSIZE) && mesh->np>100000 ) {
@@ -234,6 +235,32 @@ int _MMG5_scotchCall(MMG5_pMesh mesh, MMG5_pSol met)
   }
   return(1);
 #else
+  static MMG5_THREAD_LOCAL char mmgError = 0;
+
+  if ( mesh->info.renum && _MMG5_sfcRenumbering ) {
+    /* renumbering along a space filling curve */
+    if ( mesh->info.imprim > 5 )
+      fprintf(stdout,"  -- RENUMBERING. \n");
+
+    if ( !_MMG5_sfcRenumbering(mesh,met) ) {
+      if ( !mmgError ) {
+        fprintf(stderr,"\n  ## Error: %s: Unable to renumbering mesh. "
+                "Try to run without renumbering option (-rn 0).\n",
+                __func__);
+        mmgError = 1;
+      }
+      return(0);
+    }
+
+    if ( mesh->info.imprim > 5) {
+      fprintf(stdout,"  -- PHASE RENUMBERING COMPLETED. \n");
+    }
+
+    if ( mesh->info.ddebug ) {
+      if ( !_MMG5_chkmsh(mesh,1,0) )
+        return 0;
+    }
+  }
   return(1);
 #endif
 }
@@ -237,7 +237,7 @@ int _MMG5_buildridmetnor(MMG5_pMesh mesh,MMG5_pSol met,int np0,double nt[3],doub
 int _MMG5_intersecmet22(MMG5_pMesh mesh, double *m,double *n,double *mr) {
   double  det,imn[4],dd,sqDelta,trimn,lambda[2],vp0[2],vp1[2],dm[2],dn[2],vnorm,d0,d1,ip[4];
   double  isqhmin,isqhmax;
-  static char mmgWarn = 0, mmgWarn1 = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn = 0, mmgWarn1 = 0;
 
   isqhmin  = 1.0 / (mesh->info.hmin*mesh->info.hmin);
   isqhmax  = 1.0 / (mesh->info.hmax*mesh->info.hmax);
@@ -432,7 +432,7 @@ int _MMG5_mmgIntextmet(MMG5_pMesh mesh,MMG5_pSol met,int np,double me[6],
   double              *m,*n1,*n2,*t,r[3][3],mrot[6],mr[3],mtan[3],metan[3];
   int                 order;
   char                i;
-  static char         mmgWarn=0, mmgWarn1=0, mmgWarn2=0;
+  static MMG5_THREAD_LOCAL char         mmgWarn=0, mmgWarn1=0, mmgWarn2=0;
 
   isqhmin = 1.0 / (mesh->info.hmin*mesh->info.hmin);
   isqhmax = 1.0 / (mesh->info.hmax*mesh->info.hmax);
@@ -638,20 +638,19 @@ int _MMG5_mmgIntextmet(MMG5_pMesh mesh,MMG5_pSol met,int np,double me[6],
 }
 
 /**
- * \param c0 table of the coordinates of the starting point.
  * \param n0 normal at the starting point.
  * \param m metric to be transported.
- * \param c1 table of the coordinates of the ending point.
- * \param n1 normal at the ending point.
- * \param mt computed metric.
+ * \param pf computed factorisation (only \a u and \a lambda are filled).
  * \return 0 if fail, 1 otherwise.
  *
- * Parallel transport of a metric tensor field, attached to point \a c0, with
- * normal \a n0, to point \a c1, with normal \a n1.
+ * First step of the parallel transport of the metric \a m, attached to a point
+ * of normal \a n0: eigen decomposition of the metric induced in the tangent
+ * plane. It only depends on \a m and \a n0.
  *
  */
-int _MMG5_paratmet(double c0[3],double n0[3],double m[6],double c1[3],double n1[3],double mt[6]) {
-  double  r[3][3],mrot[6],mtan[3],lambda[2],vp[2][2],u[3],ps,ll;
+static inline
+int _MMG5_paratmetFac(double n0[3],double m[6],MMG5_pMetFac pf) {
+  double  r[3][3],mrot[6],mtan[3],lambda[2],vp[2][2];
 
   /* Take the induced metric tensor in the tangent plane by change of basis : R * M * {^t}R*/
   if ( !_MMG5_rotmatrix(n0,r) )  return(0);
@@ -664,15 +663,38 @@ int _MMG5_paratmet(double c0[3],double n0[3],double m[6],double c1[3],double n1[
   _MMG5_eigensym(mtan,lambda,vp);
 
   /* Eigenvector in canonical basis = {t}R*vp[0] */
-  u[0] = r[0][0]*vp[0][0] + r[1][0]*vp[0][1];
-  u[1] = r[0][1]*vp[0][0] + r[1][1]*vp[0][1];
-  u[2] = r[0][2]*vp[0][0] + r[1][2]*vp[0][1];
+  pf->u[0] = r[0][0]*vp[0][0] + r[1][0]*vp[0][1];
+  pf->u[1] = r[0][1]*vp[0][0] + r[1][1]*vp[0][1];
+  pf->u[2] = r[0][2]*vp[0][0] + r[1][2]*vp[0][1];
+
+  pf->lambda[0] = lambda[0];
+  pf->lambda[1] = lambda[1];
+  pf->lambda[2] = mrot[5];
+
+  return(1);
+}
+
+/**
+ * \param pf factorisation of the metric at the starting point.
+ * \param n1 normal at the ending point.
+ * \param mt computed metric.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Second step of the parallel transport of a metric: build the transported
+ * metric at the point of normal \a n1 from the factorisation \a pf.
+ *
+ */
+static inline
+int _MMG5_paratmetEnd(MMG5_pMetFac pf,double n1[3],double mt[6]) {
+  double  r[3][3],u[3],*lambda,ps,ll;
+
+  lambda = pf->lambda;
 
   /* Projection in the tangent plane of c1 */
-  ps = u[0]*n1[0] + u[1]*n1[1] + u[2]*n1[2];
-  u[0] -= ps*n1[0];
-  u[1] -= ps*n1[1];
-  u[2] -= ps*n1[2];
+  ps = pf->u[0]*n1[0] + pf->u[1]*n1[1] + pf->u[2]*n1[2];
+  u[0] = pf->u[0] - ps*n1[0];
+  u[1] = pf->u[1] - ps*n1[1];
+  u[2] = pf->u[2] - ps*n1[2];
   ll = u[0]*u[0] + u[1]*u[1] + u[2]*u[2];
   if ( ll < _MMG5_EPSD )  return(0);
   ll = 1.0 / sqrt(ll);
@@ -703,22 +725,121 @@ int _MMG5_paratmet(double c0[3],double n0[3],double m[6],double c1[3],double n1[
 
   /*mt = R * diag(lambda[0], lambda[1], mrot[5])*{^t}R */
   mt[0] = lambda[0]*r[0][0]*r[0][0] + lambda[1]*r[0][1]*r[0][1]
-    + mrot[5]*r[0][2]*r[0][2];
+    + lambda[2]*r[0][2]*r[0][2];
 
   mt[1] = lambda[0]*r[0][0]*r[1][0]
-    + lambda[1]*r[0][1]*r[1][1] + mrot[5]*r[0][2]*r[1][2];
+    + lambda[1]*r[0][1]*r[1][1] + lambda[2]*r[0][2]*r[1][2];
 
   mt[2] = lambda[0]*r[0][0]*r[2][0]
-    + lambda[1]*r[0][1]*r[2][1] + mrot[5]*r[0][2]*r[2][2];
+    + lambda[1]*r[0][1]*r[2][1] + lambda[2]*r[0][2]*r[2][2];
 
   mt[3] = lambda[0]*r[1][0]*r[1][0] + lambda[1]*r[1][1]*r[1][1]
-    + mrot[5]*r[1][2]*r[1][2];
+    + lambda[2]*r[1][2]*r[1][2];
 
   mt[4] = lambda[0]*r[2][0]*r[1][0]
-    + lambda[1]*r[2][1]*r[1][1] + mrot[5]*r[2][2]*r[1][2];
+    + lambda[1]*r[2][1]*r[1][1] + lambda[2]*r[2][2]*r[1][2];
 
   mt[5] = lambda[0]*r[2][0]*r[2][0] + lambda[1]*r[2][1]*r[2][1]
-    + mrot[5]*r[2][2]*r[2][2];
+    + lambda[2]*r[2][2]*r[2][2];
+
+  return(1);
+}
+
+/**
+ * \param c0 table of the coordinates of the starting point.
+ * \param n0 normal at the starting point.
+ * \param m metric to be transported.
+ * \param c1 table of the coordinates of the ending point.
+ * \param n1 normal at the ending point.
+ * \param mt computed metric.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Parallel transport of a metric tensor field, attached to point \a c0, with
+ * normal \a n0, to point \a c1, with normal \a n1.
+ *
+ */
+int _MMG5_paratmet(double c0[3],double n0[3],double m[6],double c1[3],double n1[3],double mt[6]) {
+  MMG5_MetFac fac;
+
+  if ( !_MMG5_paratmetFac(n0,m,&fac) )  return(0);
+
+  return(_MMG5_paratmetEnd(&fac,n1,mt));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ip index of the starting point.
+ * \param n0 normal at the starting point.
+ * \param m metric to be transported.
+ * \param n1 normal at the ending point.
+ * \param mt computed metric.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Parallel transport of the metric \a m of the point \a ip, with normal \a
+ * n0, to a point with normal \a n1. The factorisation of \a m is taken in
+ * the metric cache of the mesh if it is allocated: the entry of \a ip is
+ * computed again if the metric or the normal differ from the stored ones.
+ *
+ * \warning the cache is not protected: the function must not be called
+ * concurrently on the same mesh.
+ *
+ */
+int _MMG5_paratmetVert(MMG5_pMesh mesh,int ip,double n0[3],double m[6],
+                       double n1[3],double mt[6]) {
+  MMG5_pMetFac pf;
+  MMG5_MetFac  fac;
+
+  if ( !mesh->metfac || ip > mesh->nmetfac ) {
+    if ( !_MMG5_paratmetFac(n0,m,&fac) )  return(0);
+    return(_MMG5_paratmetEnd(&fac,n1,mt));
+  }
+
+  pf = &mesh->metfac[ip];
+  if ( memcmp(pf->m,m,6*sizeof(double)) ) {
+    memcpy(pf->m,m,6*sizeof(double));
+    pf->valid = 0;
+  }
+  if ( !(pf->valid & 1) || memcmp(pf->n,n0,3*sizeof(double)) ) {
+    if ( !_MMG5_paratmetFac(n0,m,pf) ) {
+      pf->valid &= ~1;
+      return(0);
+    }
+    memcpy(pf->n,n0,3*sizeof(double));
+    pf->valid |= 1;
+  }
+  return(_MMG5_paratmetEnd(pf,n1,mt));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 1 if success, 0 if the cache can't be allocated.
+ *
+ * Allocate the cache of the metric factorisations for the \a np points of the
+ * mesh (the points created later are not cached). The cache is optional: if
+ * the memory is missing, the factorisations are computed at each transport.
+ *
+ */
+int _MMG5_newMetFac(MMG5_pMesh mesh) {
+
+  _MMG5_freeMetFac(mesh);
+
+  _MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(MMG5_MetFac),"metric cache",
+                return(0));
+  _MMG5_SAFE_CALLOC(mesh->metfac,mesh->np+1,MMG5_MetFac,0);
+  mesh->nmetfac = mesh->np;
 
   return(1);
 }
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ *
+ * Free the cache of the metric factorisations.
+ *
+ */
+void _MMG5_freeMetFac(MMG5_pMesh mesh) {
+
+  if ( mesh->metfac )
+    _MMG5_DEL_MEM(mesh,mesh->metfac,(mesh->nmetfac+1)*sizeof(MMG5_MetFac));
+  mesh->nmetfac = 0;
+}
@@ -0,0 +1,647 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file common/mmapio.c
+ * \brief Fast reading of the ASCII Medit files through a memory mapping.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * The file is mapped once, its keywords are indexed by a single pass and the
+ * numeric blocks are parsed by several threads: the block is split into
+ * chunks at token boundaries, each thread counts the tokens of its chunk and
+ * the prefix sum of the counts gives the record and field of the first token
+ * of each chunk.
+ *
+ * Numbers are converted by a hand written parser that falls back on
+ * strtod/strtof each time the result may not be exactly rounded, so the read
+ * values are the ones given by the fscanf calls of the sequential readers.
+ */
+
+#include "mmgcommon.h"
+
+#ifdef POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+/** Minimal size (in bytes) of a block to be parsed by more than one thread */
+#define _MMG5_MMAP_PARBLOCK 1048576
+
+/** Maximal length of a number token given to strtod */
+#define _MMG5_MMAP_TOKMAX   512
+
+/** White spaces as defined by isspace in the C locale */
+#define _MMG5_MMAP_SPACE(c) ( (c)==' ' || ((c)>='\t' && (c)<='\r') )
+
+/** Exact powers of 10 in double precision */
+static const double _MMG5_mmapPow10[23] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+/** Exact powers of 10 in simple precision */
+static const float _MMG5_mmapPow10f[11] = {
+  1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+/**
+ * \param mm pointer toward the mapped file.
+ * \param inm pointer toward the file opened in "rb" mode.
+ * \return 1 if success, 0 if fail.
+ *
+ * Map the content of \a inm in memory (or read it in an allocated buffer if
+ * the mapping is not available). The positions in the mapped file are the
+ * positions given by ftell on \a inm.
+ *
+ */
+int _MMG5_mmapOpen(_MMG5_pMmap mm,FILE *inm) {
+#ifdef POSIX
+  struct stat st;
+#endif
+  long        len;
+
+  memset(mm,0,sizeof(_MMG5_Mmap));
+
+#ifdef POSIX
+  if ( !fstat(fileno(inm),&st) && st.st_size > 0 ) {
+    mm->buf = (char*)mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,fileno(inm),0);
+    if ( mm->buf != MAP_FAILED ) {
+      mm->len = (long)st.st_size;
+      mm->map = 1;
+#ifdef POSIX_MADV_SEQUENTIAL
+      posix_madvise(mm->buf,mm->len,POSIX_MADV_SEQUENTIAL);
+#endif
+      return(1);
+    }
+    mm->buf = NULL;
+  }
+#endif
+
+  /* No mapping: read the entire file */
+  fseek(inm,0,SEEK_END);
+  len = ftell(inm);
+  rewind(inm);
+  if ( len < 0 ) {
+    fprintf(stderr,"  ## Error: %s: unable to get the file size.\n",__func__);
+    return(0);
+  }
+  _MMG5_SAFE_MALLOC(mm->buf,len+1,char,0);
+  if ( (long)fread(mm->buf,1,len,inm) != len ) {
+    fprintf(stderr,"  ## Error: %s: unable to read the file.\n",__func__);
+    _MMG5_SAFE_FREE(mm->buf);
+    return(0);
+  }
+  mm->len = len;
+  rewind(inm);
+
+  return(1);
+}
+
+/**
+ * \param mm pointer toward the mapped file.
+ *
+ * Unmap the file and free the keyword positions.
+ *
+ */
+void _MMG5_mmapClose(_MMG5_pMmap mm) {
+
+  if ( mm->buf ) {
+#ifdef POSIX
+    if ( mm->map )
+      munmap(mm->buf,mm->len);
+    else
+#endif
+      _MMG5_SAFE_FREE(mm->buf);
+  }
+  if ( mm->kw )  _MMG5_SAFE_FREE(mm->kw);
+  memset(mm,0,sizeof(_MMG5_Mmap));
+}
+
+/**
+ * \param mm pointer toward the mapped file.
+ * \param beg pointer toward the beginning of the next token (to fill).
+ * \return the end of the next token, or -1 at the end of the file.
+ *
+ * Skip the white spaces from the current position and find the next token.
+ * The current position is not modified.
+ *
+ */
+static inline
+long _MMG5_mmapToken(_MMG5_pMmap mm,long *beg) {
+  long p;
+
+  p = mm->pos;
+  while ( p < mm->len && _MMG5_MMAP_SPACE(mm->buf[p]) ) ++p;
+  if ( p >= mm->len ) return(-1);
+
+  *beg = p;
+  while ( p < mm->len && !_MMG5_MMAP_SPACE(mm->buf[p]) ) ++p;
+
+  return(p);
+}
+
+/**
+ * \param mm pointer toward the mapped file.
+ * \param chaine string to fill with the keyword.
+ * \param siz size of \a chaine.
+ * \return 1 if a keyword has been read, 0 at the end of the file.
+ *
+ * Read the next keyword of the file, that is the next token beginning with a
+ * letter (the other tokens are numbers that can't match any keyword) and
+ * store its position (used to bound the numeric blocks).
+ *
+ */
+int _MMG5_mmapKeyword(_MMG5_pMmap mm,char *chaine,int siz) {
+  long beg,end;
+  int  l;
+
+  while ( (end = _MMG5_mmapToken(mm,&beg)) >= 0 ) {
+    mm->pos = end;
+    if ( !isalpha((unsigned char)mm->buf[beg]) ) continue;
+
+    if ( mm->nkw == mm->nkwmax ) {
+      mm->nkwmax = mm->nkwmax ? 2*mm->nkwmax : 32;
+      mm->kw = (long*)realloc(mm->kw,mm->nkwmax*sizeof(long));
+      if ( !mm->kw ) {
+        perror("  ## Memory problem: realloc");
+        return(0);
+      }
+    }
+    mm->kw[mm->nkw++] = beg;
+
+    l = (int)MG_MIN(end-beg,(long)siz-1);
+    memcpy(chaine,&mm->buf[beg],l);
+    chaine[l] = '\0';
+    return(1);
+  }
+  return(0);
+}
+
+/**
+ * \param s beginning of the token.
+ * \param e end of the token.
+ * \param val integer to fill.
+ * \return 1 if success, 0 if the token isn't an integer.
+ *
+ * Convert the token in integer as the "%d" conversion of fscanf.
+ *
+ */
+static inline
+int _MMG5_mmapParseInt(const char *s,const char *e,int *val) {
+  long long v;
+  int       neg;
+
+  neg = 0;
+  if ( s < e && (*s=='-' || *s=='+') ) {
+    neg = (*s=='-');
+    ++s;
+  }
+  if ( s >= e || *s < '0' || *s > '9' ) return(0);
+
+  v = 0;
+  for ( ; s<e && *s>='0' && *s<='9'; ++s ) {
+    if ( v < LLONG_MAX/10 - 10 )  v = 10*v + (*s-'0');
+  }
+  *val = (int)(neg ? -v : v);
+
+  return(1);
+}
+
+/**
+ * \param s beginning of the token.
+ * \param e end of the token.
+ * \param m mantissa (to fill).
+ * \param ex power of ten of the number (to fill).
+ * \param neg 1 if the number is negative (to fill).
+ * \return 1 if the token is a decimal number exactly stored in \a m and \a ex,
+ * 0 if it must be converted by the C library.
+ *
+ * Decompose a decimal number in a mantissa and a power of ten.
+ *
+ */
+static inline
+int _MMG5_mmapParseDec(const char *s,const char *e,uint64_t *m,int *ex,int *neg) {
+  const char *p;
+  int        nd,esgn,ee;
+
+  *neg = 0;
+  *m   = 0;
+  *ex  = 0;
+  nd   = 0;
+  if ( s < e && (*s=='-' || *s=='+') ) {
+    *neg = (*s=='-');
+    ++s;
+  }
+
+  p = s;
+  for ( ; p<e && *p>='0' && *p<='9'; ++p ) {
+    if ( nd == 19 ) return(0);
+    *m = 10*(*m) + (*p-'0');
+    if ( *m ) ++nd;
+  }
+  if ( p<e && *p=='.' ) {
+    ++p;
+    for ( ; p<e && *p>='0' && *p<='9'; ++p ) {
+      if ( nd == 19 ) return(0);
+      *m = 10*(*m) + (*p-'0');
+      if ( *m ) ++nd;
+      --(*ex);
+    }
+  }
+  /* No digit */
+  if ( p == s || (p == s+1 && *s=='.') ) return(0);
+
+  if ( p<e && (*p=='e' || *p=='E') ) {
+    ++p;
+    esgn = 1;
+    if ( p<e && (*p=='-' || *p=='+') ) {
+      if ( *p=='-' ) esgn = -1;
+      ++p;
+    }
+    if ( p>=e || *p < '0' || *p > '9' ) return(0);
+    ee = 0;
+    for ( ; p<e && *p>='0' && *p<='9'; ++p ) {
+      if ( ee < 100000 ) ee = 10*ee + (*p-'0');
+    }
+    *ex += esgn*ee;
+  }
+
+  /* Trailing characters: let the C library deal with it */
+  return( p == e );
+}
+
+/**
+ * \param s beginning of the token.
+ * \param e end of the token.
+ * \param val double to fill.
+ * \return 1 if success, 0 if the token isn't a number.
+ *
+ * Convert the token in double as the "%lf" conversion of fscanf: the fast
+ * conversion is used only when the mantissa and the power of ten are exactly
+ * representable, so the result is correctly rounded.
+ *
+ */
+static inline
+int _MMG5_mmapParseDouble(const char *s,const char *e,double *val) {
+  uint64_t m;
+  double   v;
+  char     tok[_MMG5_MMAP_TOKMAX],*end;
+  int      ex,neg;
+
+  if ( _MMG5_mmapParseDec(s,e,&m,&ex,&neg) && m <= ((uint64_t)1<<53) ) {
+    if ( !m ) {
+      *val = neg ? -0.0 : 0.0;
+      return(1);
+    }
+    if ( ex >= -22 && ex <= 22 ) {
+      v = (double)m;
+      v = ex < 0 ? v / _MMG5_mmapPow10[-ex] : v * _MMG5_mmapPow10[ex];
+      *val = neg ? -v : v;
+      return(1);
+    }
+  }
+
+  /* Slow path */
+  ex = (int)MG_MIN(e-s,_MMG5_MMAP_TOKMAX-1);
+  memcpy(tok,s,ex);
+  tok[ex] = '\0';
+  *val = strtod(tok,&end);
+
+  return( end != tok );
+}
+
+/**
+ * \param s beginning of the token.
+ * \param e end of the token.
+ * \param val double to fill with the float value.
+ * \return 1 if success, 0 if the token isn't a number.
+ *
+ * Convert the token in float as the "%f" conversion of fscanf.
+ *
+ */
+static inline
+int _MMG5_mmapParseFloat(const char *s,const char *e,double *val) {
+  char     tok[_MMG5_MMAP_TOKMAX],*end;
+  int      l;
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+  uint64_t m;
+  float    v;
+  int      ex,neg;
+
+  if ( _MMG5_mmapParseDec(s,e,&m,&ex,&neg) && m <= ((uint64_t)1<<24) ) {
+    if ( !m ) {
+      *val = neg ? -0.0 : 0.0;
+      return(1);
+    }
+    if ( ex >= -10 && ex <= 10 ) {
+      v = (float)m;
+      v = ex < 0 ? v / _MMG5_mmapPow10f[-ex] : v * _MMG5_mmapPow10f[ex];
+      *val = (double)(neg ? -v : v);
+      return(1);
+    }
+  }
+#endif
+
+  /* Slow path */
+  l = (int)MG_MIN(e-s,_MMG5_MMAP_TOKMAX-1);
+  memcpy(tok,s,l);
+  tok[l] = '\0';
+  *val = (double)strtof(tok,&end);
+
+  return( end != tok );
+}
+
+/**
+ * \param mm pointer toward the mapped file.
+ * \param val integer to fill.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the next integer of the file (as fscanf(inm,"%d",val)).
+ *
+ */
+int _MMG5_mmapInt(_MMG5_pMmap mm,int *val) {
+  long beg,end;
+
+  end = _MMG5_mmapToken(mm,&beg);
+  if ( end < 0 ) return(0);
+
+  mm->pos = end;
+  return(_MMG5_mmapParseInt(&mm->buf[beg],&mm->buf[end],val));
+}
+
+/**
+ * \param mm pointer toward the mapped file.
+ * \param pos position of the block.
+ * \return the position of the first keyword after \a pos (or the file size).
+ *
+ */
+static inline
+long _MMG5_mmapBlockEnd(_MMG5_pMmap mm,long pos) {
+  int i0,i1,im;
+
+  i0 = 0;
+  i1 = mm->nkw;
+  while ( i0 < i1 ) {
+    im = (i0+i1)/2;
+    if ( mm->kw[im] <= pos ) i0 = im+1;
+    else i1 = im;
+  }
+  return( i0 < mm->nkw ? mm->kw[i0] : mm->len );
+}
+
+/**
+ * \param mm pointer toward the mapped file.
+ * \param pos position of the block in the file.
+ * \param nrec number of records to read.
+ * \param types type of each token of a record: 'i' for an integer, 'd' for a
+ * double, 'f' for a float stored as a double and 'x' for an ignored token.
+ * \param offs offset of each token of a record in the destination structure.
+ * \param base address of the first destination structure.
+ * \param stride size of the destination structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read \a nrec records of strlen(types) tokens from the position \a pos of the
+ * file and store them in the array of structures beginning at \a base. The
+ * block is parsed in parallel if it is large enough.
+ *
+ */
+int _MMG5_mmapBlock(_MMG5_pMmap mm,long pos,int nrec,const char *types,
+                    const size_t *offs,char *base,size_t stride) {
+  long long ntot,*first,*nread,sum;
+  long      *beg,end,b;
+  int       nth,ntok,i,ier;
+
+  ntok = (int)strlen(types);
+  ntot = (long long)nrec*ntok;
+  if ( !ntot ) return(1);
+
+  /* Split the block into nth chunks beginning at a token start, the last
+   * chunk is not bounded (the keyword positions only give an estimation of the
+   * block end) */
+  end = _MMG5_mmapBlockEnd(mm,pos);
+  nth = 1;
+#ifdef USE_OPENMP
+  if ( end - pos > _MMG5_MMAP_PARBLOCK )
+    nth = mm->nth > 0 ? mm->nth : omp_get_max_threads();
+#endif
+
+  _MMG5_SAFE_MALLOC(beg,nth+1,long,0);
+  _MMG5_SAFE_CALLOC(first,nth+1,long long,0);
+  _MMG5_SAFE_CALLOC(nread,nth,long long,0);
+
+  beg[0] = pos;
+  for (i=1; i<nth; i++) {
+    b = pos + (long)(((long long)(end-pos)*i)/nth);
+    b = MG_MAX(b,beg[i-1]);
+    while ( b < mm->len && b > pos && !_MMG5_MMAP_SPACE(mm->buf[b-1]) ) ++b;
+    beg[i] = b;
+  }
+  beg[nth] = mm->len;
+
+  /* Count the tokens of the bounded chunks */
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nth)
+#endif
+  for (i=0; i<nth-1; i++) {
+    long      p,p1;
+    long long n;
+
+    n  = 0;
+    p  = beg[i];
+    p1 = beg[i+1];
+    while ( p < p1 ) {
+      while ( p < p1 && _MMG5_MMAP_SPACE(mm->buf[p]) ) ++p;
+      if ( p >= p1 ) break;
+      ++n;
+      while ( p < p1 && !_MMG5_MMAP_SPACE(mm->buf[p]) ) ++p;
+    }
+    first[i+1] = n;
+  }
+  for (i=1; i<nth; i++)  first[i] += first[i-1];
+
+  /* Parse the tokens */
+  ier = 1;
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nth) reduction(min:ier)
+#endif
+  for (i=0; i<nth; i++) {
+    const char *s,*e;
+    char       *dest;
+    long       p,p1;
+    long long  t;
+    int        f;
+
+    t  = first[i];
+    if ( t >= ntot ) continue;
+
+    p  = beg[i];
+    p1 = beg[i+1];
+    f  = (int)(t%ntok);
+    dest = base + (size_t)(t/ntok)*stride;
+
+    while ( t < ntot ) {
+      while ( p < p1 && _MMG5_MMAP_SPACE(mm->buf[p]) ) ++p;
+      if ( p >= p1 ) break;
+      s = &mm->buf[p];
+      while ( p < p1 && !_MMG5_MMAP_SPACE(mm->buf[p]) ) ++p;
+      e = &mm->buf[p];
+
+      switch ( types[f] ) {
+      case 'i':
+        if ( !_MMG5_mmapParseInt(s,e,(int*)(dest+offs[f])) ) ier = 0;
+        break;
+      case 'd':
+        if ( !_MMG5_mmapParseDouble(s,e,(double*)(dest+offs[f])) ) ier = 0;
+        break;
+      case 'f':
+        if ( !_MMG5_mmapParseFloat(s,e,(double*)(dest+offs[f])) ) ier = 0;
+        break;
+      }
+      if ( !ier ) break;
+
+      ++t;
+      if ( ++f == ntok ) {
+        f     = 0;
+        dest += stride;
+      }
+    }
+    nread[i] = t - first[i];
+  }
+
+  sum = 0;
+  for (i=0; i<nth; i++)  sum += nread[i];
+
+  _MMG5_SAFE_FREE(beg);
+  _MMG5_SAFE_FREE(first);
+  _MMG5_SAFE_FREE(nread);
+
+  if ( !ier || sum != ntot ) {
+    fprintf(stderr,"  ## Error: %s: unable to read %d records at position %ld.\n",
+            __func__,nrec,pos);
+    return(0);
+  }
+
+  return(1);
+}
+
+/**
+ * \param mm pointer toward the mapped file.
+ * \param mesh pointer toward the mesh structure.
+ * \param pos position of the vertices in the file.
+ * \param ncoor number of coordinates to store.
+ * \param nskip number of coordinates to ignore.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the coordinates and references of the mesh vertices (in simple
+ * precision if mesh->ver < 2).
+ *
+ */
+int _MMG5_mmapPoints(_MMG5_pMmap mm,MMG5_pMesh mesh,long pos,int ncoor,int nskip) {
+  size_t offs[8];
+  char   types[8];
+  int    i,n;
+
+  n = 0;
+  for (i=0; i<ncoor; i++,n++) {
+    types[n] = mesh->ver < 2 ? 'f' : 'd';
+    offs[n]  = offsetof(MMG5_Point,c) + i*sizeof(double);
+  }
+  for (i=0; i<nskip; i++,n++) {
+    types[n] = 'x';
+    offs[n]  = 0;
+  }
+  types[n] = 'i';
+  offs[n]  = offsetof(MMG5_Point,ref);
+  types[++n] = '\0';
+
+  return(_MMG5_mmapBlock(mm,pos,mesh->np,types,offs,(char*)&mesh->point[1],
+                         sizeof(MMG5_Point)));
+}
+
+/**
+ * \param mm pointer toward the mapped file.
+ * \param pos position of the elements in the file.
+ * \param nelt number of elements.
+ * \param nv number of vertices per element.
+ * \param base address of the first element.
+ * \param stride size of the element structure.
+ * \param offv offset of the vertices in the element structure.
+ * \param offref offset of the reference in the element structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read \a nelt elements given by \a nv vertices and a reference.
+ *
+ */
+int _MMG5_mmapElts(_MMG5_pMmap mm,long pos,int nelt,int nv,char *base,
+                   size_t stride,size_t offv,size_t offref) {
+  size_t offs[8];
+  char   types[8];
+  int    i;
+
+  assert ( nv < 8 );
+  for (i=0; i<nv; i++) {
+    types[i] = 'i';
+    offs[i]  = offv + i*sizeof(int);
+  }
+  types[nv]   = 'i';
+  offs[nv]    = offref;
+  types[nv+1] = '\0';
+
+  return(_MMG5_mmapBlock(mm,pos,nelt,types,offs,base,stride));
+}
+
+/**
+ * \param mm pointer toward the mapped file.
+ * \param sol pointer toward an allocated sol structure.
+ * \param pos position of the solution values in the file.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the sol->np solution values (in simple precision if sol->ver == 1). The
+ * symmetric tensors (size 6) are stored in the m11 m12 m13 m22 m23 m33 order.
+ *
+ */
+int _MMG5_mmapSol(_MMG5_pMmap mm,MMG5_pSol sol,long pos) {
+  size_t offs[6];
+  char   types[7];
+  int    i;
+
+  if ( sol->size > 6 ) return(0);
+
+  for (i=0; i<sol->size; i++) {
+    types[i] = sol->ver == 1 ? 'f' : 'd';
+    offs[i]  = i*sizeof(double);
+  }
+  types[sol->size] = '\0';
+
+  if ( sol->size == 6 ) {
+    /* the file stores m11 m12 m22 m13 m23 m33 */
+    offs[2] = 3*sizeof(double);
+    offs[3] = 2*sizeof(double);
+  }
+
+  return(_MMG5_mmapBlock(mm,pos,sol->np,types,offs,(char*)&sol->m[sol->size],
+                         sol->size*sizeof(double)));
+}
@@ -52,6 +52,8 @@ void _MMG5_mmgUsage(char *prog) {
   fprintf(stdout,"-val      Print the default parameters values\n");
   fprintf(stdout,"-default  Save a local parameters file for default parameters"
           " values\n");
+  fprintf(stdout,"-stats    Save the performance counters of the run in a JSON"
+          " file\n");
 
   fprintf(stdout,"\n**  File specifications\n");
   fprintf(stdout,"-in  file  input triangulation\n");
@@ -67,6 +69,7 @@ void _MMG5_mmgUsage(char *prog) {
   fprintf(stdout,"-hausd  val  control Hausdorff distance\n");
   fprintf(stdout,"-hgrad  val  control gradation\n");
   fprintf(stdout,"-ls     val  create mesh of isovalue val (0 if no argument provided)\n");
+  fprintf(stdout,"-tbudget val wall clock budget (s) of the remeshing\n");
 
 }
 
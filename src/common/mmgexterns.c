@@ -0,0 +1,48 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file common/mmgexterns.c
+ * \brief Definition of the function pointers shared by the mmg libraries.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * The pointers are thread-local: they are set at the beginning of each
+ * library call (see the *_Set_commonFunc and *_setfunc functions) so two
+ * threads can remesh two different meshes at the same time.
+ **/
+
+#include "mmgcommon.h"
+
+MMG5_THREAD_LOCAL int    (*_MMG5_chkmsh)(MMG5_pMesh,int,int);
+MMG5_THREAD_LOCAL int    (*_MMG5_bezierCP)(MMG5_pMesh ,MMG5_Tria *,_MMG5_pBezier ,char );
+MMG5_THREAD_LOCAL double (*_MMG5_lenSurfEdg)(MMG5_pMesh mesh,MMG5_pSol sol ,int ,int, char );
+MMG5_THREAD_LOCAL int    (*_MMG5_defsiz)(MMG5_pMesh ,MMG5_pSol );
+
+MMG5_THREAD_LOCAL int    (*_MMG5_indElt)(MMG5_pMesh mesh,int kel);
+MMG5_THREAD_LOCAL int    (*_MMG5_indPt)(MMG5_pMesh mesh,int kp);
+
+#ifdef USE_SCOTCH
+MMG5_THREAD_LOCAL int    (*_MMG5_renumbering)(int vertBoxNbr, MMG5_pMesh mesh, MMG5_pSol sol);
+#endif
+MMG5_THREAD_LOCAL int    (*_MMG5_sfcRenumbering)(MMG5_pMesh mesh, MMG5_pSol sol);
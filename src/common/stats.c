@@ -0,0 +1,189 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file common/stats.c
+ * \brief Performance counters and time budget of the remeshing runs.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include "mmgcommon.h"
+
+/** Names of the phases in the JSON output */
+static const char *_MMG5_phaseName[MMG5_NPHASES] = {
+  "total","inout","analysis","main","remesh" };
+
+/** Names of the operators in the JSON output */
+static const char *_MMG5_operName[MMG5_NOPERATORS] = {
+  "split","collapse","swap","insert","move" };
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ *
+ * Reset the performance counters at the beginning of a library call and start
+ * the clock of the time budget.
+ *
+ */
+void _MMG5_initStats(MMG5_pMesh mesh) {
+
+  memset(&mesh->stats,0,sizeof(MMG5_Stats));
+  mesh->stats.memPeak = mesh->memCur;
+  mesh->tstart        = _MMG5_wtime();
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 1 if the remeshing must be interrupted, 0 otherwise.
+ *
+ * Check the time budget and call the progress/cancel callback of the user
+ * (to call between two sweeps of the remeshing). Once the remeshing is
+ * interrupted, the function returns 1 until the end of the library call.
+ *
+ */
+int _MMG5_interrupt(MMG5_pMesh mesh) {
+  double elapsed;
+
+  if ( mesh->stats.interrupted )  return(1);
+  if ( mesh->info.tbudget <= 0. && !mesh->interruptFunc )  return(0);
+
+  elapsed = _MMG5_wtime() - mesh->tstart;
+  if ( mesh->info.tbudget > 0. && elapsed > mesh->info.tbudget ) {
+    if ( mesh->info.imprim > 0 )
+      fprintf(stdout,"\n  ## Warning: %s: time budget of %g s exceeded."
+              " Remeshing interrupted.\n",__func__,mesh->info.tbudget);
+    mesh->stats.interrupted = 1;
+  }
+  else if ( mesh->interruptFunc &&
+            mesh->interruptFunc(mesh->interruptData,elapsed) ) {
+    if ( mesh->info.imprim > 0 )
+      fprintf(stdout,"\n  ## Warning: %s: remeshing interrupted by the"
+              " user callback.\n",__func__);
+    mesh->stats.interrupted = 1;
+  }
+  return(mesh->stats.interrupted);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ctim chronographs of the library call.
+ *
+ * Store the elapsed times of the phases of a library call (the chronograph
+ * \a i of the call measures the phase \a i of the \ref MMG5_phases enum).
+ *
+ */
+void _MMG5_statTimes(MMG5_pMesh mesh,struct mytime *ctim) {
+  int k;
+
+  for ( k=0; k<MMG5_NPHASES; k++ )
+    mesh->stats.ptim[k] = ctim[k].gdif;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param filename name of the JSON file (if NULL, the name of the output
+ * mesh with the \a .stats.json extension).
+ * \param prog name of the program (mmg2d, mmgs or mmg3d).
+ * \return 1 if success, 0 if fail.
+ *
+ * Save the performance counters of the last run in a JSON file.
+ *
+ */
+int _MMG5_saveStats(MMG5_pMesh mesh,const char *filename,const char *prog) {
+  MMG5_pStats stats;
+  FILE        *out;
+  char        *data,*ptr;
+  int         k;
+
+  if ( filename && *filename ) {
+    _MMG5_SAFE_CALLOC(data,strlen(filename)+1,char,0);
+    strcpy(data,filename);
+  }
+  else if ( mesh->nameout && *mesh->nameout ) {
+    _MMG5_SAFE_CALLOC(data,strlen(mesh->nameout)+12,char,0);
+    strcpy(data,mesh->nameout);
+    ptr = strrchr(data,'.');
+    if ( ptr && ( !strcmp(ptr,".mesh") || !strcmp(ptr,".meshb") ||
+                  !strcmp(ptr,".msh") || !strcmp(ptr,".mshb") ) )
+      *ptr = '\0';
+    strcat(data,".stats.json");
+  }
+  else {
+    fprintf(stderr,"  ## Error: %s: no name for the statistics file.\n",
+            __func__);
+    return(0);
+  }
+
+  if ( !(out = fopen(data,"w")) ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
+    _MMG5_SAFE_FREE(data);
+    return(0);
+  }
+  if ( mesh->info.imprim > 0 )
+    fprintf(stdout,"  %%%% %s OPENED\n",data);
+  _MMG5_SAFE_FREE(data);
+
+  stats = &mesh->stats;
+
+  fprintf(out,"{\n  \"program\": \"%s\",\n",prog);
+#ifdef USE_STATS
+  fprintf(out,"  \"instrumented\": true,\n");
+#else
+  fprintf(out,"  \"instrumented\": false,\n");
+#endif
+
+  fprintf(out,"  \"phases\": {");
+  for ( k=0; k<MMG5_NPHASES; k++ )
+    fprintf(out,"%s\n    \"%s\": %.6f",k ? "," : "",_MMG5_phaseName[k],
+            stats->ptim[k]);
+  fprintf(out,"\n  },\n");
+
+  fprintf(out,"  \"operators\": {");
+  for ( k=0; k<MMG5_NOPERATORS; k++ )
+    fprintf(out,"%s\n    \"%s\": { \"calls\": %lld, \"success\": %lld,"
+            " \"time\": %.6f }",k ? "," : "",_MMG5_operName[k],
+            stats->ncall[k],stats->nsucc[k],stats->otim[k]);
+  fprintf(out,"\n  },\n");
+
+  fprintf(out,"  \"rejected_moves\": %lld,\n",
+          stats->ncall[MMG5_OperMove]-stats->nsucc[MMG5_OperMove]);
+  fprintf(out,"  \"cavities\": { \"count\": %lld, \"mean_size\": %.3f,"
+          " \"max_size\": %d },\n",stats->ncav,
+          stats->ncav ? (double)stats->cavsiz/(double)stats->ncav : 0.,
+          stats->cavmax);
+  fprintf(out,"  \"octree_queries\": %lld,\n",stats->noctree);
+  fprintf(out,"  \"batch_insertion\": { \"candidates\": %lld, \"stale\": %lld,"
+          " \"filtered\": %lld, \"rejected\": %lld, \"inserted\": %lld,"
+          " \"time\": %.6f },\n",stats->nbcand,stats->nbstale,stats->nbfilt,
+          stats->nbrej,stats->nbins,stats->btim);
+  fprintf(out,"  \"sweeps\": { \"count\": %lld, \"visited\": %lld },\n",
+          stats->nsweep,stats->nvisit);
+  fprintf(out,"  \"interrupted\": %s,\n",stats->interrupted ? "true":"false");
+  fprintf(out,"  \"memory_peak\": %lld,\n",stats->memPeak);
+  fprintf(out,"  \"mesh\": { \"np\": %d, \"nt\": %d, \"ne\": %d }\n",
+          mesh->np,mesh->nt,mesh->ne);
+  fprintf(out,"}\n");
+
+  fclose(out);
+  return(1);
+}
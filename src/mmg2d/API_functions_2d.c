@@ -91,6 +91,7 @@ void MMG2D_Init_parameters(MMG5_pMesh mesh) {
   mesh->info.nosurf   =  0;  /* [0/1]    ,avoid/allow surface modifications */
 
   mesh->info.renum    = 0;   /* [0]    , Turn on/off the renumbering using SCOTCH; */
+  mesh->info.renumit  = 0;   /* [n]    , Renumbering frequency in the remeshing loop; */
   mesh->info.nreg     = 0;
   /* default values for doubles */
   mesh->info.ls       = 0.0;      /* level set value */
@@ -168,6 +169,17 @@ int MMG2D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam, int val){
   case MMG2D_IPARAM_nosurf :
     mesh->info.nosurf   = val;
     break;
+  case MMG2D_IPARAM_renumit :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: the renumbering frequency must be"
+              " positive.\n",__func__);
+      return(0);
+    }
+    mesh->info.renumit  = val;
+    break;
+  case MMG2D_IPARAM_stats :
+    mesh->info.stats    = val;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return(0);
@@ -177,6 +189,19 @@ int MMG2D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam, int val){
   return(1);
 }
 
+int MMG2D_Get_stats(MMG5_pMesh mesh, MMG5_pStats stats) {
+
+  memcpy(stats,&mesh->stats,sizeof(MMG5_Stats));
+  return(1);
+}
+
+int MMG2D_Set_interruptFunc(MMG5_pMesh mesh, MMG5_Interrupt func, void *data) {
+
+  mesh->interruptFunc = func;
+  mesh->interruptData = data;
+  return(1);
+}
+
 int MMG2D_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val){
 
   switch ( dparam ) {
@@ -212,6 +237,13 @@ int MMG2D_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val)
   case MMG2D_DPARAM_ls :
     mesh->info.ls       = val;
     break;
+  case MMG2D_DPARAM_timeBudget :
+    if ( val < 0. ) {
+      fprintf(stderr,"\n  ## Error: %s: negative time budget.\n",__func__);
+      return(0);
+    }
+    mesh->info.tbudget  = val;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",
       __func__);
@@ -722,3 +722,22 @@ FORTRAN_NAME(MMG2D_SAVEALLSOLS,mmg2d_saveallsols,(MMG5_pMesh *mesh,MMG5_pSol *so
 
   return;
 }
+
+/**
+ * See \ref MMG2D_saveStats function in \ref mmg2d/libmmg2d.h file.
+ */
+FORTRAN_NAME(MMG2D_SAVESTATS,mmg2d_savestats,
+             (MMG5_pMesh *mesh,char* filename, int *strlen,int* retval),
+             (mesh,filename,strlen, retval)){
+  char *tmp = NULL;
+
+  tmp = (char*)malloc((*strlen+1)*sizeof(char));
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = MMG2D_saveStats(*mesh,tmp);
+
+  _MMG5_SAFE_FREE(tmp);
+
+  return;
+}
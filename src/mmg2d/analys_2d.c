@@ -34,7 +34,6 @@
 
 #include "mmg2d.h"
 
-extern char ddb;
 
 /**
  * \param mesh pointer toward the mesh
@@ -40,8 +40,10 @@ int _MMG2_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char im
   double             calold,calnew,area,det,alpha,ps,ps1,ps2,step,sqdetm1,sqdetm2,gr[2],grp[2],*m0,*m1,*m2;
   int                k,iel,ip0,ip1,ip2;
   char               i,i1,i2;
-  static char        mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char        mmgWarn0=0;
   
+  _MMG5_STAT_START(t0);
+
   pt0 = &mesh->tria[0];
   ppt0 = &mesh->point[0];
   gr[0] = gr[1] = 0.0;
@@ -85,7 +87,7 @@ int _MMG2_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char im
   
   /* Preconditionning of the gradient gr = M^{-1}gr */
   det = m0[0]*m0[2]-m0[1]*m0[1];
-  if ( det < _MMG5_EPSD ) return(0);
+  if ( det < _MMG5_EPSD ) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   det = 1.0 / det;
   
   grp[0] = det*(m0[2]*gr[0]-m0[1]*gr[1]);
@@ -120,14 +122,14 @@ int _MMG2_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char im
       fprintf(stderr,"\n  ## Error: %s: impossible to locate at least"
               " 1 gradient - abort.\n",__func__);
     }
-    return 0;
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   
   /* coordinates of the proposed position for relocation p = p0 + alpha*set*grp, so that
      the new point is inside the triangle */
   det = (p1->c[0]-p0->c[0])*(p2->c[1]-p0->c[1]) - (p1->c[1]-p0->c[1])*(p2->c[0]-p0->c[0]);
   ps = ps1+ps2;
-  if ( ps < _MMG5_EPSD ) return(0);
+  if ( ps < _MMG5_EPSD ) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   alpha = det / ps;
   
   ppt0->c[0] = p0->c[0] + alpha*step*grp[0];
@@ -144,15 +146,15 @@ int _MMG2_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char im
     calnew = MG_MIN(MMG2D_caltri(mesh,met,pt0),calnew);
   }
   
-  if (calold < _MMG2_NULKAL && calnew <= calold) return(0);
-  else if (calnew < _MMG2_NULKAL) return(0);
-  else if ( improve && calnew < 1.02 * calold ) return(0);
-  else if ( calnew < 0.3 * calold ) return(0);
+  if (calold < _MMG2_NULKAL && calnew <= calold) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+  else if (calnew < _MMG2_NULKAL) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+  else if ( improve && calnew < 1.02 * calold ) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+  else if ( calnew < 0.3 * calold ) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   
   /* Update of the coordinates of the point */
   p0 = &mesh->point[pt->v[i]];
   p0->c[0] = ppt0->c[0];
   p0->c[1] = ppt0->c[1];
   
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,1);
 }
@@ -81,7 +81,7 @@ int _MMG2_defmetbdy_2d(MMG5_pMesh mesh,MMG5_pSol met,int k,char i) {
   double          gpp1[2],gpp2[2];
   int             ilist,iel,ip,ip1,ip2,it[2],l,list[MMG2_LONMAX+2];
   char            i0,i1,i2,j;
-  static char     mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn0=0,mmgWarn1=0;
 
   sqhmin   = mesh->info.hmin*mesh->info.hmin;
   sqhmax   = mesh->info.hmax*mesh->info.hmax;
@@ -341,7 +341,7 @@ int _MMG2_grad2met_ani(MMG5_pMesh mesh,MMG5_pSol met,double *m,double *n,double
   double       det,dd,sqDelta,trimn,vnorm,hm,hn,lambda[2],dm[2],dn[2],imn[4];
   double       vp[2][2],ip[4];
   char         ier;
-  static char  mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char  mmgWarn0=0;
 
   ier = 0;
 
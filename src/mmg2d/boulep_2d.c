@@ -256,7 +256,7 @@ int _MMG2_bouleendp(MMG5_pMesh mesh,int start,char ip,int *ip1,int *ip2) {
   MMG5_pTria    pt;
   int           *adja,k;
   char          i,i1,i2;
-  static char   mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char   mmgWarn0=0;
   
   *ip1 = 0;
   *ip2 = 0;
@@ -39,8 +39,8 @@ int _MMG5_mmg2dChkmsh(MMG5_pMesh mesh, int severe,int base) {
   int            kk,l,nk,j,ip,lon,len;
   int           *list;
   unsigned char  voy,voy1;
-  static char    mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0,mmgErr5=0;
-  static char    mmgErr6=0;
+  static MMG5_THREAD_LOCAL char    mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0,mmgErr5=0;
+  static MMG5_THREAD_LOCAL char    mmgErr6=0;
 
   for (k=1; k<=mesh->nt; k++) {
     pt1 = &mesh->tria[k];
@@ -206,8 +206,8 @@ int _MMG2_chkmsh(MMG5_pMesh mesh) {
   MMG5_pPoint       p1,p2;
   int               *adja,*adjaj,k,jel;
   char              i,i1,i2,j;
-  static char       mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0;
-  static char       mmgErr6=0,mmgErr5=0;
+  static MMG5_THREAD_LOCAL char       mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0;
+  static MMG5_THREAD_LOCAL char       mmgErr6=0,mmgErr5=0;
 
   /* Check adjacencies */
   for (k=1; k<=mesh->nt; k++) {
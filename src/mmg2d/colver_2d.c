@@ -22,7 +22,6 @@
 */
 #include "mmg2d.h"
 
-extern unsigned char ddb;
 
 /* Check whether the validity and the geometry of the mesh are preserved when collapsing edge i (p1->p2)*/
 int _MMG2_chkcol(MMG5_pMesh mesh, MMG5_pSol met,int k,char i,int *list,char typchk) {
@@ -258,6 +257,8 @@ int _MMG2_colver(MMG5_pMesh mesh,int ilist,int *list) {
   int                iel,jel,ip1,ip2,k,kel,*adja;
   unsigned char      i,j,jj,i1,i2,open;
   
+  _MMG5_STAT_START(t0);
+
   iel = list[0] / 3;
   i1 =   list[0] % 3;
   i = _MMG5_iprv2[i1];
@@ -334,7 +335,7 @@ int _MMG2_colver(MMG5_pMesh mesh,int ilist,int *list) {
   _MMG2D_delElt(mesh,list[0] / 3);
   if ( !open )  _MMG2D_delElt(mesh,list[ilist-1] / 3);
   
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperCollapse,t0,1);
 }
 
 /* Perform effective collapse of edge i in tria k, i1->i2 
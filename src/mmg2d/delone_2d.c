@@ -95,7 +95,7 @@ static int _MMG2_correction_iso(MMG5_pMesh mesh,int ip,int *list,int ilist,int n
 int _MMG2_hashEdgeDelone(MMG5_pMesh mesh,HashTable *hash,int iel,int i,int *v) {
   int             *adja,iadr,jel,j,key,mins,maxs;
   Hedge           *ha;
-  static char     mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn0=0;
 
   /* Compute key */
   if ( v[0] < v[1] ) {
@@ -178,7 +178,7 @@ int _MMG2_cavity(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list) {
   MMG5_pPoint     ppt;
   double          c[2],crit,dd,eps,rad,ct[6];
   int             *adja,*adjb,adj,adi,voy,i,j,ilist,ipil,jel,iadr,base,nei[3],l,tref; //isreq;
-  static char     mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn0=0;
 
   ppt = &mesh->point[ip];
   base  = ++mesh->base;
@@ -261,7 +261,9 @@ int _MMG2_cavity(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list) {
   return(ilist);
 }
 
-/* Insertion in point ip in the cavity described by list */
+/* Insertion in point ip in the cavity described by list; the tagdel field of
+   the points must be 0 on entry. On success, list[0] is one of the created
+   triangles (usable as a starting point to locate the next point) */
 int _MMG2_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
   MMG5_pTria      pt,pt1;
   MMG5_pPoint     ppt;
@@ -270,12 +272,8 @@ int _MMG2_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
   short           i1;
   char            alert;
   HashTable       hedg;
-  static char     mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn0=0,mmgWarn1=0;
 
-  /* Reset tagdel field */
-  for (k=1; k<=mesh->np; k++)
-    mesh->point[k].tagdel = 0;
-  
   /* Triangles in the cavity are those s.t. pt->base == base */
   base = mesh->base;
   /* Count the number of external faces in the cavity, and tag the corresponding vertices */
@@ -408,6 +406,7 @@ int _MMG2_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
     }
     _MMG2D_delElt(mesh,list[k]);
   }
+  list[0] = ielnum[1];
 
   //ppt = &mesh->point[ip];
   //  ppt->flag = mesh->flag;
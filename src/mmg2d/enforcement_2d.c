@@ -39,9 +39,9 @@ int MMG2_bdryenforcement(MMG5_pMesh mesh,MMG5_pSol sol) {
   int             ia,ib,ilon,rnd,idep,*adja,ir,adj,list2[3];
   char            i,i1,i2,j;
 //  int       iadr2,*adja2,ndel,iadr,ped0,ped1;
-  static char     mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
-  static char     mmgWarn4=0,mmgWarn5=0,mmgWarn6=0,mmgWarn7=0;
-  static char     mmgWarn8=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn4=0,mmgWarn5=0,mmgWarn6=0,mmgWarn7=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn8=0;
 
   nex = 0;
   
@@ -154,7 +154,7 @@ int MMG2_hashTria(MMG5_pMesh mesh) {
 int MMG2_hashEdge(pHashTable edgeTable,int iel,int ia, int ib) {
   int         key,mins,maxs;
   Hedge      *ha;
-  static char mmgErr = 0;
+  static MMG5_THREAD_LOCAL char mmgErr = 0;
 
   /* compute key */
   if ( ia < ib ) {
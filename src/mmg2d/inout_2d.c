@@ -85,7 +85,8 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   long         posnp,posnt,posncor,posned,posnq,posreq,posreqed,posntreq;
   int          k,ref,tmp,ncor,norient,nreq,ntreq,nreqed,bin,iswp,nq;
   char        *ptr,*data,chaine[128];
-  double       air,dtmp;
+  double       air;
+  _MMG5_Mmap   mm;
   int          i,bdim,binch,bpos;
 
 
@@ -95,6 +96,7 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   iswp = 0;
   mesh->np = mesh->nt = mesh->na = mesh->xp = 0;
   nq = 0;
+  memset(&mm,0,sizeof(_MMG5_Mmap));
 
   _MMG5_SAFE_CALLOC(data,strlen(filename)+7,char,0);
   strcpy(data,filename);
@@ -128,65 +130,71 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   _MMG5_SAFE_FREE(data);
 
   if (!bin) {
+    if ( !_MMG5_mmapOpen(&mm,inm) ) {
+      fclose(inm);
+      return(0);
+    }
     strcpy(chaine,"D");
-    while(fscanf(inm,"%127s",&chaine[0])!=EOF && strncmp(chaine,"End",strlen("End")) ) {
+    while(_MMG5_mmapKeyword(&mm,chaine,128) && strncmp(chaine,"End",strlen("End")) ) {
       if(!strncmp(chaine,"MeshVersionFormatted",strlen("MeshVersionFormatted"))) {
-        fscanf(inm,"%d",&mesh->ver);
+        _MMG5_mmapInt(&mm,&mesh->ver);
         continue;
       }
       else if(!strncmp(chaine,"Dimension",strlen("Dimension"))) {
-        fscanf(inm,"%d",&mesh->dim);
+        _MMG5_mmapInt(&mm,&mesh->dim);
         if(mesh->info.nreg==2) {
           if(mesh->dim!=3) {
             fprintf(stdout,"WRONG USE OF -msh \n");
+            _MMG5_mmapClose(&mm);
             return(0);
           }
           mesh->dim = 2;
         }
         if(mesh->dim!=2) {
           fprintf(stdout,"BAD DIMENSION : %d\n",mesh->dim);
+          _MMG5_mmapClose(&mm);
           return(0);
         }
         continue;
       }
       else if(!strncmp(chaine,"Vertices",strlen("Vertices"))) {
-        fscanf(inm,"%d",&mesh->np);
-        posnp = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->np);
+        posnp = mm.pos;
         continue;
       }
       else if(!strncmp(chaine,"Triangles",strlen("Triangles"))) {
-        fscanf(inm,"%d",&mesh->nt);
-        posnt = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->nt);
+        posnt = mm.pos;
         continue;
       }
       else if(!strncmp(chaine,"Corners",strlen("Corners"))) {
-        fscanf(inm,"%d",&ncor);
-        posncor = ftell(inm);
+        _MMG5_mmapInt(&mm,&ncor);
+        posncor = mm.pos;
         continue;
       }
       else if(!strncmp(chaine,"RequiredVertices",strlen("RequiredVertices"))) {
-        fscanf(inm,"%d",&nreq);
-        posreq = ftell(inm);
+        _MMG5_mmapInt(&mm,&nreq);
+        posreq = mm.pos;
         continue;
       }
       else if(!strncmp(chaine,"Edges",strlen("Edges"))) {
-        fscanf(inm,"%d",&mesh->na);
-        posned = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->na);
+        posned = mm.pos;
         continue;
       }
       else if(!strncmp(chaine,"RequiredEdges",strlen("RequiredEdges"))) {
-        fscanf(inm,"%d",&nreqed);
-        posreqed = ftell(inm);
+        _MMG5_mmapInt(&mm,&nreqed);
+        posreqed = mm.pos;
         continue;
       }
       else if(!strncmp(chaine,"RequiredTriangles",strlen("RequiredTriangles"))) {
-        fscanf(inm,"%d",&ntreq);
-        posntreq = ftell(inm);
+        _MMG5_mmapInt(&mm,&ntreq);
+        posntreq = mm.pos;
         continue;
       }
       else if(!strncmp(chaine,"Quadrilaterals",strlen("Quadrilaterals"))) {
-        fscanf(inm,"%d",&nq);
-        posnq = ftell(inm);
+        _MMG5_mmapInt(&mm,&nq);
+        posnq = mm.pos;
         continue;
       }
     }
@@ -202,6 +210,12 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     }
     fread(&mesh->ver,sw,1,inm);
     if(iswp) mesh->ver = MMG_swapbin(mesh->ver);
+    if ( mesh->ver > 2 ) {
+      fprintf(stderr,"  ** UNSUPPORTED MESH VERSION %d: mmg2d only reads the"
+              " versions 1 and 2 of the binary files.\n",mesh->ver);
+      fclose(inm);
+      return(0);
+    }
     while(fread(&binch,sw,1,inm)!=0 && binch!=54 ) {
       if(iswp) binch=MMG_swapbin(binch);
       if(binch==54) break;
@@ -306,6 +320,7 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
 
   if ( !mesh->np  ) {
     fprintf(stdout,"  ** MISSING DATA : no point\n");
+    _MMG5_mmapClose(&mm);
     return(0);
   }
   if (!mesh->nt) {
@@ -321,58 +336,54 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   }
 
   /* Memory allocation */
-  if ( !MMG2D_zaldy(mesh) )  return(0);
+  if ( !MMG2D_zaldy(mesh) ) {
+    _MMG5_mmapClose(&mm);
+    return(0);
+  }
+
+  if ( !bin ) {
+    /* Parallel reading of the main blocks of the ASCII file (the third
+     * coordinate is ignored with the -msh option) */
+    if ( !_MMG5_mmapPoints(&mm,mesh,posnp,2,mesh->info.nreg==2) ||
+         ( mesh->na &&
+           !_MMG5_mmapElts(&mm,posned,mesh->na,2,(char*)&mesh->edge[1],
+                           sizeof(MMG5_Edge),offsetof(MMG5_Edge,a),
+                           offsetof(MMG5_Edge,ref)) ) ||
+         ( mesh->nt &&
+           !_MMG5_mmapElts(&mm,posnt,mesh->nt,3,(char*)&mesh->tria[1],
+                           sizeof(MMG5_Tria),offsetof(MMG5_Tria,v),
+                           offsetof(MMG5_Tria,ref)) ) ) {
+      _MMG5_mmapClose(&mm);
+      fclose(inm);
+      return(0);
+    }
+  }
 
   /* Read vertices */
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
-    if (mesh->ver < 2) { /*float*/
-      if (!bin) {
-        if(mesh->info.nreg==2) {
-          for (i=0 ; i<3 ; i++) {
-            fscanf(inm,"%f",&fc);
-            if(i==2) break;
-            ppt->c[i] = (double) fc;
-          }
-        } else {
-          for (i=0 ; i<2 ; i++) {
-            fscanf(inm,"%f",&fc);
-            ppt->c[i] = (double) fc;
-          }
-        }
-        fscanf(inm,"%d",&ppt->ref);
-      } else {
-        if(mesh->info.nreg==2) {
-          fprintf(stderr,"  ## Warning: %s: binary not available with"
-                  " -msh option.\n",__func__);
-          return(0);
-        }
+    if ( bin ) {
+      if(mesh->info.nreg==2) {
+        fprintf(stderr,"  ## Warning: %s: binary not available with"
+                " -msh option.\n",__func__);
+        return(0);
+      }
+      if (mesh->ver < 2) { /*float*/
         for (i=0 ; i<2 ; i++) {
           fread(&fc,sw,1,inm);
           if(iswp) fc=MMG_swapf(fc);
           ppt->c[i] = (double) fc;
         }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=MMG_swapbin(ppt->ref);
-      }
-    } else {
-      if (!bin) {
-        if(mesh->info.nreg==2) {
-          fscanf(inm,"%lf %lf %lf %d",&ppt->c[0],&ppt->c[1],&dtmp,&ppt->ref);
-        } else {
-          fscanf(inm,"%lf %lf %d",&ppt->c[0],&ppt->c[1],&ppt->ref);
-        }
-      }
-      else {
+      } else {
         for (i=0 ; i<2 ; i++) {
           fread(&ppt->c[i],sd,1,inm);
           if(iswp) ppt->c[i]=MMG_swapd(ppt->c[i]);
         }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=MMG_swapbin(ppt->ref);
       }
+      fread(&ppt->ref,sw,1,inm);
+      if(iswp) ppt->ref=MMG_swapbin(ppt->ref);
     }
     ppt->tag = MG_NUL;
   }
@@ -382,9 +393,7 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   fseek(inm,posned,SEEK_SET);
   for (k=1; k<=mesh->na; k++) {
     ped = &mesh->edge[k];
-    if (!bin)
-      fscanf(inm,"%d %d %d",&ped->a,&ped->b,&ped->ref);
-    else {
+    if ( bin ) {
       fread(&ped->a,sw,1,inm);
       if(iswp) ped->a=MMG_swapbin(ped->a);
       fread(&ped->b,sw,1,inm);
@@ -401,9 +410,7 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     norient = 0;
     for (k=1; k<=mesh->nt; k++) {
       pt = &mesh->tria[k];
-      if (!bin)
-        fscanf(inm,"%d %d %d %d",&pt->v[0],&pt->v[1],&pt->v[2],&pt->ref);
-      else {
+      if ( bin ) {
         for (i=0 ; i<3 ; i++) {
           fread(&pt->v[i],sw,1,inm);
           if(iswp) pt->v[i]=MMG_swapbin(pt->v[i]);
@@ -535,6 +542,7 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     }
   }
 
+  _MMG5_mmapClose(&mm);
   fclose(inm);
 
   /*maill periodique : remettre toutes les coord entre 0 et 1*/
@@ -792,6 +800,7 @@ void MMG2D_readDoubleSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
  */
 int MMG2D_loadSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
   FILE       *inm;
+  _MMG5_Mmap  mm;
   long        posnp;
   int         iswp,ier,dim;
   int         k,ver,bin,np,nsols,*type;
@@ -833,19 +842,33 @@ int MMG2D_loadSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
   _MMG5_SAFE_FREE(type);
 
   /* Read mesh solutions */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
-
-  if ( sol->ver == 1 ) {
-    /* Simple precision */
-    for (k=1; k<=sol->np; k++) {
-      MMG2D_readFloatSol(sol,inm,bin,iswp,k);
+  if ( !bin ) {
+    if ( !_MMG5_mmapOpen(&mm,inm) ) {
+      fclose(inm);
+      return(-1);
+    }
+    ier = _MMG5_mmapSol(&mm,sol,posnp);
+    _MMG5_mmapClose(&mm);
+    if ( !ier ) {
+      fclose(inm);
+      return(-1);
     }
   }
   else {
-    for (k=1; k<=sol->np; k++) {
-      /* Double precision */
-      MMG2D_readDoubleSol(sol,inm,bin,iswp,k);
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+
+    if ( sol->ver == 1 ) {
+      /* Simple precision */
+      for (k=1; k<=sol->np; k++) {
+        MMG2D_readFloatSol(sol,inm,bin,iswp,k);
+      }
+    }
+    else {
+      for (k=1; k<=sol->np; k++) {
+        /* Double precision */
+        MMG2D_readDoubleSol(sol,inm,bin,iswp,k);
+      }
     }
   }
 
@@ -873,7 +896,7 @@ int MMG2D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   int         iswp,ier,dim;
   int         j,k,ver,bin,np,nsols,*type;
   char        data[10];
-  static char mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn = 0;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,2,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -1797,3 +1820,7 @@ int _MMG2_savedisp_db(MMG5_pMesh mesh,MMG5_pSol disp,char *filename,char pack) {
   return(1);
 }
 
+int MMG2D_saveStats(MMG5_pMesh mesh, const char *filename) {
+
+  return(_MMG5_saveStats(mesh,filename,"mmg2d"));
+}
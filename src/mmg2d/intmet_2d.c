@@ -54,7 +54,7 @@ int _MMG2_intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s)
 int _MMG5_interpmet22(MMG5_pMesh mesh,double *m,double *n,double s,double *mr) {
   double      det,imn[4],dd,den,sqDelta,trimn,lambda[2],vp0[2],vp1[2],dm[2];
   double      dn[2],vnorm,d0,d1,ip[4];
-  static char mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREAD_LOCAL char mmgWarn0=0,mmgWarn1=0;
 
   /* Compute imn = M^{-1}N */
   det = m[0]*m[2] - m[1]*m[1];
@@ -239,7 +239,7 @@ int _MMG2_intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s)
   double         *m1,*m2,*mr;
   int            ip1,ip2;
   char           i1,i2;
-  static char    mmgWarn=0;
+  static MMG5_THREAD_LOCAL char    mmgWarn=0;
   
   pt = &mesh->tria[k];
   i1 = _MMG5_inxt2[i];
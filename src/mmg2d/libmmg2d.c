@@ -159,6 +159,7 @@ int MMG2D_mmg2dlib(MMG5_pMesh mesh,MMG5_pSol sol)
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  _MMG5_initStats(mesh);
 
   /* Check options */
   if ( !mesh->nt ) {
@@ -326,9 +327,11 @@ int MMG2D_mmg2dlib(MMG5_pMesh mesh,MMG5_pSol sol)
 
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
+  _MMG5_statTimes(mesh,ctim);
   if ( mesh->info.imprim )
     fprintf(stdout,"\n   MMG2DLIB: ELAPSED TIME  %s\n",stim);
-  _LIBMMG5_RETURN(mesh,sol,MMG5_SUCCESS);
+  _LIBMMG5_RETURN(mesh,sol,
+                  mesh->stats.interrupted ? MMG5_INTERRUPTED : MMG5_SUCCESS);
 
 }
 
@@ -392,6 +395,7 @@ int MMG2D_mmg2dmesh(MMG5_pMesh mesh,MMG5_pSol sol) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  _MMG5_initStats(mesh);
 
   /* Check options */
   if ( mesh->nt ) {
@@ -571,9 +575,11 @@ int MMG2D_mmg2dmesh(MMG5_pMesh mesh,MMG5_pSol sol) {
 
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
+  _MMG5_statTimes(mesh,ctim);
   if ( mesh->info.imprim )
     fprintf(stdout,"\n   MMG2DMESH: ELAPSED TIME  %s\n",stim);
-  _LIBMMG5_RETURN(mesh,sol,MMG5_SUCCESS);
+  _LIBMMG5_RETURN(mesh,sol,
+                  mesh->stats.interrupted ? MMG5_INTERRUPTED : MMG5_SUCCESS);
 
 }
 
@@ -599,6 +605,7 @@ int MMG2D_mmg2dls(MMG5_pMesh mesh,MMG5_pSol sol)
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  _MMG5_initStats(mesh);
 
   /* Check options */
   if ( mesh->info.lag >= 0 ) {
@@ -737,9 +744,11 @@ int MMG2D_mmg2dls(MMG5_pMesh mesh,MMG5_pSol sol)
 
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
+  _MMG5_statTimes(mesh,ctim);
   if ( mesh->info.imprim )
     fprintf(stdout,"\n   MMG2DLS: ELAPSED TIME  %s\n",stim);
-  _LIBMMG5_RETURN(mesh,sol,MMG5_SUCCESS);
+  _LIBMMG5_RETURN(mesh,sol,
+                  mesh->stats.interrupted ? MMG5_INTERRUPTED : MMG5_SUCCESS);
 
 }
 
@@ -764,6 +773,7 @@ int MMG2D_mmg2dmov(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  _MMG5_initStats(mesh);
 
   /* Check data compatibility */
   if ( mesh->info.imprim ) fprintf(stdout,"\n  -- MMG2DMOV: INPUT DATA\n");
@@ -891,8 +901,10 @@ int MMG2D_mmg2dmov(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
 
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
+  _MMG5_statTimes(mesh,ctim);
   if ( mesh->info.imprim )
     fprintf(stdout,"\n   MMG2DMOV: ELAPSED TIME  %s\n",stim);
 
-  _LIBMMG5_RETURN(mesh,met,MMG5_SUCCESS);
+  _LIBMMG5_RETURN(mesh,met,
+                  mesh->stats.interrupted ? MMG5_INTERRUPTED : MMG5_SUCCESS);
 }
@@ -68,6 +68,8 @@ enum MMG2D_Param {
   MMG2D_IPARAM_noswap,            /*!< [1/0], Avoid/allow edge or face flipping */
   MMG2D_IPARAM_nomove,            /*!< [1/0], Avoid/allow point relocation */
   MMG2D_IPARAM_nosurf,            /*!< [1/0], Avoid/allow surface modifications */
+  MMG2D_IPARAM_renumit,           /*!< [n], Renumber the mesh along a space filling curve every n iterations of the remeshing loop (0: never) */
+  MMG2D_IPARAM_stats,             /*!< [1/0], Turn on/off the output of the performance counters of the run */
   MMG2D_DPARAM_angleDetection,    /*!< [val], Value for angle detection */
   MMG2D_DPARAM_hmin,              /*!< [val], Minimal mesh size */
   MMG2D_DPARAM_hmax,              /*!< [val], Maximal mesh size */
@@ -75,6 +77,7 @@ enum MMG2D_Param {
   MMG2D_DPARAM_hausd,             /*!< [val], Control global Hausdorff distance (on all the boundary surfaces of the mesh) */
   MMG2D_DPARAM_hgrad,             /*!< [val], Control gradation */
   MMG2D_DPARAM_ls,                /*!< [val], Value of level-set (not use for now) */
+  MMG2D_DPARAM_timeBudget,        /*!< [val], Wall clock budget (s) of the remeshing: the remeshing is interrupted once it is exceeded (0: no budget) */
 };
 
 /*----------------------------- functions header -----------------------------*/
@@ -223,6 +226,38 @@ int  MMG2D_Set_outputSolName(MMG5_pMesh mesh,MMG5_pSol sol, const char* solout);
  */
 int MMG2D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam, int val);
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param stats pointer toward the structure that receives the counters.
+ * \return 1.
+ *
+ * Get the performance counters of the last library call (phase times, memory
+ * high-water mark and, if the library is built with the USE_STATS option,
+ * calls, successes and time of the local operators).
+ *
+ * \remark No Fortran interface (use the MMG2D_saveStats function).
+ *
+ */
+int MMG2D_Get_stats(MMG5_pMesh mesh, MMG5_pStats stats);
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param func progress/cancel callback (NULL to remove the callback).
+ * \param data pointer toward the user data given to the callback.
+ * \return 1.
+ *
+ * Set the progress/cancel callback of the remeshing. The callback is called
+ * between the sweeps of the remeshing with \a data and the elapsed time of
+ * the library call and returns a non zero value to interrupt the remeshing.
+ * An interrupted remeshing stops cleanly: the library returns a conform,
+ * packed and partially remeshed mesh with the \ref MMG5_INTERRUPTED value.
+ *
+ * \remark No Fortran interface (use the MMG2D_DPARAM_timeBudget parameter to
+ * bound the remeshing time).
+ *
+ */
+int MMG2D_Set_interruptFunc(MMG5_pMesh mesh, MMG5_Interrupt func, void *data);
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param sol pointer toward the sol structure.
@@ -1135,6 +1170,25 @@ int MMG2D_saveMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *fil
  *
  */
 int MMG2D_saveSol(MMG5_pMesh  mesh,MMG5_pSol sol ,const char *filename);
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param filename name of the JSON file (if NULL, the name of the output
+ * mesh with the \a .stats.json extension).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Save the performance counters of the last library call in a JSON file.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG2D_SAVESTATS(mesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: mesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMG2D_saveStats(MMG5_pMesh mesh, const char *filename);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param sol pointer toward the solutions array
@@ -40,7 +40,7 @@
 int MMG2_coorbary(MMG5_pMesh mesh,MMG5_pTria pt,double c[2],double* det,double* l1,double* l2) {
   MMG5_pPoint      p1,p2,p3;
   double           b2,b3;
-  static char      mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char      mmgWarn0=0;
 
   p1 = &mesh->point[pt->v[0]];
   p2 = &mesh->point[pt->v[1]];
@@ -215,16 +215,31 @@ int MMG2_cutEdgeTriangle(MMG5_pMesh mesh,int k,int ia,int ib) {
 
 /** Return the index of one triangle containing ip */
 int MMG2_findTria(MMG5_pMesh mesh,int ip) {
+  return(MMG2_findTriaFrom(mesh,ip,1));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ip index of the point to locate.
+ * \param kdep index of the triangle from which we start the walk.
+ * \return the index of one triangle containing \a ip, 0 if the walk fails.
+ *
+ * Walk through the mesh from triangle \a kdep toward the point \a ip. The
+ * walk is short if \a kdep is close to \a ip (for example the last triangle
+ * created when inserting points sorted along a space filling curve).
+ *
+ */
+int MMG2_findTriaFrom(MMG5_pMesh mesh,int ip,int kdep) {
   MMG5_pTria  pt,pt1;
   int         find,iel,base,iadr,*adja,iter,ier;
   int         mvDir[3],jel,i;
   double      l1,l2,l3,det,eps;
-  static char mmgWarn0 = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn0 = 0;
 
   ++mesh->base;
   base = ++mesh->base;
   find = iter = 0;
-  iel  = 1;
+  iel  = ( kdep > 0 && kdep <= mesh->nt ) ? kdep : 1;
   do {
     mvDir[0] = mvDir[1] = mvDir[2] = 0;
     iter++;
@@ -329,7 +344,7 @@ int MMG2_locateEdge(MMG5_pMesh mesh,int ia,int ib,int* kdep,int* list) {
   double             a[3],a11,a21,a12,a22,area1,area2,area3,prod1,prod2,prod3;
   double             niaib,npti;
   int                iadr,*adja,k,ibreak,i,ncompt,lon,iare,ivert;
-  static char        mmgWarn=0;
+  static MMG5_THREAD_LOCAL char        mmgWarn=0;
   //int       ktemp;
 
   k = *kdep;
@@ -56,6 +56,7 @@ static int MMG2D_usage(char *name) {
   fprintf(stdout,"-noinsert     no insertion/suppression point\n");
   fprintf(stdout,"-noswap       no edge flipping\n");
   fprintf(stdout,"-nomove       no point relocation\n");
+  fprintf(stdout,"-rnit [n]     renumber along a space filling curve every n iterations\n");
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -517,6 +518,24 @@ int parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,double *qdegrad)
           mesh->info.renum = -10;
         }
         break;
+      case 'r':
+        if ( !strcmp(argv[i],"-rnit") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMG2D_Set_iparameter(mesh,met,MMG2D_IPARAM_renumit,atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MMG2D_usage(argv[0]);
+            return 0;
+          }
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MMG2D_usage(argv[0]);
+          return 0;
+        }
+        break;
       case 's':
         if ( !strcmp(argv[i],"-sol") ) {
           if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
@@ -529,6 +548,22 @@ int parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,double *qdegrad)
             return 0;
           }
         }
+        else if ( !strcmp(argv[i],"-stats") ) {
+          if ( !MMG2D_Set_iparameter(mesh,met,MMG2D_IPARAM_stats,1) )
+            return 0;
+        }
+        break;
+      case 't':
+        if ( !strcmp(argv[i],"-tbudget") && ++i < argc ) {
+          if ( !MMG2D_Set_dparameter(mesh,met,MMG2D_DPARAM_timeBudget,
+                                   atof(argv[i])) )
+            return 0;
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MMG2D_usage(argv[0]);
+          return 0;
+        }
         break;
       case 'v':
         if ( ++i < argc ) {
@@ -747,6 +782,9 @@ int main(int argc,char *argv[]) {
     if( !msh && met->np )
       MMG2D_saveSol(mesh,met,mesh->nameout);
 
+    if ( mesh->info.stats )
+      MMG2D_saveStats(mesh,NULL);
+
     chrono(OFF,&MMG5_ctim[1]);
     if ( mesh->info.imprim ) fprintf(stdout,"  -- WRITING COMPLETED\n");
   }
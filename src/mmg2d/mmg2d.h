@@ -254,6 +254,7 @@ int MMG2_isInTriangle(MMG5_pMesh ,int,double c[2]);
 int MMG2_cutEdge(MMG5_pMesh ,MMG5_pTria ,MMG5_pPoint ,MMG5_pPoint );
 int MMG2_cutEdgeTriangle(MMG5_pMesh ,int ,int ,int );
 int MMG2_findTria(MMG5_pMesh ,int );
+int MMG2_findTriaFrom(MMG5_pMesh ,int ,int );
 //int MMG2_findpos(MMG5_pMesh ,MMG5_pTria ,int ,int ,int ,int ,int );
 int MMG2_locateEdge(MMG5_pMesh ,int ,int ,int* ,int* ) ;
 int MMG2_bdryenforcement(MMG5_pMesh ,MMG5_pSol);
@@ -370,12 +371,13 @@ int    interp_iso(double *,double *,double * ,double );
 int    lissmet_iso(MMG5_pMesh mesh,MMG5_pSol sol);
 int    lissmet_ani(MMG5_pMesh mesh,MMG5_pSol sol);
 
-double (*MMG2D_lencurv)(MMG5_pMesh ,MMG5_pSol ,int ,int );
-double (*MMG2D_caltri)(MMG5_pMesh ,MMG5_pSol ,MMG5_pTria );
-int    (*MMG2_optlen)(MMG5_pMesh ,MMG5_pSol ,double ,int );
-int    (*MMG2D_intmet)(MMG5_pMesh ,MMG5_pSol ,int ,char ,int ,double );
-int    (*MMG2D_gradsiz)(MMG5_pMesh ,MMG5_pSol );
-int    (*MMG2D_defsiz)(MMG5_pMesh ,MMG5_pSol );
+/* function pointers (defined in mmg2dexterns.c) */
+extern MMG5_THREAD_LOCAL double (*MMG2D_lencurv)(MMG5_pMesh ,MMG5_pSol ,int ,int );
+extern MMG5_THREAD_LOCAL double (*MMG2D_caltri)(MMG5_pMesh ,MMG5_pSol ,MMG5_pTria );
+extern MMG5_THREAD_LOCAL int    (*MMG2_optlen)(MMG5_pMesh ,MMG5_pSol ,double ,int );
+extern MMG5_THREAD_LOCAL int    (*MMG2D_intmet)(MMG5_pMesh ,MMG5_pSol ,int ,char ,int ,double );
+extern MMG5_THREAD_LOCAL int    (*MMG2D_gradsiz)(MMG5_pMesh ,MMG5_pSol );
+extern MMG5_THREAD_LOCAL int    (*MMG2D_defsiz)(MMG5_pMesh ,MMG5_pSol );
 
 /* init structures */
 void  _MMG2_Init_parameters(MMG5_pMesh mesh);
@@ -113,7 +113,7 @@ int _MMG2_anaelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
   double          len,s,o[2],no[2];
   int             ns,nc,npinit,ni,k,nt,ip1,ip2,ip,it,vx[3];
   char            i,ic,i1,i2,ier;
-  static char     mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn0=0;
 
   s = 0.5;
   ns = 0;
@@ -514,6 +514,7 @@ int _MMG2_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
   mesh->base++;
 
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     ns = 0;
     for (k=1; k<=mesh->nt; k++) {
       pt = &mesh->tria[k];
@@ -546,7 +547,16 @@ int _MMG2_adptri(MMG5_pMesh mesh,MMG5_pSol met) {
   maxit = 5;
   
   do {
-    
+    if ( _MMG5_interrupt(mesh) )  break;
+    /* Renumbering along a space filling curve */
+    if ( mesh->info.renumit && it && !(it%mesh->info.renumit) ) {
+      if ( !_MMG5_sfcRenumberingTria(mesh,met) ) {
+        fprintf(stderr,"  ## Problem in function sfcRenumberingTria."
+                " Unable to complete mesh. Exit program.\n");
+        return(0);
+      }
+    }
+
     if ( !mesh->info.noinsert ) {
       ns = _MMG2_adpspl(mesh,met);
       if ( ns < 0 ) {
@@ -753,6 +763,7 @@ int _MMG2_movtri(MMG5_pMesh mesh,MMG5_pSol met,int maxit,char improve) {
     mesh->point[k].flag = base;
 
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     base++;
     nm = ns = 0;
     for (k=1; k<=mesh->nt; k++) {
@@ -834,6 +845,12 @@ int MMG2_mmg2d1n(MMG5_pMesh mesh,MMG5_pSol met) {
     return(0);
   }
   
+  /* Renumbering along a space filling curve */
+  if ( mesh->info.renumit && !_MMG5_sfcRenumberingTria(mesh,met) ) {
+    fprintf(stderr,"  ## Unable to renumber mesh. Exit program.\n");
+    return(0);
+  }
+
   /* Stage 3: fine mesh improvements */
   if ( !_MMG2_adptri(mesh,met) ) {
     fprintf(stderr,"  ## Unable to make fine improvements. Exit program.\n");
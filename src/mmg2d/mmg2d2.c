@@ -43,7 +43,7 @@ int MMG2_removeBBtriangles(MMG5_pMesh mesh) {
   MMG5_pTria      pt;
   int             ip1,ip2,ip3,ip4,k,iadr,*adja,iadr2,*adja2,iel,nd;
   char            i,ii;
-  static char     mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn0=0;
 
   /* Bounding Box vertices */
   ip1 = mesh->np-3;
@@ -153,58 +153,156 @@ int MMG2_findtrianglestate(MMG5_pMesh mesh,int k,int ip1,int ip2,int ip3,int ip4
   }
 }
 
+/**
+ * \struct _MMG2_Grid
+ * \brief Coarse grid storing, in each cell, the last triangle created by the
+ * insertion of a point of the cell.
+ */
+typedef struct {
+  double min[2]; /*!< Lower corner of the grid */
+  double step;   /*!< Inverse of the cell size */
+  int    n;      /*!< Number of cells in each direction */
+  int    *cell;  /*!< Triangle hint of each cell (0 if empty) */
+} _MMG2_Grid;
+
+/**
+ * \param grid pointer toward the grid.
+ * \param c point coordinates.
+ * \param i pointer toward the first index of the cell containing \a c.
+ * \param j pointer toward the second index of the cell containing \a c.
+ *
+ * Compute the cell of the grid containing \a c.
+ *
+ */
+static inline
+void _MMG2_gridCell(_MMG2_Grid *grid,double c[2],int *i,int *j) {
+  *i = (int)(grid->step*(c[0]-grid->min[0]));
+  *j = (int)(grid->step*(c[1]-grid->min[1]));
+  *i = MG_MAX(0,MG_MIN(grid->n-1,*i));
+  *j = MG_MAX(0,MG_MIN(grid->n-1,*j));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ip index of the point to locate.
+ * \param kdep triangle created by the previous insertion (0 if none).
+ * \param grid pointer toward the grid of triangle hints (NULL if none).
+ * \return the index of a triangle containing \a ip, 0 if fail.
+ *
+ * Locate the point \a ip: walk from the triangle created by the previous
+ * insertion, then from the nearest hint of the grid and, as a last resort,
+ * exhaustive search.
+ *
+ */
+static int _MMG2_locatePoint(MMG5_pMesh mesh,int ip,int kdep,_MMG2_Grid *grid) {
+  MMG5_pPoint ppt;
+  int         i0,j0,i,j,r,k,kk,ntry,imin,imax,di;
+
+  ppt = &mesh->point[ip];
+
+  /* Walk from the last created triangle */
+  if ( kdep > 0 && kdep <= mesh->nt && MG_EOK(&mesh->tria[kdep]) ) {
+    k = MMG2_findTriaFrom(mesh,ip,kdep);
+    if ( k )  return(k);
+  }
+
+  /* Walk from the nearest non empty cells of the grid */
+  if ( grid && grid->cell ) {
+    _MMG2_gridCell(grid,ppt->c,&i0,&j0);
+    ntry = 0;
+    for (r=0; r<grid->n && ntry<4; r++) {
+      for (j=MG_MAX(0,j0-r); j<=MG_MIN(grid->n-1,j0+r) && ntry<4; j++) {
+        /* Only the cells of the ring r: the first and last rows are full, the
+         * other rows only have their two end cells */
+        if ( abs(j-j0) == r ) {
+          imin = MG_MAX(0,i0-r);
+          imax = MG_MIN(grid->n-1,i0+r);
+          di   = 1;
+        }
+        else {
+          imin = i0-r;
+          imax = i0+r;
+          di   = 2*r;
+        }
+        for (i=imin; i<=imax && ntry<4; i+=di) {
+          if ( i < 0 || i >= grid->n )  continue;
+
+          kk = grid->cell[j*grid->n+i];
+          if ( !kk || kk > mesh->nt || !MG_EOK(&mesh->tria[kk]) )  continue;
+
+          ++ntry;
+          k = MMG2_findTriaFrom(mesh,ip,kk);
+          if ( k )  return(k);
+        }
+      }
+    }
+  }
+  else {
+    k = MMG2_findTria(mesh,ip);
+    if ( k )  return(k);
+  }
+
+  /* Exhaustive search if not found */
+  if ( mesh->info.ddebug )
+    printf(" ** exhaustive search of point location.\n");
+
+  for(kk=1; kk<=mesh->nt; kk++) {
+    k = MMG2_isInTriangle(mesh,kk,&ppt->c[0]);
+    if ( k )  return(k);
+  }
+  return(0);
+}
+
 /**
  * \param mesh pointer toward the mesh structure
  * \param sol pointer toward the solution structure
+ * \param perm insertion order of the points.
+ * \param nperm number of points in \a perm.
+ * \param grid pointer toward the grid of triangle hints (NULL if none).
  * \return  0 if fail.
  *
- * Insertion of the list of points inside the mesh
- * (Vertices mesh->np - 3, 2, 1, 0 are the vertices of the BB and have already been inserted)
+ * Insertion of the points of \a perm inside the mesh.
  *
  */
-int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
+static
+int _MMG2_insertpoints(MMG5_pMesh mesh,MMG5_pSol sol,int *perm,int nperm,
+                       _MMG2_Grid *grid) {
   MMG5_pPoint ppt;
   int         list[MMG2_LONMAX],lon;
-  int         k,kk;
+  int         k,l,kdep,i,j;
   int         iter,maxiter,ns,nus,nu,nud;
-  static char mmgWarn0=0,mmgWarn1=0,mmgWarn2=0;
+  static MMG5_THREAD_LOCAL char mmgWarn0=0,mmgWarn1=0,mmgWarn2=0;
 
   for(k=1; k<=mesh->np-4; k++) {
     ppt = &mesh->point[k];
     ppt->flag	= -10;
   }
+  for(k=1; k<=mesh->np; k++)
+    mesh->point[k].tagdel = 0;
+
   iter = 0;
   maxiter = 10;
-  
+  kdep = 0;
+
 	do {
     ns = nus = 0;
     nu = nud = 0;
     mmgWarn1 = mmgWarn2 = 0;
-    for(k=1; k<=mesh->np-4; k++) {
+    for(l=0; l<nperm; l++) {
+      k   = perm[l];
       ppt = &mesh->point[k];
 		  if(ppt->flag != -10) continue;
 			nus++;
       /* Find the triangle lel of the mesh containing ppt */
-      list[0] = MMG2_findTria(mesh,k);
+      list[0] = _MMG2_locatePoint(mesh,k,kdep,grid);
 
-      /* Exhaustive search if not found */
       if ( !list[0] ) {
-        if ( mesh->info.ddebug )
-          printf(" ** exhaustive search of point location.\n");
-
-        for(kk=1; kk<=mesh->nt; kk++) {
-          list[0] = MMG2_isInTriangle(mesh,kk,&ppt->c[0]);
-          if ( list[0] ) break;
-        }
-
-        if ( kk>mesh->nt ) {
-          if ( !mmgWarn0 ) {
-            mmgWarn0 = 1;
-            fprintf(stderr,"\n  ## Error: %s: unable to find triangle"
-                    " for at least vertex %8d.\n",__func__,k);
-          }
-          return(0);
+        if ( !mmgWarn0 ) {
+          mmgWarn0 = 1;
+          fprintf(stderr,"\n  ## Error: %s: unable to find triangle"
+                  " for at least vertex %8d.\n",__func__,k);
         }
+        return(0);
       }
 
       /* Create the cavity of point k starting from list[0] */
@@ -231,6 +329,13 @@ int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
         } else {
           ppt->flag = 0;
           ns++;
+
+          /* The next point is close to k: start its location from here */
+          kdep = list[0];
+          if ( grid && grid->cell ) {
+            _MMG2_gridCell(grid,ppt->c,&i,&j);
+            grid->cell[j*grid->n+i] = kdep;
+          }
         }
       }
     }
@@ -250,31 +355,21 @@ int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
     mmgWarn2 = 0;
     nus = ns = 0;
     /*try to insert using splitbar*/
-    for(k=1; k<=mesh->np-4; k++) {
+    for(l=0; l<nperm; l++) {
+      k   = perm[l];
       ppt = &mesh->point[k];
 		  if(ppt->flag != -10) continue;
 			nus++;
       /* Find the triangle lel of the mesh containing ppt */
-      list[0] = MMG2_findTria(mesh,k);
+      list[0] = _MMG2_locatePoint(mesh,k,kdep,grid);
 
-      /* Exhaustive search if not found */
       if ( !list[0] ) {
-        if ( mesh->info.ddebug )
-          printf(" ** exhaustive search of point location.\n");
-
-        for(kk=1; kk<=mesh->nt; kk++) {
-          list[0] = MMG2_isInTriangle(mesh,kk,&ppt->c[0]);
-          if ( list[0] ) break;
-        }
-
-        if ( kk>mesh->nt ) {
-          if ( !mmgWarn0 ) {
-            mmgWarn0 = 1;
-            fprintf(stderr,"\n  ## Error: %s: unable to find triangle"
-                    " for at least vertex %8d.\n",__func__,k);
-          }
-          return 0;
+        if ( !mmgWarn0 ) {
+          mmgWarn0 = 1;
+          fprintf(stderr,"\n  ## Error: %s: unable to find triangle"
+                  " for at least vertex %8d.\n",__func__,k);
         }
+        return 0;
       }
       if(!_MMG2_splitbar(mesh,list[0],k)) {
         if ( !mmgWarn2 ) {
@@ -284,6 +379,7 @@ int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
         }
       } else {
         ns++;
+        kdep = list[0];
       }
     }
     if ( abs(nus-ns) ) {
@@ -295,6 +391,68 @@ int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
 	return(1);
 }
 
+/**
+ * \param mesh pointer toward the mesh structure
+ * \param sol pointer toward the solution structure
+ * \return  0 if fail.
+ *
+ * Insertion of the list of points inside the mesh
+ * (Vertices mesh->np - 3, 2, 1, 0 are the vertices of the BB and have already been inserted)
+ *
+ * The points are inserted in a biased randomized order (rounds of
+ * increasing size, each one sorted along a Hilbert curve) and each point is
+ * located from the triangle created by the previous insertion, which keeps
+ * the point location walks short.
+ *
+ */
+int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
+  MMG5_pPoint ppt;
+  _MMG2_Grid  grid;
+  double      max[2],dd;
+  int         *perm,nperm,np,k,ier;
+
+  np = mesh->np-4;
+  if ( np <= 0 )  return(1);
+
+  /* Insertion order */
+  _MMG5_ADD_MEM(mesh,np*sizeof(int),"insertion order",return(0));
+  _MMG5_SAFE_MALLOC(perm,np,int,0);
+
+  nperm = _MMG5_sfcSort2d(mesh,np,1,perm);
+  if ( nperm < 0 ) {
+    for (k=0; k<np; k++)  perm[k] = k+1;
+    nperm = np;
+  }
+
+  /* Grid of triangle hints (about 4 points per cell) */
+  grid.min[0] = grid.min[1] =  DBL_MAX;
+  max[0]      = max[1]      = -DBL_MAX;
+  for (k=1; k<=np; k++) {
+    ppt = &mesh->point[k];
+    grid.min[0] = MG_MIN(grid.min[0],ppt->c[0]);
+    grid.min[1] = MG_MIN(grid.min[1],ppt->c[1]);
+    max[0]      = MG_MAX(max[0],ppt->c[0]);
+    max[1]      = MG_MAX(max[1],ppt->c[1]);
+  }
+  grid.n    = MG_MAX(1,(int)sqrt(0.25*np));
+  dd        = MG_MAX(max[0]-grid.min[0],max[1]-grid.min[1]);
+  grid.step = dd > 0. ? grid.n / dd : 0.;
+
+  grid.cell = NULL;
+  _MMG5_ADD_MEM(mesh,grid.n*grid.n*sizeof(int),"point location grid",
+                grid.n = 0);
+  if ( grid.n )
+    _MMG5_SAFE_CALLOC(grid.cell,grid.n*grid.n,int,0);
+
+  ier = _MMG2_insertpoints(mesh,sol,perm,nperm,&grid);
+
+  if ( grid.cell )
+    _MMG5_DEL_MEM(mesh,grid.cell,grid.n*grid.n*sizeof(int));
+  _MMG5_DEL_MEM(mesh,perm,np*sizeof(int));
+
+  return(ier);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  *
@@ -247,7 +247,7 @@ int _MMG2_spllag(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met,int itdeg,int *war
   double          hma2,lmax,len;
   int             k,ns,ip,ip1,ip2;
   char            i,i1,i2,imax,ier;
-  static char     mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char     mmgWarn0=0;
 
   *warn = 0;
   ns    = 0;
@@ -0,0 +1,41 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mmg2d/mmg2dexterns.c
+ * \brief Definition of the mmg2d function pointers.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * The pointers are thread-local and are set by \ref MMG2D_setfunc at the
+ * beginning of each library call.
+ **/
+
+#include "mmg2d.h"
+
+MMG5_THREAD_LOCAL double (*MMG2D_lencurv)(MMG5_pMesh ,MMG5_pSol ,int ,int );
+MMG5_THREAD_LOCAL double (*MMG2D_caltri)(MMG5_pMesh ,MMG5_pSol ,MMG5_pTria );
+MMG5_THREAD_LOCAL int    (*MMG2_optlen)(MMG5_pMesh ,MMG5_pSol ,double ,int );
+MMG5_THREAD_LOCAL int    (*MMG2D_intmet)(MMG5_pMesh ,MMG5_pSol ,int ,char ,int ,double );
+MMG5_THREAD_LOCAL int    (*MMG2D_gradsiz)(MMG5_pMesh ,MMG5_pSol );
+MMG5_THREAD_LOCAL int    (*MMG2D_defsiz)(MMG5_pMesh ,MMG5_pSol );
@@ -55,7 +55,7 @@ int _MMG2_movedgpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list, char impro
   double             step,ll1,ll2,o[2],no[2],calold,calnew;
   int                k,iel,ip0,ip1,ip2,it1,it2;
   char               i,i1,i2;
-  static char        mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREAD_LOCAL char        mmgWarn0=0,mmgWarn1=0;
     
   pt0 = &mesh->tria[0];
   step = 0.1;
@@ -216,6 +216,8 @@ int _MMG2_movintpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char improv
   int               k,iel;
   char              i,i1,i2;
   
+  _MMG5_STAT_START(t0);
+
   ppt0 = &mesh->point[0];
   pt0  = &mesh->tria[0];
   
@@ -248,7 +250,7 @@ int _MMG2_movintpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char improv
     calold = MG_MIN(_MMG2_caltri_iso(mesh,NULL,pt),calold);
   }
   
-  if ( volbal < _MMG5_EPSD ) return(0);
+  if ( volbal < _MMG5_EPSD ) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   volbal = 1.0 / volbal;
   b[0] *= volbal;
   b[1] *= volbal;
@@ -267,10 +269,10 @@ int _MMG2_movintpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char improv
     calnew = MG_MIN(_MMG2_caltri_iso(mesh,NULL,pt0),calnew);
   }
     
-  if (calold < _MMG2_NULKAL && calnew <= calold) return(0);
-  else if (calnew < _MMG2_NULKAL) return(0);
-  else if ( improve && calnew < 1.02 * calold ) return(0);
-  else if ( calnew < 0.3 * calold ) return(0);
+  if (calold < _MMG2_NULKAL && calnew <= calold) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+  else if (calnew < _MMG2_NULKAL) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+  else if ( improve && calnew < 1.02 * calold ) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+  else if ( calnew < 0.3 * calold ) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   
   /* Update of the coordinates of the point */
   pt = &mesh->tria[list[0]/3];
@@ -279,5 +281,5 @@ int _MMG2_movintpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char improv
   p0->c[0] = b[0];
   p0->c[1] = b[1];
   
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,1);
 }
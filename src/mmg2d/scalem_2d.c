@@ -53,7 +53,7 @@ int MMG2_scaleMesh(MMG5_pMesh mesh,MMG5_pSol sol) {
   double         lambda[2],v[2][2];
   int            i,k,iadr;
   char           sethmin,sethmax;
-  static char    mmgWarn0=0, mmgWarn1=0;
+  static MMG5_THREAD_LOCAL char    mmgWarn0=0, mmgWarn1=0;
 
   // pd  = mesh->disp;
   /* compute bounding box */
@@ -33,7 +33,6 @@
 
 #include "mmg2d.h"
 
-extern unsigned char ddb;
 
 /**
  * \param mesh pointer toward the mesh
@@ -235,6 +234,8 @@ int _MMG2_split1b(MMG5_pMesh mesh,int k,char i,int ip) {
   int                *adja,iel,jel,kel,mel;
   char               i1,i2,m,j,j1,j2;
 
+  _MMG5_STAT_START(t0);
+
   iel = _MMG2D_newElt(mesh);
   if ( !iel ) {
     _MMG2D_TRIA_REALLOC(mesh,iel,mesh->gap,
@@ -317,7 +318,7 @@ int _MMG2_split1b(MMG5_pMesh mesh,int k,char i,int ip) {
     mesh->adja[3*(kel-1)+1+j] = 3*iel+i;
   }
 
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperSplit,t0,1);
 }
 
 /**
@@ -221,8 +221,10 @@ int _MMG2_swapar(MMG5_pMesh mesh,int k,char i) {
   int     *adja,adj,k11,k21;
   char     i1,i2,j,jj,j2,v11,v21;
   
+  _MMG5_STAT_START(t0);
+
   pt   = &mesh->tria[k];
-  if ( MG_EDG(pt->tag[i]) || MG_SIN(pt->tag[i]) )  return(0);
+  if ( MG_EDG(pt->tag[i]) || MG_SIN(pt->tag[i]) )  _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,0);
   
   adja = &mesh->adja[3*(k-1)+1];
   assert(adja[i]);
@@ -268,7 +270,7 @@ int _MMG2_swapar(MMG5_pMesh mesh,int k,char i) {
     mesh->adja[3*(k11-1)+1+v11] = 3*adj+j;
   mesh->adja[3*(adj-1)+1+j]   = 3*k11+v11;
   
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,1);
 }
 
 
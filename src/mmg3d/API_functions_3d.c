@@ -98,6 +98,28 @@ void MMG3D_Init_parameters(MMG5_pMesh mesh) {
 #else
   mesh->info.renum    = 0;   /* [0]    , Turn on/off the renumbering using SCOTCH; */
 #endif
+  /* MMG3D_IPARAM_sortadja = 0 */
+  mesh->info.sortadja =  0;  /* [0/1/2]  ,hash/sort if multithreaded/sort the faces to build the adjacency */
+  /* MMG3D_IPARAM_renumit = 0 */
+  mesh->info.renumit  =  0;  /* [n]      ,renumbering frequency in the remeshing loop */
+  /* MMG3D_IPARAM_batchins = 0 */
+  mesh->info.batchins =  0;  /* [0/1]    ,point by point/batched Delaunay insertion */
+  /* MMG3D_IPARAM_colmove = 0 */
+  mesh->info.colmove  =  0;  /* [0/1]    ,move the internal points by colors */
+  /* MMG3D_IPARAM_parswap = 0 */
+  mesh->info.parswap  =  0;  /* [0/1]    ,swap the internal edges by independent sets */
+  /* MMG3D_IPARAM_nthreads = 0 */
+  mesh->info.nthreads =  0;  /* [n]      ,number of threads (0: OpenMP default) */
+  /* MMG3D_IPARAM_npart = 0 */
+  mesh->info.npart    =  0;  /* [n]      ,number of partitions (0: no partitioning) */
+  /* MMG3D_IPARAM_actset = 0 */
+  mesh->info.actset   =  0;  /* [0/1]    ,sweep all the elements/the active set */
+  /* MMG3D_IPARAM_warmstart = 0 */
+  mesh->info.warmstart=  0;  /* [0/1]    ,analyse the mesh at each call/reuse the previous analysis */
+  /* MMG3D_IPARAM_keepsrc = 0 */
+  mesh->info.keepsrc  =  0;  /* [0/1]    ,free/keep a copy of the input mesh */
+  /* MMG3D_IPARAM_metcache = 0 */
+  mesh->info.metcache =  0;  /* [0/1]    ,cache the factorisations of the metric at the vertices */
 
   /* default values for doubles */
   mesh->info.ls       = 0.0;      /* level set value */
@@ -169,6 +191,9 @@ int MMG3D_Set_meshSize(MMG5_pMesh mesh, int np, int ne, int nprism,
     fprintf(stderr,"  ** WARNING:\n");
     fprintf(stderr,"     Your mesh don't contains tetrahedra.\n");
   }
+  /* the analysis of a previous mesh can't be reused */
+  mesh->warm = 0;
+
   if ( mesh->point )
     _MMG5_DEL_MEM(mesh,mesh->point,(mesh->npmax+1)*sizeof(MMG5_Point));
   if ( mesh->tetra )
@@ -181,6 +206,10 @@ int MMG3D_Set_meshSize(MMG5_pMesh mesh, int np, int ne, int nprism,
     _MMG5_DEL_MEM(mesh,mesh->quadra,(mesh->nquad+1)*sizeof(MMG5_Quad));
   if ( mesh->edge )
     _MMG5_DEL_MEM(mesh,mesh->edge,(mesh->na+1)*sizeof(MMG5_Edge));
+  if ( mesh->field ) {
+    _MMG5_DEL_MEM(mesh,mesh->field,(mesh->fsize*(mesh->npmax+1))*sizeof(double));
+    mesh->nfield = mesh->fsize = 0;
+  }
 
   mesh->np  = np;
   mesh->ne  = ne;
@@ -339,6 +368,8 @@ int MMG3D_Set_vertex(MMG5_pMesh mesh, double c0, double c1, double c2, int ref,
     return(0);
   }
 
+  mesh->warm = 0;
+
   mesh->point[pos].c[0] = c0;
   mesh->point[pos].c[1] = c1;
   mesh->point[pos].c[2] = c2;
@@ -402,6 +433,8 @@ int  MMG3D_Set_vertices(MMG5_pMesh mesh, double *vertices,int *refs) {
   MMG5_pPoint ppt;
   int i,j;
 
+  mesh->warm = 0;
+
   /*coordinates vertices*/
   for (i=1;i<=mesh->np;i++)
   {
@@ -490,6 +523,8 @@ int MMG3D_Set_tetrahedron(MMG5_pMesh mesh, int v0, int v1, int v2, int v3, int r
     return(0);
   }
 
+  mesh->warm = 0;
+
   pt = &mesh->tetra[pos];
   pt->v[0] = v0;
   pt->v[1] = v1;
@@ -579,6 +614,8 @@ int  MMG3D_Set_tetrahedra(MMG5_pMesh mesh, int *tetra, int *refs) {
   double     vol;
   int        i,ip,aux, j;
 
+  mesh->warm = 0;
+
   mesh->xp = 0;
   for (i=1;i<=mesh->ne;i++)
   {
@@ -674,6 +711,8 @@ int MMG3D_Set_prism(MMG5_pMesh mesh, int v0, int v1, int v2,
     return(0);
   }
 
+  mesh->warm = 0;
+
   pp = &mesh->prism[pos];
   pp->v[0] = v0;
   pp->v[1] = v1;
@@ -696,7 +735,7 @@ int MMG3D_Set_prism(MMG5_pMesh mesh, int v0, int v1, int v2,
 
 int MMG3D_Get_prism(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
                     int* v4, int* v5, int* ref, int* isRequired) {
-  static int npri = 0;
+  static MMG5_THREAD_LOCAL int npri = 0;
 
   if ( npri == mesh->nprism ) {
     npri = 0;
@@ -744,6 +783,8 @@ int  MMG3D_Set_prisms(MMG5_pMesh mesh, int *prisms, int *refs) {
   MMG5_pPrism pp;
   int         i,j;
 
+  mesh->warm = 0;
+
   for (i=1;i<=mesh->nprism;i++)
   {
     j = (i-1)*6;
@@ -825,6 +866,8 @@ int MMG3D_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref,int pos)
     return(0);
   }
 
+  mesh->warm = 0;
+
   mesh->tria[pos].v[0] = v0;
   mesh->tria[pos].v[1] = v1;
   mesh->tria[pos].v[2] = v2;
@@ -880,6 +923,8 @@ int  MMG3D_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs) {
   MMG5_pTria ptt;
   int         i, j;
 
+  mesh->warm = 0;
+
   for (i=1;i<=mesh->nt;i++)
   {
     j = (i-1)*3;
@@ -937,6 +982,8 @@ int MMG3D_Set_quadrilateral(MMG5_pMesh mesh, int v0, int v1, int v2, int v3,
     return(0);
   }
 
+  mesh->warm = 0;
+
   mesh->quadra[pos].v[0] = v0;
   mesh->quadra[pos].v[1] = v1;
   mesh->quadra[pos].v[2] = v2;
@@ -949,7 +996,7 @@ int MMG3D_Set_quadrilateral(MMG5_pMesh mesh, int v0, int v1, int v2, int v3,
 int MMG3D_Get_quadrilateral(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
                        int* ref,int* isRequired) {
   MMG5_pQuad  pq;
-  static int nqi = 0;
+  static MMG5_THREAD_LOCAL int nqi = 0;
 
   if ( nqi == mesh->nquad ) {
     nqi = 0;
@@ -995,6 +1042,8 @@ int  MMG3D_Set_quadrilaterals(MMG5_pMesh mesh, int *quads, int *refs) {
   MMG5_pQuad  pq;
   int         i, j;
 
+  mesh->warm = 0;
+
   for (i=1;i<=mesh->nquad;i++)
   {
     j = (i-1)*4;
@@ -1059,6 +1108,8 @@ int MMG3D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
     return(0);
   }
 
+  mesh->warm = 0;
+
   mesh->edge[pos].a = v0;
   mesh->edge[pos].b = v1;
   mesh->edge[pos].ref  = ref;
@@ -1115,18 +1166,21 @@ int MMG3D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
 
 int MMG3D_Set_corner(MMG5_pMesh mesh, int k) {
   assert ( k <= mesh->np );
+  mesh->warm = 0;
   mesh->point[k].tag |= MG_CRN;
   return(1);
 }
 
 int MMG3D_Set_requiredVertex(MMG5_pMesh mesh, int k) {
   assert ( k <= mesh->np );
+  mesh->warm = 0;
   mesh->point[k].tag |= MG_REQ;
   return(1);
 }
 
 int MMG3D_Set_requiredTetrahedron(MMG5_pMesh mesh, int k) {
   assert ( k <= mesh->ne );
+  mesh->warm = 0;
   mesh->tetra[k].tag |= MG_REQ;
   return(1);
 }
@@ -1134,6 +1188,7 @@ int MMG3D_Set_requiredTetrahedron(MMG5_pMesh mesh, int k) {
 int MMG3D_Set_requiredTetrahedra(MMG5_pMesh mesh, int *reqIdx, int nreq) {
   int k;
 
+  mesh->warm = 0;
   for ( k=0; k<nreq; ++k ){
     mesh->tetra[reqIdx[k]].tag |= MG_REQ;
   }
@@ -1143,6 +1198,7 @@ int MMG3D_Set_requiredTetrahedra(MMG5_pMesh mesh, int *reqIdx, int nreq) {
 
 int MMG3D_Set_requiredTriangle(MMG5_pMesh mesh, int k) {
   assert ( k <= mesh->nt );
+  mesh->warm = 0;
   mesh->tria[k].tag[0] |= MG_REQ;
   mesh->tria[k].tag[1] |= MG_REQ;
   mesh->tria[k].tag[2] |= MG_REQ;
@@ -1152,6 +1208,7 @@ int MMG3D_Set_requiredTriangle(MMG5_pMesh mesh, int k) {
 int MMG3D_Set_requiredTriangles(MMG5_pMesh mesh, int* reqIdx, int nreq) {
   int k;
 
+  mesh->warm = 0;
   for ( k=0; k<nreq; ++k ){
     mesh->tria[reqIdx[k]].tag[0] |= MG_REQ;
     mesh->tria[reqIdx[k]].tag[1] |= MG_REQ;
@@ -1162,6 +1219,7 @@ int MMG3D_Set_requiredTriangles(MMG5_pMesh mesh, int* reqIdx, int nreq) {
 
 int MMG3D_Set_parallelTriangle(MMG5_pMesh mesh, int k) {
   assert ( k <= mesh->nt );
+  mesh->warm = 0;
   mesh->tria[k].tag[0] |= MG_PARBDY;
   mesh->tria[k].tag[1] |= MG_PARBDY;
   mesh->tria[k].tag[2] |= MG_PARBDY;
@@ -1171,6 +1229,7 @@ int MMG3D_Set_parallelTriangle(MMG5_pMesh mesh, int k) {
 int MMG3D_Set_parallelTriangles(MMG5_pMesh mesh, int* parIdx, int npar) {
   int k;
 
+  mesh->warm = 0;
   for ( k=0; k<npar; ++k ){
     mesh->tria[parIdx[k]].tag[0] |= MG_PARBDY;
     mesh->tria[parIdx[k]].tag[1] |= MG_PARBDY;
@@ -1181,12 +1240,14 @@ int MMG3D_Set_parallelTriangles(MMG5_pMesh mesh, int* parIdx, int npar) {
 
 int MMG3D_Set_ridge(MMG5_pMesh mesh, int k) {
   assert ( k <= mesh->na );
+  mesh->warm = 0;
   mesh->edge[k].tag |= MG_GEO;
   return(1);
 }
 
 int MMG3D_Set_requiredEdge(MMG5_pMesh mesh, int k) {
   assert ( k <= mesh->na );
+  mesh->warm = 0;
   mesh->edge[k].tag |= MG_REQ;
   return(1);
 }
@@ -1194,6 +1255,7 @@ int MMG3D_Set_requiredEdge(MMG5_pMesh mesh, int k) {
 int MMG3D_Set_normalAtVertex(MMG5_pMesh mesh, int k, double n0, double n1, double n2) {
 
   assert ( k <= mesh->np );
+  mesh->warm = 0;
   mesh->point[k].n[0] = n0;
   mesh->point[k].n[1] = n1;
   mesh->point[k].n[2] = n2;
@@ -1533,6 +1595,115 @@ int MMG3D_Get_tensorSols(MMG5_pSol met, double *sols) {
   return(1);
 }
 
+int MMG3D_Set_fieldsSize(MMG5_pMesh mesh, int nfields, int *typFields) {
+  int i,size;
+
+  if ( !mesh->npmax ) {
+    fprintf(stderr,"\n  ## Error: %s: You must set the mesh size with the",
+            __func__);
+    fprintf(stderr," MMG3D_Set_meshSize function before registering fields\n");
+    return(0);
+  }
+
+  size = 0;
+  for ( i=0; i<nfields; ++i ) {
+    if ( typFields[i] == MMG5_Scalar )
+      size += 1;
+    else if ( typFields[i] == MMG5_Vector )
+      size += 3;
+    else if ( typFields[i] == MMG5_Tensor )
+      size += 6;
+    else {
+      fprintf(stderr,"\n  ## Error: %s: type of field %d not yet implemented.\n",
+              __func__,i+1);
+      return(0);
+    }
+  }
+
+  if ( mesh->field ) {
+    if ( (mesh->info.imprim > 5) || mesh->info.ddebug )
+      fprintf(stderr,"\n  ## Warning: %s: old fields deletion.\n",__func__);
+    _MMG5_DEL_MEM(mesh,mesh->field,(mesh->fsize*(mesh->npmax+1))*sizeof(double));
+  }
+  mesh->nfield = nfields;
+  mesh->fsize  = size;
+  if ( !size )  return(1);
+
+  _MMG5_ADD_MEM(mesh,(size*(mesh->npmax+1))*sizeof(double),"user fields",
+                mesh->nfield = mesh->fsize = 0;
+                return 0);
+  _MMG5_SAFE_CALLOC(mesh->field,(size*(mesh->npmax+1)),double,0);
+
+  return(1);
+}
+
+int MMG3D_Set_fieldsAtVertex(MMG5_pMesh mesh, double *f, int pos) {
+
+  if ( !mesh->field ) {
+    fprintf(stderr,"\n  ## Error: %s: You must register the fields with the",
+            __func__);
+    fprintf(stderr," MMG3D_Set_fieldsSize function before setting values\n");
+    return(0);
+  }
+  if ( pos < 1 || pos > mesh->np ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to set the fields at vertex %d.\n",
+            __func__,pos);
+    fprintf(stderr,"    Number of vertices: %d\n",mesh->np);
+    return(0);
+  }
+
+  memcpy(&mesh->field[mesh->fsize*pos],f,mesh->fsize*sizeof(double));
+  return(1);
+}
+
+int MMG3D_Set_fields(MMG5_pMesh mesh, double *f) {
+
+  if ( !mesh->field ) {
+    fprintf(stderr,"\n  ## Error: %s: You must register the fields with the",
+            __func__);
+    fprintf(stderr," MMG3D_Set_fieldsSize function before setting values\n");
+    return(0);
+  }
+
+  memcpy(&mesh->field[mesh->fsize],f,mesh->fsize*mesh->np*sizeof(double));
+  return(1);
+}
+
+int MMG3D_Get_fieldsSize(MMG5_pMesh mesh, int *nfields, int *size) {
+
+  *nfields = mesh->nfield;
+  *size    = mesh->fsize;
+  return(1);
+}
+
+int MMG3D_Get_fieldsAtVertex(MMG5_pMesh mesh, double *f, int pos) {
+
+  if ( !mesh->field ) {
+    fprintf(stderr,"\n  ## Error: %s: no user fields.\n",__func__);
+    return(0);
+  }
+  if ( pos < 1 || pos > mesh->np ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to get the fields at vertex %d.\n",
+            __func__,pos);
+    fprintf(stderr,"    Number of vertices: %d\n",mesh->np);
+    return(0);
+  }
+
+  memcpy(f,&mesh->field[mesh->fsize*pos],mesh->fsize*sizeof(double));
+  return(1);
+}
+
+int MMG3D_Get_fields(MMG5_pMesh mesh, double *f) {
+
+  if ( !mesh->field ) {
+    fprintf(stderr,"\n  ## Error: %s: no user fields.\n",__func__);
+    return(0);
+  }
+
+  memcpy(f,&mesh->field[mesh->fsize],mesh->fsize*mesh->np*sizeof(double));
+  return(1);
+}
+
 void MMG3D_Set_handGivenMesh(MMG5_pMesh mesh) {
   int k, aux;
 
@@ -1699,6 +1870,7 @@ int MMG3D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam,int val){
     break;
   case MMG3D_IPARAM_angle :
     /* free table that may contains old ridges */
+    mesh->warm = 0;
     if ( mesh->htab.geom )
       _MMG5_DEL_MEM(mesh,mesh->htab.geom,(mesh->htab.max+1)*sizeof(MMG5_hgeom));
     if ( mesh->xpoint )
@@ -1719,6 +1891,7 @@ int MMG3D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam,int val){
     break;
   case MMG3D_IPARAM_opnbdy :
     mesh->info.opnbdy = val;
+    mesh->warm = 0;
     break;
   case MMG3D_IPARAM_iso :
     mesh->info.iso      = val;
@@ -1757,6 +1930,9 @@ int MMG3D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam,int val){
   case MMG3D_IPARAM_nosurf :
     mesh->info.nosurf   = val;
     break;
+  case MMG3D_IPARAM_sortadja :
+    mesh->info.sortadja = val;
+    break;
   case MMG3D_IPARAM_numberOfLocalParam :
     if ( mesh->info.par ) {
       _MMG5_DEL_MEM(mesh,mesh->info.par,mesh->info.npar*sizeof(MMG5_Par));
@@ -1781,11 +1957,64 @@ int MMG3D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam,int val){
     }
 
     break;
-#ifdef USE_SCOTCH
   case MMG3D_IPARAM_renum :
     mesh->info.renum    = val;
     break;
+  case MMG3D_IPARAM_renumit :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: the renumbering frequency must be"
+              " positive.\n",__func__);
+      return(0);
+    }
+    mesh->info.renumit  = val;
+    break;
+  case MMG3D_IPARAM_stats :
+    mesh->info.stats    = val;
+    break;
+  case MMG3D_IPARAM_batchins :
+    mesh->info.batchins = val;
+    break;
+  case MMG3D_IPARAM_colmove :
+    mesh->info.colmove = val;
+    break;
+  case MMG3D_IPARAM_parswap :
+    mesh->info.parswap = val;
+    break;
+  case MMG3D_IPARAM_nthreads :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: unexpected number of threads: %d.\n",
+              __func__,val);
+      return(0);
+    }
+#ifndef USE_OPENMP
+    if ( val > 1 )
+      fprintf(stderr,"\n  ## Warning: %s: library built without OpenMP:"
+              " the multithreaded kernels run on 1 thread.\n",__func__);
 #endif
+    mesh->info.nthreads = val;
+    break;
+  case MMG3D_IPARAM_actset :
+    mesh->info.actset = val;
+    break;
+  case MMG3D_IPARAM_warmstart :
+    mesh->info.warmstart = val;
+    if ( !val ) mesh->warm = 0;
+    break;
+  case MMG3D_IPARAM_keepsrc :
+    mesh->info.keepsrc = val;
+    if ( !val ) _MMG3D_freeSource(mesh);
+    break;
+  case MMG3D_IPARAM_metcache :
+    mesh->info.metcache = val;
+    break;
+  case MMG3D_IPARAM_npart :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: unexpected number of partitions: %d.\n",
+              __func__,val);
+      return(0);
+    }
+    mesh->info.npart = val;
+    break;
   case MMG3D_IPARAM_anisosize :
     if ( !MMG3D_Set_solSize(mesh,sol,MMG5_Vertex,0,MMG5_Tensor) )
       return 0;
@@ -1843,25 +2072,73 @@ int MMG3D_Get_iparameter(MMG5_pMesh mesh, int iparam) {
   case MMG3D_IPARAM_nosurf :
     return ( mesh->info.nosurf );
     break;
+  case MMG3D_IPARAM_sortadja :
+    return ( mesh->info.sortadja );
+    break;
   case MMG3D_IPARAM_numberOfLocalParam :
     return ( mesh->info.npar );
     break;
-#ifdef USE_SCOTCH
   case MMG3D_IPARAM_renum :
     return ( mesh->info.renum );
     break;
-#endif
+  case MMG3D_IPARAM_renumit :
+    return ( mesh->info.renumit );
+    break;
+  case MMG3D_IPARAM_stats :
+    return ( mesh->info.stats );
+    break;
+  case MMG3D_IPARAM_batchins :
+    return ( mesh->info.batchins );
+    break;
+  case MMG3D_IPARAM_colmove :
+    return ( mesh->info.colmove );
+    break;
+  case MMG3D_IPARAM_parswap :
+    return ( mesh->info.parswap );
+    break;
+  case MMG3D_IPARAM_nthreads :
+    return ( mesh->info.nthreads );
+    break;
+  case MMG3D_IPARAM_actset :
+    return ( mesh->info.actset );
+    break;
+  case MMG3D_IPARAM_warmstart :
+    return ( mesh->info.warmstart );
+    break;
+  case MMG3D_IPARAM_keepsrc :
+    return ( mesh->info.keepsrc );
+    break;
+  case MMG3D_IPARAM_metcache :
+    return ( mesh->info.metcache );
+    break;
+  case MMG3D_IPARAM_npart :
+    return ( mesh->info.npart );
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return 0;
   }
 }
 
+int MMG3D_Get_stats(MMG5_pMesh mesh, MMG5_pStats stats) {
+
+  memcpy(stats,&mesh->stats,sizeof(MMG5_Stats));
+  return(1);
+}
+
+int MMG3D_Set_interruptFunc(MMG5_pMesh mesh, MMG5_Interrupt func, void *data) {
+
+  mesh->interruptFunc = func;
+  mesh->interruptData = data;
+  return(1);
+}
+
 int MMG3D_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val){
 
   switch ( dparam ) {
     /* double parameters */
   case MMG3D_DPARAM_angleDetection :
+    mesh->warm = 0;
     mesh->info.dhd = val;
     mesh->info.dhd = MG_MAX(0.0, MG_MIN(180.0,mesh->info.dhd));
     mesh->info.dhd = cos(mesh->info.dhd*M_PI/180.0);
@@ -1894,6 +2171,13 @@ int MMG3D_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val)
   case MMG3D_DPARAM_ls :
     mesh->info.ls       = val;
     break;
+  case MMG3D_DPARAM_timeBudget :
+    if ( val < 0. ) {
+      fprintf(stderr,"\n  ## Error: %s: negative time budget.\n",__func__);
+      return(0);
+    }
+    mesh->info.tbudget  = val;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n", __func__);
     return(0);
@@ -652,6 +652,66 @@ FORTRAN_NAME(MMG3D_GET_TENSORSOLS,mmg3d_get_tensorsols,
   return;
 }
 
+/**
+ * See \ref MMG3D_Set_fieldsSize function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_SET_FIELDSSIZE,mmg3d_set_fieldssize,
+             (MMG5_pMesh *mesh, int *nfields, int *typFields, int* retval),
+             (mesh,nfields,typFields,retval)) {
+  *retval = MMG3D_Set_fieldsSize(*mesh,*nfields,typFields);
+  return;
+}
+
+/**
+ * See \ref MMG3D_Set_fieldsAtVertex function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_SET_FIELDSATVERTEX,mmg3d_set_fieldsatvertex,
+             (MMG5_pMesh *mesh, double *f, int *pos, int* retval),
+             (mesh,f,pos,retval)) {
+  *retval = MMG3D_Set_fieldsAtVertex(*mesh,f,*pos);
+  return;
+}
+
+/**
+ * See \ref MMG3D_Set_fields function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_SET_FIELDS,mmg3d_set_fields,
+             (MMG5_pMesh *mesh, double *f, int* retval),
+             (mesh,f,retval)) {
+  *retval = MMG3D_Set_fields(*mesh,f);
+  return;
+}
+
+/**
+ * See \ref MMG3D_Get_fieldsSize function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_GET_FIELDSSIZE,mmg3d_get_fieldssize,
+             (MMG5_pMesh *mesh, int *nfields, int *size, int* retval),
+             (mesh,nfields,size,retval)) {
+  *retval = MMG3D_Get_fieldsSize(*mesh,nfields,size);
+  return;
+}
+
+/**
+ * See \ref MMG3D_Get_fieldsAtVertex function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_GET_FIELDSATVERTEX,mmg3d_get_fieldsatvertex,
+             (MMG5_pMesh *mesh, double *f, int *pos, int* retval),
+             (mesh,f,pos,retval)) {
+  *retval = MMG3D_Get_fieldsAtVertex(*mesh,f,*pos);
+  return;
+}
+
+/**
+ * See \ref MMG3D_Get_fields function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_GET_FIELDS,mmg3d_get_fields,
+             (MMG5_pMesh *mesh, double *f, int* retval),
+             (mesh,f,retval)) {
+  *retval = MMG3D_Get_fields(*mesh,f);
+  return;
+}
+
 /**
  * See \ref MMG3D_Set_handGivenMesh function in \ref mmg3d/libmmg3d.h file.
  */
@@ -960,3 +1020,22 @@ FORTRAN_NAME(MMG3D_SAVEALLSOLS,mmg3d_saveallsols,
 
   return;
 }
+
+/**
+ * See \ref MMG3D_saveStats function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_SAVESTATS,mmg3d_savestats,
+             (MMG5_pMesh *mesh,char* filename, int *strlen,int* retval),
+             (mesh,filename,strlen, retval)){
+  char *tmp = NULL;
+
+  tmp = (char*)malloc((*strlen+1)*sizeof(char));
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = MMG3D_saveStats(*mesh,tmp);
+
+  _MMG5_SAFE_FREE(tmp);
+
+  return;
+}
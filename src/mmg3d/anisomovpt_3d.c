@@ -61,6 +61,8 @@ int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int
   double               vol,totvol,m[6];
   double               calold,calnew,*callist,det;
   int                  k,iel,i0;
+  _MMG5_STAT_START(t0);
+
   // Dynamic alloc for windows comptibility
   _MMG5_SAFE_MALLOC(callist, ilist, double,0);
 
@@ -90,14 +92,14 @@ int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int
       // _MMG5_moymet must succeed because we have at least 1 point of the tet
       // that is internal.
       _MMG5_SAFE_FREE(callist);
-      return(0);
+      _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
     }
 
     det = m[0] * ( m[3]*m[5] - m[4]*m[4]) - m[1] * ( m[1]*m[5] - m[2]*m[4])
       + m[2] * ( m[1]*m[4] - m[2]*m[3]);
     if ( det < _MMG5_EPSD2 ) {
       _MMG5_SAFE_FREE(callist);
-      return(0);
+      _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
     }
 
     vol *= sqrt(det);
@@ -111,7 +113,7 @@ int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int
   }
   if (totvol < _MMG5_EPSD2) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
 
   totvol = 1.0 / totvol;
@@ -130,42 +132,44 @@ int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int
     callist[k] = _MMG5_orcal(mesh,met,0);
     if (callist[k] < _MMG5_NULKAL) {
       _MMG5_SAFE_FREE(callist);
-      return(0);
+      _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
     }
     calnew = MG_MIN(calnew,callist[k]);
   }
   if (calold < _MMG5_EPSOK && calnew <= calold) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   else if (calnew < _MMG5_EPSOK) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   else if ( improve && calnew < 1.02* calold ) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   else if ( calnew < 0.3 * calold ) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
 
   /* update position */
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, pt->v[i0], ppt0->c, p0->c);
 
+  if ( mesh->field )  _MMG3D_movfield(mesh,list,ilist,ppt0->c);
+
   p0 = &mesh->point[pt->v[i0]];
   p0->c[0] = ppt0->c[0];
   p0->c[1] = ppt0->c[1];
   p0->c[2] = ppt0->c[2];
   for (k=0; k<ilist; k++) {
     (&mesh->tetra[list[k]/4])->qual=callist[k];
-    (&mesh->tetra[list[k]/4])->mark=mesh->mark;
+    _MMG3D_MARK(mesh,list[k]/4);
   }
 
   _MMG5_SAFE_FREE(callist);
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,1);
 }
 
 /**
@@ -202,7 +206,7 @@ int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   double            calold,calnew,caltmp,*callist;
   int               k,kel,iel,l,n0,na,nb,ntempa,ntempb,ntempc,nxp,ier;
   unsigned char     i0,iface,i;
-  static int        warn = 0;
+  static MMG5_THREAD_LOCAL int        warn = 0;
 
   // Dynamic alloc for windows comptibility
   _MMG5_SAFE_MALLOC(callist, ilistv, double,0);
@@ -651,6 +655,7 @@ int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, n0, o, p0->c);
 
+  if ( mesh->field )  _MMG3D_movfield(mesh,listv,ilistv,o);
   p0->c[0] = o[0];
   p0->c[1] = o[1];
   p0->c[2] = o[2];
@@ -663,7 +668,7 @@ int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
   for(l=0; l<ilistv; l++){
     (&mesh->tetra[listv[l]/4])->qual= callist[l];
-    (&mesh->tetra[listv[l]/4])->mark= mesh->mark;
+    _MMG3D_MARK(mesh,listv[l]/4);
   }
   _MMG5_SAFE_FREE(callist);
   return(1);
@@ -993,6 +998,7 @@ int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, ip0, o, p0->c);
 
+  if ( mesh->field )  _MMG3D_movfield(mesh,listv,ilistv,o);
   p0->c[0] = o[0];
   p0->c[1] = o[1];
   p0->c[2] = o[2];
@@ -1010,7 +1016,7 @@ int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
   for( l=0 ; l<ilistv ; l++ ){
     (&mesh->tetra[listv[l]/4])->qual = callist[l];
-    (&mesh->tetra[listv[l]/4])->mark = mesh->mark;
+    _MMG3D_MARK(mesh,listv[l]/4);
   }
   _MMG5_SAFE_FREE(callist);
   return(1);
@@ -1339,6 +1345,7 @@ int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, ip0, o, p0->c);
 
+  if ( mesh->field )  _MMG3D_movfield(mesh,listv,ilistv,o);
   p0->c[0] = o[0];
   p0->c[1] = o[1];
   p0->c[2] = o[2];
@@ -1356,7 +1363,7 @@ int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
 
   for(l=0; l<ilistv; l++){
     (&mesh->tetra[listv[l]/4])->qual = callist[l];
-    (&mesh->tetra[listv[l]/4])->mark = mesh->mark;
+    _MMG3D_MARK(mesh,listv[l]/4);
   }
   _MMG5_SAFE_FREE(callist);
   return(1);
@@ -1693,6 +1700,7 @@ int _MMG5_movbdyridpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, ip0, o, p0->c);
 
+  if ( mesh->field )  _MMG3D_movfield(mesh,listv,ilistv,o);
   p0->c[0] = o[0];
   p0->c[1] = o[1];
   p0->c[2] = o[2];
@@ -1714,7 +1722,7 @@ int _MMG5_movbdyridpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
   for(l=0; l<ilistv; l++){
     (&mesh->tetra[listv[l]/4])->qual = callist[l];
-    (&mesh->tetra[listv[l]/4])->mark = mesh->mark;
+    _MMG3D_MARK(mesh,listv[l]/4);
   }
   _MMG5_SAFE_FREE(callist);
   return(1);
@@ -71,7 +71,7 @@ inline int _MMG5_moymet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,double *m1)
   double       mm[6],*mp;
   double       dd;
   int          i,k,n;
-  static char  mmgWarn=0;
+  static MMG5_THREAD_LOCAL char  mmgWarn=0;
 
   n = 0;
   for (k=0; k<6; ++k) mm[k] = 0.;
@@ -123,7 +123,7 @@ static int _MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,int kel, int iface, int
   int                lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilist,ilists,ilistv;
   int                k,iel,idp,ifac,isloc,init_s;
   unsigned char      i,i0,i1,i2;
-  static char        mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char        mmgWarn = 0;
 
   pt  = &mesh->tetra[kel];
   idp = pt->v[ip];
@@ -339,7 +339,7 @@ static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int kel,
   double         r[3][3],lispoi[3*MMG3D_LMAX+1];
   double         detg,detd;
   int            i,i0,i1,i2,ifac,isloc;
-  static char    mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char    mmgWarn = 0;
 
   pt  = &mesh->tetra[kel];
   idp = pt->v[ip];
@@ -552,7 +552,7 @@ static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,int kel, int iface, int
   double        ux,uy,uz,det2d,c[3];
   double        tAA[6],tAb[3], hausd;
   unsigned char i1,i2,itri1,itri2,i;
-  static char   mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREAD_LOCAL char   mmgWarn0=0,mmgWarn1=0;
 
   ipref[0] = ipref[1] = 0;
   pt  = &mesh->tetra[kel];
@@ -829,7 +829,7 @@ static int _MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,int kel,int iface, int
   double         det2d,c[3],isqhmin,isqhmax;
   double         tAA[6],tAb[3],hausd;
   unsigned char  i1,i;
-  static char    mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char    mmgWarn = 0;
 
   pt  = &mesh->tetra[kel];
   idp = pt->v[ip];
@@ -1054,7 +1054,7 @@ int _MMG5_defmetvol(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPar     par;
   double        v[3][3],lambda[3],isqhmax,isqhmin,*m;
   int           list[MMG3D_LMAX+2],ilist,k,l,i,j,isloc,ip;
-  static char   mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char   mmgWarn = 0;
 
   isqhmin = 1./(mesh->info.hmin*mesh->info.hmin);
   isqhmax = 1./(mesh->info.hmax*mesh->info.hmax);
@@ -1335,7 +1335,7 @@ int _MMG3D_nosurfsiz_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel, int iploc,
   double        *m,isqhmin,isqhmax,ux,uy,uz,lm,lambda[3],v[3][3];
   int           lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilists,ilistv;
   int           i,iadr,i0,ip0,ip1,i1,ia,j;
-  static char   mmgWarn=0;
+  static MMG5_THREAD_LOCAL char   mmgWarn=0;
 
   pt    = &mesh->tetra[iel];
   ip0   = pt->v[iploc];
@@ -1489,7 +1489,7 @@ int _MMG3D_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   double        mm[6];
   int           k,l,iploc;
   char          i,ismet;
-  static char   mmgErr = 0;
+  static MMG5_THREAD_LOCAL char   mmgErr = 0;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** Defining anisotropic map\n");
@@ -1511,7 +1511,7 @@ int _MMG3D_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
     _MMG5_caltet         = _MMG5_caltet_ani;
     _MMG5_caltri         = _MMG5_caltri_ani;
     _MMG5_lenedg         = _MMG5_lenedg_ani;
-    MMG3D_lenedgCoor     = _MMG5_lenedgCoor_ani;
+    _MMG5_lenedgCoor     = _MMG5_lenedgCoor_ani;
     _MMG5_lenSurfEdg     = _MMG5_lenSurfEdg_ani;
   }
 
@@ -1602,7 +1602,7 @@ int _MMG5_grad2metVol(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ia) {
   double         lambda[3],vp[3][3],alpha,beta,mu[3];
   int            ip1,ip2,kmin,i;
   char           i1,i2,ichg;
-  static char    mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char    mmgWarn = 0;
 
   i1  = _MMG5_iare[ia][0];
   i2  = _MMG5_iare[ia][1];
@@ -1819,22 +1819,116 @@ int _MMG5_grad2metVol(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ia) {
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
- * \return 1
- *
+ * \param k index of the tetra.
+ * \param upd table of the updated points.
+ * \return the number of truncated metrics.
  *
- * Enforces mesh gradation by truncating metric field.
+ * Gradation along the surface edges of the tetra \a k.
  *
  */
-int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
+static int _MMG3D_gradtet_surf(MMG5_pMesh mesh,MMG5_pSol met,int k,int *upd) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
   MMG5_Tria     ptt;
   MMG5_pPoint   p0,p1;
-  double        *m,mv;
-  int           k,it,itv,nup,nu,nupv,maxit;
-  int           i,j,ip0,ip1;
+  int           i,j,ip0,ip1,nu;
   char          ier,i0,i1;
 
+  pt = &mesh->tetra[k];
+  if ( !MG_EOK(pt) || !pt->xt )  return(0);
+  pxt = &mesh->xtetra[pt->xt];
+
+  nu = 0;
+  for (i=0; i<4; i++) {
+    if ( !(pxt->ftag[i] & MG_BDY) )  continue;
+
+    /* Gradation along a surface edge */
+    /* virtual triangle */
+    _MMG5_tet2tri(mesh,k,i,&ptt);
+    for (j=0; j<3; j++) {
+      i0  = _MMG5_inxt2[j];
+      i1  = _MMG5_iprv2[j];
+      ip0 = ptt.v[i0];
+      ip1 = ptt.v[i1];
+      p0  = &mesh->point[ip0];
+      p1  = &mesh->point[ip1];
+      if ( (p0->flag < mesh->base-1) && (p1->flag < mesh->base-1) )
+        continue;
+      /* gradation along the tangent plane */
+      ier = _MMG5_grad2metSurf(mesh,met,&ptt,j);
+      if ( ier == i0 ) {
+        p0->flag = mesh->base;
+        upd[nu++] = ip0;
+      }
+      else if ( ier == i1 ) {
+        p1->flag = mesh->base;
+        upd[nu++] = ip1;
+      }
+    }
+  }
+  return(nu);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param k index of the tetra.
+ * \param upd table of the updated points.
+ * \return the number of truncated metrics.
+ *
+ * Gradation along the volume edges of the tetra \a k.
+ *
+ */
+static int _MMG3D_gradtet_vol(MMG5_pMesh mesh,MMG5_pSol met,int k,int *upd) {
+  MMG5_pTetra   pt;
+  MMG5_pPoint   p0,p1;
+  int           i,ip0,ip1,nu;
+  char          ier,i0,i1;
+
+  pt = &mesh->tetra[k];
+  if ( !MG_EOK(pt) )  return(0);
+
+  nu = 0;
+  for (i=0; i<4; i++) {
+    /* Gradation along a volume edge */
+    i0  = _MMG5_iare[i][0];
+    i1  = _MMG5_iare[i][1];
+    ip0 = pt->v[i0];
+    ip1 = pt->v[i1];
+    p0  = &mesh->point[ip0];
+    p1  = &mesh->point[ip1];
+    if ( p0->flag < mesh->base-1 && p1->flag < mesh->base-1 )  continue;
+
+    ier = _MMG5_grad2metVol(mesh,met,pt,i);
+    if ( ier == i0 ) {
+      p0->flag = mesh->base;
+      upd[nu++] = ip0;
+    }
+    else if ( ier == i1 ) {
+      p1->flag = mesh->base;
+      upd[nu++] = ip1;
+    }
+  }
+  return(nu);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \return 1
+ *
+ *
+ * Enforces mesh gradation by truncating metric field. The result of the
+ * anisotropic truncation depends on the order of the edge processing, so the
+ * sweeps over the tetra are replayed in the same order but each sweep only
+ * visits the tetra that contain a point updated since the previous one.
+ *
+ */
+int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
+  MMG5_pPoint   p1;
+  double        *m,mv;
+  int           k,it,itv,nup,nupv,*adr,*lst;
+
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** Anisotropic mesh gradation\n");
 
@@ -1857,88 +1951,28 @@ int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
     m[4] = mv;
   }
 
-  it = nup = 0;
-  maxit = 100;
-  do {
-    mesh->base++;
-    nu = 0;
-    for (k=1; k<=mesh->ne; k++) {
-      pt = &mesh->tetra[k];
-      if ( !MG_EOK(pt) )  continue;
-      pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
-
-      if ( pxt ) {
-        for (i=0; i<4; i++) {
-          if ( pxt->ftag[i] & MG_BDY) {
-            /* Gradation along a surface edge */
-            /* virtual triangle */
-            _MMG5_tet2tri(mesh,k,i,&ptt);
-            for (j=0; j<3; j++) {
-              i0  = _MMG5_inxt2[j];
-              i1  = _MMG5_iprv2[j];
-              ip0 = ptt.v[i0];
-              ip1 = ptt.v[i1];
-              p0  = &mesh->point[ip0];
-              p1  = &mesh->point[ip1];
-              if ( (p0->flag < mesh->base-1) && (p1->flag < mesh->base-1) )
-                continue;
-              /* gradation along the tangent plane */
-              ier = _MMG5_grad2metSurf(mesh,met,&ptt,j);
-              if ( ier == i0 ) {
-                p0->flag = mesh->base;
-                nu++;
-              }
-              else if ( ier == i1 ) {
-                p1->flag = mesh->base;
-                nu++;
-              }
-            }
-          }
+  /* Without memory for the point balls, perform the full sweeps */
+  if ( !_MMG3D_gradBall(mesh,0,&adr,&lst) )
+    adr = lst = NULL;
 
-          else continue;
-        }
-      }
-    }
-    nup += nu;
+  nup = _MMG3D_gradsizReplay(mesh,met,adr,lst,_MMG3D_gradtet_surf,100,&it);
+  if ( nup < 0 ) {
+    _MMG3D_delGradBall(mesh,&adr,&lst);
+    adr = lst = NULL;
+    nup = _MMG3D_gradsizReplay(mesh,met,NULL,NULL,_MMG3D_gradtet_surf,100,&it);
   }
-  while( ++it < maxit && nu > 0 );
 
   for (k=1; k<=mesh->np; k++)
     mesh->point[k].flag = mesh->base;
 
-  nupv = itv = 0;
-  maxit = 500;
-
-  do {
-    mesh->base++;
-    nu = 0;
-    for (k=1; k<=mesh->ne; k++) {
-      pt = &mesh->tetra[k];
-      if ( !MG_EOK(pt) )  continue;
-      for (i=0; i<4; i++) {
-        /* Gradation along a volume edge */
-        i0  = _MMG5_iare[i][0];
-        i1  = _MMG5_iare[i][1];
-        ip0 = pt->v[i0];
-        ip1 = pt->v[i1];
-        p0  = &mesh->point[ip0];
-        p1  = &mesh->point[ip1];
-        if ( p0->flag < mesh->base-1 && p1->flag < mesh->base-1 )  continue;
-
-        ier = _MMG5_grad2metVol(mesh,met,pt,i);
-        if ( ier == i0 ) {
-          p0->flag = mesh->base;
-          nu++;
-        }
-        else if ( ier == i1 ) {
-          p1->flag = mesh->base;
-          nu++;
-        }
-      }
-    }
-    nupv += nu;
+  nupv = _MMG3D_gradsizReplay(mesh,met,adr,lst,_MMG3D_gradtet_vol,500,&itv);
+  if ( nupv < 0 ) {
+    _MMG3D_delGradBall(mesh,&adr,&lst);
+    adr = lst = NULL;
+    nupv = _MMG3D_gradsizReplay(mesh,met,NULL,NULL,_MMG3D_gradtet_vol,500,&itv);
   }
-  while( ++itv < maxit && nu > 0 );
+  if ( adr )
+    _MMG3D_delGradBall(mesh,&adr,&lst);
 
   if ( abs(mesh->info.imprim) > 3 ) {
     if ( abs(mesh->info.imprim) < 5 && !mesh->info.ddebug ) {
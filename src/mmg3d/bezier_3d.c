@@ -34,7 +34,6 @@
 
 #include "mmg3d.h"
 
-extern char ddb;
 
 /**
  * \param c1 coordinates of the first point of the curve.
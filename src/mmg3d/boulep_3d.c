@@ -35,7 +35,6 @@
 
 #include "mmg3d.h"
 
-extern MMG5_Info  info;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -51,11 +50,31 @@ extern MMG5_Info  info;
  *
  */
 int _MMG5_boulevolp (MMG5_pMesh mesh, int start, int ip, int * list){
+
+  return(_MMG3D_boulevolpBase(mesh,start,ip,list,++mesh->base));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param start index of the starting tetrahedra.
+ * \param ip local index of the point in the tetrahedra \a start.
+ * \param list pointer toward the list of the tetra in the volumic ball of
+ * \a ip.
+ * \param base value used to flag the tetra of the ball.
+ * \return 0 if fail and the number of the tetra in the ball otherwise.
+ *
+ * Fill the volumic ball of point \a ip in tetra \a start (see
+ * \ref _MMG5_boulevolp) using the flag \a base given by the caller. Only
+ * the tetra of the ball are read and flagged, so the balls of points that
+ * don't share any tetra may be computed concurrently with the same \a base.
+ *
+ */
+int _MMG3D_boulevolpBase(MMG5_pMesh mesh, int start, int ip, int * list,
+                         int base){
   MMG5_pTetra  pt,pt1;
-  int    *adja,nump,ilist,base,cur,k,k1;
+  int    *adja,nump,ilist,cur,k,k1;
   char    j,l,i;
 
-  base = ++mesh->base;
   pt   = &mesh->tetra[start];
   nump = pt->v[ip];
 
@@ -432,7 +451,7 @@ int _MMG5_boulesurfvolp(MMG5_pMesh mesh,int start,int ip,int iface,
   MMG5_pxTetra pxt;
   int  base,nump,k,k1,*adja,piv,na,nb,adj,cur,nvstart,fstart,aux;
   char iopp,ipiv,i,j,l,ipa,ipb,isface;
-  static char mmgErr0=0, mmgErr1=0;
+  static MMG5_THREAD_LOCAL char mmgErr0=0, mmgErr1=0;
 
   if ( isnm ) assert(!mesh->adja[4*(start-1)+iface+1]);
 
@@ -599,7 +618,7 @@ int _MMG5_bouletrid(MMG5_pMesh mesh,int start,int iface,int ip,int *il1,int *l1,
   int                  idp,na, nb, base, iopp, ipiv, piv, fstart, nvstart, adj;
   int                  i,ifac,idx,idx2,idx_tmp,i1,ipa,ipb, isface;
   double               *n1,*n2,nt[3],ps1,ps2;
-  static char          mmgErr0=0;
+  static MMG5_THREAD_LOCAL char          mmgErr0=0;
 
   pt = &mesh->tetra[start];
   if ( !MG_EOK(pt) )  return(0);
@@ -1090,7 +1109,7 @@ int _MMG5_coquil(MMG5_pMesh mesh,int start,int ia,int * list) {
   MMG5_pTetra pt;
   int         ilist,*adja,piv,adj,na,nb,ipa,ipb;
   char        i;
-  static char mmgErr0=0;
+  static MMG5_THREAD_LOCAL char mmgErr0=0;
 
   assert ( start >= 1 );
   pt = &mesh->tetra[start];
@@ -1294,7 +1313,7 @@ int _MMG5_srcbdy(MMG5_pMesh mesh,int start,int ia) {
   MMG5_pPoint ppt;
   MMG5_pTetra pt;
   int         np, ne, k, kel1, kel2;
-  static char mmgErr0;
+  static MMG5_THREAD_LOCAL char mmgErr0;
 
   if ( mmgErr0 ) return;
 
@@ -1376,7 +1395,7 @@ int _MMG3D_coquilFaceFirstLoop(MMG5_pMesh mesh,int start,int na,int nb,char ifac
   MMG5_pxTetra  pxt;
   int           *adja;
   int           pradj,pri,ier,ifar_idx,i;
-  static char   mmgErr0 = 0;
+  static MMG5_THREAD_LOCAL char   mmgErr0 = 0;
 
   pt = &mesh->tetra[start];
 
@@ -1513,7 +1532,7 @@ int _MMG5_coquilface(MMG5_pMesh mesh,int start,char iface,int ia,int *list,
   MMG5_pTetra   pt;
   int           piv,adj,na,nb,ilist,pradj,i,ier,nbdy;
   char          hasadja;
-  static char   mmgErr0=0,mmgErr1=0,mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char   mmgErr0=0,mmgErr1=0,mmgWarn0=0;
 
   pt = &mesh->tetra[start];
 
@@ -38,7 +38,6 @@
 #define  _MMG5_EPSLOC   1.00005
 #define  IEDG(a,b) (((a) > 0) && ((b) > 0)) ? ((a)+(b)) : (((a)+(b))-(1))
 
-extern char ddb;
 
 /**
  *
@@ -114,7 +113,7 @@ int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
   int            *adja,*adja1,adj,adj1,k,i,iadr;
   int            iel,a0,a1,a2,b0,b1,b2;
   unsigned char  voy,voy1;
-  static char    mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0,mmgErr5=0;
+  static MMG5_THREAD_LOCAL char    mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0,mmgErr5=0;
 
   for (k=1; k<=mesh->ne; k++) {
     pt1 = &mesh->tetra[k];
@@ -304,7 +303,7 @@ int _MMG5_chkptonbdy(MMG5_pMesh mesh,int np){
   MMG5_pPoint      p0;
   int              k;
   char             i,j,ip;
-  static char      mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREAD_LOCAL char      mmgWarn0=0,mmgWarn1=0;
 
   for(k=1;k<=mesh->np;k++)
     mesh->point[k].flag = 0;
@@ -365,7 +364,7 @@ int _MMG5_cntbdypt(MMG5_pMesh mesh, int nump){
   MMG5_pxTetra pxt;
   int          k,nf,v0,v1,v2;
   char         i,j,ip;
-  static char  mmgWarn0 = 0;
+  static MMG5_THREAD_LOCAL char  mmgWarn0 = 0;
 
   nf = 0;
 
@@ -485,7 +484,7 @@ int srcface(MMG5_pMesh mesh,int n0,int n1,int n2) {
   int          k,ip0,ip1,ip2,minn,maxn,sn,mins,maxs,sum,ref;
   int16_t      tag;
   char         i;
-  static char  mmgWarn0 = 0;
+  static MMG5_THREAD_LOCAL char  mmgWarn0 = 0;
 
   minn = MG_MIN(n0,MG_MIN(n1,n2));
   maxn = MG_MAX(n0,MG_MAX(n1,n2));
@@ -35,7 +35,6 @@
 
 #include "inlined_functions_3d.h"
 
-extern char  ddb;
 
 /** Check whether collapse ip -> iq could be performed, ip internal ;
  *  'mechanical' tests (positive jacobian) are not performed here */
@@ -714,10 +713,12 @@ int _MMG5_colver(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist,char indq,cha
     { { 0, 2}, { 0, 4}, {-1,-1}, { 2, 4} },
     { { 0, 1}, { 0, 3}, { 1, 3}, {-1,-1} } };
 
+  _MMG5_STAT_START(t0);
+
   // Dynamic allocations for windows compatibility
   if (!(ind = malloc(ilist * sizeof(unsigned char[2])))) {
     perror("  ## Memory problem: malloc");
-    return 0;
+    _MMG5_STAT_RETURN(mesh,MMG5_OperCollapse,t0,0);
   }
   _MMG5_SAFE_CALLOC(p0_c, ilist, int,-1);
   _MMG5_SAFE_CALLOC(p1_c, ilist, int,-1);
@@ -809,7 +810,7 @@ int _MMG5_colver(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist,char indq,cha
     pt = &mesh->tetra[jel];
     if (pt->v[voy] == nq) {
       _MMG5_SAFE_FREE(ind); _MMG5_SAFE_FREE(p0_c); _MMG5_SAFE_FREE(p1_c);
-      return(0);
+      _MMG5_STAT_RETURN(mesh,MMG5_OperCollapse,t0,0);
     }
   }
 
@@ -1150,7 +1151,7 @@ int _MMG5_colver(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist,char indq,cha
     }
     if ( !_MMG3D_delElt(mesh,iel) ) {
       _MMG5_SAFE_FREE(ind); _MMG5_SAFE_FREE(p0_c); _MMG5_SAFE_FREE(p1_c);
-      return -1;
+      _MMG5_STAT_RETURN(mesh,MMG5_OperCollapse,t0,-1);
     }
   }
 
@@ -1165,9 +1166,9 @@ int _MMG5_colver(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist,char indq,cha
       pt->qual=_MMG5_caltet33_ani(mesh,met,pt);
     else
       pt->qual=_MMG5_orcal(mesh,met,iel);
-    pt->mark=mesh->mark;
+    _MMG3D_MARK(mesh,iel);
   }
 
   _MMG5_SAFE_FREE(ind); _MMG5_SAFE_FREE(p0_c); _MMG5_SAFE_FREE(p1_c);
-  return(np);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperCollapse,t0,np);
 }
@@ -51,7 +51,8 @@
 #define _MMG3D_KTB    11
 #define _MMG3D_KTC    13
 
-/* hash mesh edge v[0],v[1] (face i of iel) */
+/* hash mesh edge v[0],v[1] (face i of iel). The items of the table belong to
+ * the mesh arena: the arena follows their reallocation. */
 int _MMG5_hashEdgeDelone(MMG5_pMesh mesh,_MMG5_Hash *hash,int iel,int i,int *v) {
   int             *adja,iadr,jel,j,key,mins,maxs;
   _MMG5_hedge     *ha;
@@ -100,18 +101,23 @@ int _MMG5_hashEdgeDelone(MMG5_pMesh mesh,_MMG5_Hash *hash,int iel,int i,int *v)
         }
       }
     }
+    /* no edge is removed from the table: the free items are taken in order */
     ha->nxt   = hash->nxt;
     ha        = &hash->item[hash->nxt];
     ha->a     = mins;
     ha->b     = maxs;
     ha->k     = iel*4 + i;
-    hash->nxt = ha->nxt;
     ha->nxt   = 0;
+    ++hash->nxt;
 
     if ( hash->nxt >= hash->max ) {
+      /* the items are detached from the arena while they are reallocated (the
+       * reallocation frees them if it fails) */
+      mesh->arena.hedg = NULL;
+      mesh->arena.hmax = 0;
       _MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,0.2,_MMG5_hedge,"face",
-                         return 0;,0);
-      for (j=hash->nxt; j<hash->max; j++)  hash->item[j].nxt = j+1;
+                         _MMG5_arenaSaveHash(mesh,hash);return 0;,0);
+      _MMG5_arenaSaveHash(mesh,hash);
     }
     return(1);
   }
@@ -146,9 +152,11 @@ int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
   int           vois[4],iadrold;
   short         i1;
   char          alert;
-  int           tref,isused = 0,ixt,ielnum[3*_MMG3D_LONMAX+1],ll;
+  int           tref,isused = 0,ixt,*ielnum,ll;
   _MMG5_Hash    hedg;
 
+  _MMG5_STAT_START(t0);
+
   base = mesh->base;
   /* external faces */
   size = 0;
@@ -194,10 +202,11 @@ int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
   }
   if ( alert )  {return(0);}
   /* hash table params */
-  if ( size > 3*_MMG3D_LONMAX )  return(0);
-  if ( !_MMG5_hashNew(mesh,&hedg,size,3*size) ) { /*3*size suffit */
+  if ( size > 3*_MMG3D_LONMAX )  _MMG5_STAT_RETURN(mesh,MMG5_OperInsert,t0,0);
+  ielnum = _MMG5_arenaList(mesh,size);
+  if ( !ielnum || !_MMG5_arenaHash(mesh,&hedg,size,3*size) ) { /*3*size suffit */
     fprintf(stderr,"\n  ## Error: %s: unable to complete mesh.\n",__func__);
-    return(-1);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperInsert,t0,-1);
   }
 
   /*tetra allocation : we create "size" tetra*/
@@ -211,7 +220,7 @@ int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
                                   " new element.\n",__func__);
                           for(ll=1 ; ll<k ; ll++) {
                             mesh->tetra[ielnum[ll]].v[0] = 1;
-                            if ( !_MMG3D_delElt(mesh,ielnum[ll]) )  return -1;
+                            if ( !_MMG3D_delElt(mesh,ielnum[ll]) )  _MMG5_STAT_RETURN(mesh,MMG5_OperInsert,t0,-1);
                           }
                           return -1;,-1);
     }
@@ -252,7 +261,7 @@ int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
         pt1->v[i] = ip;
         pt1->qual = _MMG5_orcal(mesh,sol,iel);
         pt1->ref = mesh->tetra[old].ref;
-        pt1->mark = mesh->mark;
+        _MMG3D_MARK(mesh,iel);
         iadr = (iel-1)*4 + 1;
         adjb = &mesh->adja[iadr];
         adjb[i] = adja[i];
@@ -313,7 +322,11 @@ int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
                 v[m] = pt1->v[ _MMG5_idir[j][l] ];
                 m++;
               }
-            _MMG5_hashEdgeDelone(mesh,&hedg,iel,j,v);
+            if ( !_MMG5_hashEdgeDelone(mesh,&hedg,iel,j,v) ) {
+              fprintf(stderr,"\n  ## Error: %s: unable to complete mesh.\n",
+                      __func__);
+              return -1;
+            }
           }
         }
       }
@@ -324,13 +337,12 @@ int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
   tref = mesh->tetra[list[0]].ref;
   for (k=0; k<ilist; k++) {
     assert(tref==mesh->tetra[list[k]].ref);
-    if ( !_MMG3D_delElt(mesh,list[k]) ) return -1;
+    if ( !_MMG3D_delElt(mesh,list[k]) ) _MMG5_STAT_RETURN(mesh,MMG5_OperInsert,t0,-1);
   }
 
   // ppt = &mesh->point[ip];
   // ppt->flag = mesh->flag;
-  _MMG5_DEL_MEM(mesh,hedg.item,(hedg.max+1)*sizeof(_MMG5_hedge));
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperInsert,t0,1);
 }
 
 /**
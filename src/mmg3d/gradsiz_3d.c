@@ -0,0 +1,541 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mmg3d/gradsiz_3d.c
+ * \brief Worklist-driven gradation of the size map.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * The historical gradation performs full sweeps over the tetrahedra until no
+ * more size is truncated, so each interior edge is visited many times per
+ * sweep and each sweep visits the whole mesh even if only a few sizes still
+ * change. This file provides:
+ *   - the point -> tetra incidence and the unique edge graph of the mesh;
+ *   - a Dijkstra-like isotropic gradation (priority queue of the vertices
+ *     whose size has changed) and its multithreaded counterpart (frontier
+ *     relaxation) that both converge toward the fixed point of the sweeps;
+ *   - a worklist replay of the sweeps (used by the anisotropic gradation whose
+ *     result depends on the order of the edge processing): each sweep only
+ *     visits the tetra that contain a point updated by the previous sweep or
+ *     earlier in the current sweep, in increasing order, which gives exactly
+ *     the same metric as the full sweeps.
+ */
+
+#include "mmg3d.h"
+
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+/** Ratio of active tetra above which a sweep visits the whole mesh */
+#define _MMG3D_GRADDENSE 4
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param noreq 1 if the required tetrahedra must be ignored.
+ * \param adr pointer toward the table of the ball addresses (allocated here).
+ * \param lst pointer toward the table of the ball tetra (allocated here).
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Build the point -> tetrahedra incidence in compressed storage: the tetra of
+ * the ball of point \a ip are stored in increasing order in
+ * lst[adr[ip]]...lst[adr[ip+1]-1].
+ *
+ */
+int _MMG3D_gradBall(MMG5_pMesh mesh,char noreq,int **adr,int **lst) {
+  MMG5_pTetra pt;
+  int         k,ip,*pos;
+  char        i;
+
+  _MMG5_ADD_MEM(mesh,(mesh->np+2+4*mesh->ne+1)*sizeof(int),"point balls",
+                return(0));
+  _MMG5_SAFE_CALLOC(*adr,mesh->np+2,int,0);
+  _MMG5_SAFE_CALLOC(*lst,4*mesh->ne+1,int,0);
+
+  pos = *adr;
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || (noreq && (pt->tag & MG_REQ)) )  continue;
+    for (i=0; i<4; i++)  ++pos[pt->v[i]+1];
+  }
+  for (ip=1; ip<=mesh->np+1; ip++)  pos[ip] += pos[ip-1];
+
+  /* Use adr[ip+1] as insertion cursor then shift it back */
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || (noreq && (pt->tag & MG_REQ)) )  continue;
+    for (i=0; i<4; i++)  (*lst)[pos[pt->v[i]]++] = k;
+  }
+  for (ip=mesh->np+1; ip>0; ip--)  pos[ip] = pos[ip-1];
+  pos[0] = 0;
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param adr table of the ball addresses.
+ * \param lst table of the ball tetra.
+ *
+ * Free the point -> tetrahedra incidence.
+ *
+ */
+void _MMG3D_delGradBall(MMG5_pMesh mesh,int **adr,int **lst) {
+  _MMG5_DEL_MEM(mesh,*adr,(mesh->np+2)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,*lst,(4*mesh->ne+1)*sizeof(int));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param noreq 1 if the edges of the required tetrahedra must be ignored.
+ * \param adr pointer toward the table of the neighbours addresses (allocated
+ * here).
+ * \param lst pointer toward the table of the neighbours (allocated here).
+ * \param nlst pointer toward the size of \a lst.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Build the unique edge graph of the mesh: the extremities of the edges
+ * passing through point \a ip are stored in lst[adr[ip]]...lst[adr[ip+1]-1].
+ *
+ */
+int _MMG3D_gradGraph(MMG5_pMesh mesh,char noreq,int **adr,int **lst,int *nlst) {
+  MMG5_pTetra pt;
+  int         *badr,*blst,*seen,ip,iq,j,l,n;
+  char        i;
+
+  if ( !_MMG3D_gradBall(mesh,noreq,&badr,&blst) )  return(0);
+
+  _MMG5_ADD_MEM(mesh,(mesh->np+2)*sizeof(int),"edge graph",
+                _MMG3D_delGradBall(mesh,&badr,&blst);
+                return(0));
+  _MMG5_SAFE_CALLOC(*adr,mesh->np+2,int,0);
+  _MMG5_SAFE_CALLOC(seen,mesh->np+1,int,0);
+
+  /* Count the neighbours of each point */
+  for (ip=1; ip<=mesh->np; ip++) {
+    n = 0;
+    for (j=badr[ip]; j<badr[ip+1]; j++) {
+      pt = &mesh->tetra[blst[j]];
+      for (i=0; i<4; i++) {
+        iq = pt->v[i];
+        if ( iq == ip || seen[iq] == ip )  continue;
+        seen[iq] = ip;
+        ++n;
+      }
+    }
+    (*adr)[ip+1] = (*adr)[ip] + n;
+  }
+  *nlst = (*adr)[mesh->np+1];
+
+  _MMG5_ADD_MEM(mesh,(*nlst+1)*sizeof(int),"edge graph",
+                _MMG5_SAFE_FREE(seen);
+                _MMG5_DEL_MEM(mesh,*adr,(mesh->np+2)*sizeof(int));
+                _MMG3D_delGradBall(mesh,&badr,&blst);
+                return(0));
+  _MMG5_SAFE_CALLOC(*lst,*nlst+1,int,0);
+
+  /* Fill the neighbours */
+  memset(seen,0,(mesh->np+1)*sizeof(int));
+  for (ip=1; ip<=mesh->np; ip++) {
+    l = (*adr)[ip];
+    for (j=badr[ip]; j<badr[ip+1]; j++) {
+      pt = &mesh->tetra[blst[j]];
+      for (i=0; i<4; i++) {
+        iq = pt->v[i];
+        if ( iq == ip || seen[iq] == ip )  continue;
+        seen[iq] = ip;
+        (*lst)[l++] = iq;
+      }
+    }
+  }
+
+  _MMG5_SAFE_FREE(seen);
+  _MMG3D_delGradBall(mesh,&badr,&blst);
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param adr table of the neighbours addresses.
+ * \param lst table of the neighbours.
+ * \param nlst size of \a lst.
+ *
+ * Free the edge graph.
+ *
+ */
+void _MMG3D_delGradGraph(MMG5_pMesh mesh,int **adr,int **lst,int nlst) {
+  _MMG5_DEL_MEM(mesh,*adr,(mesh->np+2)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,*lst,(nlst+1)*sizeof(int));
+}
+
+/**
+ * \param p0 first extremity of the edge.
+ * \param p1 second extremity of the edge.
+ * \return the euclidean length of the edge.
+ *
+ * Edge length, computed exactly as in the historical sweeps (the result
+ * doesn't depend on the edge orientation).
+ *
+ */
+static inline
+double _MMG3D_gradLength(MMG5_pPoint p0,MMG5_pPoint p1) {
+  double l;
+
+  l = (p1->c[0]-p0->c[0])*(p1->c[0]-p0->c[0]) + (p1->c[1]-p0->c[1])*(p1->c[1]-p0->c[1])\
+    + (p1->c[2]-p0->c[2])*(p1->c[2]-p0->c[2]);
+  return(sqrt(l));
+}
+
+/** Binary heap of points ordered by increasing size */
+static inline
+void _MMG3D_gradHeapUp(double *h,int *heap,int *pos,int i) {
+  int ip,ipar;
+
+  ip = heap[i];
+  while ( i > 1 ) {
+    ipar = heap[i/2];
+    if ( h[ipar] <= h[ip] )  break;
+    heap[i]   = ipar;
+    pos[ipar] = i;
+    i /= 2;
+  }
+  heap[i] = ip;
+  pos[ip] = i;
+}
+
+static inline
+void _MMG3D_gradHeapDown(double *h,int *heap,int *pos,int n,int i) {
+  int ip,c;
+
+  ip = heap[i];
+  while ( 2*i <= n ) {
+    c = 2*i;
+    if ( c < n && h[heap[c+1]] < h[heap[c]] )  ++c;
+    if ( h[ip] <= h[heap[c]] )  break;
+    heap[i]      = heap[c];
+    pos[heap[i]] = i;
+    i = c;
+  }
+  heap[i] = ip;
+  pos[ip] = i;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param adr table of the neighbours addresses.
+ * \param lst table of the neighbours.
+ * \return the number of updated sizes, -1 if fail.
+ *
+ * Isotropic gradation by a Dijkstra-like propagation: the points are
+ * extracted by increasing size and truncate the size of their neighbours to
+ * \f$ h + hgrad*l \f$. A size is final when its point is extracted, so each
+ * edge is relaxed at most twice.
+ *
+ */
+int _MMG3D_gradsizHeap_iso(MMG5_pMesh mesh,MMG5_pSol met,int *adr,int *lst) {
+  MMG5_pPoint p0;
+  double      *h,hn,l;
+  int         *heap,*pos,n,nup,ip,iq,j;
+
+  _MMG5_ADD_MEM(mesh,2*(mesh->np+1)*sizeof(int),"gradation heap",
+                return(-1));
+  _MMG5_SAFE_MALLOC(heap,mesh->np+1,int,-1);
+  _MMG5_SAFE_CALLOC(pos,mesh->np+1,int,-1);
+
+  h = met->m;
+  n = 0;
+  for (ip=1; ip<=mesh->np; ip++) {
+    if ( adr[ip+1] == adr[ip] )  continue;
+    heap[++n] = ip;
+    pos[ip]   = n;
+  }
+  for (j=n/2; j>0; j--)
+    _MMG3D_gradHeapDown(h,heap,pos,n,j);
+
+  nup = 0;
+  while ( n > 0 ) {
+    ip      = heap[1];
+    pos[ip] = 0;
+    if ( --n ) {
+      heap[1] = heap[n+1];
+      _MMG3D_gradHeapDown(h,heap,pos,n,1);
+    }
+    if ( h[ip] < _MMG5_EPSD )  continue;
+
+    p0 = &mesh->point[ip];
+    for (j=adr[ip]; j<adr[ip+1]; j++) {
+      iq = lst[j];
+      if ( !pos[iq] )  continue;
+
+      l  = _MMG3D_gradLength(p0,&mesh->point[iq]);
+      hn = h[ip] + mesh->info.hgrad*l;
+      if ( h[iq] > hn ) {
+        h[iq] = hn;
+        mesh->point[iq].flag = mesh->base;
+        _MMG3D_gradHeapUp(h,heap,pos,pos[iq]);
+        ++nup;
+      }
+    }
+  }
+
+  _MMG5_DEL_MEM(mesh,heap,(mesh->np+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,pos,(mesh->np+1)*sizeof(int));
+
+  return(nup);
+}
+
+#ifdef USE_OPENMP
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param adr table of the neighbours addresses.
+ * \param lst table of the neighbours.
+ * \param nit pointer toward the number of relaxation steps.
+ * \return the number of updated sizes, -1 if fail.
+ *
+ * Multithreaded isotropic gradation: at each step, the neighbours of the
+ * points whose size has changed at the previous step pull in parallel the
+ * smallest admissible size from their own neighbours, then the new sizes
+ * are committed. Reads and writes are separated so the result doesn't depend
+ * on the number of threads and is the fixed point of the sequential version.
+ *
+ */
+int _MMG3D_gradsizFront_iso(MMG5_pMesh mesh,MMG5_pSol met,int *adr,int *lst,
+                            int *nit) {
+  double      *h,*hnew;
+  int         *front,*cand,*stamp,nf,nc,nup,ip,iq,j,k,step,nth;
+
+  nth = _MMG5_NTHREADS(mesh);
+
+  _MMG5_ADD_MEM(mesh,(mesh->np+1)*(3*sizeof(int)+sizeof(double)),
+                "gradation front",return(-1));
+  _MMG5_SAFE_MALLOC(front,mesh->np+1,int,-1);
+  _MMG5_SAFE_MALLOC(cand,mesh->np+1,int,-1);
+  _MMG5_SAFE_CALLOC(stamp,mesh->np+1,int,-1);
+  _MMG5_SAFE_MALLOC(hnew,mesh->np+1,double,-1);
+
+  h  = met->m;
+  nf = 0;
+  for (ip=1; ip<=mesh->np; ip++)
+    if ( adr[ip+1] > adr[ip] )  front[nf++] = ip;
+
+  nup = step = 0;
+  while ( nf ) {
+    ++step;
+
+    /* Candidates: neighbours of the points updated at the previous step */
+    nc = 0;
+    for (k=0; k<nf; k++) {
+      ip = front[k];
+      for (j=adr[ip]; j<adr[ip+1]; j++) {
+        iq = lst[j];
+        if ( stamp[iq] == step )  continue;
+        stamp[iq]  = step;
+        cand[nc++] = iq;
+      }
+    }
+
+#pragma omp parallel for private(ip,iq,j) num_threads(nth) schedule(static)
+    for (k=0; k<nc; k++) {
+      MMG5_pPoint p0;
+      double      hv,hn,l;
+
+      ip = cand[k];
+      p0 = &mesh->point[ip];
+      hv = h[ip];
+      for (j=adr[ip]; j<adr[ip+1]; j++) {
+        iq = lst[j];
+        if ( h[iq] < _MMG5_EPSD )  continue;
+        l  = _MMG3D_gradLength(p0,&mesh->point[iq]);
+        hn = h[iq] + mesh->info.hgrad*l;
+        if ( hv > hn )  hv = hn;
+      }
+      hnew[ip] = hv;
+    }
+
+    /* Commit */
+    nf = 0;
+    for (k=0; k<nc; k++) {
+      ip = cand[k];
+      if ( hnew[ip] < h[ip] ) {
+        h[ip] = hnew[ip];
+        mesh->point[ip].flag = mesh->base;
+        front[nf++] = ip;
+      }
+    }
+    nup += nf;
+  }
+  *nit = step;
+
+  _MMG5_DEL_MEM(mesh,front,(mesh->np+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,cand,(mesh->np+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,stamp,(mesh->np+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,hnew,(mesh->np+1)*sizeof(double));
+
+  return(nup);
+}
+#endif
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param adr table of the ball addresses (NULL to perform full sweeps).
+ * \param lst table of the ball tetra.
+ * \param gradtet function that process the edges of one tetra.
+ * \param maxit maximal number of sweeps.
+ * \param nit pointer toward the number of performed sweeps.
+ * \return the number of updated sizes, -1 if fail.
+ *
+ * Replay of the gradation sweeps over the tetra. The \a gradtet function
+ * grades the edges of a tetra having an extremity whose flag is at least
+ * mesh->base-1, flags the updated extremities with mesh->base and store them
+ * in its last argument (12 points at most). A tetra whose points have been
+ * neither updated by the previous sweep nor earlier in the current sweep is
+ * a no-op, so each sweep only visits (in increasing order) the balls of the
+ * updated points: the result is identical to the one of the full sweeps.
+ *
+ */
+int _MMG3D_gradsizReplay(MMG5_pMesh mesh,MMG5_pSol met,int *adr,int *lst,
+                         int (*gradtet)(MMG5_pMesh,MMG5_pSol,int,int*),
+                         int maxit,int *nit) {
+  int   *cur,*next,*heap,nc,nn,n,nu,nup,it,k,kk,j,l,c,upd[12];
+  char  dense;
+
+  if ( !adr ) {
+    /* Full sweeps */
+    it = nup = 0;
+    do {
+      mesh->base++;
+      nu = 0;
+      for (k=1; k<=mesh->ne; k++)
+        nu += gradtet(mesh,met,k,upd);
+      nup += nu;
+    }
+    while( ++it < maxit && nu > 0 );
+    *nit = it;
+    return(nup);
+  }
+
+  _MMG5_ADD_MEM(mesh,3*(mesh->ne+1)*sizeof(int),"gradation worklist",
+                return(-1));
+  _MMG5_SAFE_CALLOC(cur,mesh->ne+1,int,-1);
+  _MMG5_SAFE_CALLOC(next,mesh->ne+1,int,-1);
+  _MMG5_SAFE_MALLOC(heap,mesh->ne+1,int,-1);
+
+  /* cur[k]/next[k]: sweep in which k is visited/scheduled for the next one */
+  it = nup = 0;
+  nc = mesh->ne;
+  dense = 1;
+  do {
+    mesh->base++;
+    nu = nn = 0;
+
+    if ( dense ) {
+      for (k=1; k<=mesh->ne; k++) {
+        n   = gradtet(mesh,met,k,upd);
+        nu += n;
+        for (l=0; l<n; l++) {
+          for (j=adr[upd[l]]; j<adr[upd[l]+1]; j++) {
+            kk = lst[j];
+            if ( next[kk] == it+2 )  continue;
+            next[kk]   = it+2;
+            heap[++nn] = kk;
+          }
+        }
+      }
+    }
+    else {
+      /* heap[1..nc] contains the tetra scheduled by the previous sweep */
+      for (j=nc/2; j>0; j--) {
+        kk = heap[j];
+        l  = j;
+        while ( 2*l <= nc ) {
+          c = 2*l;
+          if ( c < nc && heap[c+1] < heap[c] )  ++c;
+          if ( kk <= heap[c] )  break;
+          heap[l] = heap[c];
+          l = c;
+        }
+        heap[l] = kk;
+      }
+      for (j=1; j<=nc; j++)  cur[heap[j]] = it+1;
+
+      /* The tetra scheduled for the next sweep are stored after the heap */
+      while ( nc > 0 ) {
+        k  = heap[1];
+        kk = heap[nc--];
+        l  = 1;
+        while ( 2*l <= nc ) {
+          c = 2*l;
+          if ( c < nc && heap[c+1] < heap[c] )  ++c;
+          if ( kk <= heap[c] )  break;
+          heap[l] = heap[c];
+          l = c;
+        }
+        heap[l] = kk;
+
+        n   = gradtet(mesh,met,k,upd);
+        nu += n;
+        for (l=0; l<n; l++) {
+          for (j=adr[upd[l]]; j<adr[upd[l]+1]; j++) {
+            kk = lst[j];
+            if ( next[kk] != it+2 ) {
+              next[kk] = it+2;
+              ++nn;
+            }
+            if ( kk > k && cur[kk] != it+1 ) {
+              /* Tetra met later in the current sweep */
+              cur[kk] = it+1;
+              c = ++nc;
+              while ( c > 1 && heap[c/2] > kk ) {
+                heap[c] = heap[c/2];
+                c /= 2;
+              }
+              heap[c] = kk;
+            }
+          }
+        }
+      }
+      /* Gather the tetra scheduled for the next sweep */
+      if ( nn ) {
+        nn = 0;
+        for (k=1; k<=mesh->ne; k++)
+          if ( next[k] == it+2 )  heap[++nn] = k;
+      }
+    }
+    nup  += nu;
+    nc    = nn;
+    dense = ( _MMG3D_GRADDENSE*nc > mesh->ne );
+  }
+  while( ++it < maxit && nu > 0 );
+  *nit = it;
+
+  _MMG5_DEL_MEM(mesh,cur,(mesh->ne+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,next,(mesh->ne+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,heap,(mesh->ne+1)*sizeof(int));
+
+  return(nup);
+}
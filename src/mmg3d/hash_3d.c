@@ -35,9 +35,15 @@
 
 #include "mmg3d.h"
 
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
 #define _MMG5_KC    13
 
-extern char  ddb;
+/** Maximal number of segments of the radix pass of the faces sorting */
+#define _MMG3D_SORTDIGITS 4096
+
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -168,6 +174,238 @@ static int _MMG5_hashGetFace(_MMG5_Hash *hash,int ia,int ib,int ic) {
   return(0);
 }
 
+/**
+ * \struct _MMG3D_faceRec
+ * \brief Face of a tetra sorted by its vertices.
+ */
+typedef struct {
+  uint64_t key;  /*!< Middle and largest vertices of the face */
+  int      idx;  /*!< Index 4*(k-1)+i+1 of the face i of the tetra k */
+  int      mins; /*!< Smallest vertex of the face */
+} _MMG3D_faceRec;
+
+/**
+ * \param pt pointer toward the tetra.
+ * \param i local index of the face.
+ * \param rec pointer toward the record of the face (NULL if unused).
+ * \return the smallest vertex of the face \a i of \a pt.
+ *
+ * Sorted vertices of a face.
+ *
+ */
+static inline
+int _MMG3D_faceKey(MMG5_pTetra pt,unsigned char i,_MMG3D_faceRec *rec) {
+  int a,b,c,mins,maxs;
+
+  a = pt->v[_MMG5_idir[i][0]];
+  b = pt->v[_MMG5_idir[i][1]];
+  c = pt->v[_MMG5_idir[i][2]];
+
+  mins = MG_MIN(a,MG_MIN(b,c));
+  maxs = MG_MAX(a,MG_MAX(b,c));
+  if ( rec ) {
+    rec->key  = ((uint64_t)(a^b^c^mins^maxs) << 32) | (uint64_t)maxs;
+    rec->mins = mins;
+  }
+  return(mins);
+}
+
+/**
+ * \param a pointer toward the first face.
+ * \param b pointer toward the second face.
+ * \return -1, 0 or 1 if the face \a a is lower, equal or greater than \a b.
+ *
+ * Comparison of two faces of same smallest vertex (for qsort).
+ *
+ */
+static int _MMG3D_faceCompare(const void *a,const void *b) {
+  const _MMG3D_faceRec *fa,*fb;
+
+  fa = (const _MMG3D_faceRec*)a;
+  fb = (const _MMG3D_faceRec*)b;
+
+  if ( fa->key < fb->key )  return(-1);
+  if ( fa->key > fb->key )  return(1);
+  return( (fa->idx > fb->idx) - (fa->idx < fb->idx) );
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 0 if failed (lack of memory), 1 otherwise.
+ *
+ * Fill the (allocated and zeroed) adjacency table of a compact mesh by
+ * sorting the faces instead of hashing them:
+ *   1. a radix pass distributes the faces into segments along the high bits
+ *   of their smallest vertex (each thread counts and scatters the faces of a
+ *   contiguous range of tetra, so the result doesn't depend on the number of
+ *   threads);
+ *   2. each segment is sorted by smallest vertex (counting sort) then by
+ *   middle and largest vertices and the consecutive equal faces are paired.
+ * For a face shared by more than two tetra (invalid mesh), the faces are
+ * paired as by the hash table (from the last one).
+ *
+ * \remark Needs 64 bytes per tetra instead of 4. On a single thread, it runs at
+ * 0.4-0.7 times the speed of the hash table.
+ *
+ */
+static int _MMG3D_sortTetraFaces(MMG5_pMesh mesh) {
+  _MMG3D_faceRec *lst,*rec;
+  int            *hist,*end,*cnt,nth,ntu,shift,nd,nv,d,t,sum,c,maxseg;
+
+  nth = _MMG5_NTHREADS(mesh);
+
+  shift = 0;
+  while ( (mesh->np >> shift) >= _MMG3D_SORTDIGITS )  ++shift;
+  nd = (mesh->np >> shift) + 1;
+  nv = 1 << shift;
+
+  _MMG5_ADD_MEM(mesh,(4*mesh->ne+1)*sizeof(_MMG3D_faceRec)+nth*nd*sizeof(int),
+                "faces buckets",return(0));
+  _MMG5_SAFE_MALLOC(lst,4*mesh->ne+1,_MMG3D_faceRec,0);
+  _MMG5_SAFE_CALLOC(hist,nth*nd,int,0);
+
+  /* Radix pass on the high bits of the smallest vertex of the faces */
+  ntu = 1;
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(nth)
+#endif
+  {
+    MMG5_pTetra    pt;
+    _MMG3D_faceRec face;
+    int            *h,k,k0,k1,tid,nt,l;
+    unsigned char  i;
+
+    tid = 0;
+    nt  = 1;
+#ifdef USE_OPENMP
+    tid = omp_get_thread_num();
+    nt  = omp_get_num_threads();
+#endif
+    k0 = 1 + (int)(((long long)mesh->ne*tid)/nt);
+    k1 = 1 + (int)(((long long)mesh->ne*(tid+1))/nt);
+    h  = &hist[tid*nd];
+
+    for (k=k0; k<k1; k++) {
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) )  continue;
+      for (i=0; i<4; i++)
+        ++h[_MMG3D_faceKey(pt,i,NULL) >> shift];
+    }
+#ifdef USE_OPENMP
+#pragma omp barrier
+#endif
+#ifdef USE_OPENMP
+#pragma omp single
+#endif
+    {
+      ntu = nt;
+      sum = 0;
+      for (d=0; d<nd; d++) {
+        for (t=0; t<nt; t++) {
+          c = hist[t*nd+d];
+          hist[t*nd+d] = sum;
+          sum += c;
+        }
+      }
+    }
+
+    for (k=k0; k<k1; k++) {
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) )  continue;
+      for (i=0; i<4; i++) {
+        _MMG3D_faceKey(pt,i,&face);
+        face.idx = 4*(k-1)+i+1;
+        l = h[face.mins >> shift]++;
+        lst[l] = face;
+      }
+    }
+  }
+
+  /* Now, the segment d ends at end[d] */
+  end    = &hist[(ntu-1)*nd];
+  maxseg = end[0];
+  for (d=1; d<nd; d++)
+    maxseg = MG_MAX(maxseg,end[d]-end[d-1]);
+
+  /* Working arrays of the threads */
+  _MMG5_ADD_MEM(mesh,nth*(maxseg*sizeof(_MMG3D_faceRec)+(nv+1)*sizeof(int)),
+                "faces buckets",
+                _MMG5_DEL_MEM(mesh,lst,(4*mesh->ne+1)*sizeof(_MMG3D_faceRec));
+                _MMG5_DEL_MEM(mesh,hist,nth*nd*sizeof(int));
+                return(0));
+  _MMG5_SAFE_MALLOC(rec,nth*maxseg+1,_MMG3D_faceRec,0);
+  _MMG5_SAFE_MALLOC(cnt,nth*(nv+1),int,0);
+
+  /* Sort each segment and pair the equal faces */
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(nth)
+#endif
+  {
+    _MMG3D_faceRec *ra,*rb,tmp;
+    int            *cv,tid,d,n,j,j0,j1,l,v,base;
+
+    tid = 0;
+#ifdef USE_OPENMP
+    tid = omp_get_thread_num();
+#endif
+    rb = &rec[tid*maxseg];
+    cv = &cnt[tid*(nv+1)];
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(dynamic,1)
+#endif
+    for (d=0; d<nd; d++) {
+      ra   = d ? &lst[end[d-1]] : lst;
+      n    = d ? end[d]-end[d-1] : end[0];
+      base = d << shift;
+      if ( n < 2 )  continue;
+
+      /* Counting sort along the smallest vertex (stable) */
+      memset(cv,0,(nv+1)*sizeof(int));
+      for (j=0; j<n; j++)
+        ++cv[ra[j].mins-base+1];
+      for (v=0; v<nv; v++)  cv[v+1] += cv[v];
+      for (j=0; j<n; j++)
+        rb[cv[ra[j].mins-base]++] = ra[j];
+
+      /* cv[v] is now the end of the faces of smallest vertex v */
+      for (v=0,j0=0; v<nv; j0=cv[v++]) {
+        j1 = cv[v];
+        if ( j1-j0 < 2 )  continue;
+
+        /* The faces are stored by increasing indices: stable sort on keys */
+        if ( j1-j0 <= 64 ) {
+          for (j=j0+1; j<j1; j++) {
+            tmp = rb[j];
+            for (l=j; l>j0 && rb[l-1].key > tmp.key; l--)
+              rb[l] = rb[l-1];
+            rb[l] = tmp;
+          }
+        }
+        else
+          qsort(&rb[j0],j1-j0,sizeof(_MMG3D_faceRec),_MMG3D_faceCompare);
+      }
+
+      /* Pair the equal faces */
+      for (j0=0; j0<n; j0=j1) {
+        for (j1=j0+1; j1<n && rb[j1].key==rb[j0].key && rb[j1].mins==rb[j0].mins; j1++);
+        for (j=j1-1; j>j0; j-=2) {
+          /* 4*kk+ii for face 4*(kk-1)+ii+1 */
+          mesh->adja[rb[j].idx]   = rb[j-1].idx+3;
+          mesh->adja[rb[j-1].idx] = rb[j].idx+3;
+        }
+      }
+    }
+  }
+
+  _MMG5_DEL_MEM(mesh,rec,(nth*maxseg+1)*sizeof(_MMG3D_faceRec));
+  _MMG5_DEL_MEM(mesh,cnt,nth*(nv+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,lst,(4*mesh->ne+1)*sizeof(_MMG3D_faceRec));
+  _MMG5_DEL_MEM(mesh,hist,nth*nd*sizeof(int));
+
+  return(1);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param pack we pack the mesh at function begining if \f$pack=1\f$.
@@ -202,6 +440,15 @@ int MMG3D_hashTetra(MMG5_pMesh mesh, int pack) {
                 fprintf(stderr,"  Exit program.\n");
                 return 0);
   _MMG5_SAFE_CALLOC(mesh->adja,4*mesh->nemax+5,int,0);
+
+  /* The hash table is faster on a single thread: sort the faces only if
+   * several threads are available, or if it is forced */
+  if ( mesh->info.sortadja == 2
+       || ( mesh->info.sortadja == 1 && _MMG5_NTHREADS(mesh) > 1 ) ) {
+    if ( _MMG3D_sortTetraFaces(mesh) )  return(1);
+    /* Lack of memory: use the hash table */
+  }
+
   _MMG5_SAFE_CALLOC(hcode,mesh->ne+5,int,0);
 
   link  = mesh->adja;
@@ -522,7 +769,7 @@ int _MMG5_setEdgeNmTag(MMG5_pMesh mesh, _MMG5_Hash *hash) {
   int                 ipa,ipb,nbdy,start;
   unsigned int        key;
   char                iface,hasadja;
-  static char         mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREAD_LOCAL char         mmgWarn0=0,mmgWarn1=0;
 
   nr = 0;
 
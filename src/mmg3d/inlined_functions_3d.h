@@ -499,4 +499,151 @@ inline double _MMG5_caltet_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt) {
   return(cal);
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param pk pointer toward the pack of tetra.
+ * \param pt pointer toward the tetra to add to the pack.
+ * \param typ quality function (\ref _MMG3D_QUALISO, \ref _MMG3D_QUALANI or
+ * \ref _MMG3D_QUALANI33).
+ *
+ * Gather the coordinates of the vertices of \a pt and, for the anisotropic
+ * qualities, its mean metric in the pack \a pk. The pack must not be full.
+ *
+ */
+static
+inline void _MMG3D_packTetra(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_QualPack *pk,
+                             MMG5_pTetra pt,int typ) {
+  double mm[6],*m0,*m1,*m2,*m3;
+  int    i,j,n;
+
+  n = pk->n++;
+  assert ( n < _MMG3D_QPACK );
+
+  for (j=0; j<4; j++) {
+    for (i=0; i<3; i++)
+      pk->c[3*j+i][n] = mesh->point[pt->v[j]].c[i];
+  }
+  if ( typ == _MMG3D_QUALISO )  return;
+
+  if ( typ == _MMG3D_QUALANI33 ) {
+    m0 = &met->m[6*pt->v[0]];
+    m1 = &met->m[6*pt->v[1]];
+    m2 = &met->m[6*pt->v[2]];
+    m3 = &met->m[6*pt->v[3]];
+    for (i=0; i<6; i++)
+      pk->m[i][n] = 0.25 * (m0[i]+m1[i]+m2[i]+m3[i]);
+  }
+  else {
+    /* a null metric gives a null quality, as _MMG5_caltet_ani */
+    if ( !_MMG5_moymet(mesh,met,pt,mm) )
+      memset(mm,0,6*sizeof(double));
+    for (i=0; i<6; i++)
+      pk->m[i][n] = mm[i];
+  }
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param pt pointer toward the tetra.
+ * \param msk edges to compute (bit \a ia for the edge \a ia).
+ * \param metRidTyp metric storage at ridge points (0 classic, 1 special).
+ * \param len lengths of the edges of \a pt (only the edges of \a msk are
+ * filled).
+ * \param imin index of the shortest edge of \a msk (-1 if none), may be null.
+ * \param imax index of the longest non null edge of \a msk (-1 if none), may be
+ * null.
+ *
+ * Compute the lengths of the edges \a msk of \a pt, as \ref _MMG5_lenedg
+ * (\ref _MMG5_lenedg33_ani for a classic storage). For an anisotropic metric,
+ * the metrics of the 4 vertices are loaded once and the internal edges are
+ * computed in one pass by \ref _MMG3D_lenedgPack_ani.
+ *
+ */
+static
+inline void _MMG3D_lenedgTet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,
+                             int msk,char metRidTyp,double len[6],
+                             int *imin,int *imax) {
+  MMG5_pxTetra   pxt;
+  MMG5_pPoint    ppt;
+  _MMG3D_EdgPack pk;
+  double         mm[6],lpk[6],lmin,lmax,*m[4];
+  int            i,j,ia,i0,i1;
+  char           ismoy,isedg;
+
+  if ( met->size == 6 && met->m ) {
+    /* vertex metrics (mean metric of the tetra at the ridge points for the
+     * special storage, null if it can't be computed) */
+    ismoy = 0;
+    for (j=0; j<4; j++) {
+      ppt  = &mesh->point[pt->v[j]];
+      m[j] = &met->m[6*pt->v[j]];
+      if ( metRidTyp && !(MG_SIN(ppt->tag) || (MG_NOM & ppt->tag))
+           && (ppt->tag & MG_GEO) ) {
+        if ( !ismoy )  ismoy = _MMG5_moymet(mesh,met,pt,mm) ? 1 : -1;
+        m[j] = ( ismoy > 0 ) ? mm : NULL;
+      }
+    }
+
+    for (ia=0; ia<6; ia++) {
+      i0 = _MMG5_iare[ia][0];
+      i1 = _MMG5_iare[ia][1];
+      for (i=0; i<3; i++) {
+        pk.a[i][ia] = mesh->point[pt->v[i0]].c[i];
+        pk.b[i][ia] = mesh->point[pt->v[i1]].c[i];
+      }
+      for (i=0; i<6; i++) {
+        pk.ma[i][ia] = m[i0] ? m[i0][i] : 0.;
+        pk.mb[i][ia] = m[i1] ? m[i1][i] : 0.;
+      }
+    }
+    _MMG3D_lenedgPack_ani(&pk,lpk);
+
+    pxt = pt->xt ? &mesh->xtetra[pt->xt] : NULL;
+    for (ia=0; ia<6; ia++) {
+      if ( !(msk & (1<<ia)) )  continue;
+      i0 = _MMG5_iare[ia][0];
+      i1 = _MMG5_iare[ia][1];
+
+      if ( pxt && (pxt->tag[ia] & MG_BDY) ) {
+        isedg = ( pxt->tag[ia] & MG_GEO);
+        len[ia] = metRidTyp ?
+          _MMG5_lenSurfEdg_ani(mesh,met,pt->v[i0],pt->v[i1],isedg) :
+          _MMG5_lenSurfEdg33_ani(mesh,met,pt->v[i0],pt->v[i1],isedg);
+      }
+      else
+        len[ia] = ( m[i0] && m[i1] ) ? lpk[ia] : 0.;
+    }
+  }
+  else {
+    for (ia=0; ia<6; ia++) {
+      if ( msk & (1<<ia) )
+        len[ia] = _MMG5_lenedg(mesh,met,ia,pt);
+    }
+  }
+
+  /* shortest and longest edges */
+  if ( imin ) {
+    *imin = -1;
+    lmin  = DBL_MAX;
+    for (ia=0; ia<6; ia++) {
+      if ( (msk & (1<<ia)) && len[ia] < lmin ) {
+        lmin  = len[ia];
+        *imin = ia;
+      }
+    }
+  }
+  if ( imax ) {
+    *imax = -1;
+    lmax  = 0.0;
+    for (ia=0; ia<6; ia++) {
+      if ( (msk & (1<<ia)) && len[ia] > lmax ) {
+        lmax  = len[ia];
+        *imax = ia;
+      }
+    }
+  }
+}
+
 #endif
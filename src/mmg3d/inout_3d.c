@@ -112,9 +112,11 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   long        posnp,posnt,posne,posned,posncor,posnpreq,posntreq,posnereq,posnedreq;
   long        posnr,posnprism,posnormal,posnc1,posnq,posnqreq;
   int         npreq,ntreq,nereq,nedreq,nqreq,ncor,ned,ng,bin,iswp;
-  int         binch,bdim,bpos,i,k,ip,idn;
+  long        bpos;
+  int         binch,bdim,i,k,ip,idn,badcnt,ovf;
   int         *ina,v[3],ref,nt,na,nr,ia,aux,nref;
   char        *ptr,*data,chaine[128];
+  _MMG5_Mmap  mm;
 
   posnp = posnt = posne = posncor = 0;
   posnpreq = posntreq = posnereq = posned = posnedreq = posnr = 0;
@@ -122,8 +124,11 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   ncor = ned = npreq = ntreq = nqreq = nereq = nedreq = nr = ng = 0;
   bin = 0;
   iswp = 0;
+  badcnt = 0;
+  ovf = 0;
   ina = NULL;
   mesh->np = mesh->nt = mesh->ne = 0;
+  memset(&mm,0,sizeof(_MMG5_Mmap));
 
   _MMG5_SAFE_CALLOC(data,strlen(filename)+7,char,-1);
 
@@ -160,82 +165,88 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   _MMG5_SAFE_FREE(data);
 
   if (!bin) {
+    if ( !_MMG5_mmapOpen(&mm,inm) ) {
+      fclose(inm);
+      return(-1);
+    }
+    mm.nth = mesh->info.nthreads;
     strcpy(chaine,"D");
-    while(fscanf(inm,"%127s",&chaine[0])!=EOF && strncmp(chaine,"End",strlen("End")) ) {
+    while(_MMG5_mmapKeyword(&mm,chaine,128) && strncmp(chaine,"End",strlen("End")) ) {
       if(!strncmp(chaine,"MeshVersionFormatted",strlen("MeshVersionFormatted"))) {
-        fscanf(inm,"%d",&mesh->ver);
+        _MMG5_mmapInt(&mm,&mesh->ver);
         continue;
       } else if(!strncmp(chaine,"Dimension",strlen("Dimension"))) {
-        fscanf(inm,"%d",&mesh->dim);
+        _MMG5_mmapInt(&mm,&mesh->dim);
         if(mesh->dim!=3) {
           fprintf(stderr,"BAD DIMENSION : %d\n",mesh->dim);
+          _MMG5_mmapClose(&mm);
           return(-1);
         }
         continue;
       } else if(!strncmp(chaine,"Vertices",strlen("Vertices"))) {
-        fscanf(inm,"%d",&mesh->npi);
-        posnp = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->npi);
+        posnp = mm.pos;
         continue;
       } else if(!strncmp(chaine,"RequiredVertices",strlen("RequiredVertices"))) {
-        fscanf(inm,"%d",&npreq);
-        posnpreq = ftell(inm);
+        _MMG5_mmapInt(&mm,&npreq);
+        posnpreq = mm.pos;
         continue;
       } else if(!strncmp(chaine,"Triangles",strlen("Triangles"))) {
         if ( !strncmp(chaine,"TrianglesP",strlen("TrianglesP")) ) continue;
-        fscanf(inm,"%d",&mesh->nti);
-        posnt = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->nti);
+        posnt = mm.pos;
         continue;
       } else if(!strncmp(chaine,"RequiredTriangles",strlen("RequiredTriangles"))) {
-        fscanf(inm,"%d",&ntreq);
-        posntreq = ftell(inm);
+        _MMG5_mmapInt(&mm,&ntreq);
+        posntreq = mm.pos;
         continue;
       }
       else if(!strncmp(chaine,"Quadrilaterals",strlen("Quadrilaterals"))) {
-        fscanf(inm,"%d",&mesh->nquad);
-        posnq = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->nquad);
+        posnq = mm.pos;
         continue;
       } else if(!strncmp(chaine,"RequiredQuadrilaterals",strlen("RequiredQuadrilaterals"))) {
-        fscanf(inm,"%d",&nqreq);
-        posnqreq = ftell(inm);
+        _MMG5_mmapInt(&mm,&nqreq);
+        posnqreq = mm.pos;
         continue;
 
       } else if(!strncmp(chaine,"Tetrahedra",strlen("Tetrahedra"))) {
         if ( !strncmp(chaine,"TetrahedraP",strlen("TetrahedraP")) ) continue;
-        fscanf(inm,"%d",&mesh->nei);
-        posne = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->nei);
+        posne = mm.pos;
         continue;
       } else if((!strncmp(chaine,"Prisms",strlen("Prisms")))||
                 (!strncmp(chaine,"Pentahedra",strlen("Pentahedra")))) {
-        fscanf(inm,"%d",&mesh->nprism);
-        posnprism = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->nprism);
+        posnprism = mm.pos;
         continue;
       } else if(!strncmp(chaine,"RequiredTetrahedra",strlen("RequiredTetrahedra"))) {
-        fscanf(inm,"%d",&nereq);
-        posnereq = ftell(inm);
+        _MMG5_mmapInt(&mm,&nereq);
+        posnereq = mm.pos;
         continue;
       } else if(!strncmp(chaine,"Corners",strlen("Corners"))) {
-        fscanf(inm,"%d",&ncor);
-        posncor = ftell(inm);
+        _MMG5_mmapInt(&mm,&ncor);
+        posncor = mm.pos;
         continue;
       } else if(!strncmp(chaine,"Edges",strlen("Edges"))) {
-        fscanf(inm,"%d",&mesh->nai);
-        posned = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->nai);
+        posned = mm.pos;
         continue;
       } else if(!strncmp(chaine,"RequiredEdges",strlen("RequiredEdges"))) {
-        fscanf(inm,"%d",&nedreq);
-        posnedreq = ftell(inm);
+        _MMG5_mmapInt(&mm,&nedreq);
+        posnedreq = mm.pos;
         continue;
       } else if(!strncmp(chaine,"Ridges",strlen("Ridges"))) {
-        fscanf(inm,"%d",&nr);
-        posnr = ftell(inm);
+        _MMG5_mmapInt(&mm,&nr);
+        posnr = mm.pos;
         continue;
       } else if(!ng && !strncmp(chaine,"Normals",strlen("Normals"))) {
-        fscanf(inm,"%d",&ng);
-        posnormal = ftell(inm);
+        _MMG5_mmapInt(&mm,&ng);
+        posnormal = mm.pos;
         continue;
       } else if(!strncmp(chaine,"NormalAtVertices",strlen("NormalAtVertices"))) {
-        fscanf(inm,"%d",&mesh->nc1);
-        posnc1 = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->nc1);
+        posnc1 = mm.pos;
         continue;
       }
     }
@@ -249,13 +260,17 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       fprintf(stderr,"BAD FILE ENCODING\n");
     }
     fread(&mesh->ver,sw,1,inm);
-    if(iswp) mesh->ver = _MMG5_swapbin(mesh->ver);
+    if(iswp) mesh->ver=_MMG5_swapbin(mesh->ver);
+    if ( mesh->ver < 1 || mesh->ver > 4 ) {
+      fprintf(stderr,"BAD FILE VERSION : %d\n",mesh->ver);
+      fclose(inm);
+      return(-1);
+    }
     while(fread(&binch,sw,1,inm)!=0 && binch!=54 ) {
       if(iswp) binch=_MMG5_swapbin(binch);
       if(binch==54) break;
       if(!bdim && binch==3) {  //Dimension
-        fread(&bdim,sw,1,inm);  //NulPos=>20
-        if(iswp) bdim=_MMG5_swapbin(bdim);
+        _MMG5_breadPos(inm,iswp,mesh->ver);  //NulPos=>20
         fread(&bdim,sw,1,inm);
         if(iswp) bdim=_MMG5_swapbin(bdim);
         mesh->dim = bdim;
@@ -266,144 +281,158 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
         }
         continue;
       } else if(!mesh->npi && binch==4) {  //Vertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->npi,sw,1,inm);
-        if(iswp) mesh->npi=_MMG5_swapbin(mesh->npi);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&mesh->npi) ) {
+          badcnt = 1;
+          break;
+        }
         posnp = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(binch==15) {  //RequiredVertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&npreq,sw,1,inm);
-        if(iswp) npreq=_MMG5_swapbin(npreq);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&npreq) ) {
+          badcnt = 1;
+          break;
+        }
         posnpreq = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(!mesh->nti && binch==6) {//Triangles
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nti,sw,1,inm);
-        if(iswp) mesh->nti=_MMG5_swapbin(mesh->nti);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&mesh->nti) ) {
+          badcnt = 1;
+          break;
+        }
         posnt = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(binch==17) {  //RequiredTriangles
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&ntreq,sw,1,inm);
-        if(iswp) ntreq=_MMG5_swapbin(ntreq);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&ntreq) ) {
+          badcnt = 1;
+          break;
+        }
         posntreq = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       }
       else if(!mesh->nquad && binch==7) {//Quadrilaterals
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nquad,sw,1,inm);
-        if(iswp) mesh->nquad=_MMG5_swapbin(mesh->nquad);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&mesh->nquad) ) {
+          badcnt = 1;
+          break;
+        }
         posnq = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(binch==18) {  //RequiredQuadrilaterals
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&nqreq,sw,1,inm);
-        if(iswp) nqreq=_MMG5_swapbin(nqreq);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&nqreq) ) {
+          badcnt = 1;
+          break;
+        }
         posnqreq = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(!mesh->nei && binch==8) {//Tetra
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nei,sw,1,inm);
-        if(iswp) mesh->nei=_MMG5_swapbin(mesh->nei);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&mesh->nei) ) {
+          badcnt = 1;
+          break;
+        }
         posne = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(!mesh->nprism && binch==9) {//Prism
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nprism,sw,1,inm);
-        if(iswp) mesh->nprism=_MMG5_swapbin(mesh->nprism);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&mesh->nprism) ) {
+          badcnt = 1;
+          break;
+        }
         posnprism = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(binch==12) {  //RequiredTetra
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&nereq,sw,1,inm);
-        if(iswp) nereq=_MMG5_swapbin(nereq);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&nereq) ) {
+          badcnt = 1;
+          break;
+        }
         posnereq = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(!ncor && binch==13) { //Corners
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&ncor,sw,1,inm);
-        if(iswp) ncor=_MMG5_swapbin(ncor);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&ncor) ) {
+          badcnt = 1;
+          break;
+        }
         posncor = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(!mesh->nai && binch==5) { //Edges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nai,sw,1,inm);
-        if(iswp) mesh->nai=_MMG5_swapbin(mesh->nai);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&mesh->nai) ) {
+          badcnt = 1;
+          break;
+        }
         posned = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(binch==16) {  //RequiredEdges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&nedreq,sw,1,inm);
-        if(iswp) nedreq=_MMG5_swapbin(nedreq);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&nedreq) ) {
+          badcnt = 1;
+          break;
+        }
         posnedreq = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       }  else if(binch==14) {  //Ridges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&nr,sw,1,inm);
-        if(iswp) nr=_MMG5_swapbin(nr);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&nr) ) {
+          badcnt = 1;
+          break;
+        }
         posnr = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(!ng && binch==60) {  //Normals
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&ng,sw,1,inm);
-        if(iswp) ng=_MMG5_swapbin(ng);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&ng) ) {
+          badcnt = 1;
+          break;
+        }
         posnormal = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else if(binch==20) {  //NormalAtVertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nc1,sw,1,inm);
-        if(iswp) mesh->nc1=_MMG5_swapbin(mesh->nc1);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
+        if ( !_MMG5_breadCount(inm,iswp,mesh->ver,&mesh->nc1) ) {
+          badcnt = 1;
+          break;
+        }
         posnc1 = ftell(inm);
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
         continue;
       } else {
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
+        bpos = _MMG5_breadPos(inm,iswp,mesh->ver); //NulPos
 
         rewind(inm);
         fseek(inm,bpos,SEEK_SET);
@@ -411,10 +440,17 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     }
   }
 
+  if ( badcnt ) {
+    _MMG5_mmapClose(&mm);
+    fclose(inm);
+    return(-1);
+  }
+
   if ( !mesh->npi || !mesh->nei ) {
     fprintf(stderr,"  ** MISSING DATA.\n");
     fprintf(stderr," Check that your mesh contains points and tetrahedra.\n");
     fprintf(stderr," Exit program.\n");
+    _MMG5_mmapClose(&mm);
     return(-1);
   }
   /* memory allocation */
@@ -422,42 +458,54 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   mesh->nt = mesh->nti;
   mesh->ne = mesh->nei;
   mesh->na = mesh->nai;
-  if ( !_MMG3D_zaldy(mesh) )  return(0);
+  if ( !_MMG3D_zaldy(mesh) ) {
+    _MMG5_mmapClose(&mm);
+    return(0);
+  }
   if (mesh->npmax < mesh->np || mesh->ntmax < mesh->nt || mesh->nemax < mesh->ne) {
+    _MMG5_mmapClose(&mm);
     return(-1);
   }
 
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
+  if ( !bin ) {
+    /* Parallel reading of the main blocks of the ASCII file */
+    if ( !_MMG5_mmapPoints(&mm,mesh,posnp,3,0) ||
+         !_MMG5_mmapElts(&mm,posne,mesh->ne,4,(char*)&mesh->tetra[1],
+                         sizeof(MMG5_Tetra),offsetof(MMG5_Tetra,v),
+                         offsetof(MMG5_Tetra,ref)) ||
+         ( mesh->nt &&
+           !_MMG5_mmapElts(&mm,posnt,mesh->nt,3,(char*)&mesh->tria[1],
+                           sizeof(MMG5_Tria),offsetof(MMG5_Tria,v),
+                           offsetof(MMG5_Tria,ref)) ) ||
+         ( mesh->na &&
+           !_MMG5_mmapElts(&mm,posned,mesh->na,2,(char*)&mesh->edge[1],
+                           sizeof(MMG5_Edge),offsetof(MMG5_Edge,a),
+                           offsetof(MMG5_Edge,ref)) ) ) {
+      _MMG5_mmapClose(&mm);
+      fclose(inm);
+      return(-1);
+    }
+  }
+  else {
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+  }
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
-    if (mesh->ver < 2) { /*float*/
-      if (!bin) {
-        for (i=0 ; i<3 ; i++) {
-          fscanf(inm,"%f",&fc);
-          ppt->c[i] = (double) fc;
-        }
-        fscanf(inm,"%d",&ppt->ref);
-      } else {
+    if ( bin ) {
+      if (mesh->ver < 2) { /*float*/
         for (i=0 ; i<3 ; i++) {
           fread(&fc,sw,1,inm);
           if(iswp) fc=_MMG5_swapf(fc);
           ppt->c[i] = (double) fc;
         }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=_MMG5_swapbin(ppt->ref);
-      }
-    } else {
-      if (!bin)
-        fscanf(inm,"%lf %lf %lf %d",&ppt->c[0],&ppt->c[1],&ppt->c[2],&ppt->ref);
-      else {
+      } else {
         for (i=0 ; i<3 ; i++) {
           fread(&ppt->c[i],sd,1,inm);
           if(iswp) ppt->c[i]=_MMG5_swapd(ppt->c[i]);
         }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=_MMG5_swapbin(ppt->ref);
       }
+      ppt->ref = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
     }
     ppt->tag  = MG_NUL;
     ppt->tmp  = 0;
@@ -470,8 +518,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       if(!bin)
         fscanf(inm,"%d",&i);
       else {
-        fread(&i,sw,1,inm);
-        if(iswp) i=_MMG5_swapbin(i);
+        i = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
       }
       if(i>mesh->np) {
         fprintf(stderr,"\n  ## Warning: %s: required Vertices number %8d"
@@ -491,8 +538,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       if(!bin)
         fscanf(inm,"%d",&i);
       else {
-        fread(&i,sw,1,inm);
-        if(iswp) i=_MMG5_swapbin(i);
+        i = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
       }
       if(i>mesh->np) {
         fprintf(stderr,"\n  ## Warning: %s: corner number %8d ignored.\n",
@@ -515,15 +561,19 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       _MMG5_SAFE_CALLOC(ina,nt+1,int,-1);
 
       for (k=1; k<=nt; k++) {
-        if (!bin)
-          fscanf(inm,"%d %d %d %d",&v[0],&v[1],&v[2],&ref);
+        if (!bin) {
+          /* already read: the triangles are packed in place */
+          pt1  = &mesh->tria[k];
+          v[0] = pt1->v[0];
+          v[1] = pt1->v[1];
+          v[2] = pt1->v[2];
+          ref  = pt1->ref;
+        }
         else {
           for (i=0 ; i<3 ; i++) {
-            fread(&v[i],sw,1,inm);
-            if(iswp) v[i]=_MMG5_swapbin(v[i]);
+            v[i] = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
           }
-          fread(&ref,sw,1,inm);
-          if(iswp) ref=_MMG5_swapbin(ref);
+          ref = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
         }
         if( abs(ref) != MG_ISO ) {
           pt1 = &mesh->tria[++mesh->nt];
@@ -540,6 +590,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       else if ( mesh->nt < nt ) {
         _MMG5_ADD_MEM(mesh,(mesh->nt-nt)*sizeof(MMG5_Tria),"triangles",
                       fprintf(stderr,"  Exit program.\n");
+                      _MMG5_mmapClose(&mm);
                       return -1);
         _MMG5_SAFE_RECALLOC(mesh->tria,nt+1,(mesh->nt+1),MMG5_Tria,
                             "triangles",-1);
@@ -548,15 +599,11 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     else {
       for (k=1; k<=mesh->nt; k++) {
         pt1 = &mesh->tria[k];
-        if (!bin)
-          fscanf(inm,"%d %d %d %d",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt1->ref);
-        else {
+        if ( bin ) {
           for (i=0 ; i<3 ; i++) {
-            fread(&pt1->v[i],sw,1,inm);
-            if(iswp) pt1->v[i]=_MMG5_swapbin(pt1->v[i]);
+            pt1->v[i] = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
           }
-          fread(&pt1->ref,sw,1,inm);
-          if(iswp) pt1->ref=_MMG5_swapbin(pt1->ref);
+          pt1->ref = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
         }
       }
     }
@@ -568,8 +615,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
         if(!bin)
           fscanf(inm,"%d",&i);
         else {
-          fread(&i,sw,1,inm);
-          if(iswp) i=_MMG5_swapbin(i);
+          i = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
         }
         if ( i>mesh->nt ) {
           fprintf(stderr,"\n  ## Warning: %s: required triangle number %8d"
@@ -609,11 +655,9 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
                &pq1->v[3],&pq1->ref);
       else {
         for (i=0 ; i<4 ; i++) {
-          fread(&pq1->v[i],sw,1,inm);
-          if(iswp) pq1->v[i]=_MMG5_swapbin(pq1->v[i]);
+          pq1->v[i] = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
         }
-        fread(&pq1->ref,sw,1,inm);
-        if(iswp) pq1->ref=_MMG5_swapbin(pq1->ref);
+        pq1->ref = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
       }
     }
 
@@ -625,8 +669,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
         if(!bin)
           fscanf(inm,"%d",&i);
         else {
-          fread(&i,sw,1,inm);
-          if(iswp) i=_MMG5_swapbin(i);
+          i = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
         }
         if ( i>mesh->nquad ) {
           fprintf(stderr,"\n  ## Warning: %s: required quadrilaterals number"
@@ -655,15 +698,10 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
 
     for (k=1; k<=na; k++) {
       pa = &mesh->edge[k];
-      if (!bin)
-        fscanf(inm,"%d %d %d",&pa->a,&pa->b,&pa->ref);
-      else {
-        fread(&pa->a,sw,1,inm);
-        if(iswp) pa->a=_MMG5_swapbin(pa->a);
-        fread(&pa->b,sw,1,inm);
-        if(iswp) pa->b=_MMG5_swapbin(pa->b);
-        fread(&pa->ref,sw,1,inm);
-        if(iswp) pa->ref=_MMG5_swapbin(pa->ref);
+      if ( bin ) {
+        pa->a = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
+        pa->b = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
+        pa->ref = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
       }
       pa->tag |= MG_REF;
       if ( mesh->info.iso ) {
@@ -682,6 +720,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
         _MMG5_ADD_MEM(mesh,(mesh->na-na)*sizeof(MMG5_Edge),"edges",
                       fprintf(stderr,"  Exit program.\n");
                       _MMG5_SAFE_FREE(ina);
+                      _MMG5_mmapClose(&mm);
                       return -1);
         _MMG5_SAFE_RECALLOC(mesh->edge,na+1,(mesh->na+1),MMG5_Edge,"edges",-1);
       }
@@ -696,8 +735,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
         if(!bin)
           fscanf(inm,"%d",&ia);
         else {
-          fread(&ia,sw,1,inm);
-          if(iswp) ia=_MMG5_swapbin(ia);
+          ia = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
         }
         if(ia>na) {
           fprintf(stderr,"\n  ## Warning: %s: ridge number %8d ignored.\n",
@@ -726,8 +764,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
         if(!bin)
           fscanf(inm,"%d",&ia);
         else {
-          fread(&ia,sw,1,inm);
-          if(iswp) ia=_MMG5_swapbin(ia);
+          ia = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
         }
         if(ia>na) {
           fprintf(stderr,"\n  ## Warning: %s: required Edges number %8d/%8d"
@@ -760,14 +797,12 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
     if (!bin)
-      fscanf(inm,"%d %d %d %d %d",&pt->v[0],&pt->v[1],&pt->v[2],&pt->v[3],&ref);
+      ref = pt->ref;
     else {
       for (i=0 ; i<4 ; i++) {
-        fread(&pt->v[i],sw,1,inm);
-        if(iswp) pt->v[i]=_MMG5_swapbin(pt->v[i]);
+        pt->v[i] = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
       }
-      fread(&ref,sw,1,inm);
-      if(iswp) ref=_MMG5_swapbin(ref);
+      ref = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
     }
     if(ref < 0) {
       nref++;
@@ -808,8 +843,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       if(!bin)
         fscanf(inm,"%d",&i);
       else {
-        fread(&i,sw,1,inm);
-        if(iswp) i=_MMG5_swapbin(i);
+        i = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
       }
       if(i>mesh->ne) {
         fprintf(stderr,"\n  ## Warning: %s: required Tetra number %8d"
@@ -830,11 +864,9 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
              &pp->v[3],&pp->v[4],&pp->v[5],&ref);
     else {
       for (i=0 ; i<6 ; i++) {
-        fread(&pp->v[i],sw,1,inm);
-        if(iswp) pp->v[i]=_MMG5_swapbin(pp->v[i]);
+        pp->v[i] = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
       }
-      fread(&ref,sw,1,inm);
-      if(iswp) ref=_MMG5_swapbin(ref);
+      ref = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
     }
     pp->ref  = ref;
     for (i=0; i<6; i++) {
@@ -897,10 +929,8 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       if (!bin)
         fscanf(inm,"%d %d",&ip,&idn);
       else {
-        fread(&ip,sw,1,inm);
-        if(iswp) ip=_MMG5_swapbin(ip);
-        fread(&idn,sw,1,inm);
-        if(iswp) idn=_MMG5_swapbin(idn);
+        ip = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
+        idn = _MMG5_breadInt(inm,iswp,mesh->ver,&ovf);
       }
       if ( idn > 0 && ip < mesh->np+1 )
         memcpy(&mesh->point[ip].n,&norm[3*(idn-1)+1],3*sizeof(double));
@@ -908,6 +938,14 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     _MMG5_SAFE_FREE(norm);
   }
 
+  if ( ovf ) {
+    fprintf(stderr,"  ** INDEX OR REFERENCE LARGER THAN %d: UNSUPPORTED.\n",
+            INT_MAX);
+    fprintf(stderr," Exit program.\n");
+    _MMG5_mmapClose(&mm);
+    fclose(inm);
+    return(-1);
+  }
 
   /* stats */
   if ( abs(mesh->info.imprim) > 3 ) {
@@ -942,6 +980,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     }
     if(ncor) fprintf(stdout,"     NUMBER OF CORNERS        %8d \n",ncor);
   }
+  _MMG5_mmapClose(&mm);
   fclose(inm);
   return(1);
 }
@@ -1076,8 +1115,10 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
   MMG5_xPoint *pxp;
   int          k,na,nc,np,ne,nn,nr,nre,nedreq,ntreq,nt,nereq;
   int          npr,nprreq,nq,nqreq;
-  int          bin,binch,bpos;
+  int          bin,binch;
+  long         bsiz;
   char         *data,chaine[128],*ptr;
+  _MMG5_Bfile  bf;
 
   mesh->ver = 2;
   bin = 0;
@@ -1122,24 +1163,24 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
   _MMG5_SAFE_FREE(data);
 
   /*entete fichier*/
-  binch=0; bpos=10;
   if(!bin) {
     strcpy(&chaine[0],"MeshVersionFormatted 2\n");
     fprintf(inm,"%s",chaine);
     strcpy(&chaine[0],"\n\nDimension 3\n");
     fprintf(inm,"%s ",chaine);
   } else {
-    binch = 1; //MeshVersionFormatted
-    fwrite(&binch,sw,1,inm);
-    binch = 2; //version
-    fwrite(&binch,sw,1,inm);
-    binch = 3; //Dimension
-    fwrite(&binch,sw,1,inm);
-    bpos = 20; //Pos
-    fwrite(&bpos,sw,1,inm);
-    binch = 3;
-    fwrite(&binch,sw,1,inm);
-
+    /* Upper bound of the file size: the positions are stored on 64 bits
+     * (version 3) if the file may exceed 2GB */
+    bsiz = 1024 + 100*(long)mesh->np + 24*(long)mesh->ne
+      + 32*(long)mesh->nprism + 20*(long)mesh->nt + 24*(long)mesh->nquad
+      + 20*(long)mesh->na;
+    if ( bsiz > INT_MAX ) mesh->ver = 3;
+
+    if ( !_MMG5_bopen(&bf,inm,mesh->ver) ) {
+      fclose(inm);
+      return(0);
+    }
+    _MMG5_bwriteHeader(&bf,3);
   }
   /* vertices */
   np = nc = na = nr = nre = 0;
@@ -1147,6 +1188,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
   if ( !mesh->point ) {
     fprintf(stderr, "\n  ## Error: %s: points array not allocated.\n",
             __func__);
+    if ( bin ) _MMG5_bclose(&bf);
     fclose(inm);
     return 0;
   }
@@ -1167,11 +1209,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     fprintf(inm,"%s",chaine);
     fprintf(inm,"%d\n",np);
   } else {
-    binch = 4; //Vertices
-    fwrite(&binch,sw,1,inm);
-    bpos += 12+(1+3*mesh->ver)*4*np; //NullPos
-    fwrite(&bpos,sw,1,inm);
-    fwrite(&np,sw,1,inm);
+    _MMG5_bwriteKwd(&bf,4,np,(long)np*(3*bf.rsiz+bf.isiz));
   }
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
@@ -1179,11 +1217,11 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       if(!bin) {
         fprintf(inm,"%.15lg %.15lg %.15lg %d\n",ppt->c[0],ppt->c[1],ppt->c[2],abs(ppt->ref));
       } else {
-        fwrite((unsigned char*)&ppt->c[0],sd,1,inm);
-        fwrite((unsigned char*)&ppt->c[1],sd,1,inm);
-        fwrite((unsigned char*)&ppt->c[2],sd,1,inm);
+        _MMG5_bwriteReal(&bf,ppt->c[0]);
+        _MMG5_bwriteReal(&bf,ppt->c[1]);
+        _MMG5_bwriteReal(&bf,ppt->c[2]);
         ppt->ref = abs(ppt->ref);
-        fwrite((unsigned char*)&ppt->ref,sw,1,inm);
+        _MMG5_bwriteInt(&bf,ppt->ref);
       }
     }
   }
@@ -1195,11 +1233,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       fprintf(inm,"%s",chaine);
       fprintf(inm,"%d\n",nc);
     } else {
-      binch = 13; //
-      fwrite(&binch,sw,1,inm);
-      bpos += 12+4*nc; //NullPos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nc,sw,1,inm);
+      _MMG5_bwriteKwd(&bf,13,nc,(long)nc*bf.isiz);
     }
 
     for (k=1; k<=mesh->np; k++) {
@@ -1208,7 +1242,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         if(!bin) {
           fprintf(inm,"%d \n",ppt->tmp);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_bwriteInt(&bf,ppt->tmp);
         }
       }
     }
@@ -1219,11 +1253,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       fprintf(inm,"%s",chaine);
       fprintf(inm,"%d\n",nre);
     } else {
-      binch = 15; //
-      fwrite(&binch,sw,1,inm);
-      bpos += 12+4*nre; //NullPos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nre,sw,1,inm);
+      _MMG5_bwriteKwd(&bf,15,nre,(long)nre*bf.isiz);
     }
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
@@ -1231,7 +1261,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         if(!bin) {
           fprintf(inm,"%d \n",ppt->tmp);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_bwriteInt(&bf,ppt->tmp);
         }
       }
     }
@@ -1261,11 +1291,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     fprintf(inm,"%s",chaine);
     fprintf(inm,"%d\n",ne);
   } else {
-    binch = 8; //Tetra
-    fwrite(&binch,sw,1,inm);
-    bpos += 12 + 20*ne;//Pos
-    fwrite(&bpos,sw,1,inm);
-    fwrite((unsigned char*)&ne,sw,1,inm);
+    _MMG5_bwriteKwd(&bf,8,ne,(long)5*ne*bf.isiz);
   }
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
@@ -1283,11 +1309,11 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         fprintf(inm,"%d %d %d %d %d\n",mesh->point[pt->v[0]].tmp,mesh->point[pt->v[1]].tmp
                 ,mesh->point[pt->v[2]].tmp,mesh->point[pt->v[3]].tmp,pt->ref);
       } else {
-        fwrite(&mesh->point[pt->v[0]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pt->v[1]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pt->v[2]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pt->v[3]].tmp,sw,1,inm);
-        fwrite(&pt->ref,sw,1,inm);
+        _MMG5_bwriteInt(&bf,mesh->point[pt->v[0]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pt->v[1]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pt->v[2]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pt->v[3]].tmp);
+        _MMG5_bwriteInt(&bf,pt->ref);
       }
     }
   }
@@ -1298,11 +1324,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       fprintf(inm,"%s",chaine);
       fprintf(inm,"%d\n",nereq);
     } else {
-      binch = 12; //RequiredTetra
-      fwrite(&binch,sw,1,inm);
-      bpos += 12 + 4*nereq;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nereq,sw,1,inm);
+      _MMG5_bwriteKwd(&bf,12,nereq,(long)nereq*bf.isiz);
     }
     ne = 0;
     for (k=1; k<=mesh->ne; k++) {
@@ -1313,7 +1335,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         if(!bin) {
           fprintf(inm,"%d \n",ne);
         } else {
-          fwrite(&ne,sw,1,inm);
+          _MMG5_bwriteInt(&bf,ne);
         }
       }
     }
@@ -1336,11 +1358,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       fprintf(inm,"%s",chaine);
       fprintf(inm,"%d\n",npr);
     } else {
-      binch = 9; //Prism
-      fwrite(&binch,sw,1,inm);
-      bpos += 12 + 20*npr;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite((unsigned char*)&npr,sw,1,inm);
+      _MMG5_bwriteKwd(&bf,9,npr,(long)7*npr*bf.isiz);
     }
     for (k=1; k<=mesh->nprism; k++) {
       pp = &mesh->prism[k];
@@ -1352,13 +1370,13 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
                 ,mesh->point[pp->v[2]].tmp,mesh->point[pp->v[3]].tmp
                 ,mesh->point[pp->v[4]].tmp,mesh->point[pp->v[5]].tmp,pp->ref);
       } else {
-        fwrite(&mesh->point[pp->v[0]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[1]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[2]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[3]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[4]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[5]].tmp,sw,1,inm);
-        fwrite(&pp->ref,sw,1,inm);
+        _MMG5_bwriteInt(&bf,mesh->point[pp->v[0]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pp->v[1]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pp->v[2]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pp->v[3]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pp->v[4]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pp->v[5]].tmp);
+        _MMG5_bwriteInt(&bf,pp->ref);
       }
     }
   }
@@ -1381,11 +1399,8 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       strcpy(&chaine[0],"\n\nNormals\n");
       fprintf(inm,"%s",chaine);
       fprintf(inm,"%d\n",nn);
-    } else {      binch = 60; //normals
-      fwrite(&binch,sw,1,inm);
-      bpos += 12+(3*mesh->ver)*4*nn; //Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nn,sw,1,inm);
+    } else {
+      _MMG5_bwriteKwd(&bf,60,nn,(long)3*nn*bf.rsiz);
     }
 
     for (k=1; k<=mesh->np; k++) {
@@ -1397,9 +1412,9 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         if(!bin) {
           fprintf(inm,"%.15lg %.15lg %.15lg \n",pxp->n1[0],pxp->n1[1],pxp->n1[2]);
         } else {
-          fwrite((unsigned char*)&pxp->n1[0],sd,1,inm);
-          fwrite((unsigned char*)&pxp->n1[1],sd,1,inm);
-          fwrite((unsigned char*)&pxp->n1[2],sd,1,inm);
+          _MMG5_bwriteReal(&bf,pxp->n1[0]);
+          _MMG5_bwriteReal(&bf,pxp->n1[1]);
+          _MMG5_bwriteReal(&bf,pxp->n1[2]);
         }
       }
     }
@@ -1409,11 +1424,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       fprintf(inm,"%s",chaine);
       fprintf(inm,"%d\n",nn);
     } else {
-      binch = 20; //normalatvertices
-      fwrite(&binch,sw,1,inm);
-      bpos += 12 + 2*4*nn;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nn,sw,1,inm);
+      _MMG5_bwriteKwd(&bf,20,nn,(long)2*nn*bf.isiz);
     }
     nn = 0;
     for (k=1; k<=mesh->np; k++) {
@@ -1424,9 +1435,9 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         if(!bin) {
           fprintf(inm,"%d %d\n",ppt->tmp,++nn);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_bwriteInt(&bf,ppt->tmp);
           ++nn;
-          fwrite(&nn,sw,1,inm);
+          _MMG5_bwriteInt(&bf,nn);
         }
       }
     }
@@ -1438,11 +1449,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         fprintf(inm,"%s",chaine);
         fprintf(inm,"%d\n",nt);
       } else {
-        binch = 59; //tangent
-        fwrite(&binch,sw,1,inm);
-        bpos += 12+(3*mesh->ver)*4*nt; //Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nt,sw,1,inm);
+        _MMG5_bwriteKwd(&bf,59,nt,(long)3*nt*bf.rsiz);
       }
 
       for (k=1; k<=mesh->np; k++) {
@@ -1452,9 +1459,9 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
           if(!bin) {
             fprintf(inm,"%.15lg %.15lg %.15lg \n",ppt->n[0],ppt->n[1],ppt->n[2]);
           } else {
-            fwrite((unsigned char*)&ppt->n[0],sd,1,inm);
-            fwrite((unsigned char*)&ppt->n[1],sd,1,inm);
-            fwrite((unsigned char*)&ppt->n[2],sd,1,inm);
+            _MMG5_bwriteReal(&bf,ppt->n[0]);
+            _MMG5_bwriteReal(&bf,ppt->n[1]);
+            _MMG5_bwriteReal(&bf,ppt->n[2]);
           }
         }
       }
@@ -1465,11 +1472,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         fprintf(inm,"%s",chaine);
         fprintf(inm,"%d\n",nt);
       } else {
-        binch = 61; //tangentatvertices
-        fwrite(&binch,sw,1,inm);
-        bpos += 12 + 2*4*nt;//Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nt,sw,1,inm);
+        _MMG5_bwriteKwd(&bf,61,nt,(long)2*nt*bf.isiz);
       }
       nt = 0;
       for (k=1; k<=mesh->np; k++) {
@@ -1479,9 +1482,9 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
           if(!bin) {
             fprintf(inm,"%d %d\n",ppt->tmp,++nt);
           } else {
-            fwrite(&ppt->tmp,sw,1,inm);
+            _MMG5_bwriteInt(&bf,ppt->tmp);
             ++nt;
-            fwrite(&(nn),sw,1,inm);
+            _MMG5_bwriteInt(&bf,nt);
           }
         }
       }
@@ -1498,11 +1501,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       fprintf(inm,"%s",chaine);
       fprintf(inm,"%d \n",mesh->nt);
     } else {
-      binch = 6; //Triangles
-      fwrite(&binch,sw,1,inm);
-      bpos += 12+16*mesh->nt; //Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&mesh->nt,sw,1,inm);
+      _MMG5_bwriteKwd(&bf,6,mesh->nt,(long)4*mesh->nt*bf.isiz);
     }
     for (k=1; k<=mesh->nt; k++) {
       ptt = &mesh->tria[k];
@@ -1513,10 +1512,10 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         fprintf(inm,"%d %d %d %d\n",mesh->point[ptt->v[0]].tmp,mesh->point[ptt->v[1]].tmp
                 ,mesh->point[ptt->v[2]].tmp,ptt->ref);
       } else {
-        fwrite(&mesh->point[ptt->v[0]].tmp,sw,1,inm);
-        fwrite(&mesh->point[ptt->v[1]].tmp,sw,1,inm);
-        fwrite(&mesh->point[ptt->v[2]].tmp,sw,1,inm);
-        fwrite(&ptt->ref,sw,1,inm);
+        _MMG5_bwriteInt(&bf,mesh->point[ptt->v[0]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[ptt->v[1]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[ptt->v[2]].tmp);
+        _MMG5_bwriteInt(&bf,ptt->ref);
       }
     }
     if ( ntreq ) {
@@ -1525,11 +1524,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         fprintf(inm,"%s",chaine);
         fprintf(inm,"%d \n",ntreq);
       } else {
-        binch = 17; //ReqTriangles
-        fwrite(&binch,sw,1,inm);
-        bpos += 12+4*ntreq; //Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&ntreq,sw,1,inm);
+        _MMG5_bwriteKwd(&bf,17,ntreq,(long)ntreq*bf.isiz);
       }
       for (k=0; k<=mesh->nt; k++) {
         ptt = &mesh->tria[k];
@@ -1538,7 +1533,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
           if(!bin) {
             fprintf(inm,"%d \n",k);
           } else {
-            fwrite(&k,sw,1,inm);
+            _MMG5_bwriteInt(&bf,k);
           }
         }
       }
@@ -1569,11 +1564,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       fprintf(inm,"%s",chaine);
       fprintf(inm,"%d \n",nq);
     } else {
-      binch = 7; //Quadrilaterals
-      fwrite(&binch,sw,1,inm);
-      bpos += 12+20*nq; //Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nq,sw,1,inm);
+      _MMG5_bwriteKwd(&bf,7,nq,(long)5*nq*bf.isiz);
     }
     for (k=1; k<=mesh->nquad; k++) {
       pq = &mesh->quadra[k];
@@ -1584,11 +1575,11 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
                 mesh->point[pq->v[1]].tmp,mesh->point[pq->v[2]].tmp,
                 mesh->point[pq->v[3]].tmp, pq->ref);
       } else {
-        fwrite(&mesh->point[pq->v[0]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pq->v[1]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pq->v[2]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pq->v[3]].tmp,sw,1,inm);
-        fwrite(&pq->ref,sw,1,inm);
+        _MMG5_bwriteInt(&bf,mesh->point[pq->v[0]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pq->v[1]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pq->v[2]].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[pq->v[3]].tmp);
+        _MMG5_bwriteInt(&bf,pq->ref);
       }
     }
     if ( nqreq ) {
@@ -1597,11 +1588,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         fprintf(inm,"%s",chaine);
         fprintf(inm,"%d \n",nqreq);
       } else {
-        binch = 18; //ReqQuad
-        fwrite(&binch,sw,1,inm);
-        bpos += 12+4*nqreq; //Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nqreq,sw,1,inm);
+        _MMG5_bwriteKwd(&bf,18,nqreq,(long)nqreq*bf.isiz);
       }
       for (k=0; k<=mesh->nquad; k++) {
         pq = &mesh->quadra[k];
@@ -1610,7 +1597,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
           if(!bin) {
             fprintf(inm,"%d \n",k);
           } else {
-            fwrite(&k,sw,1,inm);
+            _MMG5_bwriteInt(&bf,k);
           }
         }
       }
@@ -1624,20 +1611,16 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       fprintf(inm,"%s",chaine);
       fprintf(inm,"%d\n",mesh->na);
     } else {
-      binch = 5; //Edges
-      fwrite(&binch,sw,1,inm);
-      bpos += 12 + 3*4*mesh->na;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&mesh->na,sw,1,inm);
+      _MMG5_bwriteKwd(&bf,5,mesh->na,(long)3*mesh->na*bf.isiz);
     }
     for (k=1; k<=mesh->na; k++) {
       if(!bin) {
         fprintf(inm,"%d %d %d \n",mesh->point[mesh->edge[k].a].tmp,
                 mesh->point[mesh->edge[k].b].tmp,mesh->edge[k].ref);
       } else {
-        fwrite(&mesh->point[mesh->edge[k].a].tmp,sw,1,inm);
-        fwrite(&mesh->point[mesh->edge[k].b].tmp,sw,1,inm);
-        fwrite(&mesh->edge[k].ref,sw,1,inm);
+        _MMG5_bwriteInt(&bf,mesh->point[mesh->edge[k].a].tmp);
+        _MMG5_bwriteInt(&bf,mesh->point[mesh->edge[k].b].tmp);
+        _MMG5_bwriteInt(&bf,mesh->edge[k].ref);
       }
       if ( mesh->edge[k].tag & MG_GEO ) nr++;
       if ( mesh->edge[k].tag & MG_REQ ) nedreq++;
@@ -1649,11 +1632,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         fprintf(inm,"%s",chaine);
         fprintf(inm,"%d\n",nr);
       } else {
-        binch = 14; //Ridges
-        fwrite(&binch,sw,1,inm);
-        bpos += 12 + 4*nr;//Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nr,sw,1,inm);
+        _MMG5_bwriteKwd(&bf,14,nr,(long)nr*bf.isiz);
       }
       na = 0;
       for (k=1; k<=mesh->na; k++) {
@@ -1662,7 +1641,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
           if(!bin) {
             fprintf(inm,"%d \n",na);
           } else {
-            fwrite(&na,sw,1,inm);
+            _MMG5_bwriteInt(&bf,na);
           }
         }
       }
@@ -1674,11 +1653,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         fprintf(inm,"%s",chaine);
         fprintf(inm,"%d\n",nedreq);
       } else {
-        binch = 16; //RequiredEdges
-        fwrite(&binch,sw,1,inm);
-        bpos += 12 + 4*nedreq;//Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nedreq,sw,1,inm);
+        _MMG5_bwriteKwd(&bf,16,nedreq,(long)nedreq*bf.isiz);
       }
       na = 0;
       for (k=1; k<=mesh->na; k++) {
@@ -1687,7 +1662,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
           if(!bin) {
             fprintf(inm,"%d \n",na);
           } else {
-            fwrite(&na,sw,1,inm);
+            _MMG5_bwriteInt(&bf,na);
           }
         }
       }
@@ -1718,7 +1693,11 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     fprintf(inm,"%s",chaine);
   } else {
     binch = 54; //End
-    fwrite(&binch,sw,1,inm);
+    _MMG5_bwrite(&bf,&binch,sw);
+    if ( !_MMG5_bclose(&bf) ) {
+      fclose(inm);
+      return(0);
+    }
   }
   fclose(inm);
   return(1);
@@ -1745,6 +1724,7 @@ int MMG3D_saveMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *fil
  */
 int MMG3D_loadSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   FILE       *inm;
+  _MMG5_Mmap  mm;
   long        posnp;
   int         iswp,ier,dim;
   int         k,ver,bin,np,nsols,*type;
@@ -1785,19 +1765,34 @@ int MMG3D_loadSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   _MMG5_SAFE_FREE(type);
 
   /* Read mesh solutions */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
-
-  if ( met->ver == 1 ) {
-    /* Simple precision */
-    for (k=1; k<=mesh->np; k++) {
-      MMG5_readFloatSol3D(met,inm,bin,iswp,k);
+  if ( !bin ) {
+    if ( !_MMG5_mmapOpen(&mm,inm) ) {
+      fclose(inm);
+      return(-1);
+    }
+    mm.nth = mesh->info.nthreads;
+    ier = _MMG5_mmapSol(&mm,met,posnp);
+    _MMG5_mmapClose(&mm);
+    if ( !ier ) {
+      fclose(inm);
+      return(-1);
     }
   }
   else {
-    /* Double precision */
-    for (k=1; k<=mesh->np; k++) {
-      MMG5_readDoubleSol3D(met,inm,bin,iswp,k);
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+
+    if ( met->ver == 1 ) {
+      /* Simple precision */
+      for (k=1; k<=mesh->np; k++) {
+        MMG5_readFloatSol3D(met,inm,bin,iswp,k);
+      }
+    }
+    else {
+      /* Double precision */
+      for (k=1; k<=mesh->np; k++) {
+        MMG5_readDoubleSol3D(met,inm,bin,iswp,k);
+      }
     }
   }
 
@@ -1825,7 +1820,7 @@ int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   int         iswp,ier,dim;
   int         j,k,ver,bin,np,nsols,*type;
   char        data[10];
-  static char mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn = 0;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,3,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -1927,17 +1922,38 @@ int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 int MMG3D_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   FILE*        inm;
   MMG5_pPoint  ppt;
+  _MMG5_Bfile  bf;
   int          binch,bin,ier,k;
 
   if ( !met->m )  return(-1);
 
-  met->ver = 2;
+  /* The positions of a binary file are stored on 64 bits (version 3) if it
+   * may exceed 2GB */
+  met->ver = ( 8*(long)met->size*mesh->np + 1024 > INT_MAX ) ? 3 : 2;
 
   ier = MMG5_saveSolHeader( mesh,filename,&inm,met->ver,&bin,mesh->np,met->dim,
                             1,&met->type,&met->size);
 
   if ( ier < 1 )  return ier;
 
+  if ( bin ) {
+    if ( !_MMG5_bopen(&bf,inm,met->ver) ) {
+      fclose(inm);
+      return(0);
+    }
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) ) continue;
+
+      MMG5_bwriteDoubleSol3D(mesh,met,&bf,k,1);
+    }
+    binch = 54; //End
+    _MMG5_bwrite(&bf,&binch,sw);
+    ier = _MMG5_bclose(&bf);
+    fclose(inm);
+    return(ier);
+  }
+
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
     if ( !MG_VOK(ppt) ) continue;
@@ -1947,12 +1963,7 @@ int MMG3D_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   }
 
   /* End file */
-  if(!bin) {
-    fprintf(inm,"\n\nEnd\n");
-  } else {
-    binch = 54; //End
-    fwrite(&binch,sw,1,inm);
-  }
+  fprintf(inm,"\n\nEnd\n");
   fclose(inm);
   return(1);
 }
@@ -1970,19 +1981,22 @@ int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol    psl;
   FILE*        inm;
   MMG5_pPoint  ppt;
+  _MMG5_Bfile  bf;
+  long         bsiz;
   int          binch,bin,ier,k,j;
   int          *type,*size;
 
   if ( !(*sol)[0].m )  return(-1);
 
-  (*sol)[0].ver = 2;
-
   _MMG5_SAFE_CALLOC(type,mesh->nsols,int,0);
   _MMG5_SAFE_CALLOC(size,mesh->nsols,int,0);
+  bsiz = 1024;
   for (k=0; k<mesh->nsols; ++k ) {
     type[k] = (*sol)[k].type;
     size[k] = (*sol)[k].size;
+    bsiz   += 8*(long)size[k]*mesh->np;
   }
+  (*sol)[0].ver = ( bsiz > INT_MAX ) ? 3 : 2;
 
   ier = MMG5_saveSolHeader( mesh,filename,&inm,(*sol)[0].ver,&bin,mesh->np,
                             (*sol)[0].dim,mesh->nsols,type,size);
@@ -1992,6 +2006,27 @@ int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
   if ( ier < 1 )  return ier;
 
+  if ( bin ) {
+    if ( !_MMG5_bopen(&bf,inm,(*sol)[0].ver) ) {
+      fclose(inm);
+      return(0);
+    }
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) ) continue;
+
+      for ( j=0; j<mesh->nsols; ++j ) {
+        psl = *sol+j;
+        MMG5_bwriteDoubleSol3D(mesh,psl,&bf,k,0);
+      }
+    }
+    binch = 54; //End
+    _MMG5_bwrite(&bf,&binch,sw);
+    ier = _MMG5_bclose(&bf);
+    fclose(inm);
+    return(ier);
+  }
+
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
     if ( !MG_VOK(ppt) ) continue;
@@ -2004,12 +2039,12 @@ int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   }
 
   /* End file */
-  if(!bin) {
-    fprintf(inm,"\n\nEnd\n");
-  } else {
-    binch = 54; //End
-    fwrite(&binch,sw,1,inm);
-  }
+  fprintf(inm,"\n\nEnd\n");
   fclose(inm);
   return(1);
 }
+
+int MMG3D_saveStats(MMG5_pMesh mesh, const char *filename) {
+
+  return(_MMG5_saveStats(mesh,filename,"mmg3d"));
+}
@@ -95,7 +95,9 @@ int _MMG5_intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,
  * \return 0 if fail, 1 otherwise.
  *
  * Interpolation of anisotropic sizemap at parameter \a s along edge \a i of elt
- * \a k for a classic storage of ridges metrics (before defsiz call).
+ * \a k for a classic storage of ridges metrics (before defsiz call). The
+ * factorisation of the metric of the first extremity is taken in the metric
+ * cache.
  *
  */
 int _MMG3D_intmet33_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,
@@ -112,7 +114,7 @@ int _MMG3D_intmet33_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,
   n   = &met->m[6*ip2];
   mr  = &met->m[6*ip];
 
-  return(_MMG5_mmgIntmet33_ani(m,n,mr,s));
+  return(_MMG5_mmgIntmet33Vert(mesh,ip1,m,n,mr,s));
 }
 
 /**
@@ -204,7 +206,7 @@ static inline int
 _MMG5_intregvolmet(double *ma,double *mb,double *mp,double t) {
   double        dma[6],dmb[6],mai[6],mbi[6],mi[6];
   int           i;
-  static char   mmgWarn=0;
+  static MMG5_THREAD_LOCAL char   mmgWarn=0;
 
   for (i=0; i<6; i++) {
     dma[i] = ma[i];
@@ -337,7 +339,7 @@ int _MMG5_interp4barintern(MMG5_pSol met,int ip,double cb[4],double dm0[6],
                            double dm1[6],double dm2[6],double dm3[6]) {
   double        m0i[6],m1i[6],m2i[6],m3i[6],mi[6];
   int           i;
-  static char   mmgWarn=0;
+  static MMG5_THREAD_LOCAL char   mmgWarn=0;
 
  if ( !_MMG5_invmat(dm0,m0i) || !_MMG5_invmat(dm1,m1i) ||
        !_MMG5_invmat(dm2,m2i) || !_MMG5_invmat(dm3,m3i) ) {
@@ -471,3 +473,159 @@ int _MMG5_interp4bar33_ani(MMG5_pMesh mesh, MMG5_pSol met, int k, int ip,
   }
   return(_MMG5_interp4barintern(met,ip,cb,dm0,dm1,dm2,dm3));
 }
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ip1 index of the first extremity of the edge.
+ * \param ip2 index of the second extremity of the edge.
+ * \param ip index of the new point.
+ * \param s interpolation parameter (between 0 and 1).
+ *
+ * Linear interpolation of the user fields at parameter \a s along the edge
+ * \f$ ip_1 ip_2 \f$. The values of a point are contiguous so all the fields
+ * are interpolated by one loop that the compiler vectorises.
+ *
+ */
+void _MMG3D_intfieldEdg(MMG5_pMesh mesh,int ip1,int ip2,int ip,double s) {
+  double *f,*f1,*f2;
+  int    i,n;
+
+  n  = mesh->fsize;
+  f1 = &mesh->field[n*ip1];
+  f2 = &mesh->field[n*ip2];
+  f  = &mesh->field[n*ip];
+
+  for (i=0; i<n; i++)
+    f[i] = (1.0-s)*f1[i] + s*f2[i];
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param k element index.
+ * \param i local index of edge in \a k.
+ * \param ip index of the new point.
+ * \param s interpolation parameter (between 0 and 1).
+ *
+ * Linear interpolation of the user fields at parameter \a s along edge \a i
+ * of elt \a k.
+ *
+ */
+void _MMG3D_intfield(MMG5_pMesh mesh,int k,char i,int ip,double s) {
+  MMG5_pTetra pt;
+
+  pt = &mesh->tetra[k];
+  _MMG3D_intfieldEdg(mesh,pt->v[_MMG5_iare[i][0]],pt->v[_MMG5_iare[i][1]],
+                     ip,s);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param k index of the tetra.
+ * \param ip index of the new point.
+ * \param cb barycentric coordinates of \a ip in \a k.
+ *
+ * Linear interpolation of the user fields in a tetra given the barycentric
+ * coordinates of the new point in \a k.
+ *
+ */
+void _MMG3D_intfield4bar(MMG5_pMesh mesh,int k,int ip,double cb[4]) {
+  MMG5_pTetra pt;
+  double      *f,*f0,*f1,*f2,*f3;
+  int         i,n;
+
+  pt = &mesh->tetra[k];
+  n  = mesh->fsize;
+  f0 = &mesh->field[n*pt->v[0]];
+  f1 = &mesh->field[n*pt->v[1]];
+  f2 = &mesh->field[n*pt->v[2]];
+  f3 = &mesh->field[n*pt->v[3]];
+  f  = &mesh->field[n*ip];
+
+  for (i=0; i<n; i++)
+    f[i] = cb[0]*f0[i] + cb[1]*f1[i] + cb[2]*f2[i] + cb[3]*f3[i];
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param list pointer toward the volumic ball of the moved point.
+ * \param ilist size of the ball.
+ * \param c new coordinates of the point.
+ *
+ * Interpolation of the user fields at the new position \a c of the center of
+ * the ball \a list, called before the update of its coordinates. The fields are
+ * interpolated in the tetra of the ball that contains \a c or, for a point
+ * moved along a curved surface, in the closest one (with clamped barycentric
+ * coordinates).
+ *
+ */
+void _MMG3D_movfield(MMG5_pMesh mesh,int *list,int ilist,double c[3]) {
+  MMG5_pTetra pt;
+  double      *q[4],cb[4],cbest[4],vol,cmin,best,dd;
+  int         ip,kbest,l,j;
+
+  ip    = mesh->tetra[list[0]/4].v[list[0]%4];
+  kbest = 0;
+  best  = -DBL_MAX;
+  for (l=0; l<ilist; l++) {
+    pt = &mesh->tetra[list[l]/4];
+    for (j=0; j<4; j++)
+      q[j] = mesh->point[pt->v[j]].c;
+    vol = _MMG5_det4pt(q[0],q[1],q[2],q[3]);
+    if ( vol <= 0. )  continue;
+
+    vol   = 1./vol;
+    cb[0] = vol*_MMG5_det4pt(c,q[1],q[2],q[3]);
+    cb[1] = vol*_MMG5_det4pt(q[0],c,q[2],q[3]);
+    cb[2] = vol*_MMG5_det4pt(q[0],q[1],c,q[3]);
+    cb[3] = vol*_MMG5_det4pt(q[0],q[1],q[2],c);
+    cmin  = MG_MIN(MG_MIN(cb[0],cb[1]),MG_MIN(cb[2],cb[3]));
+    if ( cmin > best ) {
+      best  = cmin;
+      kbest = list[l]/4;
+      memcpy(cbest,cb,4*sizeof(double));
+      if ( best >= 0. )  break;
+    }
+  }
+  if ( !kbest )  return;
+
+  if ( best < 0. ) {
+    dd = 0.;
+    for (j=0; j<4; j++) {
+      cbest[j] = MG_MAX(cbest[j],0.);
+      dd += cbest[j];
+    }
+    if ( dd < _MMG5_EPSD2 )  return;
+    dd = 1./dd;
+    for (j=0; j<4; j++)  cbest[j] *= dd;
+  }
+  _MMG3D_intfield4bar(mesh,kbest,ip,cbest);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param perm new index of the points 1 to \a mesh->np (0 if the point is
+ * removed).
+ * \return 1 if success, 0 if fail.
+ *
+ * Move the user fields of the point \a k at the position \a perm[k] before a
+ * renumbering of the points. The permutation table is not modified.
+ *
+ */
+int _MMG3D_permField(MMG5_pMesh mesh,int *perm) {
+  double *field;
+  int    k,n;
+
+  n = mesh->fsize;
+  _MMG5_ADD_MEM(mesh,n*(mesh->npmax+1)*sizeof(double),"user fields",
+                return(0));
+  _MMG5_SAFE_CALLOC(field,n*(mesh->npmax+1),double,0);
+
+  for (k=1; k<=mesh->np; k++) {
+    if ( !perm[k] )  continue;
+    memcpy(&field[n*perm[k]],&mesh->field[n*k],n*sizeof(double));
+  }
+  _MMG5_DEL_MEM(mesh,mesh->field,n*(mesh->npmax+1)*sizeof(double));
+  mesh->field = field;
+
+  return(1);
+}
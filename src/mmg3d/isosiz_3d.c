@@ -35,7 +35,10 @@
 #include "mmg3d.h"
 #include "inlined_functions.h"
 
-extern char   ddb;
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
 
 #define MAXLEN    1.0e9
 #define A64TH     0.015625
@@ -97,7 +100,7 @@ _MMG5_defsizreg(MMG5_pMesh mesh,MMG5_pSol met,int nump,int *lists,
   double       kappa[2],vp[2][2];
   int          k,na,nb,ntempa,ntempb,iel,ip0;
   char         iface,i,j,i0;
-  static char  mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
+  static MMG5_THREAD_LOCAL char  mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
 
   p0 = &mesh->point[nump];
 
@@ -898,72 +901,100 @@ int _MMG3D_defsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
- * \return 0 if fail, 1 otherwise.
+ * \param k index of the tetra.
+ * \param upd table of the updated points.
+ * \return the number of truncated sizes.
  *
- * Enforce mesh gradation by truncating size map.
+ * Truncate the sizes at the extremities of the edges of the tetra \a k.
  *
  */
-int _MMG5_gradsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
+static int _MMG3D_gradtet_iso(MMG5_pMesh mesh,MMG5_pSol met,int k,int *upd) {
   MMG5_pTetra    pt;
   MMG5_pPoint    p0,p1;
   double    l,hn;
-  int       ip0,ip1,it,maxit,nu,nup,k;
+  int       ip0,ip1,nu;
   char      i,j,ia,i0,i1;
 
+  pt = &mesh->tetra[k];
+  if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  return(0);
+
+  nu = 0;
+  for (i=0; i<4; i++) {
+    for (j=0; j<3; j++) {
+      ia  = _MMG5_iarf[i][j];
+      i0  = _MMG5_iare[ia][0];
+      i1  = _MMG5_iare[ia][1];
+      ip0 = pt->v[i0];
+      ip1 = pt->v[i1];
+      p0  = &mesh->point[ip0];
+      p1  = &mesh->point[ip1];
+      if ( p0->flag < mesh->base-1 && p1->flag < mesh->base-1 )  continue;
+
+      l = (p1->c[0]-p0->c[0])*(p1->c[0]-p0->c[0]) + (p1->c[1]-p0->c[1])*(p1->c[1]-p0->c[1])\
+        + (p1->c[2]-p0->c[2])*(p1->c[2]-p0->c[2]);
+      l = sqrt(l);
+
+      if ( met->m[ip0] < met->m[ip1] ) {
+        if ( met->m[ip0] < _MMG5_EPSD )  continue;
+        hn = met->m[ip0] + mesh->info.hgrad*l;
+        if ( met->m[ip1] > hn ) {
+          met->m[ip1] = hn;
+          p1->flag = mesh->base;
+          upd[nu++] = ip1;
+        }
+      }
+      else {
+        if ( met->m[ip1] < _MMG5_EPSD )  continue;
+        hn = met->m[ip1] + mesh->info.hgrad*l;
+        if ( met->m[ip0] > hn ) {
+          met->m[ip0] = hn;
+          p0->flag = mesh->base;
+          upd[nu++] = ip0;
+        }
+      }
+    }
+  }
+  return(nu);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Enforce mesh gradation by truncating size map. The sizes are propagated
+ * over the edge graph of the mesh from the smallest one (or by frontier
+ * relaxation if multiple threads are available), which gives the fixed point
+ * of the historical sweeps over the tetra. The sweeps are used if we lack of
+ * memory.
+ *
+ */
+int _MMG5_gradsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
+  int       *adr,*lst,nlst,it,nup,k;
+
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** Grading mesh\n");
 
   for (k=1; k<=mesh->np; k++)
     mesh->point[k].flag = mesh->base;
 
-  it = nup = 0;
-  maxit = 100;
-  do {
+  nup = -1;
+  it  = 1;
+  if ( _MMG3D_gradGraph(mesh,1,&adr,&lst,&nlst) ) {
     mesh->base++;
-    nu = 0;
-    for (k=1; k<=mesh->ne; k++) {
-      pt = &mesh->tetra[k];
-      if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
-
-      for (i=0; i<4; i++) {
-        for (j=0; j<3; j++) {
-          ia  = _MMG5_iarf[i][j];
-          i0  = _MMG5_iare[ia][0];
-          i1  = _MMG5_iare[ia][1];
-          ip0 = pt->v[i0];
-          ip1 = pt->v[i1];
-          p0  = &mesh->point[ip0];
-          p1  = &mesh->point[ip1];
-          if ( p0->flag < mesh->base-1 && p1->flag < mesh->base-1 )  continue;
-
-          l = (p1->c[0]-p0->c[0])*(p1->c[0]-p0->c[0]) + (p1->c[1]-p0->c[1])*(p1->c[1]-p0->c[1])\
-            + (p1->c[2]-p0->c[2])*(p1->c[2]-p0->c[2]);
-          l = sqrt(l);
-
-          if ( met->m[ip0] < met->m[ip1] ) {
-            if ( met->m[ip0] < _MMG5_EPSD )  continue;
-            hn = met->m[ip0] + mesh->info.hgrad*l;
-            if ( met->m[ip1] > hn ) {
-              met->m[ip1] = hn;
-              p1->flag = mesh->base;
-              nu++;
-            }
-          }
-          else {
-            if ( met->m[ip1] < _MMG5_EPSD )  continue;
-            hn = met->m[ip1] + mesh->info.hgrad*l;
-            if ( met->m[ip0] > hn ) {
-              met->m[ip0] = hn;
-              p0->flag = mesh->base;
-              nu++;
-            }
-          }
-        }
-      }
-    }
-    nup += nu;
+#ifdef USE_OPENMP
+    if ( _MMG5_NTHREADS(mesh) > 1 )
+      nup = _MMG3D_gradsizFront_iso(mesh,met,adr,lst,&it);
+    else
+#endif
+      nup = _MMG3D_gradsizHeap_iso(mesh,met,adr,lst);
+    _MMG3D_delGradGraph(mesh,&adr,&lst,nlst);
+  }
+  if ( nup < 0 ) {
+    for (k=1; k<=mesh->np; k++)
+      mesh->point[k].flag = mesh->base;
+    nup = _MMG3D_gradsizReplay(mesh,met,NULL,NULL,_MMG3D_gradtet_iso,100,&it);
   }
-  while( ++it < maxit && nu > 0 );
 
   if ( abs(mesh->info.imprim) > 4 )
     fprintf(stdout,"     gradation: %7d updated, %d iter.\n",nup,it);
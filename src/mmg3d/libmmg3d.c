@@ -83,6 +83,108 @@ void _MMG3D_Free_topoTables(MMG5_pMesh mesh) {
   return;
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 1 if the previous analysis can be reused, 0 otherwise.
+ *
+ * Check if the adjacency and the boundary data kept by the previous call
+ * (\ref MMG3D_IPARAM_warmstart) are still valid. If so, delete the boundary
+ * triangles and edges built by _MMG3D_packMesh for the user: the surface
+ * analysis is skipped and they would not be updated by the remeshing.
+ *
+ */
+static int _MMG3D_warmStart(MMG5_pMesh mesh) {
+
+  if ( !mesh->info.warmstart || !mesh->warm )  return(0);
+  mesh->warm = 0;
+
+  /* the partitions are analysed from scratch */
+  if ( mesh->info.npart > 1 )  return(0);
+
+  if ( !mesh->adja || !mesh->xtetra || !mesh->xpoint )  return(0);
+
+  /* the prisms and the nosurf mode need the full analysis */
+  if ( mesh->nprism || mesh->info.nosurf )  return(0);
+
+  if ( mesh->adjt )
+    _MMG5_DEL_MEM(mesh,mesh->adjt,(3*mesh->nt+4)*sizeof(int));
+  if ( mesh->tria )
+    _MMG5_DEL_MEM(mesh,mesh->tria,(mesh->nt+1)*sizeof(MMG5_Tria));
+  mesh->nt = 0;
+  if ( mesh->edge )
+    _MMG5_DEL_MEM(mesh,mesh->edge,(mesh->na+1)*sizeof(MMG5_Edge));
+  mesh->na = 0;
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Compact the xtetra and xpoint tables. The entries of the deleted tetra and
+ * points are not reused by the remeshing: without compaction the tables
+ * would grow at each call of a warm restart loop.
+ *
+ * \warning the tetra and the points must be packed.
+ */
+static int _MMG3D_packXTables(MMG5_pMesh mesh) {
+  MMG5_pTetra pt;
+  MMG5_pPoint ppt;
+  int         *idx,k,n,nmax;
+
+  nmax = MG_MAX(mesh->xt,mesh->xp);
+  _MMG5_ADD_MEM(mesh,(nmax+1)*sizeof(int),"boundary tables renumbering",
+                return(0));
+  _MMG5_SAFE_CALLOC(idx,nmax+1,int,0);
+
+  /* xtetra */
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( MG_EOK(pt) && pt->xt )  idx[pt->xt] = 1;
+  }
+  n = 0;
+  for (k=1; k<=mesh->xt; k++) {
+    if ( !idx[k] )  continue;
+    idx[k] = ++n;
+    if ( n != k )
+      memcpy(&mesh->xtetra[n],&mesh->xtetra[k],sizeof(MMG5_xTetra));
+  }
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( MG_EOK(pt) && pt->xt )  pt->xt = idx[pt->xt];
+  }
+  /* the new entries are expected to be zeroed */
+  if ( n < mesh->xt )
+    memset(&mesh->xtetra[n+1],0,(mesh->xt-n)*sizeof(MMG5_xTetra));
+  mesh->xt = n;
+
+  /* xpoint */
+  memset(idx,0,(nmax+1)*sizeof(int));
+  for (k=1; k<=mesh->np; k++) {
+    ppt = &mesh->point[k];
+    if ( MG_VOK(ppt) && ppt->xp )  idx[ppt->xp] = 1;
+  }
+  n = 0;
+  for (k=1; k<=mesh->xp; k++) {
+    if ( !idx[k] )  continue;
+    idx[k] = ++n;
+    if ( n != k )
+      memcpy(&mesh->xpoint[n],&mesh->xpoint[k],sizeof(MMG5_xPoint));
+  }
+  for (k=1; k<=mesh->np; k++) {
+    ppt = &mesh->point[k];
+    if ( MG_VOK(ppt) && ppt->xp )  ppt->xp = idx[ppt->xp];
+  }
+  if ( n < mesh->xp )
+    memset(&mesh->xpoint[n+1],0,(mesh->xp-n)*sizeof(MMG5_xPoint));
+  mesh->xp = n;
+
+  _MMG5_DEL_MEM(mesh,idx,(nmax+1)*sizeof(int));
+
+  return(1);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the solution structure.
@@ -376,6 +478,9 @@ int _MMG3D_packMesh(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
     }
     nbl++;
   }
+  /* clean the adjacency of the released slots (kept by a warm restart) */
+  if ( mesh->adja && ne < mesh->ne )
+    memset(&mesh->adja[4*ne+1],0,4*(mesh->ne-ne)*sizeof(int));
   mesh->ne = ne;
 
   /* update prisms and quads vertex indices */
@@ -430,6 +535,19 @@ int _MMG3D_packMesh(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
     }
   }
 
+  /* compact user fields */
+  nbl = 1;
+  if ( mesh->field ) {
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) )  continue;
+      if ( k!=nbl )
+        memcpy(&mesh->field[mesh->fsize*nbl],&mesh->field[mesh->fsize*k],
+               mesh->fsize*sizeof(double));
+      ++nbl;
+    }
+  }
+
   /*compact vertices*/
   np  = 0;
   nbl = 1;
@@ -485,6 +603,11 @@ int _MMG3D_packMesh(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
     }
   }
 
+  /* the boundary tables are kept for the next call */
+  if ( mesh->info.warmstart && mesh->xtetra && mesh->xpoint ) {
+    if ( !_MMG3D_packXTables(mesh) )  return(0);
+  }
+
   if ( mesh->info.imprim ) {
     fprintf(stdout,"     NUMBER OF VERTICES   %8d   CORNERS %8d\n",mesh->np,nc);
     fprintf(stdout,"     NUMBER OF TETRAHEDRA %8d\n",mesh->ne);
@@ -516,6 +639,7 @@ int _MMG3D_packMesh(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
 int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
   mytime    ctim[TIMEMAX];
   char      stim[32];
+  int       warm,ier;
 
   if ( mesh->info.imprim ) {
     fprintf(stdout,"\n  -- MMG3d, Release %s (%s) \n",MG_VER,MG_REL);
@@ -526,11 +650,20 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
   _MMG3D_Set_commonFunc();
 
 
-  _MMG5_warnOrientation(mesh);
+  /* the copy of the input mesh of the previous call is outdated */
+  _MMG3D_freeSource(mesh);
+  _MMG5_freeMetFac(mesh);
+
+  /* warm restart: reuse the topology and the analysis of the previous call */
+  warm = _MMG3D_warmStart(mesh);
 
-  /** Free topologic tables (adja, xpoint, xtetra) resulting from a previous
-   * run */
-  _MMG3D_Free_topoTables(mesh);
+  if ( !warm ) {
+    _MMG5_warnOrientation(mesh);
+
+    /** Free topologic tables (adja, xpoint, xtetra) resulting from a previous
+     * run */
+    _MMG3D_Free_topoTables(mesh);
+  }
 
   signal(SIGABRT,_MMG5_excfun);
   signal(SIGFPE,_MMG5_excfun);
@@ -541,6 +674,7 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  _MMG5_initStats(mesh);
 
   /* Check options */
   if ( mesh->info.lag > -1 ) {
@@ -605,6 +739,25 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
   if ( mesh->info.imprim )
     fprintf(stdout,"  --  INPUT DATA COMPLETED.     %s\n",stim);
 
+  /* partitioned remeshing (-1: the mesh is remeshed as a whole) */
+  if ( mesh->info.npart > 1 ) {
+    chrono(ON,&(ctim[3]));
+    ier = _MMG3D_mmg3dpart(mesh,met);
+    chrono(OFF,&(ctim[3]));
+    if ( ier >= 0 ) {
+      printim(ctim[3].gdif,stim);
+      if ( mesh->info.imprim )
+        fprintf(stdout,"  -- PHASE 2 COMPLETED.     %s\n",stim);
+
+      chrono(OFF,&ctim[0]);
+      printim(ctim[0].gdif,stim);
+      _MMG5_statTimes(mesh,ctim);
+      if ( mesh->info.imprim )
+        fprintf(stdout,"\n   MMG3DLIB: ELAPSED TIME  %s\n",stim);
+      _LIBMMG5_RETURN(mesh,met,ier);
+    }
+  }
+
   /* analysis */
   chrono(ON,&(ctim[2]));
   if ( mesh->info.imprim ) {
@@ -642,12 +795,28 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
     }
   }
 
-  /* mesh analysis */
-  if ( !_MMG3D_analys(mesh) ) {
+  /* mesh analysis (the normals are unit vectors: they don't depend on the
+   * scaling) */
+  if ( warm ) {
+    if ( abs(mesh->info.imprim) > 3 )
+      fprintf(stdout,"  ** WARM RESTART: ANALYSIS OF THE PREVIOUS CALL REUSED\n");
+  }
+  else if ( !_MMG3D_analys(mesh) ) {
     if ( !_MMG5_unscaleMesh(mesh,met) )  _LIBMMG5_RETURN(mesh,met,MMG5_STRONGFAILURE);
     _LIBMMG5_RETURN(mesh,met,MMG5_LOWFAILURE);
   }
 
+  /* copy of the input mesh for the transfer of the solutions */
+  if ( mesh->info.keepsrc && !_MMG3D_saveSource(mesh) )
+    fprintf(stderr,"\n  ## Warning: unable to keep a copy of the input mesh:"
+            " the solutions can't be interpolated.\n");
+
+  /* cache of the metric factorisations for the transport of the metric */
+  if ( mesh->info.metcache && met->size == 6 && !_MMG5_newMetFac(mesh) ) {
+    if ( mesh->info.imprim > 4 )
+      fprintf(stderr,"\n  ## Warning: unable to allocate the metric cache.\n");
+  }
+
   if ( mesh->info.imprim > 1 && met->m ) _MMG3D_prilen(mesh,met,0);
 
   chrono(OFF,&(ctim[2]));
@@ -688,6 +857,7 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
     _MMG5_RETURN_AND_PACK(mesh,met,NULL,MMG5_LOWFAILURE);
   }
 #endif
+  _MMG5_freeMetFac(mesh);
 
   chrono(OFF,&(ctim[3]));
   printim(ctim[3].gdif,stim);
@@ -711,11 +881,16 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
   if ( !_MMG3D_packMesh(mesh,met,NULL) )     _LIBMMG5_RETURN(mesh,met,MMG5_STRONGFAILURE);
   chrono(OFF,&(ctim[1]));
 
+  /* the next call may restart from the topology and the analysis */
+  mesh->warm = mesh->info.warmstart && mesh->adja;
+
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
+  _MMG5_statTimes(mesh,ctim);
   if ( mesh->info.imprim )
     fprintf(stdout,"\n   MMG3DLIB: ELAPSED TIME  %s\n",stim);
-  _LIBMMG5_RETURN(mesh,met,MMG5_SUCCESS);
+  _LIBMMG5_RETURN(mesh,met,
+                  mesh->stats.interrupted ? MMG5_INTERRUPTED : MMG5_SUCCESS);
 }
 
 int MMG3D_mmg3dls(MMG5_pMesh mesh,MMG5_pSol met) {
@@ -730,6 +905,11 @@ int MMG3D_mmg3dls(MMG5_pMesh mesh,MMG5_pSol met) {
 
   _MMG3D_Set_commonFunc();
 
+  /* the warm restart and the copy of the input mesh are only available for
+   * the adaptation */
+  mesh->warm = 0;
+  _MMG3D_freeSource(mesh);
+
   signal(SIGABRT,_MMG5_excfun);
   signal(SIGFPE,_MMG5_excfun);
   signal(SIGILL,_MMG5_excfun);
@@ -739,6 +919,7 @@ int MMG3D_mmg3dls(MMG5_pMesh mesh,MMG5_pSol met) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  _MMG5_initStats(mesh);
 
   /* Check options */
   if ( mesh->info.lag > -1 ) {
@@ -890,9 +1071,11 @@ int MMG3D_mmg3dls(MMG5_pMesh mesh,MMG5_pSol met) {
 
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
+  _MMG5_statTimes(mesh,ctim);
   if ( mesh->info.imprim )
     fprintf(stdout,"\n   MMG3DLS: ELAPSED TIME  %s\n",stim);
-  _LIBMMG5_RETURN(mesh,met,MMG5_SUCCESS);
+  _LIBMMG5_RETURN(mesh,met,
+                  mesh->stats.interrupted ? MMG5_INTERRUPTED : MMG5_SUCCESS);
 }
 
 
@@ -908,6 +1091,11 @@ int MMG3D_mmg3dmov(MMG5_pMesh mesh,MMG5_pSol met, MMG5_pSol disp) {
 
   _MMG3D_Set_commonFunc();
 
+  /* the warm restart and the copy of the input mesh are only available for
+   * the adaptation */
+  mesh->warm = 0;
+  _MMG3D_freeSource(mesh);
+
   signal(SIGABRT,_MMG5_excfun);
   signal(SIGFPE,_MMG5_excfun);
   signal(SIGILL,_MMG5_excfun);
@@ -917,6 +1105,7 @@ int MMG3D_mmg3dmov(MMG5_pMesh mesh,MMG5_pSol met, MMG5_pSol disp) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  _MMG5_initStats(mesh);
 
   /* Check options */
   if ( mesh->info.iso ) {
@@ -1085,8 +1274,10 @@ int MMG3D_mmg3dmov(MMG5_pMesh mesh,MMG5_pSol met, MMG5_pSol disp) {
 
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
+  _MMG5_statTimes(mesh,ctim);
   if ( mesh->info.imprim )
     fprintf(stdout,"\n   MMG3DMOV: ELAPSED TIME  %s\n",stim);
   disp->npi = disp->np;
-  _LIBMMG5_RETURN(mesh,met,MMG5_SUCCESS);
+  _LIBMMG5_RETURN(mesh,met,
+                  mesh->stats.interrupted ? MMG5_INTERRUPTED : MMG5_SUCCESS);
 }
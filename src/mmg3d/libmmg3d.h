@@ -81,9 +81,21 @@ enum MMG3D_Param {
   MMG3D_IPARAM_nomove,            /*!< [1/0], Avoid/allow point relocation */
   MMG3D_IPARAM_nosurf,            /*!< [1/0], Avoid/allow surface modifications */
   MMG3D_IPARAM_numberOfLocalParam,/*!< [n], Number of local parameters */
-  MMG3D_IPARAM_renum,             /*!< [1/0], Turn on/off point relocation with Scotch */
+  MMG3D_IPARAM_renum,             /*!< [1/0], Turn on/off point relocation with Scotch (with a space filling curve if Scotch is not available) */
   MMG3D_IPARAM_anisosize,         /*!< [1/0], Turn on/off anisotropic metric creation when no metric is provided */
   MMG3D_IPARAM_octree,            /*!< [n], Specify the max number of points per octree cell (DELAUNAY) */
+  MMG3D_IPARAM_sortadja,          /*!< [0/1/2], Build the tetra adjacency by hashing the faces (0), by sorting them in parallel if several threads are available (1) or by sorting them in any case (2) */
+  MMG3D_IPARAM_renumit,           /*!< [n], Renumber the mesh along a space filling curve every n iterations of the remeshing loop (0: never) */
+  MMG3D_IPARAM_stats,             /*!< [1/0], Turn on/off the output of the performance counters of the run */
+  MMG3D_IPARAM_batchins,          /*!< [1/0], Turn on/off the batched insertion of the Delaunay points along a space filling curve */
+  MMG3D_IPARAM_colmove,           /*!< [1/0], Turn on/off the relocation of the internal points by independent sets (colors), in parallel if OpenMP is used */
+  MMG3D_IPARAM_parswap,           /*!< [1/0], Turn on/off the swap of the internal edges by independent sets, evaluated in parallel if OpenMP is used */
+  MMG3D_IPARAM_nthreads,          /*!< [n], Number of threads of the multithreaded kernels (0: OpenMP default) */
+  MMG3D_IPARAM_actset,            /*!< [1/0], Turn on/off the restriction of the remeshing sweeps to the elements modified by the last iterations (active set) */
+  MMG3D_IPARAM_warmstart,         /*!< [1/0], Turn on/off the reuse of the adjacency and of the surface analysis of the previous MMG3D_mmg3dlib call (only the metric may change between the calls) */
+  MMG3D_IPARAM_keepsrc,           /*!< [1/0], Turn on/off the copy of the input mesh of MMG3D_mmg3dlib, used by MMG3D_interpolate to transfer solutions onto the output mesh */
+  MMG3D_IPARAM_metcache,          /*!< [1/0], Turn on/off the cache of the factorisations of the metric at the vertices (anisotropic metric) */
+  MMG3D_IPARAM_npart,             /*!< [n], Number of partitions of the partitioned remeshing, remeshed concurrently with frozen interfaces (0/1: no partitioning) */
   MMG3D_DPARAM_angleDetection,    /*!< [val], Value for angle detection */
   MMG3D_DPARAM_hmin,              /*!< [val], Minimal mesh size */
   MMG3D_DPARAM_hmax,              /*!< [val], Maximal mesh size */
@@ -91,6 +103,7 @@ enum MMG3D_Param {
   MMG3D_DPARAM_hausd,             /*!< [val], Control global Hausdorff distance (on all the boundary surfaces of the mesh) */
   MMG3D_DPARAM_hgrad,             /*!< [val], Control gradation */
   MMG3D_DPARAM_ls,                /*!< [val], Value of level-set */
+  MMG3D_DPARAM_timeBudget,        /*!< [val], Wall clock budget (s) of the remeshing: the remeshing is interrupted once it is exceeded (0: no budget) */
   MMG3D_PARAM_size,               /*!< [n], Number of parameters */
 };
 
@@ -832,6 +845,68 @@ int MMG3D_Set_tensorSol(MMG5_pSol met, double m11,double m12, double m13,
  *
  */
 int MMG3D_Set_tensorSols(MMG5_pSol met, double *sols);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param nfields number of user fields (0 to remove the fields).
+ * \param typFields types of the fields (\ref MMG5_Scalar, \ref MMG5_Vector
+ * or \ref MMG5_Tensor).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Register \a nfields user fields at mesh vertices (flow variables for
+ * example). They are carried through the remeshing: each new point receives
+ * the linear interpolation of the fields along the split edge (pattern
+ * splitting, Delaunay insertion, swaps and level-set discretization) or in the
+ * split tetrahedron. The values of all the fields at a point are stored
+ * contiguously (scalar fields take 1 value, vectors 3 and tensors 6), in the
+ * order of \a typFields. Must be called after the mesh size setting; the
+ * fields are initialized to 0.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_SET_FIELDSSIZE(mesh,nfields,typFields,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
+ * >     INTEGER, INTENT(IN)           :: nfields\n
+ * >     INTEGER, DIMENSION(*), INTENT(IN) :: typFields\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMG3D_Set_fieldsSize(MMG5_pMesh mesh, int nfields, int *typFields);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param f values of the user fields at vertex \a pos (see
+ * \ref MMG3D_Get_fieldsSize for the number of values).
+ * \param pos position of the vertex.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set the values of the user fields at vertex \a pos.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_SET_FIELDSATVERTEX(mesh,f,pos,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
+ * >     REAL(KIND=8), DIMENSION(*),INTENT(IN) :: f\n
+ * >     INTEGER, INTENT(IN)           :: pos\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMG3D_Set_fieldsAtVertex(MMG5_pMesh mesh, double *f, int pos);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param f values of the user fields at mesh vertices. If \a size is the
+ * number of values by vertex, f[size*(i-1)]\@size are the values at vertex i.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set the values of the user fields at mesh vertices.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_SET_FIELDS(mesh,f,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
+ * >     REAL(KIND=8), DIMENSION(*),INTENT(IN) :: f\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMG3D_Set_fields(MMG5_pMesh mesh, double *f);
 /**
  * \param mesh pointer toward the mesh structure.
  *
@@ -1394,6 +1469,60 @@ int MMG3D_Get_tensorSol(MMG5_pSol met, double *m11,double *m12, double *m13,
  *
  */
 int MMG3D_Get_tensorSols(MMG5_pSol met, double *sols);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param nfields pointer toward the number of user fields.
+ * \param size pointer toward the number of values of the fields by vertex.
+ * \return 1.
+ *
+ * Get the number of user fields and the number of values that they take at
+ * each vertex.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_GET_FIELDSSIZE(mesh,nfields,size,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
+ * >     INTEGER, INTENT(OUT)          :: nfields,size\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMG3D_Get_fieldsSize(MMG5_pMesh mesh, int *nfields, int *size);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param f pointer toward the values of the user fields at vertex \a pos.
+ * \param pos position of the vertex.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Get the values of the user fields at vertex \a pos.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_GET_FIELDSATVERTEX(mesh,f,pos,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
+ * >     REAL(KIND=8), DIMENSION(*),INTENT(OUT) :: f\n
+ * >     INTEGER, INTENT(IN)           :: pos\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMG3D_Get_fieldsAtVertex(MMG5_pMesh mesh, double *f, int pos);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param f table of the values of the user fields at mesh vertices. If
+ * \a size is the number of values by vertex, f[size*(i-1)]\@size are the
+ * values at vertex i.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Get the values of the user fields at mesh vertices.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_GET_FIELDS(mesh,f,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
+ * >     REAL(KIND=8), DIMENSION(*),INTENT(OUT) :: f\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMG3D_Get_fields(MMG5_pMesh mesh, double *f);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param iparam integer parameter to set (see \a MMG3D_Param structure).
@@ -1411,6 +1540,38 @@ int MMG3D_Get_tensorSols(MMG5_pSol met, double *sols);
  */
 int MMG3D_Get_iparameter(MMG5_pMesh mesh, int iparam);
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param stats pointer toward the structure that receives the counters.
+ * \return 1.
+ *
+ * Get the performance counters of the last library call (phase times, memory
+ * high-water mark and, if the library is built with the USE_STATS option,
+ * calls, successes and time of the local operators).
+ *
+ * \remark No Fortran interface (use the MMG3D_saveStats function).
+ *
+ */
+int MMG3D_Get_stats(MMG5_pMesh mesh, MMG5_pStats stats);
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param func progress/cancel callback (NULL to remove the callback).
+ * \param data pointer toward the user data given to the callback.
+ * \return 1.
+ *
+ * Set the progress/cancel callback of the remeshing. The callback is called
+ * between the sweeps of the remeshing with \a data and the elapsed time of
+ * the library call and returns a non zero value to interrupt the remeshing.
+ * An interrupted remeshing stops cleanly: the library returns a conform,
+ * packed and partially remeshed mesh with the \ref MMG5_INTERRUPTED value.
+ *
+ * \remark No Fortran interface (use the MMG3D_DPARAM_timeBudget parameter to
+ * bound the remeshing time).
+ *
+ */
+int MMG3D_Set_interruptFunc(MMG5_pMesh mesh, MMG5_Interrupt func, void *data);
+
 /* input/output functions */
 /**
  * \param mesh pointer toward the mesh structure.
@@ -1419,6 +1580,12 @@ int MMG3D_Get_iparameter(MMG5_pMesh mesh, int iparam);
  *
  * Read mesh data.
  *
+ * \remark The binary files of versions 1 to 4 are read. The numbers of
+ * entities, the indices and the references are stored in int, so the files of
+ * versions 3 and 4 are rejected if one of their values doesn't fit in 32 bits
+ * (the 64 bits positions of these versions only lift the 2 GB file size
+ * limit). The binary readers of mmgs and mmg2d only read versions 1 and 2.
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_LOADMESH(mesh,filename,strlen,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: mesh\n
@@ -1475,6 +1642,11 @@ int MMG3D_loadMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *fil
  *
  * Save mesh data.
  *
+ * \remark The binary files are written in version 2, or in version 3 (64 bits
+ * positions) if they may exceed 2 GB. Version 4 is never needed since the
+ * numbers of entities are stored in int. The binary writers of mmgs and mmg2d
+ * always write version 2.
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SAVEMESH(mesh,filename,strlen,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: mesh\n
@@ -1601,6 +1773,25 @@ int MMG3D_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename);
  */
 int MMG3D_saveAllSols(MMG5_pMesh  mesh,MMG5_pSol *sol ,const char *filename);
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param filename name of the JSON file (if NULL, the name of the output
+ * mesh with the \a .stats.json extension).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Save the performance counters of the last library call in a JSON file.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_SAVESTATS(mesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: mesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMG3D_saveStats(MMG5_pMesh mesh, const char *filename);
+
 /* deallocations */
 /**
  * \param starter dummy argument used to initialize the variadic argument
@@ -1715,6 +1906,19 @@ int MMG3D_Free_names(const int starter,...);
  *
  * Main program for the remesh library.
  *
+ * \remark With the \ref MMG3D_IPARAM_warmstart parameter, the adjacency, the
+ * boundary data (xtetra/xpoint tables, normals, ridges...) of the output mesh
+ * are kept and the next call skips the surface analysis: only the metric may
+ * be updated between the two calls. Any function that sets the mesh entities
+ * or the angle detection triggers a full analysis at the next call.
+ *
+ * \remark With the \ref MMG3D_IPARAM_npart parameter, the tetra are split in
+ * partitions by a coordinate bisection and the partitions are remeshed
+ * concurrently, with frozen interfaces, then merged. The bisection axes are
+ * rotated between the iterations to remesh the interfaces. The meshes with
+ * prisms or quadrilaterals and the optim mode are remeshed as a whole, and
+ * the user callback is only checked between the iterations.
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_MMG3DLIB(mesh,met,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: mesh,met\n
@@ -1966,6 +2170,9 @@ int MMG3D_Get_adjaTet(MMG5_pMesh mesh,int kel, int listet[4]);
  * coordinates of edge extremities) according to the size
  * prescription.
  *
+ * \warning the metric type used is the one of the last \ref MMG3D_setfunc
+ * call of the calling thread.
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_LENEDGCOOR(ca,cb,sa,sb,retval)\n
  * >     REAL(KIND=8), INTENT(IN)           :: ca,cb,sa,sb\n
@@ -1973,7 +2180,7 @@ int MMG3D_Get_adjaTet(MMG5_pMesh mesh,int kel, int listet[4]);
  * >   END SUBROUTINE\n
  *
  */
-double (*MMG3D_lenedgCoor)(double *ca,double *cb,double *sa,double *sb);
+double MMG3D_lenedgCoor(double *ca,double *cb,double *sa,double *sb);
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -1981,7 +2188,10 @@ double (*MMG3D_lenedgCoor)(double *ca,double *cb,double *sa,double *sb);
  * \return 0 if failed, 1 otherwise.
  *
  * Create table of adjacency. Set pack variable to 0 for a compact
- * mesh and to 1 for a mesh that need to be packed.
+ * mesh and to 1 for a mesh that need to be packed. If the
+ * \a MMG3D_IPARAM_sortadja parameter is set, the faces are sorted in parallel
+ * instead of being hashed when several threads are available (or in any case
+ * if the parameter is 2).
  *
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_HASHTETRA(mesh,pack,retval)\n
@@ -2026,6 +2236,31 @@ int MMG3D_doSol(MMG5_pMesh mesh,MMG5_pSol met);
  */
 int MMG3D_Set_constantSize(MMG5_pMesh mesh,MMG5_pSol met);
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param solin pointer toward the solution at the vertices of the input mesh
+ * of the last \ref MMG3D_mmg3dlib call.
+ * \param solout pointer toward the solution at the vertices of the output
+ * mesh (allocated by the function, with the type of \a solin).
+ * \return 1 if success, 0 otherwise.
+ *
+ * Interpolate the P1 solution \a solin of the input mesh at the vertices of
+ * the output mesh. The \ref MMG3D_IPARAM_keepsrc parameter must be set before
+ * the call of \ref MMG3D_mmg3dlib so that the library keeps a copy of the
+ * input mesh. Each vertex is located in this copy by a walk through the
+ * adjacency starting from a grid of buckets; the vertices are processed in
+ * parallel (\ref MMG3D_IPARAM_nthreads). The vertices outside the input mesh
+ * take the values of the closest point of the closest tetra found.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_INTERPOLATE(mesh,solin,solout,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT)     :: mesh,solin,solout\n
+ * >     INTEGER, INTENT(OUT)               :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMG3D_interpolate(MMG5_pMesh mesh,MMG5_pSol solin,MMG5_pSol solout);
+
 /** To associate function pointers without calling MMG3D_mmg3dlib */
 /**
  * \param mesh pointer toward the mesh structure (unused).
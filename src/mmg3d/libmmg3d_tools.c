@@ -44,7 +44,7 @@ void MMG3D_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
     }
     _MMG5_caltri          = _MMG5_caltri_iso;
     _MMG5_lenedg          = _MMG5_lenedg_iso;
-    MMG3D_lenedgCoor      = _MMG5_lenedgCoor_iso;
+    _MMG5_lenedgCoor      = _MMG5_lenedgCoor_iso;
     _MMG5_lenSurfEdg      = _MMG5_lenSurfEdg_iso;
     _MMG5_intmet          = _MMG5_intmet_iso;
     _MMG5_lenedgspl       = _MMG5_lenedg_iso;
@@ -65,14 +65,14 @@ void MMG3D_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
       _MMG5_caltet          = _MMG5_caltet_iso;
       _MMG5_caltri          = _MMG5_caltri_iso;
       _MMG5_lenedg         = _MMG5_lenedg_iso;
-      MMG3D_lenedgCoor     = _MMG5_lenedgCoor_iso;
+      _MMG5_lenedgCoor     = _MMG5_lenedgCoor_iso;
       _MMG5_lenSurfEdg     = _MMG5_lenSurfEdg_iso;
     }
     else {
       _MMG5_caltet         = _MMG5_caltet_ani;
       _MMG5_caltri         = _MMG5_caltri_ani;
       _MMG5_lenedg         = _MMG5_lenedg_ani;
-      MMG3D_lenedgCoor     = _MMG5_lenedgCoor_ani;
+      _MMG5_lenedgCoor     = _MMG5_lenedgCoor_ani;
       _MMG5_lenSurfEdg     = _MMG5_lenSurfEdg_ani;
     }
     _MMG5_intmet         = _MMG5_intmet_ani;
@@ -92,6 +92,32 @@ void MMG3D_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
   }
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \return the batched quality kernel matching \ref _MMG5_caltet
+ * (\ref _MMG3D_QUALISO or \ref _MMG3D_QUALANI), \ref _MMG3D_QUALNONE if there
+ * is none.
+ *
+ * Follow the choice of the quality function made by \ref MMG3D_setfunc (and by
+ * the computation of an anisotropic metric) to use the batched kernels.
+ *
+ */
+int _MMG3D_qualType(MMG5_pMesh mesh,MMG5_pSol met) {
+  if ( met->size == 1 || ( met->size == 3 && mesh->info.lag >= 0 ) ) {
+    return ( mesh->info.optimLES ? _MMG3D_QUALNONE : _MMG3D_QUALISO );
+  }
+  else if ( met->size == 6 ) {
+    if ( met->m ) return(_MMG3D_QUALANI);
+    if ( !mesh->info.optim && mesh->info.hsiz<=0. ) return(_MMG3D_QUALISO);
+  }
+  return(_MMG3D_QUALNONE);
+}
+
+double MMG3D_lenedgCoor(double *ca,double *cb,double *sa,double *sb) {
+  return(_MMG5_lenedgCoor(ca,cb,sa,sb));
+}
+
 int MMG3D_Get_adjaTet(MMG5_pMesh mesh, int kel, int listet[4]) {
   int idx;
 
@@ -125,7 +151,10 @@ int MMG3D_usage(char *prog) {
 #endif
 #ifdef USE_SCOTCH
   fprintf(stdout,"-rn [n]      Turn on or off the renumbering using SCOTCH [1/0] \n");
+#else
+  fprintf(stdout,"-rn [n]      Turn on or off the space filling curve renumbering [1/0] \n");
 #endif
+  fprintf(stdout,"-rnit [n]    Renumber along a space filling curve every n iterations of the remeshing loop\n");
   fprintf(stdout,"\n");
 
   fprintf(stdout,"-nofem       do not force Mmg to create a finite element mesh \n");
@@ -135,6 +164,14 @@ int MMG3D_usage(char *prog) {
   fprintf(stdout,"-noswap      no edge or face flipping\n");
   fprintf(stdout,"-nomove      no point relocation\n");
   fprintf(stdout,"-nosurf      no surface modifications\n");
+  fprintf(stdout,"-sortadja    build the adjacency by sorting the faces (if several threads)\n");
+  fprintf(stdout,"-batchins    insert the Delaunay points by batches sorted along a space filling curve\n");
+  fprintf(stdout,"-colmove     move the internal points by colors (in parallel with OpenMP)\n");
+  fprintf(stdout,"-parswap     swap the internal edges by independent sets (in parallel with OpenMP)\n");
+  fprintf(stdout,"-nthreads n  number of threads of the multithreaded kernels\n");
+  fprintf(stdout,"-npart n     remesh n partitions concurrently (frozen interfaces)\n");
+  fprintf(stdout,"-actset      sweep only the elements modified by the last iterations\n");
+  fprintf(stdout,"-metcache    cache the factorisations of the metric at the vertices\n");
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -152,6 +189,8 @@ int MMG3D_defaultValues(MMG5_pMesh mesh) {
   fprintf(stdout,"SCOTCH renumbering                  : enabled\n");
 #else
   fprintf(stdout,"SCOTCH renumbering                  : disabled\n");
+  fprintf(stdout,"Space filling curve renumbering (-rn): %s\n",
+          mesh->info.renum ? "enabled" : "disabled");
 #endif
   fprintf(stdout,"\n\n");
 
@@ -180,15 +219,32 @@ int MMG3D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
         return 0;
 
       case 'a':
-        if ( !strcmp(argv[i],"-ar") && ++i < argc )
+        if ( !strcmp(argv[i],"-ar") && ++i < argc ) {
           if ( !MMG3D_Set_dparameter(mesh,met,MMG3D_DPARAM_angleDetection,
                                     atof(argv[i])) )
             return 0;
+        }
+        else if ( !strcmp(argv[i],"-actset") ) {
+          if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_actset,1) )
+            return 0;
+        }
         break;
       case 'A': /* anisotropy */
         if ( !MMG3D_Set_solSize(mesh,met,MMG5_Vertex,0,MMG5_Tensor) )
           return 0;
         break;
+      case 'b':
+        if ( !strcmp(argv[i],"-batchins") ) {
+          if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_batchins,1) )
+            return 0;
+        }
+        break;
+      case 'c':
+        if ( !strcmp(argv[i],"-colmove") ) {
+          if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_colmove,1) )
+            return 0;
+        }
+        break;
       case 'd':
         if ( !strcmp(argv[i],"-default") ) {
           mesh->mark=1;
@@ -276,7 +332,11 @@ int MMG3D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
         }
         break;
       case 'm':  /* memory */
-        if ( ++i < argc && isdigit(argv[i][0]) ) {
+        if ( !strcmp(argv[i],"-metcache") ) {
+          if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_metcache,1) )
+            return 0;
+        }
+        else if ( ++i < argc && isdigit(argv[i][0]) ) {
           if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_mem,atoi(argv[i])) )
             return 0;
         }
@@ -311,6 +371,30 @@ int MMG3D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
           if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_nosurf,1) )
             return 0;
         }
+        else if ( !strcmp(argv[i],"-nthreads") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_nthreads,
+                                       atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MMG3D_usage(argv[0]);
+            return 0;
+          }
+        }
+        else if ( !strcmp(argv[i],"-npart") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_npart,
+                                       atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MMG3D_usage(argv[0]);
+            return 0;
+          }
+        }
         break;
       case 'o':
         if ( !strcmp(argv[i],"-out") ) {
@@ -344,7 +428,12 @@ int MMG3D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
             return 0;
         }
         break;
-#ifdef USE_SCOTCH
+      case 'p':
+        if ( !strcmp(argv[i],"-parswap") ) {
+          if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_parswap,1) )
+            return 0;
+        }
+        break;
       case 'r':
         if ( !strcmp(argv[i],"-rn") ) {
           if ( ++i < argc ) {
@@ -364,8 +453,18 @@ int MMG3D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
             return 0;
           }
         }
+        else if ( !strcmp(argv[i],"-rnit") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_renumit,atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MMG3D_usage(argv[0]);
+            return 0;
+          }
+        }
         break;
-#endif
       case 's':
         if ( !strcmp(argv[i],"-sol") ) {
           if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
@@ -378,6 +477,26 @@ int MMG3D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
             return 0;
           }
         }
+        else if ( !strcmp(argv[i],"-sortadja") ) {
+          if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_sortadja,1) )
+            return 0;
+        }
+        else if ( !strcmp(argv[i],"-stats") ) {
+          if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_stats,1) )
+            return 0;
+        }
+        break;
+      case 't':
+        if ( !strcmp(argv[i],"-tbudget") && ++i < argc ) {
+          if ( !MMG3D_Set_dparameter(mesh,met,MMG3D_DPARAM_timeBudget,
+                                   atof(argv[i])) )
+            return 0;
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MMG3D_usage(argv[0]);
+          return 0;
+        }
         break;
       case 'v':
         if ( ++i < argc ) {
@@ -918,3 +1037,30 @@ int MMG3D_Set_constantSize(MMG5_pMesh mesh,MMG5_pSol met) {
   }
   return 1;
 }
+
+int MMG3D_interpolate(MMG5_pMesh mesh,MMG5_pSol solin,MMG5_pSol solout) {
+
+  if ( !mesh->src.ne ) {
+    fprintf(stderr,"\n  ## Error: %s: no copy of the input mesh.\n",__func__);
+    fprintf(stderr,"     Set the MMG3D_IPARAM_keepsrc parameter before the"
+            " call of MMG3D_mmg3dlib.\n");
+    return(0);
+  }
+  if ( !solin->m || solin->np != mesh->src.np ) {
+    fprintf(stderr,"\n  ## Error: %s: the solution must be given at the %d"
+            " vertices of the input mesh.\n",__func__,mesh->src.np);
+    return(0);
+  }
+  if ( solin->size!=1 && solin->size!=3 && solin->size!=6 ) {
+    fprintf(stderr,"\n  ## Error: %s: unexpected size of solution: %d.\n",
+            __func__,solin->size);
+    return(0);
+  }
+  if ( solout == solin ) {
+    fprintf(stderr,"\n  ## Error: %s: the input and output solutions must be"
+            " distinct.\n",__func__);
+    return(0);
+  }
+
+  return(_MMG3D_interpSource(mesh,solin,solout));
+}
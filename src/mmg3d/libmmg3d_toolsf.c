@@ -189,3 +189,13 @@ FORTRAN_NAME(MMG3D_SET_CONSTANTSIZE,mmg3d_set_constantsize,
   *retval =  MMG3D_Set_constantSize(*mesh,*met);
   return;
 }
+
+/**
+ * See \ref MMG3D_interpolate function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_INTERPOLATE,mmg3d_interpolate,
+             (MMG5_pMesh *mesh,MMG5_pSol *solin,MMG5_pSol *solout,int *retval),
+             (mesh,solin,solout,retval)) {
+  *retval =  MMG3D_interpolate(*mesh,*solin,*solout);
+  return;
+}
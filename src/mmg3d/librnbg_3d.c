@@ -23,7 +23,7 @@
 
 /**
  * \file mmg3d/librnbg_3d.c
- * \brief Functions for scotch renumerotation.
+ * \brief Functions for scotch and space filling curve renumerotation.
  * \author Algiane Froehly (Inria/UBordeaux)
  * \author Cedric Lachat (Inria/UBordeaux)
  * \version 5
@@ -354,7 +354,11 @@ int _MMG5_mmg3dRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol) {
     }
   }
 
-  /* Permute nodes and sol */
+  /* Permute nodes, sol and user fields */
+  if ( mesh->field && !_MMG3D_permField(mesh,permNodTab) ) {
+    _MMG5_DEL_MEM(mesh,permNodTab,(mesh->np+1)*sizeof(int));
+    return(0);
+  }
   for (j=1; j<= mesh->np; j++) {
     while ( permNodTab[j] != j && permNodTab[j] )
       _MMG5_swapNod(mesh->point,sol->m,permNodTab,j,permNodTab[j],sol->size);
@@ -389,3 +393,225 @@ int _MMG5_mmg3dRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol) {
 }
 #endif
 
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure (may be NULL).
+ * \param octree pointer toward the octree structure (may be NULL).
+ * \return 1 if success or if the renumbering is skipped (unchanged mesh), 0 if
+ * fail.
+ *
+ * Renumber the points and the tetrahedra along the 3D Hilbert curve and pack
+ * the point, tetra, xpoint and xtetra tables. The tables are permuted in place
+ * and the adjacency, the metric and the octree are updated instead of being
+ * rebuilt so the renumbering is cheap enough to be called along the remeshing
+ * loop. The mesh must be scaled.
+ *
+ */
+int _MMG3D_sfcRenumbering(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree) {
+  MMG5_pPoint  ppt,p0;
+  MMG5_pTetra  pt;
+  _MMG5_sfcKey *keys;
+  double       c[3];
+  int          *perm,*permel,*permx,*adja;
+  int          nkey,nx,np,ne,nxp,nxt,k,i,j;
+
+  /* the prism adjacency stores tetra indices */
+  if ( mesh->adjapr || mesh->np < 2 || mesh->ne < 2 )  return(1);
+
+  nkey = MG_MAX(mesh->np,mesh->ne);
+  nx   = MG_MAX(mesh->xp,mesh->xt);
+
+  _MMG5_ADD_MEM(mesh,nkey*sizeof(_MMG5_sfcKey),"space filling curve keys",
+                return(1));
+  _MMG5_SAFE_MALLOC(keys,nkey,_MMG5_sfcKey,1);
+  _MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(int),"point permutation",
+                _MMG5_DEL_MEM(mesh,keys,nkey*sizeof(_MMG5_sfcKey));
+                return(1));
+  _MMG5_SAFE_MALLOC(perm,mesh->np+1,int,1);
+  _MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(int),"tetra permutation",
+                _MMG5_DEL_MEM(mesh,keys,nkey*sizeof(_MMG5_sfcKey));
+                _MMG5_DEL_MEM(mesh,perm,(mesh->np+1)*sizeof(int));
+                return(1));
+  _MMG5_SAFE_MALLOC(permel,mesh->ne+1,int,1);
+  _MMG5_ADD_MEM(mesh,(nx+1)*sizeof(int),"boundary entities permutation",
+                _MMG5_DEL_MEM(mesh,keys,nkey*sizeof(_MMG5_sfcKey));
+                _MMG5_DEL_MEM(mesh,perm,(mesh->np+1)*sizeof(int));
+                _MMG5_DEL_MEM(mesh,permel,(mesh->ne+1)*sizeof(int));
+                return(1));
+  _MMG5_SAFE_MALLOC(permx,nx+1,int,1);
+
+  /** Step 1: new numbering of the points and of the xpoints (xpoints are
+   * numbered in the order of their points) */
+  nkey = 0;
+  for (k=1; k<=mesh->np; k++) {
+    ppt = &mesh->point[k];
+    if ( !MG_VOK(ppt) )  continue;
+    keys[nkey].key = _MMG5_sfcKeyCoor(3,ppt->c);
+    keys[nkey].idx = k;
+    ++nkey;
+  }
+  np = _MMG5_sfcPerm(keys,nkey,mesh->np,perm);
+
+  if ( mesh->field && !_MMG3D_permField(mesh,perm) ) {
+    _MMG5_DEL_MEM(mesh,keys,MG_MAX(mesh->np,mesh->ne)*sizeof(_MMG5_sfcKey));
+    _MMG5_DEL_MEM(mesh,perm,(mesh->np+1)*sizeof(int));
+    _MMG5_DEL_MEM(mesh,permel,(mesh->ne+1)*sizeof(int));
+    _MMG5_DEL_MEM(mesh,permx,(nx+1)*sizeof(int));
+    return(1);
+  }
+
+  memset(permx,0,(mesh->xp+1)*sizeof(int));
+  nxp = 0;
+  for (k=0; k<np; k++) {
+    ppt = &mesh->point[keys[k].idx];
+    if ( ppt->xp && !permx[ppt->xp] )  permx[ppt->xp] = ++nxp;
+  }
+  j = nxp;
+  for (k=1; k<=mesh->xp; k++)
+    if ( !permx[k] )  permx[k] = ++j;
+
+  for (k=1; k<=mesh->np; k++) {
+    ppt = &mesh->point[k];
+    if ( ppt->xp )  ppt->xp = permx[ppt->xp];
+  }
+  if ( mesh->xp ) {
+    _MMG5_sfcPermute(mesh->xp,permx,(char*)&mesh->xpoint[1],sizeof(MMG5_xPoint),
+                     NULL,0);
+    if ( mesh->xp > nxp )
+      memset(&mesh->xpoint[nxp+1],0,(mesh->xp-nxp)*sizeof(MMG5_xPoint));
+    mesh->xp = nxp;
+  }
+
+  /** Step 2: new numbering of the tetra (along the curve of their barycenters)
+   * and of the xtetra */
+  nkey = 0;
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) )  continue;
+    c[0] = c[1] = c[2] = 0.;
+    for (i=0; i<4; i++) {
+      p0 = &mesh->point[pt->v[i]];
+      c[0] += p0->c[0];
+      c[1] += p0->c[1];
+      c[2] += p0->c[2];
+    }
+    c[0] *= 0.25;
+    c[1] *= 0.25;
+    c[2] *= 0.25;
+    keys[nkey].key = _MMG5_sfcKeyCoor(3,c);
+    keys[nkey].idx = k;
+    ++nkey;
+  }
+  ne = _MMG5_sfcPerm(keys,nkey,mesh->ne,permel);
+
+  memset(permx,0,(mesh->xt+1)*sizeof(int));
+  nxt = 0;
+  for (k=0; k<ne; k++) {
+    pt = &mesh->tetra[keys[k].idx];
+    if ( pt->xt && !permx[pt->xt] )  permx[pt->xt] = ++nxt;
+  }
+  j = nxt;
+  for (k=1; k<=mesh->xt; k++)
+    if ( !permx[k] )  permx[k] = ++j;
+
+  _MMG5_DEL_MEM(mesh,keys,MG_MAX(mesh->np,mesh->ne)*sizeof(_MMG5_sfcKey));
+
+  /** Step 3: update the references toward the renumbered entities */
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) )  continue;
+    for (i=0; i<4; i++)
+      pt->v[i] = perm[pt->v[i]];
+    if ( pt->xt )  pt->xt = permx[pt->xt];
+
+    if ( !mesh->adja )  continue;
+    adja = &mesh->adja[4*(k-1)+1];
+    for (i=0; i<4; i++)
+      if ( adja[i] )  adja[i] = 4*permel[adja[i]/4] + adja[i]%4;
+  }
+  for (k=1; k<=mesh->nprism; k++)
+    for (i=0; i<6; i++)
+      mesh->prism[k].v[i] = perm[mesh->prism[k].v[i]];
+  for (k=1; k<=mesh->nquad; k++)
+    for (i=0; i<4; i++)
+      mesh->quadra[k].v[i] = perm[mesh->quadra[k].v[i]];
+  if ( mesh->tria ) {
+    for (k=1; k<=mesh->nt; k++) {
+      if ( !MG_EOK(&mesh->tria[k]) )  continue;
+      for (i=0; i<3; i++)
+        mesh->tria[k].v[i] = perm[mesh->tria[k].v[i]];
+    }
+  }
+  if ( mesh->edge ) {
+    for (k=1; k<=mesh->na; k++) {
+      if ( !mesh->edge[k].a )  continue;
+      mesh->edge[k].a = perm[mesh->edge[k].a];
+      mesh->edge[k].b = perm[mesh->edge[k].b];
+    }
+  }
+  if ( octree )
+    _MMG3D_renumOctree(mesh,octree,perm);
+
+  /** Step 4: in place permutation of the tables */
+  if ( mesh->xt ) {
+    _MMG5_sfcPermute(mesh->xt,permx,(char*)&mesh->xtetra[1],sizeof(MMG5_xTetra),
+                     NULL,0);
+    if ( mesh->xt > nxt )
+      memset(&mesh->xtetra[nxt+1],0,(mesh->xt-nxt)*sizeof(MMG5_xTetra));
+    mesh->xt = nxt;
+  }
+
+  _MMG5_sfcPermute(mesh->np,perm,(char*)&mesh->point[1],sizeof(MMG5_Point),
+                   (met && met->m) ? (char*)&met->m[met->size] : NULL,
+                   met ? met->size*sizeof(double) : 0);
+
+  _MMG5_sfcPermute(mesh->ne,permel,(char*)&mesh->tetra[1],sizeof(MMG5_Tetra),
+                   mesh->adja ? (char*)&mesh->adja[1] : NULL,4*sizeof(int));
+
+  _MMG5_DEL_MEM(mesh,permx,(nx+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,permel,(mesh->ne+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,perm,(mesh->np+1)*sizeof(int));
+
+  /** Step 5: the removed entities are packed at the end of the tables, rebuild
+   * the garbage collectors */
+  mesh->np = np;
+  mesh->ne = ne;
+
+  if ( mesh->np == mesh->npmax )
+    mesh->npnil = 0;
+  else
+    mesh->npnil = mesh->np + 1;
+
+  if ( mesh->ne == mesh->nemax )
+    mesh->nenil = 0;
+  else
+    mesh->nenil = mesh->ne + 1;
+
+  if ( mesh->npnil ) {
+    for (k=mesh->npnil; k<mesh->npmax-1; k++)
+      mesh->point[k].tmp  = k+1;
+    mesh->point[MG_MAX(mesh->npnil,mesh->npmax-1)].tmp = 0;
+  }
+
+  if ( mesh->nenil ) {
+    for (k=mesh->nenil; k<mesh->nemax-1; k++)
+      mesh->tetra[k].v[3] = k+1;
+    mesh->tetra[MG_MAX(mesh->nenil,mesh->nemax-1)].v[3] = 0;
+  }
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Renumber the mesh along a space filling curve (used when Scotch is not
+ * available).
+ *
+ */
+int _MMG5_mmg3dSfcRenumbering(MMG5_pMesh mesh,MMG5_pSol met) {
+  return(_MMG3D_sfcRenumbering(mesh,met,NULL));
+}
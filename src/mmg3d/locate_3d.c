@@ -0,0 +1,509 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mmg3d/locate_3d.c
+ * \brief Transfer of the solutions of the input mesh onto the output mesh.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * A copy of the input mesh (\ref MMG5_Source) is kept by \ref MMG3D_mmg3dlib
+ * if the \ref MMG3D_IPARAM_keepsrc parameter is set. Each vertex of the output
+ * mesh is located in this copy by a walk through the adjacency, starting from
+ * the tetra stored in a uniform grid of buckets, and the P1 solutions are
+ * interpolated with the barycentric coordinates of the vertex.
+ *
+ */
+
+#include "mmg3d.h"
+
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+/** Maximal number of steps of the walk toward a point */
+#define _MMG3D_SRCMAXIT 10000
+
+/** Tolerance on the barycentric coordinates of a point inside a tetra */
+#define _MMG3D_SRCEPS   1.e-12
+
+/** Number of tetra of the brute-force search when the walk fails */
+#define _MMG3D_SRCNLOC  128
+
+/**
+ * \param a first vertex.
+ * \param b second vertex.
+ * \param c third vertex.
+ * \param d fourth vertex.
+ * \return six times the signed volume of the tetra \a abcd.
+ *
+ */
+static inline
+double _MMG3D_srcDet(double *a,double *b,double *c,double *d) {
+  double ab[3],ac[3],ad[3];
+
+  ab[0] = b[0]-a[0];  ab[1] = b[1]-a[1];  ab[2] = b[2]-a[2];
+  ac[0] = c[0]-a[0];  ac[1] = c[1]-a[1];  ac[2] = c[2]-a[2];
+  ad[0] = d[0]-a[0];  ad[1] = d[1]-a[1];  ad[2] = d[2]-a[2];
+
+  return( ab[0]*(ac[1]*ad[2]-ac[2]*ad[1])
+          + ab[1]*(ac[2]*ad[0]-ac[0]*ad[2])
+          + ab[2]*(ac[0]*ad[1]-ac[1]*ad[0]) );
+}
+
+/**
+ * \param src pointer toward the source mesh.
+ * \param k index of a tetra of the source mesh.
+ * \param p coordinates of the point.
+ * \param lambda barycentric coordinates of \a p in \a k.
+ *
+ * Compute the barycentric coordinates of \a p in the tetra \a k.
+ *
+ */
+static inline
+void _MMG3D_srcBary(MMG5_Source *src,int k,double *p,double *lambda) {
+  double *a,*b,*c,*d,vol;
+
+  a = &src->c[3*src->v[4*k]];
+  b = &src->c[3*src->v[4*k+1]];
+  c = &src->c[3*src->v[4*k+2]];
+  d = &src->c[3*src->v[4*k+3]];
+
+  vol = _MMG3D_srcDet(a,b,c,d);
+  if ( fabs(vol) < _MMG5_EPSD2 ) {
+    lambda[0] = lambda[1] = lambda[2] = lambda[3] = 0.25;
+    return;
+  }
+  vol = 1.0/vol;
+  lambda[0] = vol*_MMG3D_srcDet(p,b,c,d);
+  lambda[1] = vol*_MMG3D_srcDet(a,p,c,d);
+  lambda[2] = vol*_MMG3D_srcDet(a,b,p,d);
+  lambda[3] = 1.0 - lambda[0] - lambda[1] - lambda[2];
+}
+
+/**
+ * \param src pointer toward the source mesh.
+ * \param p coordinates of the point.
+ * \return the index of the cell of the grid containing \a p.
+ *
+ * The points outside the grid are projected on its boundary cells.
+ *
+ */
+static inline
+int _MMG3D_srcCell(MMG5_Source *src,double *p) {
+  double dd;
+  int    i,j[3];
+
+  for ( i=0; i<3; i++ ) {
+    dd   = (p[i]-src->min[i])*src->dh;
+    j[i] = dd < 0. ? 0 : ( dd >= src->nc ? src->nc-1 : (int)dd );
+  }
+  return( (j[2]*src->nc + j[1])*src->nc + j[0] );
+}
+
+/**
+ * \param src pointer toward the source mesh.
+ * \param p coordinates of the point.
+ * \param start tetra from which the walk starts.
+ * \param lambda barycentric coordinates of \a p in the returned tetra.
+ * \param best smallest barycentric coordinate of \a p in the best tetra found
+ * so far (updated).
+ * \return the tetra of the walk whose smallest barycentric coordinate is the
+ * largest if it is larger than \a best, 0 otherwise.
+ *
+ * Walk from \a start toward \a p: the walk crosses the face of the current
+ * tetra with the most negative barycentric coordinate. It stops at the tetra
+ * containing \a p, at the boundary of the mesh or after \ref _MMG3D_SRCMAXIT
+ * steps. \a lambda is updated only if a better tetra is found.
+ *
+ */
+static int
+_MMG3D_srcWalk(MMG5_Source *src,double *p,int start,double *lambda,
+               double *best) {
+  double l[4];
+  int    k,kbest,it,i,imin;
+
+  k     = start;
+  kbest = 0;
+
+  for ( it=0; it<_MMG3D_SRCMAXIT; it++ ) {
+    _MMG3D_srcBary(src,k,p,l);
+
+    imin = 0;
+    for ( i=1; i<4; i++ )
+      if ( l[i] < l[imin] )  imin = i;
+
+    if ( l[imin] > *best ) {
+      *best = l[imin];
+      kbest = k;
+      memcpy(lambda,l,4*sizeof(double));
+    }
+    if ( l[imin] >= -_MMG3D_SRCEPS )  break;
+
+    k = src->adja[4*(k-1)+1+imin]/4;
+    if ( !k )  break;
+  }
+  return(kbest);
+}
+
+/**
+ * \param src pointer toward the source mesh.
+ * \param p coordinates of the point.
+ * \param start tetra from which the search starts.
+ * \param lambda barycentric coordinates of \a p in the returned tetra.
+ * \param best smallest barycentric coordinate of \a p in the best tetra found
+ * so far (updated).
+ * \return the best tetra of the search if it is better than \a best, 0
+ * otherwise.
+ *
+ * Brute-force search of \a p in the \ref _MMG3D_SRCNLOC tetra closest to
+ * \a start through the adjacency: unlike the walk, the search goes around the
+ * concave parts of the boundary. \a lambda is updated only if a better tetra is
+ * found.
+ *
+ */
+static int
+_MMG3D_srcSearch(MMG5_Source *src,double *p,int start,double *lambda,
+                 double *best) {
+  double l[4],lmin;
+  int    list[_MMG3D_SRCNLOC],ilist,cur,k,kk,kbest,i,j;
+
+  list[0] = start;
+  ilist   = 1;
+  kbest   = 0;
+
+  for ( cur=0; cur<ilist; cur++ ) {
+    k = list[cur];
+    _MMG3D_srcBary(src,k,p,l);
+
+    lmin = MG_MIN(MG_MIN(l[0],l[1]),MG_MIN(l[2],l[3]));
+    if ( lmin > *best ) {
+      *best = lmin;
+      kbest = k;
+      memcpy(lambda,l,4*sizeof(double));
+      if ( lmin >= -_MMG3D_SRCEPS )  break;
+    }
+
+    for ( i=0; i<4 && ilist<_MMG3D_SRCNLOC; i++ ) {
+      kk = src->adja[4*(k-1)+1+i]/4;
+      if ( !kk )  continue;
+      for ( j=0; j<ilist; j++ )
+        if ( list[j]==kk )  break;
+      if ( j==ilist )  list[ilist++] = kk;
+    }
+  }
+  return(kbest);
+}
+
+/**
+ * \param src pointer toward the source mesh.
+ * \param p coordinates of the point.
+ * \param start tetra from which the walk starts.
+ * \param lambda barycentric coordinates of \a p in the returned tetra.
+ * \return the tetra containing \a p, or the closest tetra found if \a p is
+ * outside the source mesh.
+ *
+ * Walk from \a start toward \a p. If the walk ends outside the mesh, either
+ * because \a p is outside or because the walk is stopped by a concave part of
+ * the boundary, it is restarted from the tetra of the buckets neighbouring the
+ * one of \a p, then the tetra around the best one are searched by brute
+ * force. The tetra whose smallest barycentric coordinate is the largest is
+ * returned.
+ *
+ */
+static int
+_MMG3D_srcLocate(MMG5_Source *src,double *p,int start,double *lambda) {
+  double best;
+  int    tried[27],ntried,k,kbest,ic,c[3],i,j,d0,d1,d2,nc;
+
+  best  = -DBL_MAX;
+  kbest = _MMG3D_srcWalk(src,p,start,lambda,&best);
+  if ( best >= -_MMG3D_SRCEPS )  return(kbest);
+
+  /* restart from the tetra of the neighbouring buckets */
+  nc     = src->nc;
+  ic     = _MMG3D_srcCell(src,p);
+  c[0]   = ic%nc;
+  c[1]   = (ic/nc)%nc;
+  c[2]   = ic/(nc*nc);
+  tried[0] = start;
+  ntried   = 1;
+  for ( d2=-1; d2<=1; d2++ ) {
+    if ( c[2]+d2 < 0 || c[2]+d2 >= nc )  continue;
+    for ( d1=-1; d1<=1; d1++ ) {
+      if ( c[1]+d1 < 0 || c[1]+d1 >= nc )  continue;
+      for ( d0=-1; d0<=1; d0++ ) {
+        if ( c[0]+d0 < 0 || c[0]+d0 >= nc )  continue;
+        i = ((c[2]+d2)*nc + c[1]+d1)*nc + c[0]+d0;
+        k = src->cell[i];
+        for ( j=0; j<ntried; j++ )
+          if ( tried[j]==k )  break;
+        if ( j<ntried )  continue;
+        tried[ntried++] = k;
+
+        k = _MMG3D_srcWalk(src,p,k,lambda,&best);
+        if ( k )  kbest = k;
+        if ( best >= -_MMG3D_SRCEPS )  return(kbest);
+      }
+    }
+  }
+
+  /* local brute-force search around the best tetra */
+  k = _MMG3D_srcSearch(src,p,kbest,lambda,&best);
+  if ( k )  kbest = k;
+
+  return(kbest);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ *
+ * Free the copy of the input mesh.
+ *
+ */
+void _MMG3D_freeSource(MMG5_pMesh mesh) {
+  MMG5_Source *src;
+
+  src = &mesh->src;
+  if ( src->c )
+    _MMG5_DEL_MEM(mesh,src->c,3*(src->np+1)*sizeof(double));
+  if ( src->v )
+    _MMG5_DEL_MEM(mesh,src->v,4*(src->ne+1)*sizeof(int));
+  if ( src->adja )
+    _MMG5_DEL_MEM(mesh,src->adja,(4*src->ne+5)*sizeof(int));
+  if ( src->cell )
+    _MMG5_DEL_MEM(mesh,src->cell,
+                  (size_t)src->nc*src->nc*src->nc*sizeof(int));
+  memset(src,0,sizeof(MMG5_Source));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Copy the points, the tetra and the adjacency of the mesh in the source
+ * structure and build the grid of buckets. The coordinates are copied
+ * unscaled.
+ *
+ * \warning the tetra must be packed and the adjacency built: the function is
+ * called at the end of the analysis, before any modification of the mesh.
+ *
+ */
+int _MMG3D_saveSource(MMG5_pMesh mesh) {
+  MMG5_Source *src;
+  MMG5_pTetra pt;
+  double      max[3],bar[3],dd;
+  int         k,i,l,a,b,base,stride,nc,nc2,ic;
+
+  assert ( mesh->adja );
+
+  _MMG3D_freeSource(mesh);
+  src = &mesh->src;
+
+  src->np = mesh->np;
+  src->ne = mesh->ne;
+  src->nc = MG_MAX(1,(int)pow(0.5*mesh->ne,1./3.));
+  nc      = src->nc;
+  nc2     = nc*nc;
+
+  _MMG5_ADD_MEM(mesh,3*(src->np+1)*sizeof(double),"source mesh points",
+                _MMG3D_freeSource(mesh);return(0));
+  _MMG5_SAFE_MALLOC(src->c,3*(src->np+1),double,0);
+  _MMG5_ADD_MEM(mesh,4*(src->ne+1)*sizeof(int),"source mesh tetra",
+                _MMG3D_freeSource(mesh);return(0));
+  _MMG5_SAFE_MALLOC(src->v,4*(src->ne+1),int,0);
+  _MMG5_ADD_MEM(mesh,(4*src->ne+5)*sizeof(int),"source mesh adjacency",
+                _MMG3D_freeSource(mesh);return(0));
+  _MMG5_SAFE_MALLOC(src->adja,4*src->ne+5,int,0);
+  _MMG5_ADD_MEM(mesh,(size_t)nc2*nc*sizeof(int),"source mesh buckets",
+                _MMG3D_freeSource(mesh);return(0));
+  _MMG5_SAFE_CALLOC(src->cell,(size_t)nc2*nc,int,0);
+
+  /* unscaled coordinates and tetra */
+  dd = mesh->info.delta;
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(_MMG5_NTHREADS(mesh))
+#endif
+  for ( k=1; k<=mesh->np; k++ ) {
+    src->c[3*k]   = mesh->point[k].c[0]*dd + mesh->info.min[0];
+    src->c[3*k+1] = mesh->point[k].c[1]*dd + mesh->info.min[1];
+    src->c[3*k+2] = mesh->point[k].c[2]*dd + mesh->info.min[2];
+  }
+  src->c[0] = src->c[1] = src->c[2] = 0.;
+
+#ifdef USE_OPENMP
+#pragma omp parallel for private(pt) num_threads(_MMG5_NTHREADS(mesh))
+#endif
+  for ( k=1; k<=mesh->ne; k++ ) {
+    pt = &mesh->tetra[k];
+    assert ( MG_EOK(pt) );
+    memcpy(&src->v[4*k],pt->v,4*sizeof(int));
+  }
+  memset(src->v,0,4*sizeof(int));
+  memcpy(src->adja,mesh->adja,(4*src->ne+5)*sizeof(int));
+
+  /* bounding box of the grid */
+  for ( i=0; i<3; i++ ) {
+    src->min[i] =  DBL_MAX;
+    max[i]      = -DBL_MAX;
+  }
+  for ( k=1; k<=src->np; k++ ) {
+    for ( i=0; i<3; i++ ) {
+      src->min[i] = MG_MIN(src->min[i],src->c[3*k+i]);
+      max[i]      = MG_MAX(max[i],src->c[3*k+i]);
+    }
+  }
+  dd = 0.;
+  for ( i=0; i<3; i++ )  dd = MG_MAX(dd,max[i]-src->min[i]);
+  src->dh = dd > _MMG5_EPSD2 ? nc/dd : 1.;
+
+  /* store in each bucket a tetra whose barycenter lies in it */
+  for ( k=1; k<=src->ne; k++ ) {
+    for ( i=0; i<3; i++ ) {
+      bar[i] = 0.25*( src->c[3*src->v[4*k]+i] + src->c[3*src->v[4*k+1]+i]
+                      + src->c[3*src->v[4*k+2]+i] + src->c[3*src->v[4*k+3]+i] );
+    }
+    src->cell[_MMG3D_srcCell(src,bar)] = k;
+  }
+
+  /* fill the empty buckets with the tetra of the closest bucket of the same
+   * line, along x, then y, then z */
+  for ( i=0; i<3; i++ ) {
+    stride = ( i==0 ) ? 1 : ( i==1 ? nc : nc2 );
+#ifdef USE_OPENMP
+#pragma omp parallel for private(a,l,base,ic) num_threads(_MMG5_NTHREADS(mesh))
+#endif
+    for ( b=0; b<nc; b++ ) {
+      for ( a=0; a<nc; a++ ) {
+        if ( i==0 )       base = a*nc + b*nc2;
+        else if ( i==1 )  base = a + b*nc2;
+        else              base = a + b*nc;
+
+        for ( l=1; l<nc; l++ ) {
+          ic = base + l*stride;
+          if ( !src->cell[ic] )  src->cell[ic] = src->cell[ic-stride];
+        }
+        for ( l=nc-2; l>=0; l-- ) {
+          ic = base + l*stride;
+          if ( !src->cell[ic] )  src->cell[ic] = src->cell[ic+stride];
+        }
+      }
+    }
+  }
+
+  if ( abs(mesh->info.imprim) > 4 )
+    fprintf(stdout,"  ## Source mesh: %d points, %d tetra, %d^3 buckets.\n",
+            src->np,src->ne,nc);
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param solin pointer toward the solution defined at the vertices of the
+ * source mesh.
+ * \param solout pointer toward the solution to compute at the vertices of the
+ * mesh (allocated by the function).
+ * \return 1 if success, 0 if fail.
+ *
+ * Interpolate the P1 solution \a solin of the source mesh at the vertices of
+ * the mesh. The vertices are processed in parallel: each thread starts the
+ * walk from the tetra found for its previous vertex if it is closer than the
+ * tetra of the bucket, which is the case for the points renumbered along a
+ * space filling curve. The vertices outside the source mesh are given the
+ * values of the closest point of the tetra returned by the search.
+ *
+ */
+int _MMG3D_interpSource(MMG5_pMesh mesh,MMG5_pSol solin,MMG5_pSol solout) {
+  MMG5_Source *src;
+  int         k,size,type,nout;
+
+  src  = &mesh->src;
+  size = solin->size;
+  type = ( size==1 ) ? MMG5_Scalar : ( size==3 ? MMG5_Vector : MMG5_Tensor );
+
+  if ( !MMG3D_Set_solSize(mesh,solout,MMG5_Vertex,mesh->np,type) )
+    return(0);
+
+  nout = 0;
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(_MMG5_NTHREADS(mesh)) reduction(+:nout)
+#endif
+  {
+    MMG5_pPoint ppt;
+    double      lambda[4],*m,*ma,*a,*b,d0,d1,dd;
+    int         kel,kc,i,j;
+
+    kel = 0;
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for ( k=1; k<=mesh->np; k++ ) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) )  continue;
+
+      kc = src->cell[_MMG3D_srcCell(src,ppt->c)];
+      if ( kel && kel != kc ) {
+        a  = &src->c[3*src->v[4*kel]];
+        b  = &src->c[3*src->v[4*kc]];
+        d0 = d1 = 0.;
+        for ( i=0; i<3; i++ ) {
+          d0 += (a[i]-ppt->c[i])*(a[i]-ppt->c[i]);
+          d1 += (b[i]-ppt->c[i])*(b[i]-ppt->c[i]);
+        }
+        if ( d1 < d0 )  kel = kc;
+      }
+      else if ( !kel ) {
+        kel = kc;
+      }
+
+      kel = _MMG3D_srcLocate(src,ppt->c,kel,lambda);
+
+      /* outside point: clamp the barycentric coordinates */
+      if ( lambda[0] < -_MMG3D_SRCEPS || lambda[1] < -_MMG3D_SRCEPS ||
+           lambda[2] < -_MMG3D_SRCEPS || lambda[3] < -_MMG3D_SRCEPS ) {
+        ++nout;
+        dd = 0.;
+        for ( j=0; j<4; j++ ) {
+          lambda[j] = MG_MAX(0.,lambda[j]);
+          dd       += lambda[j];
+        }
+        dd = 1./dd;
+        for ( j=0; j<4; j++ )  lambda[j] *= dd;
+      }
+
+      m = &solout->m[size*k];
+      for ( i=0; i<size; i++ )  m[i] = 0.;
+      for ( j=0; j<4; j++ ) {
+        ma = &solin->m[size*src->v[4*kel+j]];
+        for ( i=0; i<size; i++ )  m[i] += lambda[j]*ma[i];
+      }
+    }
+  }
+
+  if ( nout && abs(mesh->info.imprim) > 4 )
+    fprintf(stdout,"  ## Warning: %s: %d points outside the source mesh.\n",
+            __func__,nout);
+
+  return(1);
+}
@@ -429,6 +429,9 @@ int main(int argc,char *argv[]) {
     if ( !msh && !MMG3D_saveSol(mesh,met,met->nameout) )
       _MMG5_RETURN_AND_FREE(mesh,met,disp,MMG5_STRONGFAILURE);
 
+    if ( mesh->info.stats && !MMG3D_saveStats(mesh,NULL) )
+      _MMG5_RETURN_AND_FREE(mesh,met,disp,MMG5_STRONGFAILURE);
+
     chrono(OFF,&MMG5_ctim[1]);
     if ( mesh->info.imprim )
       fprintf(stdout,"  -- WRITING COMPLETED\n");
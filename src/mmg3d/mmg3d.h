@@ -47,8 +47,9 @@ extern "C" {
     of point ip with coordinates o and tag tag*/
 #define _MMG5_POINT_REALLOC(mesh,sol,ip,wantedGap,law,o,tag,retval ) do \
   {                                                                     \
-    int klink;                                                          \
+    int klink,oldSiz;                                                   \
                                                                         \
+    oldSiz = mesh->npmax;                                               \
     _MMG5_TAB_RECALLOC(mesh,mesh->point,mesh->npmax,wantedGap,MMG5_Point, \
                        "larger point table",law,retval);                \
                                                                         \
@@ -63,6 +64,13 @@ extern "C" {
       _MMG5_SAFE_REALLOC(sol->m,sol->size*(mesh->npmax+1),              \
                          double,"larger solution",retval);              \
     }                                                                   \
+    /* user fields */                                                   \
+    if ( mesh->field ) {                                                \
+      _MMG5_ADD_MEM(mesh,(mesh->fsize*(mesh->npmax-oldSiz))*sizeof(double), \
+                    "larger user fields",law);                          \
+      _MMG5_SAFE_REALLOC(mesh->field,mesh->fsize*(mesh->npmax+1),       \
+                         double,"larger user fields",retval);           \
+    }                                                                   \
     sol->npmax = mesh->npmax;                                           \
                                                                         \
     /* We try again to add the point */                                 \
@@ -98,6 +106,27 @@ extern "C" {
     if ( !jel ) {law;}                                                  \
   }while(0)
 
+/** Mark the tetra \a k as modified by the current iteration and add it to the
+    active set of the sweeps if it is used (see \ref _MMG3D_startSweep) */
+#define _MMG3D_MARK(mesh,k) do                                          \
+  {                                                                     \
+    (mesh)->tetra[k].mark = (mesh)->mark;                               \
+    if ( (mesh)->arena.act ) {                                          \
+      if ( (mesh)->arena.nact < (mesh)->arena.amax )                    \
+        (mesh)->arena.act[++(mesh)->arena.nact] = (k);                  \
+      else                                                              \
+        (mesh)->arena.aovf = 1;                                         \
+    }                                                                   \
+  }while(0)
+
+/** Index of the \a l-th tetra of a sweep started by \ref _MMG3D_startSweep
+    (\a nact is the returned value) */
+#define _MMG3D_SWEEPELT(mesh,nact,l) ( (nact) < 0 ? (l) : (mesh)->arena.act[l] )
+
+/** Number of tetra of a sweep started by \ref _MMG3D_startSweep: the tetra
+    marked during the sweep are visited too */
+#define _MMG3D_SWEEPEND(mesh,nact) ( (nact) < 0 ? (mesh)->ne : (mesh)->arena.nact )
+
 /* numerical accuracy */
 #define _MMG3D_ALPHAD    20.7846096908265    //0.04811252243247      /* 12*sqrt(3) */
 #define _MMG3D_LLONG     2.5//2.0   // 1.414213562373
@@ -173,23 +202,82 @@ typedef struct _MMG3D_octree_s
   int  depth; /*!< sub tree depth */
 } _MMG3D_octree_s;
 
+/**
+ * Memory chunk of the octree pool (the blocks follow the header).
+ */
+typedef struct _MMG3D_octreeChunk_s
+{
+  struct _MMG3D_octreeChunk_s* nxt; /*!< previously allocated chunk */
+  size_t siz; /*!< chunk size (header included) */
+} _MMG3D_octreeChunk;
+
+/** Number of size classes of the octree pool (blocks of 2^k bytes) */
+#define _MMG3D_OCTREE_NCLASS 32
+/** Default size of the chunks of the octree pool */
+#define _MMG3D_OCTREE_CHUNK  65536
+
 /**
  * Octree global structure (enriched by global variables).
+ *
+ * The vertex lists and the sub-branches of the cells are taken from a pool of
+ * memory chunks owned by the octree: a freed block is kept in the free list of
+ * its size class and reused by the next allocation of the same class.
  */
 typedef struct
 {
   int nv;  /*!< Max number of points per octree cell */
   int nc; /*!< Max number of cells listed per local search in the octree (-3)*/
   _MMG3D_octree_s* q0; /*!<  Pointer toward the first octree cell */
+  _MMG3D_octree_s** qlist; /*!< Cells listed by the last zone search */
+  double* dist; /*!< Distances of the listed cells to the zone center (nc) */
+  void* pool[_MMG3D_OCTREE_NCLASS]; /*!< Free blocks of each size class */
+  _MMG3D_octreeChunk* chunk; /*!< Last allocated chunk of the pool */
+  char* cur; /*!< First unused byte of the last chunk */
+  size_t left; /*!< Number of unused bytes of the last chunk */
 } _MMG3D_octree;
 typedef _MMG3D_octree * _MMG3D_pOctree;
 
+/** Number of tetra of the packs of the batched quality kernels */
+#define _MMG3D_QPACK 8
+
+/** Quality functions of the batched kernels */
+#define _MMG3D_QUALNONE  -1 /*!< no batched kernel (LES quality) */
+#define _MMG3D_QUALISO    0 /*!< \ref _MMG5_caltet_iso */
+#define _MMG3D_QUALANI    1 /*!< \ref _MMG5_caltet_ani (mean metric without the
+                              ridge points) */
+#define _MMG3D_QUALANI33  2 /*!< \ref _MMG5_caltet33_ani (mean metric of the 4
+                              vertices) */
+
+/**
+ * Pack of tetra whose qualities are computed together: the data are stored
+ * by component (one line of _MMG3D_QPACK values per coordinate or metric
+ * coefficient) so that the kernels work on the whole pack at once.
+ */
+typedef struct
+{
+  double c[12][_MMG3D_QPACK]; /*!< Coordinate i of the vertex j in c[3*j+i] */
+  double m[6][_MMG3D_QPACK];  /*!< Mean metric (anisotropic kernels) */
+  int    n; /*!< Number of tetra of the pack */
+} _MMG3D_QualPack;
+
+/**
+ * Edges of a tetra whose anisotropic lengths are computed together: the
+ * extremities of the edge \a ia and their metrics are stored in the column
+ * \a ia.
+ */
+typedef struct
+{
+  double a[3][6],b[3][6];   /*!< Coordinates of the extremities of the edges */
+  double ma[6][6],mb[6][6]; /*!< Metrics at the extremities of the edges */
+} _MMG3D_EdgPack;
+
 
 /* octree */
 void _MMG3D_initOctree_s( _MMG3D_octree_s* q);
 int _MMG3D_initOctree(MMG5_pMesh,_MMG3D_pOctree* q, int nv);
-void _MMG3D_freeOctree_s(MMG5_pMesh,_MMG3D_octree_s* q, int nv);
+void _MMG3D_freeOctree_s(MMG5_pMesh,_MMG3D_pOctree,_MMG3D_octree_s* q, int nv);
 void _MMG3D_freeOctree(MMG5_pMesh,_MMG3D_octree** q);
+void _MMG3D_renumOctree(MMG5_pMesh,_MMG3D_pOctree q,int *perm);
 int _MMG3D_isCellIncluded(double* cellCenter, double l, double* zoneCenter, double l0);
 void _MMG3D_placeInListDouble(double*, double, int, int);
 void _MMG3D_placeInListOctree(_MMG3D_octree_s**, _MMG3D_octree_s*, int, int);
@@ -198,13 +286,16 @@ int _MMG3D_intersectRect(double *rectin, double *rectinout);
 int _MMG3D_getListSquareRec(_MMG3D_octree_s*,double*,double*,
                             _MMG3D_octree_s***,double*,double*,double, int, int, int*);
 int  _MMG3D_getListSquare(MMG5_pMesh,double*,_MMG3D_octree*,double*,_MMG3D_octree_s***);
-int _MMG3D_addOctreeRec(MMG5_pMesh,_MMG3D_octree_s*,double*, const int, int);
+int _MMG3D_addOctreeRec(MMG5_pMesh,_MMG3D_pOctree,_MMG3D_octree_s*,double*,
+                        const int, int);
 int _MMG3D_addOctree(MMG5_pMesh mesh, _MMG3D_octree* q, const int no);
-int _MMG3D_delOctreeVertex(MMG5_pMesh,_MMG3D_octree_s* q, int no);
+int _MMG3D_delOctreeVertex(MMG5_pMesh,_MMG3D_pOctree,_MMG3D_octree_s* q, int no);
 int _MMG3D_moveOctree(MMG5_pMesh, _MMG3D_pOctree,int, double*, double*);
 void _MMG3D_mergeBranchesRec(_MMG3D_octree_s*, _MMG3D_octree_s*, int, int , int*);
-void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_octree_s* q, int dim, int nv);
-int _MMG3D_delOctreeRec(MMG5_pMesh,_MMG3D_octree_s*,double*, const int,const int);
+void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_pOctree,_MMG3D_octree_s* q,
+                          int dim, int nv);
+int _MMG3D_delOctreeRec(MMG5_pMesh,_MMG3D_pOctree,_MMG3D_octree_s*,double*,
+                        const int,const int);
 int _MMG3D_delOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no);
 void _MMG3D_printArbreDepth(_MMG3D_octree_s* q, int depth, int nv, int dim);
 void _MMG3D_printArbre(_MMG3D_octree* q);
@@ -225,6 +316,8 @@ int  _MMG3D_Free_names_var( va_list argptr );
 int  _MMG3D_newPt(MMG5_pMesh mesh,double c[3],int16_t tag);
 int  _MMG3D_newElt(MMG5_pMesh mesh);
 int  _MMG3D_delElt(MMG5_pMesh mesh,int iel);
+int  _MMG3D_initActive(MMG5_pMesh mesh);
+int  _MMG3D_startSweep(MMG5_pMesh mesh,int mark);
 void _MMG3D_delPt(MMG5_pMesh mesh,int ip);
 int  _MMG3D_zaldy(MMG5_pMesh mesh);
 void _MMG5_freeXTets(MMG5_pMesh mesh);
@@ -246,6 +339,7 @@ extern int  _MMG5_norface(MMG5_pMesh mesh ,int k, int iface, double v[3]);
 int  _MMG5_boulernm (MMG5_pMesh mesh, int start, int ip, int *ng, int *nr);
 int  _MMG5_boulenm(MMG5_pMesh mesh, int start, int ip, int iface, double n[3],double t[3]);
 int  _MMG5_boulevolp(MMG5_pMesh mesh, int start, int ip, int * list);
+int  _MMG3D_boulevolpBase(MMG5_pMesh mesh, int start, int ip, int * list,int base);
 int  _MMG5_boulesurfvolp(MMG5_pMesh mesh,int start,int ip,int iface,int *listv,
                          int *ilistv,int *lists,int*ilists, int isnm);
 int  _MMG5_bouletrid(MMG5_pMesh,int,int,int,int *,int *,int *,int *,int *,int *);
@@ -291,6 +385,7 @@ int  _MMG3D_memOption(MMG5_pMesh mesh);
 int  _MMG5_mmg3d1_pattern(MMG5_pMesh ,MMG5_pSol );
 int  _MMG5_mmg3d1_delone(MMG5_pMesh ,MMG5_pSol );
 int  _MMG3D_mmg3d2(MMG5_pMesh ,MMG5_pSol );
+int  _MMG3D_mmg3dpart(MMG5_pMesh ,MMG5_pSol );
 int  _MMG5_mmg3dChkmsh(MMG5_pMesh,int,int);
 int  _MMG3D_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
 int  _MMG5_split1(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp);
@@ -322,6 +417,9 @@ int    _MMG5_movintpt_iso(MMG5_pMesh ,MMG5_pSol,_MMG3D_pOctree, int *, int , int
 int    _MMG3D_movnormal_iso(MMG5_pMesh ,MMG5_pSol ,int ,int );
 int    _MMG5_movintptLES_iso(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree,int *,int,int);
 int    _MMG5_movintpt_ani(MMG5_pMesh ,MMG5_pSol,_MMG3D_pOctree,int *,int ,int);
+int    _MMG3D_movintptCol(MMG5_pMesh,MMG5_pSol,
+                          double (*)(MMG5_pMesh,MMG5_pSol,MMG5_pTetra),
+                          int*,int,int,double*,double*);
 int    _MMG5_movbdyregpt_iso(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree,
                              int*, int, int*, int, int ,int);
 int    _MMG5_movbdyregpt_ani(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree,
@@ -345,6 +443,8 @@ int  _MMG5_chkswpbdy(MMG5_pMesh, MMG5_pSol,int*, int, int, int,char);
 int  _MMG5_swpbdy(MMG5_pMesh,MMG5_pSol,int*,int,int,_MMG3D_pOctree,char);
 int  _MMG5_swpgen(MMG5_pMesh,MMG5_pSol,int, int, int*,_MMG3D_pOctree,char);
 int  _MMG5_chkswpgen(MMG5_pMesh,MMG5_pSol,int,int,int*,int*,double,char);
+int  _MMG3D_chkswpgenTet(MMG5_pMesh,MMG5_pSol,int,int,int*,int*,double,char,
+                         MMG5_pTetra,double (*)(MMG5_pMesh,MMG5_pSol,MMG5_pTetra));
 int  MMG3D_swap23(MMG5_pMesh mesh,MMG5_pSol met,int k,char metRidTyp);
 int  _MMG5_srcface(MMG5_pMesh mesh,int n0,int n1,int n2);
 int _MMG5_chkptonbdy(MMG5_pMesh,int);
@@ -384,6 +484,8 @@ void _MMG5_printTetra(MMG5_pMesh mesh,char* fileName);
 #ifdef USE_SCOTCH
 int _MMG5_mmg3dRenumbering(int vertBoxNbr, MMG5_pMesh mesh, MMG5_pSol sol);
 #endif
+int _MMG3D_sfcRenumbering(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree);
+int _MMG5_mmg3dSfcRenumbering(MMG5_pMesh mesh,MMG5_pSol met);
 
 int    _MMG5_meancur(MMG5_pMesh mesh,int np,double c[3],int ilist,int *list,double h[3]);
 double _MMG5_surftri(MMG5_pMesh,int,int);
@@ -429,30 +531,54 @@ int    _MMG3D_intmet33_ani(MMG5_pMesh,MMG5_pSol,int,char,int, double);
 int    _MMG5_interp4bar_ani(MMG5_pMesh,MMG5_pSol,int,int,double *);
 int    _MMG5_interp4bar33_ani(MMG5_pMesh,MMG5_pSol,int,int,double *);
 int    _MMG5_interp4bar_iso(MMG5_pMesh,MMG5_pSol,int,int,double *);
+void   _MMG3D_intfieldEdg(MMG5_pMesh,int,int,int,double);
+void   _MMG3D_intfield(MMG5_pMesh,int,char,int,double);
+void   _MMG3D_intfield4bar(MMG5_pMesh,int,int,double[4]);
+void   _MMG3D_movfield(MMG5_pMesh,int*,int,double[3]);
+int    _MMG3D_permField(MMG5_pMesh,int*);
+int    _MMG3D_saveSource(MMG5_pMesh);
+void   _MMG3D_freeSource(MMG5_pMesh);
+int    _MMG3D_interpSource(MMG5_pMesh,MMG5_pSol,MMG5_pSol);
+int    _MMG3D_qualType(MMG5_pMesh,MMG5_pSol);
+void   _MMG3D_caltetPack_iso(_MMG3D_QualPack*,double*);
+void   _MMG3D_caltetPack_ani(_MMG3D_QualPack*,double*);
+double _MMG3D_caltetPack(_MMG3D_QualPack*,int,double*);
+void   _MMG3D_lenedgPack_ani(_MMG3D_EdgPack*,double*);
 int    _MMG3D_defsiz_iso(MMG5_pMesh,MMG5_pSol );
 int    _MMG3D_defsiz_ani(MMG5_pMesh ,MMG5_pSol );
 int    _MMG5_gradsiz_iso(MMG5_pMesh ,MMG5_pSol );
 int    _MMG5_gradsiz_ani(MMG5_pMesh ,MMG5_pSol );
+int    _MMG3D_gradBall(MMG5_pMesh,char,int**,int**);
+void   _MMG3D_delGradBall(MMG5_pMesh,int**,int**);
+int    _MMG3D_gradGraph(MMG5_pMesh,char,int**,int**,int*);
+void   _MMG3D_delGradGraph(MMG5_pMesh,int**,int**,int);
+int    _MMG3D_gradsizHeap_iso(MMG5_pMesh,MMG5_pSol,int*,int*);
+#ifdef USE_OPENMP
+int    _MMG3D_gradsizFront_iso(MMG5_pMesh,MMG5_pSol,int*,int*,int*);
+#endif
+int    _MMG3D_gradsizReplay(MMG5_pMesh,MMG5_pSol,int*,int*,
+                            int (*gradtet)(MMG5_pMesh,MMG5_pSol,int,int*),int,int*);
 double     _MMG5_meansizreg_iso(MMG5_pMesh,MMG5_pSol,int,int*,int,double,double);
 int        _MMG3D_chk4ridVertices(MMG5_pMesh mesh,MMG5_pTetra pt);
 extern int _MMG5_moymet(MMG5_pMesh ,MMG5_pSol ,MMG5_pTetra ,double *);
 
 
-double (*_MMG5_lenedg)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra );
-double (*_MMG5_lenedgspl)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra );
-double (*_MMG5_caltet)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt);
-double (*_MMG5_caltri)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt);
-int    (*_MMG5_defsiz)(MMG5_pMesh ,MMG5_pSol );
-int    (*_MMG5_gradsiz)(MMG5_pMesh ,MMG5_pSol );
-int    (*_MMG5_intmet)(MMG5_pMesh,MMG5_pSol,int,char,int, double);
-int    (*_MMG5_interp4bar)(MMG5_pMesh,MMG5_pSol,int,int,double *);
-int    (*_MMG5_movintpt)(MMG5_pMesh ,MMG5_pSol, _MMG3D_pOctree ,int *, int , int );
-int    (*_MMG5_movbdyregpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int, int ,int);
-int    (*_MMG5_movbdyrefpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
-int    (*_MMG5_movbdynompt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
-int    (*_MMG5_movbdyridpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
-  int    (*_MMG5_cavity)(MMG5_pMesh ,MMG5_pSol ,int ,int ,int *,int ,double);
-  int    (*_MMG3D_octreein)(MMG5_pMesh ,MMG5_pSol ,_MMG3D_pOctree ,int,double );
+/* function pointers (defined in mmg3dexterns.c) */
+extern MMG5_THREAD_LOCAL double (*_MMG5_lenedg)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra );
+extern MMG5_THREAD_LOCAL double (*_MMG5_lenedgspl)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra );
+extern MMG5_THREAD_LOCAL double (*_MMG5_lenedgCoor)(double*, double*, double*, double*);
+extern MMG5_THREAD_LOCAL double (*_MMG5_caltet)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt);
+extern MMG5_THREAD_LOCAL double (*_MMG5_caltri)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt);
+extern MMG5_THREAD_LOCAL int    (*_MMG5_gradsiz)(MMG5_pMesh ,MMG5_pSol );
+extern MMG5_THREAD_LOCAL int    (*_MMG5_intmet)(MMG5_pMesh,MMG5_pSol,int,char,int, double);
+extern MMG5_THREAD_LOCAL int    (*_MMG5_interp4bar)(MMG5_pMesh,MMG5_pSol,int,int,double *);
+extern MMG5_THREAD_LOCAL int    (*_MMG5_movintpt)(MMG5_pMesh ,MMG5_pSol, _MMG3D_pOctree ,int *, int , int );
+extern MMG5_THREAD_LOCAL int    (*_MMG5_movbdyregpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int, int ,int);
+extern MMG5_THREAD_LOCAL int    (*_MMG5_movbdyrefpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
+extern MMG5_THREAD_LOCAL int    (*_MMG5_movbdynompt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
+extern MMG5_THREAD_LOCAL int    (*_MMG5_movbdyridpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
+extern MMG5_THREAD_LOCAL int    (*_MMG5_cavity)(MMG5_pMesh ,MMG5_pSol ,int ,int ,int *,int ,double);
+extern MMG5_THREAD_LOCAL int    (*_MMG3D_octreein)(MMG5_pMesh ,MMG5_pSol ,_MMG3D_pOctree ,int,double );
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -489,6 +615,7 @@ void _MMG3D_Set_commonFunc() {
 #ifdef USE_SCOTCH
   _MMG5_renumbering       = _MMG5_mmg3dRenumbering;
 #endif
+  _MMG5_sfcRenumbering    = _MMG5_mmg3dSfcRenumbering;
 }
 
 #ifdef __cplusplus
@@ -38,7 +38,25 @@
 
 #include "inlined_functions_3d.h"
 
-char  ddb;
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+/** Maximal number of colors of the vertices moved by independent sets */
+#define _MMG3D_NCOL 64
+
+/** Maximal size of the shells stored by the swaps by independent sets */
+#define _MMG3D_SWPSHELL 16
+
+/** Internal point whose move is delayed to the colored relocation */
+typedef struct {
+  double c[3]; /*!< old coordinates of the point if moved */
+  int    ip;   /*!< point index */
+  int    k;    /*!< tetra of the ball of the point */
+  char   i0;   /*!< local index of the point in \a k */
+  char   ok;   /*!< 1 if the point has been moved */
+} _MMG3D_colMove;
+
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -309,7 +327,7 @@ char _MMG5_chkedg(MMG5_pMesh mesh,MMG5_Tria *pt,char ori, double hmax,
   double   ps,ps2,ux,uy,uz,ll,il,alpha,dis,hma2;
   int      ia,ib,ic;//l,info;
   char     i,i1,i2;
-  static char mmgWarn0 = 0, mmgWarn1 = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn0 = 0, mmgWarn1 = 0;
 
   ia   = pt->v[0];
   ib   = pt->v[1];
@@ -534,14 +552,17 @@ char _MMG5_chkedg(MMG5_pMesh mesh,MMG5_Tria *pt,char ori, double hmax,
 int _MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int typchk) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
-  int      k,it,list[MMG3D_LMAX+2],ilist,ret,it1,it2,ns,nns,maxit;
+  int      k,it,list[MMG3D_LMAX+2],ilist,ret,it1,it2,ns,nns,maxit,l,nact;
   char     i,j,ia,ier;
 
   it = nns = 0;
   maxit = 2;
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     ns = 0;
-    for (k=1; k<=mesh->ne; k++) {
+    nact = _MMG3D_startSweep(mesh,mesh->mark-2);
+    for (l=1; l<=_MMG3D_SWEEPEND(mesh,nact); l++) {
+      k  = _MMG3D_SWEEPELT(mesh,nact,l);
       pt = &mesh->tetra[k];
       if ( (!MG_EOK(pt)) || pt->ref < 0 || (pt->tag & MG_REQ) )   continue;
       else if ( !pt->xt ) continue;
@@ -576,6 +597,7 @@ int _MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int typchk
         if ( ier )  break;
       }
     }
+    mesh->stats.nvisit += l-1;
     nns += ns;
   }
   while ( ++it < maxit && ns > 0 );
@@ -585,6 +607,185 @@ int _MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int typchk
   return(nns);
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param crit coefficient of quality improvment.
+ * \param declic quality threshold under which we try to swap the edges of a
+ * tetra.
+ * \param octree pointer toward the octree structure in delaunay mode and
+ * toward the \a NULL pointer otherwise
+ * \param typchk type of checking permformed for edge length (hmin or LSHORT
+ * criterion).
+ * \return -1 if failed, the number of swaps otherwise.
+ *
+ * Internal edge flipping by independent sets. Each sweep over the bad tetra
+ * is made of rounds:
+ *   1. a swap improving each tetra is searched concurrently (OpenMP), the
+ *   mesh being only read, and the shell of the edge to swap is stored;
+ *   2. the swaps are applied in the order of the tetra, skipping a swap if
+ *   its shell shares a tetra with the shell of a swap applied during the
+ *   round. Otherwise the shell and thus the evaluated configuration are
+ *   unchanged (a swap only modifies the tetra of its shell);
+ *   3. the skipped tetra that are still bad make the next round.
+ * The result doesn't depend on the number of threads nor on the scheduling.
+ *
+ */
+static int _MMG3D_swptetSets(MMG5_pMesh mesh,MMG5_pSol met,double crit,
+                             double declic,_MMG3D_pOctree octree,int typchk) {
+  MMG5_pTetra   pt;
+  double        (*caltet)(MMG5_pMesh,MMG5_pSol,MMG5_pTetra);
+  int           list[MMG3D_LMAX+2],ilist,k,l,it,maxit,ns,nns,nskip,ier,n,nact;
+  int           *cand,*conf,*shell,*stamp,ncand,nemem,nstamp,nshell,rnd;
+  unsigned char *nsh;
+  char          *edg;
+
+  /* _MMG5_caltet is local to each thread */
+  caltet = _MMG5_caltet;
+
+  maxit = 2;
+  it = nns = 0;
+
+  do {
+    if ( _MMG5_interrupt(mesh) )  break;
+    ns = ier = 0;
+
+    /* Tetra to improve */
+    nemem = nstamp = mesh->ne+1;
+    _MMG5_ADD_MEM(mesh,nemem*(3*sizeof(int)+2),"swap candidates",return(-1));
+    _MMG5_SAFE_MALLOC(cand,nemem,int,-1);
+    _MMG5_SAFE_MALLOC(conf,nemem,int,-1);
+    _MMG5_SAFE_MALLOC(edg,nemem,char,-1);
+    _MMG5_SAFE_MALLOC(nsh,nemem,unsigned char,-1);
+    _MMG5_SAFE_CALLOC(stamp,nstamp,int,-1);
+
+    nact = _MMG3D_startSweep(mesh,mesh->mark-2);
+    n    = nact < 0 ? mesh->ne : nact;
+    mesh->stats.nvisit += n;
+
+    ncand = 0;
+    for (l=1; l<=n; l++) {
+      k  = _MMG3D_SWEEPELT(mesh,nact,l);
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
+      else if ( pt->mark < mesh->mark-2 )  continue;
+
+      if ( pt->qual > declic )  continue;
+      cand[ncand++] = k;
+    }
+    shell  = NULL;
+    nshell = _MMG3D_SWPSHELL*ncand+1;
+    _MMG5_ADD_MEM(mesh,nshell*sizeof(int),"swap shells",
+                  nshell=0;ier=-1;goto clean);
+    _MMG5_SAFE_MALLOC(shell,nshell,int,-1);
+
+    rnd = 0;
+    while ( ncand > 0 ) {
+      ++rnd;
+      if ( mesh->ne+1 > nstamp ) {
+        _MMG5_ADD_MEM(mesh,(mesh->ne+1-nstamp)*sizeof(int),"swap stamps",
+                      ier=-1;goto clean);
+        _MMG5_SAFE_RECALLOC(stamp,nstamp,mesh->ne+1,int,"swap stamps",-1);
+        nstamp = mesh->ne+1;
+      }
+
+      /* Concurrent search of the swaps */
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(_MMG5_NTHREADS(mesh)) schedule(dynamic,64)
+#endif
+      for (l=0; l<ncand; l++) {
+        MMG5_Tetra    tet0;
+        MMG5_pTetra   ptl;
+        MMG5_pxTetra  pxtl;
+        int           lst[MMG3D_LMAX+2],ilst,nconf;
+        char          j;
+
+        conf[l] = 0;
+        ptl = &mesh->tetra[cand[l]];
+        for (j=0; j<6; j++) {
+          /* Prevent swap of a ref or tagged edge */
+          if ( ptl->xt ) {
+            pxtl = &mesh->xtetra[ptl->xt];
+            if ( pxtl->edg[j] || pxtl->tag[j] ) continue;
+          }
+
+          nconf = _MMG3D_chkswpgenTet(mesh,met,cand[l],j,&ilst,lst,crit,typchk,
+                                      &tet0,caltet);
+          if ( nconf ) {
+            conf[l] = nconf;
+            edg[l]  = j;
+            /* Large shells are evaluated again when applied */
+            nsh[l]  = ilst <= _MMG3D_SWPSHELL ? ilst : 0;
+            if ( nsh[l] )
+              memcpy(&shell[_MMG3D_SWPSHELL*l],lst,ilst*sizeof(int));
+            break;
+          }
+        }
+      }
+
+      /* Application of the independent swaps */
+      nskip = 0;
+      for (l=0; l<ncand; l++) {
+        if ( !conf[l] )  continue;
+
+        if ( nsh[l] ) {
+          ilist = nsh[l];
+          memcpy(list,&shell[_MMG3D_SWPSHELL*l],ilist*sizeof(int));
+          for (k=0; k<ilist; k++)
+            if ( stamp[list[k]/6] == rnd )  break;
+          if ( k < ilist ) {
+            cand[nskip++] = cand[l];
+            continue;
+          }
+        }
+        else {
+          pt = &mesh->tetra[cand[l]];
+          if ( !MG_EOK(pt) )  continue;
+          conf[l] = _MMG5_chkswpgen(mesh,met,cand[l],edg[l],&ilist,list,crit,
+                                    typchk);
+          if ( !conf[l] )  continue;
+        }
+
+        for (k=0; k<ilist; k++)
+          if ( list[k]/6 < nstamp )  stamp[list[k]/6] = rnd;
+
+        ier = _MMG5_swpgen(mesh,met,conf[l],ilist,list,octree,typchk);
+        if ( ier > 0 )  ns++;
+        else if ( ier < 0 )  break;
+      }
+      if ( ier < 0 )  break;
+
+      /* Skipped tetra that are still bad */
+      ncand = 0;
+      for (l=0; l<nskip; l++) {
+        pt = &mesh->tetra[cand[l]];
+        if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
+        else if ( pt->mark < mesh->mark-2 )  continue;
+
+        if ( pt->qual > declic )  continue;
+        cand[ncand++] = cand[l];
+      }
+    }
+
+clean:
+    _MMG5_DEL_MEM(mesh,shell,nshell*sizeof(int));
+    _MMG5_DEL_MEM(mesh,stamp,nstamp*sizeof(int));
+    _MMG5_DEL_MEM(mesh,cand,nemem*sizeof(int));
+    _MMG5_DEL_MEM(mesh,conf,nemem*sizeof(int));
+    _MMG5_DEL_MEM(mesh,edg,nemem*sizeof(char));
+    _MMG5_DEL_MEM(mesh,nsh,nemem*sizeof(unsigned char));
+    if ( ier < 0 )  return(-1);
+
+    nns += ns;
+  }
+  while ( ++it < maxit && ns > 0 );
+
+  if ( (abs(mesh->info.imprim) > 5 || mesh->info.ddebug) && nns > 0 )
+    fprintf(stdout,"     %8d edge swapped\n",nns);
+
+  return(nns);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
@@ -601,15 +802,21 @@ int _MMG5_swptet(MMG5_pMesh mesh,MMG5_pSol met,double crit,double declic,
                  _MMG3D_pOctree octree,int typchk) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
-  int      list[MMG3D_LMAX+2],ilist,k,it,nconf,maxit,ns,nns,ier;
+  int      list[MMG3D_LMAX+2],ilist,k,it,nconf,maxit,ns,nns,ier,l,nact;
   char     i;
 
+  if ( mesh->info.parswap )
+    return(_MMG3D_swptetSets(mesh,met,crit,declic,octree,typchk));
+
   maxit = 2;
   it = nns = 0;
 
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     ns = 0;
-    for (k=1; k<=mesh->ne; k++) {
+    nact = _MMG3D_startSweep(mesh,mesh->mark-2);
+    for (l=1; l<=_MMG3D_SWEEPEND(mesh,nact); l++) {
+      k  = _MMG3D_SWEEPELT(mesh,nact,l);
       pt = &mesh->tetra[k];
       if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
       else if ( pt->mark < mesh->mark-2 )  continue;
@@ -632,6 +839,7 @@ int _MMG5_swptet(MMG5_pMesh mesh,MMG5_pSol met,double crit,double declic,
         }
       }
     }
+    mesh->stats.nvisit += l-1;
     nns += ns;
   }
   while ( ++it < maxit && ns > 0 );
@@ -641,6 +849,158 @@ int _MMG5_swptet(MMG5_pMesh mesh,MMG5_pSol met,double crit,double declic,
   return(nns);
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param col colors of the points (0 if not colored).
+ * \param ip index of the point to color.
+ * \param list pointer toward the volumic ball of the point.
+ * \param ilist size of the volumic ball.
+ *
+ * Give to the point \a ip the smallest color that is not used by the
+ * vertices of its ball (greedy coloring), so two points of same color never
+ * share a tetra. Color \ref _MMG3D_NCOL+1 is given if all the colors are
+ * used: such points are moved one by one.
+ *
+ */
+static inline
+void _MMG3D_colorPoint(MMG5_pMesh mesh,unsigned char *col,int ip,
+                       int *list,int ilist) {
+  MMG5_pTetra   pt;
+  uint64_t      used;
+  int           l;
+  unsigned char j,c;
+
+  used = 0;
+  for (l=0; l<ilist; l++) {
+    pt = &mesh->tetra[list[l]/4];
+    for (j=0; j<4; j++) {
+      c = col[pt->v[j]];
+      if ( c && c <= _MMG3D_NCOL )  used |= ((uint64_t)1) << (c-1);
+    }
+  }
+  for (c=0; c<_MMG3D_NCOL; c++)
+    if ( !(used & (((uint64_t)1) << c)) )  break;
+
+  col[ip] = c+1;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param octree pointer toward the octree structure.
+ * \param cand points to move.
+ * \param ncand number of points to move.
+ * \param col colors of the points (reset at the end).
+ * \param perm work array of size \a ncand.
+ * \param improve forbid volume degradation during the move.
+ * \return the number of moved points.
+ *
+ * Move the internal points \a cand color by color. The points of one color
+ * don't share any tetra so they are moved concurrently (OpenMP); the octree
+ * is then updated serially in the order of \a cand. The result doesn't
+ * depend on the number of threads nor on the scheduling.
+ *
+ */
+static int _MMG3D_movColors(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,
+                            _MMG3D_colMove *cand,int ncand,unsigned char *col,
+                            int *perm,int improve) {
+  _MMG3D_colMove *cd;
+  MMG5_pPoint    ppt;
+  double         (*caltet)(MMG5_pMesh,MMG5_pSol,MMG5_pTetra),c[3];
+  int            cnt[_MMG3D_NCOL+2],lst[MMG3D_LMAX+2],ilst,k,l,nm,base;
+  int            col0,col1;
+  unsigned char  icol;
+  _MMG5_STAT_START(t0);
+
+  /* Sort the points by color (stable) */
+  memset(cnt,0,(_MMG3D_NCOL+2)*sizeof(int));
+  for (l=0; l<ncand; l++)  ++cnt[col[cand[l].ip]];
+  for (icol=1; icol<=_MMG3D_NCOL+1; icol++)  cnt[icol] += cnt[icol-1];
+  for (l=ncand-1; l>=0; l--)  perm[--cnt[col[cand[l].ip]]] = l;
+
+  /* _MMG5_caltet is local to each thread */
+  caltet = _MMG5_caltet;
+
+  nm = 0;
+  for (icol=1; icol<=_MMG3D_NCOL+1; icol++) {
+    col0 = cnt[icol];
+    col1 = icol <= _MMG3D_NCOL ? cnt[icol+1] : ncand;
+    if ( col0 == col1 )  continue;
+
+    if ( icol <= _MMG3D_NCOL ) {
+      base = ++mesh->base;
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(_MMG5_NTHREADS(mesh)) schedule(static)
+#endif
+      for (l=col0; l<col1; l++) {
+        _MMG3D_colMove *cl;
+        double         callist[MMG3D_LMAX+2];
+        int            listv[MMG3D_LMAX+2],ilistv;
+
+        cl     = &cand[perm[l]];
+        ilistv = _MMG3D_boulevolpBase(mesh,cl->k,cl->i0,listv,base);
+        cl->ok = ilistv ?
+          _MMG3D_movintptCol(mesh,met,caltet,listv,ilistv,improve,callist,cl->c) : 0;
+      }
+    }
+    else {
+      /* Points that can't be colored: move them one by one */
+      for (l=col0; l<col1; l++) {
+        double callist[MMG3D_LMAX+2];
+        int    listv[MMG3D_LMAX+2],ilistv;
+
+        cd     = &cand[perm[l]];
+        ilistv = _MMG5_boulevolp(mesh,cd->k,cd->i0,listv);
+        cd->ok = ilistv ?
+          _MMG3D_movintptCol(mesh,met,caltet,listv,ilistv,improve,callist,cd->c) : 0;
+        if ( cd->ok && octree ) {
+          ppt = &mesh->point[cd->ip];
+          _MMG3D_moveOctree(mesh,octree,cd->ip,ppt->c,cd->c);
+        }
+      }
+    }
+
+    if ( octree && icol <= _MMG3D_NCOL ) {
+      /* One move at a time in the octree: restore the old positions of the
+       * moved points, then move them again in order */
+      for (l=col0; l<col1; l++) {
+        cd = &cand[perm[l]];
+        if ( !cd->ok )  continue;
+        ppt = &mesh->point[cd->ip];
+        memcpy(c,ppt->c,3*sizeof(double));
+        memcpy(ppt->c,cd->c,3*sizeof(double));
+        memcpy(cd->c,c,3*sizeof(double));
+      }
+      for (l=col0; l<col1; l++) {
+        cd = &cand[perm[l]];
+        if ( !cd->ok )  continue;
+        ppt = &mesh->point[cd->ip];
+        memcpy(c,ppt->c,3*sizeof(double));
+        memcpy(ppt->c,cd->c,3*sizeof(double));
+        _MMG3D_moveOctree(mesh,octree,cd->ip,ppt->c,c);
+      }
+    }
+    for (l=col0; l<col1; l++) {
+      cd = &cand[perm[l]];
+      _MMG5_STAT_INC(mesh,ncall[MMG5_OperMove]);
+      if ( cd->ok ) {
+        _MMG5_STAT_INC(mesh,nsucc[MMG5_OperMove]);
+        ++nm;
+        if ( mesh->arena.act ) {
+          /* _MMG3D_movintptCol doesn't update the active set */
+          ilst = _MMG5_boulevolp(mesh,cd->k,cd->i0,lst);
+          for (k=0; k<ilst; k++)  _MMG3D_MARK(mesh,lst[k]/4);
+        }
+      }
+    }
+  }
+  _MMG5_STAT_TIME(mesh,otim[MMG5_OperMove],t0);
+
+  for (l=0; l<ncand; l++)  col[cand[l].ip] = 0;
+
+  return(nm);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
@@ -656,6 +1016,10 @@ int _MMG5_swptet(MMG5_pMesh mesh,MMG5_pSol met,double crit,double declic,
  *
  * Analyze tetrahedra and move points so as to make mesh more uniform.
  *
+ * \remark If the \a colmove option is set, the internal points are not moved
+ * during the analysis but stored, colored and moved by independent sets
+ * at the end of each iteration (see \ref _MMG3D_movColors).
+ *
  */
 int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
                  double clickSurf,double clickVol,int moveVol, int improveSurf,
@@ -664,22 +1028,41 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   MMG5_pPoint        ppt;
   MMG5_pxTetra       pxt;
   MMG5_Tria          tt;
+  _MMG3D_colMove     *cand;
   double        *n,caltri;
   int           i,k,ier,nm,nnm,ns,lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilists,ilistv,it;
-  unsigned char j,i0,base;
+  int           *perm,ncand,colmove,l,nact;
+  unsigned char j,i0,base,*col;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** OPTIMIZING MESH\n");
 
+  cand    = NULL;
+  perm    = NULL;
+  col     = NULL;
+  colmove = mesh->info.colmove && moveVol && improveVol != 2;
+  if ( colmove ) {
+    _MMG5_ADD_MEM(mesh,(mesh->np+1)*(sizeof(_MMG3D_colMove)+sizeof(int)+1),
+                  "colored moves",colmove = 0);
+  }
+  if ( colmove ) {
+    _MMG5_SAFE_MALLOC(cand,mesh->np+1,_MMG3D_colMove,-1);
+    _MMG5_SAFE_MALLOC(perm,mesh->np+1,int,-1);
+    _MMG5_SAFE_CALLOC(col,mesh->np+1,unsigned char,-1);
+  }
+
   base = 1;
   for (k=1; k<=mesh->np; k++)
     mesh->point[k].flag = base;
 
   it = nnm = 0;
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     base++;
-    nm = ns = 0;
-    for (k=1; k<=mesh->ne; k++) {
+    nm = ns = ncand = 0;
+    nact = _MMG3D_startSweep(mesh,mesh->mark-2);
+    for (l=1; l<=_MMG3D_SWEEPEND(mesh,nact); l++) {
+      k  = _MMG3D_SWEEPELT(mesh,nact,l);
       pt = &mesh->tetra[k];
       if ( !MG_EOK(pt) || pt->ref < 0 || (pt->tag & MG_REQ) )   continue;
       else if ( pt->mark < mesh->mark-2 )  continue;
@@ -719,16 +1102,20 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
               if( !ier )  continue;
               else if ( ier>0 )
                 ier = _MMG5_movbdynompt(mesh,met,octree,listv,ilistv,lists,ilists,improveVolSurf);
-              else
-                return(-1);
+              else {
+                ier = -1;
+                goto end;
+              }
             }
             else if ( ppt->tag & MG_GEO ) {
               ier=_MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0);
               if ( !ier )  continue;
               else if ( ier>0 )
                 ier = _MMG5_movbdyridpt(mesh,met,octree,listv,ilistv,lists,ilists,improveVolSurf);
-              else
-                return(-1);
+              else {
+                ier = -1;
+                goto end;
+              }
             }
             else if ( ppt->tag & MG_REF ) {
               ier=_MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0);
@@ -736,15 +1123,19 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
                 continue;
               else if ( ier>0 )
                 ier = _MMG5_movbdyrefpt(mesh,met,octree,listv,ilistv,lists,ilists,improveVolSurf);
-              else
-                return(-1);
+              else {
+                ier = -1;
+                goto end;
+              }
             }
             else {
               ier=_MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0);
               if ( !ier )
                 continue;
-              else if ( ier<0 )
-                return(-1);
+              else if ( ier<0 ) {
+                ier = -1;
+                goto end;
+              }
 
               n = &(mesh->xpoint[ppt->xp].n1[0]);
               // if ( MG_GET(pxt->ori,i) ) {
@@ -760,13 +1151,26 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
               }
               ier = _MMG5_movbdyregpt(mesh,met,octree,listv,ilistv,
                                       lists,ilists,improveSurf,improveVolSurf);
-              if (ier < 0 ) return -1;
+              if (ier < 0 ) {
+                ier = -1;
+                goto end;
+              }
               else if ( ier )  ns++;
             }
           }
           else if ( moveVol && (pt->qual < clickVol) ) {
             ilistv = _MMG5_boulevolp(mesh,k,i0,listv);
             if ( !ilistv )  continue;
+            if ( colmove ) {
+              /* Delay the move to the colored relocation */
+              ppt->flag = base;
+              _MMG3D_colorPoint(mesh,col,pt->v[i0],listv,ilistv);
+              cand[ncand].ip = pt->v[i0];
+              cand[ncand].k  = k;
+              cand[ncand].i0 = i0;
+              ++ncand;
+              continue;
+            }
             ier = _MMG5_movintpt(mesh,met,octree,listv,ilistv,improveVol);
           }
           if ( ier ) {
@@ -778,6 +1182,9 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
         }
       }
     }
+    mesh->stats.nvisit += l-1;
+    if ( ncand )
+      nm += _MMG3D_movColors(mesh,met,octree,cand,ncand,col,perm,improveVol);
     nnm += nm;
     if ( mesh->info.ddebug )  fprintf(stdout,"     %8d moved, %d geometry\n",nm,ns);
   }
@@ -786,7 +1193,15 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   if ( (abs(mesh->info.imprim) > 5 || mesh->info.ddebug) && nnm )
     fprintf(stdout,"     %8d vertices moved, %d iter.\n",nnm,it);
 
-  return(nnm);
+  ier = nnm;
+
+end:
+  if ( colmove ) {
+    _MMG5_DEL_MEM(mesh,cand,(mesh->np+1)*sizeof(_MMG3D_colMove));
+    _MMG5_DEL_MEM(mesh,perm,(mesh->np+1)*sizeof(int));
+    _MMG5_DEL_MEM(mesh,col,(mesh->np+1)*sizeof(unsigned char));
+  }
+  return(ier);
 }
 
 /**
@@ -1209,6 +1624,7 @@ _MMG5_anatetv(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
             continue;
           }
         }
+        if ( mesh->field )  _MMG3D_intfield(mesh,k,i,ip,0.5);
 
         if ( !_MMG5_hashEdge(mesh,&hash,ip1,ip2,ip) )  return(-1);
         MG_SET(pt->flag,i);
@@ -1376,7 +1792,7 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   int           vx[6],k,l,ip,ic,it,nap,nc,ni,ne,ns,ip1,ip2,ier,isloc;
   char          i,j,j2,ia,i1,i2,ifac;
   static double uv[3][2] = { {0.5,0.5}, {0.,0.5}, {0.5,0.} };
-  static char   mmgWarn = 0, mmgWarn2 = 0;
+  static MMG5_THREAD_LOCAL char   mmgWarn = 0, mmgWarn2 = 0;
 
   /** 1. analysis of boundary elements */
   if ( !_MMG5_hashNew(mesh,&hash,mesh->np,7*mesh->np) ) return(-1);
@@ -1537,6 +1953,7 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
             continue;
           }
         }
+        if ( mesh->field )  _MMG3D_intfield(mesh,k,ia,ip,0.5);
 
         if ( MG_EDG(ptt.tag[j]) || (ptt.tag[j] & MG_NOM) )
           ppt->ref = ptt.edg[j] ? ptt.edg[j] : ptt.ref;
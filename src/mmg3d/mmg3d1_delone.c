@@ -34,11 +34,10 @@
  *
  * \todo Clean the boucle for (code copy...)
  */
-#include "mmg3d.h"
+#include "inlined_functions_3d.h"
 
 #ifndef PATTERN
 
-char  ddb;
 
 #define _MMG3D_LOPTL_MMG5_DEL     1.41
 #define _MMG3D_LOPTS_MMG5_DEL     0.6
@@ -58,6 +57,8 @@ char  ddb;
  * \param warn pointer to store a flag that warn the user in case of
  * reallocation difficulty.
  * \param it iteration index.
+ * \param tried pointer toward the hash table of the edges already tried by
+ * \ref _MMG5_boucle_batch (NULL if none).
  * \return -1 if fail and we don't save the mesh, 0 if fail but we try to save
  * the mesh, 1 otherwise.
  *
@@ -67,7 +68,8 @@ char  ddb;
  */
 static inline int
 _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
-                 int* ifilt,int* ns,int* nc,int* warn,int it) {
+                 int* ifilt,int* ns,int* nc,int* warn,int it,
+                 _MMG5_Hash *tried) {
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
   MMG5_Tria    ptt;
@@ -82,9 +84,10 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
   int          imin,iq;
   int          ii;
   double       lmaxtet,lmintet,volmin;
-  int          imaxtet,imintet,base;
+  int          imaxtet,imintet,base,l,n,nact,msk,jmax;
+  double       lent[6];
   char         chkRidTet;
-  static char  mmgWarn0 = 0;
+  static MMG5_THREAD_LOCAL char  mmgWarn0 = 0;
 
   /*first try to adapt the bdry so very strict criterion on the volume for Delaunay insertion*/
   volmin=1e-15;
@@ -94,28 +97,28 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
   if ( met->size==6 )  chkRidTet=1;
   else chkRidTet=0;
 
-  for (k=1; k<=ne; k++) {
+  /* the tetra created by the sweep are not visited */
+  nact = _MMG3D_startSweep(mesh,base-2);
+  n    = nact < 0 ? ne : nact;
+  mesh->stats.nvisit += n;
+
+  for (l=1; l<=n; l++) {
+    k  = _MMG3D_SWEEPELT(mesh,nact,l);
     pt = &mesh->tetra[k];
     if ( !MG_EOK(pt)  || (pt->tag & MG_REQ) )   continue;
     else if ( pt->mark < base-2 )  continue;
     pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
 
     /* 1) find longest and shortest edge  and try to manage it */
-    imax = -1; lmax = 0.0;
-    imin = -1; lmin = DBL_MAX;
-    for (ii=0; ii<6; ii++) {
-      if ( pt->xt && (pxt->tag[ii] & MG_REQ) )  continue;
-      len = _MMG5_lenedg(mesh,met,ii,pt);
-
-      if ( len > lmax ) {
-        lmax = len;
-        imax = ii;
-      }
-      if ( len < lmin ) {
-        lmin = len;
-        imin = ii;
-      }
+    msk = 0x3f;
+    if ( pt->xt ) {
+      for (ii=0; ii<6; ii++)
+        if ( pxt->tag[ii] & MG_REQ )  msk &= ~(1<<ii);
     }
+    _MMG3D_lenedgTet(mesh,met,pt,msk,1,lent,&imin,&jmax);
+    imax = jmax;
+    lmax = ( jmax < 0 ) ? 0.0 : lent[jmax];
+    lmin = ( imin < 0 ) ? DBL_MAX : lent[imin];
     if ( imax==-1 ) {
       if ( (mesh->info.ddebug || mesh->info.imprim > 5 ) ) {
         if ( !mmgWarn0 ) {
@@ -216,6 +219,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
             goto collapse;
           }
         }
+        if ( mesh->field )  _MMG3D_intfield(mesh,k,imax,ip,0.5);
         ier = _MMG3D_simbulgept(mesh,met,list,ilist,ip);
         if ( !ier ) {
           _MMG3D_dichoto1b(mesh,met,list,ilist,ip);
@@ -295,6 +299,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
             goto collapse;
           }
         }
+        if ( mesh->field )  _MMG3D_intfield(mesh,k,imax,ip,0.5);
         ier = _MMG3D_simbulgept(mesh,met,list,ilist,ip);
         if ( ier )
           ier = _MMG5_split1b(mesh,met,list,ilist,ip,1,1,0);
@@ -318,6 +323,8 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
 
         /* Case of an internal face */
       } else {
+        /* the edge has already been tried by _MMG5_boucle_batch */
+        if ( tried && _MMG5_hashGet(tried,ip1,ip2) ) goto collapse;
         ilist = _MMG5_coquil(mesh,k,imax,list);
         if ( !ilist )    continue;
         else if ( ilist<0 ) return(-1);
@@ -340,6 +347,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
             goto collapse;
           };
         }
+        if ( mesh->field )  _MMG3D_intfield(mesh,k,imax,ip,0.5);
 
         /* Delaunay */
         if ( lmax<1.6 ) {
@@ -353,6 +361,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
           goto collapse;
         } else {
           lon = _MMG5_cavity(mesh,met,k,ip,list,ilist/2,volmin);
+          _MMG5_STAT_CAVITY(mesh,lon);
           if ( lon < 1 ) {
             // MMG_npd++; // decomment to debug
             _MMG3D_delPt(mesh,ip);
@@ -540,6 +549,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
               goto collapse2;
             }
           }
+          if ( mesh->field )  _MMG3D_intfield(mesh,k,imax,ip,0.5);
           ier = _MMG3D_simbulgept(mesh,met,list,ilist,ip);
           if ( !ier ) {
             ier = _MMG3D_dichoto1b(mesh,met,list,ilist,ip);
@@ -618,6 +628,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
               goto collapse2;
             }
           }
+          if ( mesh->field )  _MMG3D_intfield(mesh,k,imax,ip,0.5);
           ier = _MMG3D_simbulgept(mesh,met,list,ilist,ip);
           if ( ier )
             ier = _MMG5_split1b(mesh,met,list,ilist,ip,1,1,0);
@@ -661,6 +672,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
               goto collapse2;
             }
           }
+          if ( mesh->field )  _MMG3D_intfield(mesh,k,imax,ip,0.5);
 
           if ( lmaxtet<1.6 ) {
             lfilt = 0.7;
@@ -673,6 +685,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
             goto collapse2;
           } else {
             lon = _MMG5_cavity(mesh,met,k,ip,list,ilist/2,volmin);
+            _MMG5_STAT_CAVITY(mesh,lon);
             if ( lon < 1 ) {
               // MMG_npd++; // decomment to debug
               _MMG3D_delPt(mesh,ip);
@@ -786,6 +799,7 @@ _MMG5_optbad(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
   crit = 1.053;
 
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     /* treatment of bad elements*/
     nw = MMG3D_opttyp(mesh,met,octree);
     /* badly shaped process */
@@ -834,6 +848,248 @@ _MMG5_optbad(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
   return(1);
 }
 
+/**
+ * \struct _MMG3D_batchCand
+ * \brief Candidate edge of the batched Delaunay insertion.
+ */
+typedef struct {
+  uint64_t key; /*!< Position of the edge midpoint along the Hilbert curve */
+  double   lmax; /*!< Length of the edge */
+  int      k; /*!< Tetra used to reach the edge */
+  int      ip1,ip2; /*!< Edge extremities (ip1 < ip2) */
+  char     imax; /*!< Local index of the edge in the tetra \a k */
+} _MMG3D_batchCand;
+
+/**
+ * \param a pointer toward the first candidate.
+ * \param b pointer toward the second candidate.
+ * \return -1, 0 or 1 if \a a is lower, equal or greater than \a b.
+ *
+ * Comparison of two candidates of the batched insertion (for qsort): the
+ * candidates are sorted along the Hilbert curve then by edge so the copies of
+ * an edge found from the different tetra of its shell are contiguous.
+ *
+ */
+static int _MMG3D_batchCompare(const void *a,const void *b) {
+  const _MMG3D_batchCand *ca,*cb;
+
+  ca = (const _MMG3D_batchCand*)a;
+  cb = (const _MMG3D_batchCand*)b;
+
+  if ( ca->key != cb->key )  return( ca->key < cb->key ? -1 : 1 );
+  if ( ca->ip1 != cb->ip1 )  return( ca->ip1 < cb->ip1 ? -1 : 1 );
+  if ( ca->ip2 != cb->ip2 )  return( ca->ip2 < cb->ip2 ? -1 : 1 );
+  return( (ca->k > cb->k) - (ca->k < cb->k) );
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param octree pointer toward the octree structure.
+ * \param ne number of elements.
+ * \param ifilt pointer to store the number of vertices filtered by the octree.
+ * \param ns pointer to store the number of vertices insertions.
+ * \param tried pointer toward the hash table filled with the edges that the
+ * batch has tried to split.
+ * \param warn pointer to store a flag that warn the user in case of
+ * reallocation difficulty.
+ * \return -1 if fail and we don't save the mesh, 0 if fail but we try to save
+ * the mesh, 1 otherwise.
+ *
+ * Batched Delaunay insertion: collect the longest internal edge of each tetra
+ * if it is longer than \ref _MMG3D_LOPTL_MMG5_DEL, remove the copies of the
+ * edges, sort the midpoints along the Hilbert curve and insert them in this
+ * order. The candidates are filtered against the already inserted points by
+ * the octree and the edges destroyed by a previous cavity of the batch are
+ * skipped. The edges that the batch has tried are stored in \a tried: the
+ * boundary splits, the collapses and the internal edges that the batch has not
+ * reached (stale candidates, tetra created by the batch) are left to
+ * \ref _MMG5_boucle_for.
+ *
+ */
+static int
+_MMG5_boucle_batch(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,int ne,
+                   int* ifilt,int* ns,_MMG5_Hash *tried,int* warn) {
+  MMG5_pTetra      pt;
+  MMG5_pPoint      p0,p1;
+  _MMG3D_batchCand *cand,*pc;
+  double           lmax,o[3],lfilt,volmin,t0,lent[6];
+  int              k,ip,ip1,ip2,list[MMG3D_LMAX+2],ilist,lon,ret;
+  int              ncand,nc,base,ier,l,n,nact,imax;
+  int              nstale,nfilt,nrej,nins;
+
+  volmin = 1e-15;
+  t0     = _MMG5_wtime();
+  ier    = 1;
+
+  /* same selection of the tetra as the next call of _MMG5_boucle_for */
+  base = mesh->mark+1;
+
+  _MMG5_ADD_MEM(mesh,ne*sizeof(_MMG3D_batchCand),"batch candidates",
+                *warn=1;
+                return(1));
+  _MMG5_SAFE_MALLOC(cand,ne,_MMG3D_batchCand,-1);
+
+  /** Step 1: collection of the candidates */
+  nact = _MMG3D_startSweep(mesh,base-2);
+  n    = nact < 0 ? ne : nact;
+  mesh->stats.nvisit += n;
+
+  ncand = 0;
+  for (l=1; l<=n; l++) {
+    k  = _MMG3D_SWEEPELT(mesh,nact,l);
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || (pt->tag & MG_REQ) || pt->xt )  continue;
+    else if ( pt->mark < base-2 )  continue;
+
+    _MMG3D_lenedgTet(mesh,met,pt,0x3f,1,lent,NULL,&imax);
+    if ( imax==-1 )  continue;
+    lmax = lent[imax];
+    if ( lmax < _MMG3D_LOPTL_MMG5_DEL )  continue;
+
+    ip1 = pt->v[_MMG5_iare[imax][0]];
+    ip2 = pt->v[_MMG5_iare[imax][1]];
+    p0  = &mesh->point[ip1];
+    p1  = &mesh->point[ip2];
+    o[0] = 0.5*(p0->c[0] + p1->c[0]);
+    o[1] = 0.5*(p0->c[1] + p1->c[1]);
+    o[2] = 0.5*(p0->c[2] + p1->c[2]);
+
+    pc = &cand[ncand++];
+    pc->key  = _MMG5_sfcKeyCoor(3,o);
+    pc->lmax = lmax;
+    pc->k    = k;
+    pc->ip1  = MG_MIN(ip1,ip2);
+    pc->ip2  = MG_MAX(ip1,ip2);
+    pc->imax = imax;
+  }
+
+  /** Step 2: sort along the Hilbert curve and remove the copies */
+  qsort(cand,ncand,sizeof(_MMG3D_batchCand),_MMG3D_batchCompare);
+  nc = 0;
+  for (k=0; k<ncand; k++) {
+    if ( nc && cand[nc-1].ip1 == cand[k].ip1 && cand[nc-1].ip2 == cand[k].ip2 )
+      continue;
+    cand[nc++] = cand[k];
+  }
+
+  /* without the table, _MMG5_boucle_for inserts all the edges */
+  if ( !_MMG5_hashNew(mesh,tried,nc,2*nc) ) {
+    *warn = 1;
+    nc = 0;
+  }
+
+  /** Step 3: insertion */
+  nstale = nfilt = nrej = nins = 0;
+  for (k=0; k<nc; k++) {
+    pc = &cand[k];
+    pt = &mesh->tetra[pc->k];
+    ip1 = pt->v[_MMG5_iare[(int)pc->imax][0]];
+    ip2 = pt->v[_MMG5_iare[(int)pc->imax][1]];
+
+    /* the edge may have been destroyed by a previous cavity */
+    if ( !MG_EOK(pt) || (pt->tag & MG_REQ) || pt->xt
+         || MG_MIN(ip1,ip2) != pc->ip1
+         || MG_MAX(ip1,ip2) != pc->ip2 ) {
+      ++nstale;
+      continue;
+    }
+    if ( !_MMG5_hashEdge(mesh,tried,ip1,ip2,1) ) {
+      *warn = 1;
+      break;
+    }
+
+    ilist = _MMG5_coquil(mesh,pc->k,pc->imax,list);
+    if ( !ilist ) {
+      ++nrej;
+      continue;
+    }
+    else if ( ilist<0 ) {
+      ier = -1;
+      break;
+    }
+    else if ( ilist%2 ) {
+      /* boundary edge */
+      ++nrej;
+      continue;
+    }
+
+    p0  = &mesh->point[ip1];
+    p1  = &mesh->point[ip2];
+    o[0] = 0.5*(p0->c[0] + p1->c[0]);
+    o[1] = 0.5*(p0->c[1] + p1->c[1]);
+    o[2] = 0.5*(p0->c[2] + p1->c[2]);
+    ip = _MMG3D_newPt(mesh,o,MG_NOTAG);
+
+    if ( !ip )  {
+      /* reallocation of point table */
+      _MMG5_POINT_REALLOC(mesh,met,ip,mesh->gap,
+                          *warn=1;
+                          goto end,
+                          o,MG_NOTAG,-1);
+    }
+    if ( met->m ) {
+      if ( _MMG5_intmet(mesh,met,pc->k,pc->imax,ip,0.5)<=0 ) {
+        _MMG3D_delPt(mesh,ip);
+        ++nrej;
+        continue;
+      }
+    }
+    if ( mesh->field )  _MMG3D_intfield(mesh,pc->k,pc->imax,ip,0.5);
+
+    lfilt = ( pc->lmax < 1.6 ) ? 0.7 : 0.2;
+
+    if ( octree && !_MMG3D_octreein(mesh,met,octree,ip,lfilt) ) {
+      _MMG3D_delPt(mesh,ip);
+      ++nfilt;
+      continue;
+    }
+
+    lon = _MMG5_cavity(mesh,met,pc->k,ip,list,ilist/2,volmin);
+    _MMG5_STAT_CAVITY(mesh,lon);
+    if ( lon < 1 ) {
+      _MMG3D_delPt(mesh,ip);
+      ++nrej;
+      continue;
+    }
+    ret = _MMG5_delone(mesh,met,ip,list,lon);
+    if ( ret > 0 ) {
+      if ( octree )
+        _MMG3D_addOctree(mesh,octree,ip);
+      ++nins;
+    }
+    else if ( ret == 0 ) {
+      _MMG3D_delPt(mesh,ip);
+      ++nrej;
+    }
+    else {
+      /* allocation problem ==> saveMesh */
+      _MMG3D_delPt(mesh,ip);
+      ier = 0;
+      break;
+    }
+  }
+
+end:
+  _MMG5_DEL_MEM(mesh,cand,ne*sizeof(_MMG3D_batchCand));
+
+  *ns    += nins;
+  *ifilt += nfilt;
+
+  mesh->stats.nbcand  += nc;
+  mesh->stats.nbstale += nstale;
+  mesh->stats.nbfilt  += nfilt;
+  mesh->stats.nbrej   += nrej;
+  mesh->stats.nbins   += nins;
+  mesh->stats.btim    += _MMG5_wtime() - t0;
+
+  if ( abs(mesh->info.imprim) > 4 || mesh->info.ddebug )
+    fprintf(stdout,"     batch: %8d candidates, %8d stale, %8d filtered,"
+            " %8d rejected, %8d inserted\n",nc,nstale,nfilt,nrej,nins);
+
+  return(ier);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
@@ -848,6 +1104,7 @@ _MMG5_optbad(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
  */
 static int
 _MMG5_adpsplcol(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int* warn) {
+  _MMG5_Hash tried;
   int        nfilt,ifilt,ne,ier;
   int        ns,nc,it,nnc,nns,nnf,nnm,maxit,nf,nm,noptim;
   double     maxgap,dd;
@@ -859,12 +1116,34 @@ _MMG5_adpsplcol(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int* warn)
   mesh->gap = maxgap = 0.5;
   // MMG_npuiss = MMG_nvol = MMG_npres = MMG_npd = 0; // decomment to debug
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
+    /* renumbering along a space filling curve: the new points and tetra are
+     * stored in the free slots of the tables in an arbitrary order */
+    if ( mesh->info.renumit && it && !(it%mesh->info.renumit) ) {
+      if ( !_MMG3D_sfcRenumbering(mesh,met,octree) )
+        return(-1);
+      /* the active set is rebuilt with the new indices */
+      mesh->arena.aovf = 1;
+    }
+
     if ( !mesh->info.noinsert ) {
       *warn=0;
       ns = nc = 0;
       ifilt = 0;
       ne = mesh->ne;
-      ier = _MMG5_boucle_for(mesh,met,octree,ne,&ifilt,&ns,&nc,warn,it);
+      memset(&tried,0,sizeof(_MMG5_Hash));
+      if ( mesh->info.batchins ) {
+        ier = _MMG5_boucle_batch(mesh,met,octree,ne,&ifilt,&ns,&tried,warn);
+        if ( ier<=0 ) {
+          if ( tried.item )
+            _MMG5_DEL_MEM(mesh,tried.item,(tried.max+1)*sizeof(_MMG5_hedge));
+          return -1;
+        }
+      }
+      ier = _MMG5_boucle_for(mesh,met,octree,ne,&ifilt,&ns,&nc,warn,it,
+                             tried.item ? &tried : NULL);
+      if ( tried.item )
+        _MMG5_DEL_MEM(mesh,tried.item,(tried.max+1)*sizeof(_MMG5_hedge));
       if ( ier<=0 ) return -1;
     } /* End conditional loop on mesh->info.noinsert */
     else  ns = nc = ifilt = 0;
@@ -964,6 +1243,7 @@ _MMG5_optetLES(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
   declic = 1.01;
   ++mesh->mark;
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     /* treatment of bad elements*/
     if(it < 5) {
       nw = MMG3D_opttyp(mesh,met,octree);
@@ -1049,6 +1329,7 @@ _MMG5_optet(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
   ++mesh->mark;
 
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     /* treatment of bad elements*/
     if(it < 5) {
       nw = MMG3D_opttyp(mesh,met,octree);
@@ -1180,6 +1461,7 @@ _MMG5_adptet_delone(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree) {
   /* renumerotation if available */
   if ( !_MMG5_scotchCall(mesh,met) )
     return(0);
+  mesh->arena.aovf = 1;
 
   if(mesh->info.optimLES) {
     if(!_MMG5_optetLES(mesh,met,octree)) return(0);
@@ -1280,6 +1562,9 @@ int _MMG5_mmg3d1_delone(MMG5_pMesh mesh,MMG5_pSol met) {
     }
   }
 
+  /* without active set, the sweeps visit all the tetra */
+  _MMG3D_initActive(mesh);
+
   if ( !_MMG5_adptet_delone(mesh,met,octree) ) {
     fprintf(stderr,"\n  ## Unable to adapt. Exit program.\n");
     if ( octree )
@@ -1313,6 +1598,8 @@ int _MMG5_mmg3d1_delone(MMG5_pMesh mesh,MMG5_pSol met) {
     /*free octree*/
     _MMG3D_freeOctree(mesh,&octree);
 
+  _MMG5_freeArena(mesh);
+
   return(1);
 }
 
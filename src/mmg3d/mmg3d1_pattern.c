@@ -54,13 +54,13 @@ static int _MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
  MMG5_Tria    ptt;
  MMG5_pPoint  p0,p1,ppt;
  MMG5_pxPoint pxp;
- double       dd,len,lmax,o[3],to[3],no1[3],no2[3],v[3];
+ double       dd,lmax,o[3],to[3],no1[3],no2[3],v[3],lent[6];
  int          k,ip,ip1,ip2,list[MMG3D_LMAX+2],ilist;
- int          ns,ref,ier;
+ int          ns,ref,ier,msk,jmax;
  int16_t      tag;
  char         imax,j,i,i1,i2,ifa0,ifa1;
  char         chkRidTet;
- static char  mmgWarn    = 0;
+ static MMG5_THREAD_LOCAL char  mmgWarn    = 0;
 
   *warn=0;
   ns = 0;
@@ -74,16 +74,13 @@ static int _MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
     pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
 
     /* find longest edge */
-    imax = -1; lmax = 0.0;
-    for (i=0; i<6; i++) {
-      if ( pt->xt && (pxt->tag[i] & MG_REQ) )  continue;
-      len = _MMG5_lenedg(mesh,met,i,pt);
-
-      if ( len > lmax ) {
-        lmax = len;
-        imax = i;
-      }
+    msk = 0x3f;
+    if ( pt->xt ) {
+      for (i=0; i<6; i++)
+        if ( pxt->tag[i] & MG_REQ )  msk &= ~(1<<i);
     }
+    _MMG3D_lenedgTet(mesh,met,pt,msk,1,lent,NULL,&jmax);
+    imax = jmax;
     if ( imax==-1 ) {
       if ( !mmgWarn ) {
         fprintf(stderr,
@@ -93,6 +90,7 @@ static int _MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
       }
       continue;
     }
+    lmax = lent[imax];
     if ( lmax < _MMG3D_LOPTL )  continue;
 
     /* proceed edges according to lengths */
@@ -177,6 +175,7 @@ static int _MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
           continue;
         }
       }
+      if ( mesh->field )  _MMG3D_intfield(mesh,k,imax,ip,0.5);
       ier = _MMG3D_simbulgept(mesh,met,list,ilist,ip);
       if ( !ier ) {
         ier = _MMG3D_dichoto1b(mesh,met,list,ilist,ip);
@@ -250,6 +249,7 @@ static int _MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
           continue;
         }
       }
+      if ( mesh->field )  _MMG3D_intfield(mesh,k,imax,ip,0.5);
       ier = _MMG3D_simbulgept(mesh,met,list,ilist,ip);
       if ( ier )
         ier = _MMG5_split1b(mesh,met,list,ilist,ip,1,1,0);
@@ -284,12 +284,12 @@ static int _MMG5_adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTetra     pt;
   MMG5_pxTetra    pxt;
   MMG5_pPoint     p0,p1;
-  double     len,lmin;
+  double     lmin,lent[6];
   int        k,ip,iq,list[MMG3D_LMAX+2],ilist,lists[MMG3D_LMAX+2],ilists,nc;
-  int        ier;
+  int        ier,msk,jmin;
   int16_t    tag;
   char       imin,j,i,i1,i2,ifa0,ifa1;
-  static char mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn = 0;
 
   nc = 0;
   for (k=1; k<=mesh->ne; k++) {
@@ -298,16 +298,13 @@ static int _MMG5_adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
     pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
 
     /* find shortest edge */
-    imin = -1; lmin = DBL_MAX;
-    for (i=0; i<6; i++) {
-      if ( pt->xt && (pxt->tag[i] & MG_REQ) )  continue;
-      len = _MMG5_lenedg(mesh,met,i,pt);
-
-      if ( len < lmin ) {
-        lmin = len;
-        imin = i;
-      }
+    msk = 0x3f;
+    if ( pt->xt ) {
+      for (i=0; i<6; i++)
+        if ( pxt->tag[i] & MG_REQ )  msk &= ~(1<<i);
     }
+    _MMG3D_lenedgTet(mesh,met,pt,msk,1,lent,&jmin,NULL);
+    imin = jmin;
     if ( imin==-1 ) {
       if ( !mmgWarn ) {
         fprintf(stderr,
@@ -317,6 +314,7 @@ static int _MMG5_adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
       }
       continue;
     }
+    lmin = lent[imin];
     if ( lmin > _MMG3D_LOPTS )  continue;
 
     // Case of an internal tetra with 4 ridges vertices.
@@ -389,6 +387,7 @@ static int _MMG5_adptet(MMG5_pMesh mesh,MMG5_pSol met) {
   maxit = 10;
   mesh->gap = maxgap = 0.5;
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     if ( !mesh->info.noinsert ) {
       ns = _MMG5_adpspl(mesh,met,&warn);
       if ( ns < 0 ) {
@@ -403,6 +402,12 @@ static int _MMG5_adptet(MMG5_pMesh mesh,MMG5_pSol met) {
     if ( it==1 && !_MMG5_scotchCall(mesh,met) )
       return(0);
 
+    /* renumbering along a space filling curve */
+    if ( mesh->info.renumit && it && !(it%mesh->info.renumit) ) {
+      if ( !_MMG3D_sfcRenumbering(mesh,met,NULL) )
+        return(0);
+    }
+
     if ( !mesh->info.noinsert ) {
       nc = _MMG5_adpcol(mesh,met);
       if ( nc < 0 ) {
@@ -477,6 +482,7 @@ static int _MMG5_adptet(MMG5_pMesh mesh,MMG5_pSol met) {
   it  = 0;
   maxit = 2;
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
 /*     /\* treatment of bad elements*\/ */
 /*     if( 0 && it < 2) { */
 /*       nw = MMG3D_opttyp(mesh,met,NULL); */
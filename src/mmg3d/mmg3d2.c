@@ -35,7 +35,6 @@
 
 #include "mmg3d.h"
 
-extern char  ddb;
 
 /**
  * \remark Not used.
@@ -93,7 +92,7 @@ _MMG5_ismaniball(MMG5_pMesh mesh,MMG5_pSol sol,int k,int indp) {
   double       v,v0,v1,v2;
   int         *adja,list[MMG3D_LMAX+1],bdy[MMG3D_LMAX+1],ibdy,np,ilist,base,cur,iel,jel,res,l;
   char         i,i0,i1,i2,j0,j1,j2,j,ip,nzeros,nopp,nsame;
-  static char  mmgWarn0 = 0;
+  static MMG5_THREAD_LOCAL char  mmgWarn0 = 0;
 
   pt = &mesh->tetra[k];
   np = pt->v[indp];
@@ -428,7 +427,7 @@ static int _MMG3D_cuttet_ls(MMG5_pMesh mesh, MMG5_pSol sol/*,double *tmp*/){
   double        c[3],v0,v1,s;
   int           vx[6],nb,k,ip0,ip1,np,ns,ne,ier;
   char          ia,j,npneg;
-  static char   mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char   mmgWarn = 0;
   /* Commented because unused */
   /*MMG5_pPoint  p[4];*/
   /*double   *grad,A[3][3],b[3],*g0,*g1,area,a,d,dd,s1,s2;*/
@@ -607,6 +606,7 @@ static int _MMG3D_cuttet_ls(MMG5_pMesh mesh, MMG5_pSol sol/*,double *tmp*/){
                             ,c,0,0);
       }
       sol->m[np] = mesh->info.ls;
+      if ( mesh->field )  _MMG3D_intfieldEdg(mesh,ip0,ip1,np,s);
 
       if ( npneg ) {
         /* We split a required edges */
@@ -830,7 +830,7 @@ int _MMG5_chkmani(MMG5_pMesh mesh){
   int          k,iel,ref;
   int         *adja;
   char         i,j,ip,cnt;
-  static char  mmgWarn0 = 0;
+  static MMG5_THREAD_LOCAL char  mmgWarn0 = 0;
 
   for(k=1; k<=mesh->np; k++){
     mesh->point[k].flag = 0;
@@ -41,7 +41,6 @@
 
 #define _MMG5_DEGTOL  1.e-1
 
-extern char  ddb;
 
 /** Calculate an estimate of the average (isotropic) length of edges in the mesh */
 double _MMG5_estavglen(MMG5_pMesh mesh) {
@@ -109,7 +108,7 @@ static int _MMG5_spllag(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met,int itdeg,
   double      *m1,*m2,*mp;
   int          k,ip,ip1,ip2,list[MMG3D_LMAX+2],ilist,ns,ier,iadr;
   char         imax,i,i1,i2;
-  static char  mmgWarn0 = 0;
+  static MMG5_THREAD_LOCAL char  mmgWarn0 = 0;
   
   *warn=0;
   ns = 0;
@@ -184,6 +183,7 @@ static int _MMG5_spllag(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met,int itdeg,
         return(-1);
       }
     }
+    if ( mesh->field )  _MMG3D_intfield(mesh,k,imax,ip,0.5);
     
     /* Interpolation of displacement */
     if ( disp->m ) {
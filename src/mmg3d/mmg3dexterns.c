@@ -0,0 +1,50 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mmg3d/mmg3dexterns.c
+ * \brief Definition of the mmg3d function pointers.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * The pointers are thread-local and are set by \ref MMG3D_setfunc at the
+ * beginning of each library call.
+ **/
+
+#include "mmg3d.h"
+
+MMG5_THREAD_LOCAL double (*_MMG5_lenedg)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra );
+MMG5_THREAD_LOCAL double (*_MMG5_lenedgspl)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra );
+MMG5_THREAD_LOCAL double (*_MMG5_lenedgCoor)(double*, double*, double*, double*);
+MMG5_THREAD_LOCAL double (*_MMG5_caltet)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt);
+MMG5_THREAD_LOCAL double (*_MMG5_caltri)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt);
+MMG5_THREAD_LOCAL int    (*_MMG5_gradsiz)(MMG5_pMesh ,MMG5_pSol );
+MMG5_THREAD_LOCAL int    (*_MMG5_intmet)(MMG5_pMesh,MMG5_pSol,int,char,int, double);
+MMG5_THREAD_LOCAL int    (*_MMG5_interp4bar)(MMG5_pMesh,MMG5_pSol,int,int,double *);
+MMG5_THREAD_LOCAL int    (*_MMG5_movintpt)(MMG5_pMesh ,MMG5_pSol, _MMG3D_pOctree ,int *, int , int );
+MMG5_THREAD_LOCAL int    (*_MMG5_movbdyregpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int, int ,int);
+MMG5_THREAD_LOCAL int    (*_MMG5_movbdyrefpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
+MMG5_THREAD_LOCAL int    (*_MMG5_movbdynompt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
+MMG5_THREAD_LOCAL int    (*_MMG5_movbdyridpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
+MMG5_THREAD_LOCAL int    (*_MMG5_cavity)(MMG5_pMesh ,MMG5_pSol ,int ,int ,int *,int ,double);
+MMG5_THREAD_LOCAL int    (*_MMG3D_octreein)(MMG5_pMesh ,MMG5_pSol ,_MMG3D_pOctree ,int,double );
@@ -62,6 +62,8 @@ int _MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   int    iloc;
   int                  k,iel,i0;
 
+  _MMG5_STAT_START(t0);
+
   // Dynamic alloc for windows comptibility
   _MMG5_SAFE_MALLOC(callist, ilist, double,0);
 
@@ -90,7 +92,7 @@ int _MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   }
   if (totvol < _MMG5_EPSD2) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
 
   totvol = 1.0 / totvol;
@@ -109,7 +111,7 @@ int _MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
     callist[k] = _MMG5_orcal(mesh,met,0);
     if (callist[k] < _MMG5_NULKAL) {
       _MMG5_SAFE_FREE(callist);
-      return(0);
+      _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
     }
     calnew = MG_MIN(calnew,callist[k]);
 
@@ -120,13 +122,13 @@ int _MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
         if ( (len1 < _MMG3D_LOPTL && len2 >= _MMG3D_LOPTL) ||
              (len1 > _MMG3D_LOPTL && len2 >len1 ) ) {
           _MMG5_SAFE_FREE(callist);
-          return 0;
+          _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
         }
 
         if ( (len1 > _MMG3D_LOPTS && len2 <= _MMG3D_LOPTS) ||
              (len1 < _MMG3D_LOPTS && len2 <len1 ) ) {
           _MMG5_SAFE_FREE(callist);
-          return 0;
+          _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
         }
       }
     }
@@ -134,36 +136,143 @@ int _MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   }
   if (calold < _MMG5_EPSOK && calnew <= calold) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   else if (calnew < _MMG5_EPSOK) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   else if ( improve && calnew < 1.02 * calold ) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   else if ( calnew < 0.3 * calold ) {
     _MMG5_SAFE_FREE(callist);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
 
   /* update position */
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, pt->v[i0], ppt0->c, p0->c);
 
+  if ( mesh->field )  _MMG3D_movfield(mesh,list,ilist,ppt0->c);
+
   p0 = &mesh->point[pt->v[i0]];
   p0->c[0] = ppt0->c[0];
   p0->c[1] = ppt0->c[1];
   p0->c[2] = ppt0->c[2];
   for (k=0; k<ilist; k++) {
     (&mesh->tetra[list[k]/4])->qual=callist[k];
-    (&mesh->tetra[list[k]/4])->mark=mesh->mark;
+    _MMG3D_MARK(mesh,list[k]/4);
   }
 
 
   _MMG5_SAFE_FREE(callist);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param caltet function computing the quality of a tetra.
+ * \param list pointer toward the volumic ball of the point.
+ * \param ilist size of the volumic ball.
+ * \param improve force the new minimum element quality to be greater or equal
+ * than 1.02 of the old minimum element quality.
+ * \param callist work array of size \a ilist for the new qualities.
+ * \param oldc filled by the old coordinates of the point if it is moved.
+ *
+ * \return 0 if we can't move the point, 1 if we can.
+ *
+ * Move internal point whose volumic ball is passed, as
+ * \ref _MMG5_movintpt_iso and \ref _MMG5_movintpt_ani (depending on the metric
+ * size) but without using the point 0 and the tetra 0 to store the new
+ * configuration: the point is moved in place and restored if the move
+ * fails. The octree is not updated. Thus the function can be called
+ * concurrently for points that don't share any tetra (the quality function
+ * is given by the caller because \ref _MMG5_caltet is local to each thread).
+ *
+ * \remark the active set of the sweeps is not updated.
+ * \remark the metric is not interpolated at the new position.
+ * \remark we don't check if we break the hausdorff criterion.
+ *
+ */
+int _MMG3D_movintptCol(MMG5_pMesh mesh,MMG5_pSol met,
+                       double (*caltet)(MMG5_pMesh,MMG5_pSol,MMG5_pTetra),
+                       int *list,int ilist,int improve,double *callist,
+                       double *oldc) {
+  MMG5_pTetra          pt;
+  MMG5_pPoint          p0,p1,p2,p3,ppt;
+  double               vol,totvol,m[6],c[3];
+  double               calold,calnew,det;
+  int                  k,iel;
+
+  /* Coordinates of optimal point */
+  c[0] = c[1] = c[2] = 0.0;
+  calold = DBL_MAX;
+  totvol = 0.0;
+  for (k=0; k<ilist; k++) {
+    iel = list[k] / 4;
+    pt = &mesh->tetra[iel];
+    p0 = &mesh->point[pt->v[0]];
+    p1 = &mesh->point[pt->v[1]];
+    p2 = &mesh->point[pt->v[2]];
+    p3 = &mesh->point[pt->v[3]];
+    vol= _MMG5_det4pt(p0->c,p1->c,p2->c,p3->c);
+
+    if ( met->size == 6 ) {
+      if ( !_MMG5_moymet(mesh,met,pt,m) )  return(0);
+
+      det = m[0] * ( m[3]*m[5] - m[4]*m[4]) - m[1] * ( m[1]*m[5] - m[2]*m[4])
+        + m[2] * ( m[1]*m[4] - m[2]*m[3]);
+      if ( det < _MMG5_EPSD2 )  return(0);
+
+      vol *= sqrt(det);
+    }
+    totvol += vol;
+    /* barycenter */
+    c[0] += 0.25 * vol*(p0->c[0] + p1->c[0] + p2->c[0] + p3->c[0]);
+    c[1] += 0.25 * vol*(p0->c[1] + p1->c[1] + p2->c[1] + p3->c[1]);
+    c[2] += 0.25 * vol*(p0->c[2] + p1->c[2] + p2->c[2] + p3->c[2]);
+    calold = MG_MIN(calold, pt->qual);
+  }
+  if (totvol < _MMG5_EPSD2)  return(0);
+
+  totvol = 1.0 / totvol;
+  c[0] *= totvol;
+  c[1] *= totvol;
+  c[2] *= totvol;
+
+  /* Check new position validity: no other vertex of the ball may move
+   * meanwhile, so the tetra are evaluated in place. */
+  ppt = &mesh->point[mesh->tetra[list[0]/4].v[list[0]%4]];
+  memcpy(oldc,ppt->c,3*sizeof(double));
+  memcpy(ppt->c,c,3*sizeof(double));
+
+  calnew = DBL_MAX;
+  for (k=0; k<ilist; k++) {
+    callist[k] = caltet(mesh,met,&mesh->tetra[list[k]/4]);
+    if (callist[k] < _MMG5_NULKAL)  break;
+    calnew = MG_MIN(calnew,callist[k]);
+  }
+  if ( k < ilist ||
+       (calold < _MMG5_EPSOK && calnew <= calold) ||
+       calnew < _MMG5_EPSOK ||
+       ( improve && calnew < 1.02 * calold ) ||
+       calnew < 0.3 * calold ) {
+    memcpy(ppt->c,oldc,3*sizeof(double));
+    return(0);
+  }
+  if ( mesh->field ) {
+    memcpy(ppt->c,oldc,3*sizeof(double));
+    _MMG3D_movfield(mesh,list,ilist,c);
+    memcpy(ppt->c,c,3*sizeof(double));
+  }
+
+  for (k=0; k<ilist; k++) {
+    (&mesh->tetra[list[k]/4])->qual=callist[k];
+    (&mesh->tetra[list[k]/4])->mark=mesh->mark;
+  }
   return(1);
 }
 
@@ -342,7 +451,7 @@ int _MMG5_movintptLES_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
 
    for (k=0; k<ilist; k++) {
      (&mesh->tetra[list[k]/4])->qual=callist[k];
-     (&mesh->tetra[list[k]/4])->mark=mesh->mark;
+     _MMG3D_MARK(mesh,list[k]/4);
    }
 
    _MMG5_SAFE_FREE(callist);
@@ -380,7 +489,7 @@ int _MMG5_movbdyregpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   double            calold,calnew,caltmp,*callist;
   int               k,kel,iel,l,n0,na,nb,ntempa,ntempb,ntempc,nut,nxp;
   unsigned char     i0,iface,i;
-  static char       mmgErr0=0,mmgErr1=0;
+  static MMG5_THREAD_LOCAL char       mmgErr0=0,mmgErr1=0;
 
   step = 0.1;
   nut    = 0;
@@ -747,6 +856,7 @@ int _MMG5_movbdyregpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, n0, o, p0->c);
 
+  if ( mesh->field )  _MMG3D_movfield(mesh,listv,ilistv,o);
   p0->c[0] = o[0];
   p0->c[1] = o[1];
   p0->c[2] = o[2];
@@ -757,7 +867,7 @@ int _MMG5_movbdyregpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
   for(l=0; l<ilistv; l++){
     (&mesh->tetra[listv[l]/4])->qual= callist[l];
-    (&mesh->tetra[listv[l]/4])->mark=mesh->mark;
+    _MMG3D_MARK(mesh,listv[l]/4);
   }
   _MMG5_SAFE_FREE(callist);
   return(1);
@@ -1092,6 +1202,7 @@ int _MMG5_movbdyrefpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, ip0, o, p0->c);
 
+  if ( mesh->field )  _MMG3D_movfield(mesh,listv,ilistv,o);
   p0->c[0] = o[0];
   p0->c[1] = o[1];
   p0->c[2] = o[2];
@@ -1107,7 +1218,7 @@ int _MMG5_movbdyrefpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
   for( l=0 ; l<ilistv ; l++ ){
     (&mesh->tetra[listv[l]/4])->qual = callist[l];
-    (&mesh->tetra[listv[l]/4])->mark = mesh->mark;
+    _MMG3D_MARK(mesh,listv[l]/4);
   }
   _MMG5_SAFE_FREE(callist);
   return(1);
@@ -1442,6 +1553,7 @@ int _MMG5_movbdynompt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   /* Update coordinates, normals, for new point */
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, ip0, o, p0->c);
+  if ( mesh->field )  _MMG3D_movfield(mesh,listv,ilistv,o);
   p0->c[0] = o[0];
   p0->c[1] = o[1];
   p0->c[2] = o[2];
@@ -1457,7 +1569,7 @@ int _MMG5_movbdynompt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
 
   for(l=0; l<ilistv; l++){
     (&mesh->tetra[listv[l]/4])->qual = callist[l];
-    (&mesh->tetra[listv[l]/4])->mark = mesh->mark;
+    _MMG3D_MARK(mesh,listv[l]/4);
   }
   _MMG5_SAFE_FREE(callist);
   return(1);
@@ -1791,6 +1903,7 @@ int _MMG5_movbdyridpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   if ( octree )
     _MMG3D_moveOctree(mesh, octree, ip0, o, p0->c);
 
+  if ( mesh->field )  _MMG3D_movfield(mesh,listv,ilistv,o);
   p0->c[0] = o[0];
   p0->c[1] = o[1];
   p0->c[2] = o[2];
@@ -1810,7 +1923,7 @@ int _MMG5_movbdyridpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
   for(l=0; l<ilistv; l++){
     (&mesh->tetra[listv[l]/4])->qual = callist[l];
-    (&mesh->tetra[listv[l]/4])->mark = mesh->mark;
+    _MMG3D_MARK(mesh,listv[l]/4);
   }
   _MMG5_SAFE_FREE(callist);
   return(1);
@@ -1905,12 +2018,22 @@ int _MMG3D_movv_ani(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
     memcpy(ppa->c,oldc,3*sizeof(double));
     return(0);
   }
+  if ( mesh->field ) {
+    /* interpolate the fields from the old position of the point */
+    for (j=0; j<3; j++) {
+      dd = ppa->c[j];
+      ppa->c[j] = oldc[j];
+      oldc[j] = dd;
+    }
+    _MMG3D_movfield(mesh,list,lon,oldc);
+    memcpy(ppa->c,oldc,3*sizeof(double));
+  }
 
   for (l=0; l<lon; l++) {
     iel = list[l] / 4;
     pt1 = &mesh->tetra[iel];
     pt1->qual = qualtet[l];
-    pt1->mark = mesh->mark;
+    _MMG3D_MARK(mesh,iel);
   }
   return(1);
 
@@ -2025,12 +2148,22 @@ int _MMG3D_movnormal_iso(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
     memcpy(ppa->c,oldp,3*sizeof(double));
     return(0);
   }
+  if ( mesh->field ) {
+    /* interpolate the fields from the old position of the point */
+    for (j=0; j<3; j++) {
+      dd = ppa->c[j];
+      ppa->c[j] = oldp[j];
+      oldp[j] = dd;
+    }
+    _MMG3D_movfield(mesh,list,lon,oldp);
+    memcpy(ppa->c,oldp,3*sizeof(double));
+  }
 
   for (l=0; l<lon; l++) {
     iel = list[l] / 4;
     pt1 = &mesh->tetra[iel];
     pt1->qual = qualtet[l];
-    pt1->mark = mesh->mark;
+    _MMG3D_MARK(mesh,iel);
   }
   return(1);
 
@@ -2134,12 +2267,22 @@ int _MMG3D_movv_iso(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
     memcpy(ppa->c,oldc,3*sizeof(double));
     return(0);
   }
+  if ( mesh->field ) {
+    /* interpolate the fields from the old position of the point */
+    for (j=0; j<3; j++) {
+      dd = ppa->c[j];
+      ppa->c[j] = oldc[j];
+      oldc[j] = dd;
+    }
+    _MMG3D_movfield(mesh,list,lon,oldc);
+    memcpy(ppa->c,oldc,3*sizeof(double));
+  }
 
   for (l=0; l<lon; l++) {
     iel = list[l] / 4;
     pt1 = &mesh->tetra[iel];
     pt1->qual = qualtet[l];
-    pt1->mark = mesh->mark;
+    _MMG3D_MARK(mesh,iel);
   }
   return(1);
 
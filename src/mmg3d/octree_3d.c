@@ -56,6 +56,118 @@ void _MMG3D_initOctree_s( _MMG3D_octree_s* q)
   q->branches = NULL;
 }
 
+/**
+ * \param siz size of a block (in bytes).
+ * \return the size class of the block.
+ *
+ * Size class of a block of the octree pool: the blocks of class \a k have
+ * \f$2^k\f$ bytes (8 bytes at least to store the free list link).
+ *
+ */
+static inline
+int _MMG3D_octreeClass(size_t siz) {
+  int k;
+
+  k = 3;
+  while ( ((size_t)1<<k) < siz ) ++k;
+
+  return(k);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param octree pointer toward the global octree.
+ * \param siz size of the block (in bytes).
+ * \return a pointer toward the block, NULL if fail.
+ *
+ * Get a block of \a siz bytes from the octree pool: a free block of the same
+ * size class is reused if any, otherwise the block is taken at the end of the
+ * last memory chunk (a new chunk is allocated if needed).
+ *
+ */
+static
+void* _MMG3D_octreeAlloc(MMG5_pMesh mesh,_MMG3D_pOctree octree,size_t siz) {
+  _MMG3D_octreeChunk *chunk;
+  void               *ptr;
+  char               *mem;
+  size_t             bsiz,csiz;
+  int                k;
+
+  k = _MMG3D_octreeClass(siz);
+  assert ( k < _MMG3D_OCTREE_NCLASS );
+
+  if ( octree->pool[k] ) {
+    ptr             = octree->pool[k];
+    octree->pool[k] = *(void**)ptr;
+    return(ptr);
+  }
+
+  bsiz = (size_t)1<<k;
+  if ( octree->left < bsiz ) {
+    /* the end of the previous chunk is lost */
+    csiz = MG_MAX(_MMG3D_OCTREE_CHUNK,sizeof(_MMG3D_octreeChunk)+bsiz);
+    _MMG5_ADD_MEM(mesh,csiz,"octree chunk",return(NULL));
+    _MMG5_SAFE_MALLOC(mem,csiz,char,NULL);
+    chunk         = (_MMG3D_octreeChunk*)mem;
+    chunk->nxt    = octree->chunk;
+    chunk->siz    = csiz;
+    octree->chunk = chunk;
+    octree->cur   = (char*)chunk + sizeof(_MMG3D_octreeChunk);
+    octree->left  = csiz - sizeof(_MMG3D_octreeChunk);
+  }
+
+  ptr           = octree->cur;
+  octree->cur  += bsiz;
+  octree->left -= bsiz;
+
+  return(ptr);
+}
+
+/**
+ * \param octree pointer toward the global octree.
+ * \param ptr pointer toward the block to release.
+ * \param siz size of the block (in bytes).
+ *
+ * Give a block back to the free list of its size class.
+ *
+ */
+static inline
+void _MMG3D_octreeFree(_MMG3D_pOctree octree,void *ptr,size_t siz) {
+  int k;
+
+  k               = _MMG3D_octreeClass(siz);
+  *(void**)ptr    = octree->pool[k];
+  octree->pool[k] = ptr;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param octree pointer toward the global octree.
+ * \param ptr pointer toward the block to resize.
+ * \param siz size of the block (in bytes).
+ * \param nsiz new size of the block (in bytes).
+ * \return a pointer toward the resized block, NULL if fail.
+ *
+ * Resize a block of the octree pool (the block is only moved if its size class
+ * changes).
+ *
+ */
+static
+void* _MMG3D_octreeRealloc(MMG5_pMesh mesh,_MMG3D_pOctree octree,void *ptr,
+                           size_t siz,size_t nsiz) {
+  void *nptr;
+
+  if ( _MMG3D_octreeClass(siz) == _MMG3D_octreeClass(nsiz) )  return(ptr);
+
+  nptr = _MMG3D_octreeAlloc(mesh,octree,nsiz);
+  if ( !nptr )  return(NULL);
+
+  memcpy(nptr,ptr,MG_MIN(siz,nsiz));
+  _MMG3D_octreeFree(octree,ptr,siz);
+
+  return(nptr);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param q pointer toward the global octree
@@ -71,7 +183,7 @@ int _MMG3D_initOctree(MMG5_pMesh mesh,_MMG3D_pOctree* q, int nv)
 
   _MMG5_ADD_MEM(mesh,sizeof(_MMG3D_octree),"octree structure",
                 return 0);
-  _MMG5_SAFE_MALLOC(*q,1, _MMG3D_octree,0);
+  _MMG5_SAFE_CALLOC(*q,1, _MMG3D_octree,0);
 
 
   // set nv to the next power of 2
@@ -87,6 +199,12 @@ int _MMG3D_initOctree(MMG5_pMesh mesh,_MMG3D_pOctree* q, int nv)
   // Number maximum of cells listed for the zone search
   (*q)->nc = MG_MAX(2048/nv,16);
 
+  // Work arrays of the zone search
+  _MMG5_ADD_MEM(mesh,(*q)->nc*(sizeof(_MMG3D_octree_s*)+sizeof(double)),
+                "octree search lists",return 0);
+  _MMG5_SAFE_MALLOC((*q)->qlist,(*q)->nc,_MMG3D_octree_s*,0);
+  _MMG5_SAFE_MALLOC((*q)->dist,(*q)->nc,double,0);
+
   _MMG5_ADD_MEM(mesh,sizeof(_MMG3D_octree_s),"initial octree cell",
                 return 0);
 
@@ -107,13 +225,15 @@ int _MMG3D_initOctree(MMG5_pMesh mesh,_MMG3D_pOctree* q, int nv)
 
 /**
  * \param mesh pointer toward the mesh structure.
+ * \param octree pointer toward the global octree.
  * \param q pointer toward the octree cell
  * \param nv number of vertices in the cell subtree
  *
- * Free the octree cell.
+ * Free the octree cell (its memory goes back to the octree pool).
  *
  */
-void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_octree_s* q, int nv)
+void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_pOctree octree,
+                         _MMG3D_octree_s* q, int nv)
 {
   int nbBitsInt,depthMax,dim,i,sizTab,sizBr,nvTemp;
 
@@ -126,9 +246,9 @@ void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_octree_s* q, int nv)
   {
     for ( i = 0; i<sizBr; i++)
     {
-      _MMG3D_freeOctree_s(mesh,&(q->branches[i]), nv);
+      _MMG3D_freeOctree_s(mesh,octree,&(q->branches[i]), nv);
     }
-    _MMG5_DEL_MEM(mesh,q->branches,sizBr*sizeof(_MMG3D_octree_s));
+    _MMG3D_octreeFree(octree,q->branches,sizBr*sizeof(_MMG3D_octree_s));
     q->branches = NULL;
   }
   else if (q->nbVer>0)
@@ -144,7 +264,7 @@ void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_octree_s* q, int nv)
       nvTemp |= nvTemp >> 16;
       nvTemp++;
 
-      _MMG5_DEL_MEM(mesh,q->v,nvTemp*sizeof(int));
+      _MMG3D_octreeFree(octree,q->v,nvTemp*sizeof(int));
       q->v = NULL;
       q->nbVer = 0;
     }else
@@ -158,7 +278,7 @@ void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_octree_s* q, int nv)
         sizTab = nv * ((int)(q->nbVer/nv) + sizTab);
       }
       assert(q->v);
-      _MMG5_DEL_MEM(mesh,q->v,sizTab*sizeof(int));
+      _MMG3D_octreeFree(octree,q->v,sizTab*sizeof(int));
       q->v = NULL;
       q->nbVer = 0;
     }
@@ -169,18 +289,76 @@ void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_octree_s* q, int nv)
  * \param mesh pointer toward the mesh structure.
  * \param q pointer toward a pointer toward the global octree.
  *
- * Free the global octree structure.
+ * Free the global octree structure (the cells being stored in the octree pool,
+ * we only have to release the pool chunks).
  *
  */
 void _MMG3D_freeOctree(MMG5_pMesh mesh,_MMG3D_pOctree *q)
 {
-  _MMG3D_freeOctree_s(mesh,(*q)->q0, (*q)->nv);
+  _MMG3D_octreeChunk *chunk;
+
+  while ( (*q)->chunk ) {
+    chunk        = (*q)->chunk;
+    (*q)->chunk  = chunk->nxt;
+    _MMG5_DEL_MEM(mesh,chunk,chunk->siz);
+  }
   _MMG5_DEL_MEM(mesh,(*q)->q0,sizeof(_MMG3D_octree_s));
   (*q)->q0 = NULL;
+  _MMG5_DEL_MEM(mesh,(*q)->qlist,(*q)->nc*sizeof(_MMG3D_octree_s*));
+  _MMG5_DEL_MEM(mesh,(*q)->dist,(*q)->nc*sizeof(double));
   _MMG5_DEL_MEM(mesh,*q,sizeof(_MMG3D_octree));
   *q = NULL;
 }
 
+/**
+ * \param q pointer toward the octree cell.
+ * \param nv maximum number of vertices in each cell before subdivision.
+ * \param dim space dimension.
+ * \param perm new indices of the mesh points.
+ *
+ * Update the point indices stored in the octree cell and its sub-cells.
+ *
+ */
+static
+void _MMG3D_renumOctree_s(_MMG3D_octree_s* q, int nv, int dim, int *perm)
+{
+  int nbBitsInt,depthMax,i,sizBr;
+
+  sizBr     = 1<<dim;
+  nbBitsInt = sizeof(int64_t)*8;
+  depthMax  = nbBitsInt/dim - 1;
+
+  if (q->nbVer>nv && q->depth < depthMax )
+  {
+    for ( i = 0; i<sizBr; i++)
+    {
+      _MMG3D_renumOctree_s(&(q->branches[i]),nv,dim,perm);
+    }
+  }
+  else
+  {
+    for ( i = 0; i<q->nbVer; i++)
+    {
+      q->v[i] = perm[q->v[i]];
+    }
+  }
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param q pointer toward the global octree.
+ * \param perm new indices of the mesh points (the point \a k becomes the point
+ * \a perm[k]).
+ *
+ * Update the point indices stored in the octree after a renumbering of the
+ * mesh points (the point coordinates being unchanged, the octree structure is
+ * preserved).
+ *
+ */
+void _MMG3D_renumOctree(MMG5_pMesh mesh,_MMG3D_pOctree q, int *perm)
+{
+  _MMG3D_renumOctree_s(q->q0,q->nv,mesh->dim,perm);
+}
 
 /**
  * \param q pointer toward the global octree.
@@ -253,12 +431,12 @@ int _MMG3D_moveOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, int no, double* newVer,
   {
     /* delOctree */
     memcpy(&pt, oldVer ,dim*sizeof(double));
-    if (!_MMG3D_delOctreeRec(mesh, q->q0, pt , no, q->nv))
+    if (!_MMG3D_delOctreeRec(mesh, q, q->q0, pt , no, q->nv))
       return 0;
 
     /* addOctree */
     memcpy(&pt, newVer ,dim*sizeof(double));
-    if(!_MMG3D_addOctreeRec(mesh, q->q0, pt , no, q->nv))
+    if(!_MMG3D_addOctreeRec(mesh, q, q->q0, pt , no, q->nv))
       return 0;
   }
   return 1;
@@ -576,7 +754,9 @@ int _MMG3D_getListSquareRec(_MMG3D_octree_s* q, double* center, double* rect,
  *
  * \return index, the number of subtrees in the list, -1 if fail.
  *
- * List the number of octree cells that intersect the rectangle \a rect.
+ * List the number of octree cells that intersect the rectangle \a rect. The
+ * list is stored in the work array of the octree: it is valid until the next
+ * search and must not be freed.
  *
  */
 int _MMG3D_getListSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, double* rect,
@@ -596,10 +776,8 @@ int _MMG3D_getListSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, double*
   //the center of the rectangle)
   index = q->nc-3;
 
-  _MMG5_ADD_MEM(mesh,q->nc*sizeof(_MMG3D_octree_s*),"octree cell",return -1);
-
-  _MMG5_SAFE_MALLOC(*qlist,index,_MMG3D_octree_s*,-1);
-  _MMG5_SAFE_MALLOC(dist,index+3,double,-1);
+  *qlist = q->qlist;
+  dist   = q->dist;
 
   // Set the center of the zone search
   dist[q->nc-3] = rect[0]+rect[3]/2;
@@ -628,18 +806,14 @@ int _MMG3D_getListSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, double*
 
 
   if (index>q->nc-4)
-  {
-    _MMG5_SAFE_FREE(dist);
     return -1;
-  }
-
-  _MMG5_SAFE_FREE(dist);
 
   return index;
 }
 
 /**
  * \param mesh pointer toward the mesh structure.
+ * \param octree pointer toward the global octree.
  * \param q pointer toward an octree cell.
  * \param ver vertex coordinates scaled such that the quadrant is [0;1]x[0;1]x[0;1]
  * \param no vertex index in the mesh.
@@ -651,8 +825,8 @@ int _MMG3D_getListSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, double*
  * coordinates are scaled such as the quadrant is the [0;1]x[0;1]x[0;1] box.
  *
  */
-int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
-                         const int no, int nv)
+int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_pOctree octree,
+                        _MMG3D_octree_s* q, double* ver, const int no, int nv)
 {
   double   pt[3];
   int      dim, nbBitsInt,depthMax,i,j,k;
@@ -671,16 +845,16 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
 
       if(q->nbVer == 0)  // first vertex list allocation
       {
-        _MMG5_ADD_MEM(mesh,sizeof(int),"octree vertice table", return 0);
-        _MMG5_SAFE_MALLOC(q->v,1,int,0);
+        q->v = (int*)_MMG3D_octreeAlloc(mesh,octree,sizeof(int));
+        if ( !q->v )  return 0;
       }
       else if(!(q->nbVer & (q->nbVer - 1))) //is a power of 2 -> reallocation of the vertex list
       {
         sizeRealloc = q->nbVer;
         sizeRealloc<<=1;
-        _MMG5_ADD_MEM(mesh,(sizeRealloc-sizeRealloc/2)*sizeof(int),"octree realloc",
-                      return 0);
-        _MMG5_SAFE_REALLOC(q->v,sizeRealloc,int,"octree",0);
+        q->v = (int*)_MMG3D_octreeRealloc(mesh,octree,q->v,q->nbVer*sizeof(int),
+                                          sizeRealloc*sizeof(int));
+        if ( !q->v )  return 0;
       }
 
       q->v[q->nbVer] = no;
@@ -690,9 +864,9 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
     else if (q->nbVer == nv && q->branches==NULL)  //vertex list at maximum -> cell subdivision
     {
       /* creation of sub-branch and relocation of vertices in the sub-branches */
-      _MMG5_ADD_MEM(mesh,sizBr*sizeof(_MMG3D_octree_s),"octree branches",
-                    return 0);
-      _MMG5_SAFE_MALLOC(q->branches,sizBr,_MMG3D_octree_s,0);
+      q->branches = (_MMG3D_octree_s*)
+        _MMG3D_octreeAlloc(mesh,octree,sizBr*sizeof(_MMG3D_octree_s));
+      if ( !q->branches )  return 0;
 
       for ( i = 0; i<sizBr; i++)
       {
@@ -712,14 +886,15 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
             pt[k] *= 2;
           }
         }
-        if (!_MMG3D_addOctreeRec(mesh, q, pt, q->v[i],nv))
+        if (!_MMG3D_addOctreeRec(mesh, octree, q, pt, q->v[i],nv))
           return 0;
         q->nbVer--;
       }
-      if (!_MMG3D_addOctreeRec(mesh, q, ver, no, nv))
+      if (!_MMG3D_addOctreeRec(mesh, octree, q, ver, no, nv))
         return 0;
       q->nbVer--;
-      _MMG5_DEL_MEM(mesh,q->v,nv*sizeof(int));
+      _MMG3D_octreeFree(octree,q->v,nv*sizeof(int));
+      q->v = NULL;
 
     }else // Recursive call in the corresponding sub cell
     {
@@ -732,7 +907,7 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
       }
 
       q->nbVer++;
-      if (!_MMG3D_addOctreeRec(mesh, &(q->branches[quadrant]), ver, no, nv))
+      if (!_MMG3D_addOctreeRec(mesh, octree, &(q->branches[quadrant]), ver, no, nv))
         return 0;
     }
   }else // maximum octree depth reached
@@ -741,24 +916,23 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
     {
       if(q->nbVer == 0) // first allocation
       {
-        _MMG5_ADD_MEM(mesh,sizeof(int),"octree vertices table",
-                      return 0);
-        _MMG5_SAFE_MALLOC(q->v,1,int,0);
+        q->v = (int*)_MMG3D_octreeAlloc(mesh,octree,sizeof(int));
+        if ( !q->v )  return 0;
       }
       else if(!(q->nbVer & (q->nbVer - 1))) //is a power of 2 -> normal reallocation
       {
         sizeRealloc = q->nbVer;
         sizeRealloc<<=1;
-        _MMG5_ADD_MEM(mesh,(sizeRealloc-sizeRealloc/2)*sizeof(int),"octree realloc",
-                      return 0);
-        _MMG5_SAFE_REALLOC(q->v,sizeRealloc,int,"octree",0);
+        q->v = (int*)_MMG3D_octreeRealloc(mesh,octree,q->v,q->nbVer*sizeof(int),
+                                          sizeRealloc*sizeof(int));
+        if ( !q->v )  return 0;
       }
     }
     else if (q->nbVer%nv == 0) // special reallocation of the vertex list because it is at maximum depth
     {
-      _MMG5_ADD_MEM(mesh,nv*sizeof(int),"octree realloc",
-                    return 0);
-      _MMG5_SAFE_REALLOC(q->v,q->nbVer+nv,int,"octree",0);
+      q->v = (int*)_MMG3D_octreeRealloc(mesh,octree,q->v,q->nbVer*sizeof(int),
+                                        (q->nbVer+nv)*sizeof(int));
+      if ( !q->v )  return 0;
     }
 
     q->v[q->nbVer] = no;
@@ -784,7 +958,7 @@ int _MMG3D_addOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no)
   dim = mesh->dim;
   assert(no<=mesh->np);
   memcpy(&pt, mesh->point[no].c ,dim*sizeof(double));
-  if (!_MMG3D_addOctreeRec(mesh, q->q0, pt , no, q->nv))
+  if (!_MMG3D_addOctreeRec(mesh, q, q->q0, pt , no, q->nv))
   {
     return 0;
   }
@@ -801,10 +975,10 @@ int _MMG3D_addOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no)
  * the cells if necessary.
  *
  */
-int _MMG3D_delOctreeVertex(MMG5_pMesh mesh, _MMG3D_octree_s* q, int indNo)
+int _MMG3D_delOctreeVertex(MMG5_pMesh mesh, _MMG3D_pOctree octree,
+                           _MMG3D_octree_s* q, int indNo)
 {
   int i;
-  int* vTemp;
 
   assert(q->v);
   assert(q->nbVer>indNo);
@@ -814,13 +988,9 @@ int _MMG3D_delOctreeVertex(MMG5_pMesh mesh, _MMG3D_octree_s* q, int indNo)
   --(q->nbVer);
   if (!(q->nbVer & (q->nbVer - 1)) && q->nbVer > 0) // is a power of 2
   {
-    _MMG5_ADD_MEM(mesh,q->nbVer*sizeof(int),"octree index",
-                  return 0);
-    _MMG5_SAFE_MALLOC(vTemp,q->nbVer,int,0);
-    memcpy(vTemp, q->v,q->nbVer*sizeof(int));
-    _MMG5_DEL_MEM(mesh,q->v,2*q->nbVer*sizeof(int));
-
-    q->v = vTemp;
+    q->v = (int*)_MMG3D_octreeRealloc(mesh,octree,q->v,2*q->nbVer*sizeof(int),
+                                      q->nbVer*sizeof(int));
+    if ( !q->v )  return 0;
   }
   return 1;
 }
@@ -865,7 +1035,8 @@ void _MMG3D_mergeBranchesRec(_MMG3D_octree_s* q0, _MMG3D_octree_s* q, int dim, i
  * Merge branches that have a parent counting less than nv vertices.
  *
  */
-void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_octree_s* q, int dim, int nv)
+void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_pOctree octree,
+                          _MMG3D_octree_s* q, int dim, int nv)
 {
   int index;
   int i;
@@ -879,9 +1050,10 @@ void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_octree_s* q, int dim, int nv)
   for (i = 0; i<(1<<dim); ++i)
   {
     _MMG3D_mergeBranchesRec(q, &(q->branches[i]), dim, nv, &index);
-    _MMG3D_freeOctree_s(mesh,&(q->branches[i]), nv);
+    _MMG3D_freeOctree_s(mesh,octree,&(q->branches[i]), nv);
   }
-  _MMG5_DEL_MEM(mesh,q->branches,sizBr*sizeof(_MMG3D_octree_s));
+  _MMG3D_octreeFree(octree,q->branches,sizBr*sizeof(_MMG3D_octree_s));
+  q->branches = NULL;
 }
 
 /**
@@ -898,7 +1070,9 @@ void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_octree_s* q, int dim, int nv)
  * quadrant is the [0;1]x[0;1]x[0;1] box.
  *
  */
-int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver, const int no, const int nv)
+int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_pOctree octree,
+                        _MMG3D_octree_s* q, double* ver, const int no,
+                        const int nv)
 {
   int i;
   int quadrant;
@@ -911,11 +1085,12 @@ int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver, const
     {
       if (q->v[i] == no)
       {
-        if (!_MMG3D_delOctreeVertex(mesh, q, i))
+        if (!_MMG3D_delOctreeVertex(mesh, octree, q, i))
           return 0;
         if ( q->nbVer == 0)
         {
-          _MMG5_DEL_MEM(mesh,q->v,sizeof(int));
+          _MMG3D_octreeFree(octree,q->v,sizeof(int));
+          q->v = NULL;
         }
         break;
       }
@@ -934,15 +1109,14 @@ int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver, const
     nbVerTemp = q->branches[quadrant].nbVer;
 
     // warning: calling recursively here is not optimal
-    if(!_MMG3D_delOctreeRec(mesh, &(q->branches[quadrant]), ver, no, nv))
+    if(!_MMG3D_delOctreeRec(mesh, octree, &(q->branches[quadrant]), ver, no, nv))
       return 0;
 
     if (nbVerTemp > q->branches[quadrant].nbVer)
     {
-      _MMG5_ADD_MEM(mesh,nv*sizeof(int),"octree vertices table",
-                    return 0);
-      _MMG5_SAFE_MALLOC(q->v,nv,int,0);
-      _MMG3D_mergeBranches(mesh,q,dim,nv);
+      q->v = (int*)_MMG3D_octreeAlloc(mesh,octree,nv*sizeof(int));
+      if ( !q->v )  return 0;
+      _MMG3D_mergeBranches(mesh,octree,q,dim,nv);
     }else
     {
       ++q->nbVer;
@@ -960,7 +1134,7 @@ int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver, const
 
     --q->nbVer;
     nbVerTemp = q->branches[quadrant].nbVer;
-    if(!_MMG3D_delOctreeRec(mesh, &(q->branches[quadrant]), ver, no, nv))
+    if(!_MMG3D_delOctreeRec(mesh, octree, &(q->branches[quadrant]), ver, no, nv))
       return 0;
     if (nbVerTemp <= q->branches[quadrant].nbVer) // test if deletion worked
     {
@@ -989,7 +1163,7 @@ int _MMG3D_delOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no)
   assert(MG_VOK(&mesh->point[no]));
 
   memcpy(&pt, mesh->point[no].c ,dim*sizeof(double));
-  if(!_MMG3D_delOctreeRec(mesh, q->q0, pt , no, q->nv))
+  if(!_MMG3D_delOctreeRec(mesh, q, q->q0, pt , no, q->nv))
   {
     return 0;
   }
@@ -1194,14 +1368,13 @@ int NearNeighborSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, int no, d
   MMG5_pPoint   ppt,ppt1;
   _MMG3D_octree_s** qlist;
   int ns,nver;
-  double *rect;
+  double rect[6];
   double lmin =10;
   double x,y,z;
   int nmin;
   int i, j;
 
   nmin = 0;
-  _MMG5_SAFE_MALLOC(rect,2*dim,double,-1);
 
   ppt = &mesh->point[no];
   rect[0] = ppt->c[0]-l;
@@ -1237,8 +1410,6 @@ int NearNeighborSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, int no, d
     }
   }
 
-  _MMG5_SAFE_FREE(qlist);
-  _MMG5_SAFE_FREE(rect);
 
   if (sqrt(lmin)<l)
     return nmin;
@@ -1268,6 +1439,8 @@ int _MMG3D_octreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
   double          ani[6];
   //double          dmax;
 
+  _MMG5_STAT_INC(mesh,noctree);
+
   ani[0] = sol->m[ip];
   ani[3] = sol->m[ip];
   ani[5] = sol->m[ip];
@@ -1292,11 +1465,8 @@ int _MMG3D_octreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
 
   ncells = _MMG3D_getListSquare(mesh, ani, octree, methalo, &lococ);
   if (ncells < 0)
-  {
-
-    _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
     return(0);
-  }
+
   /* Check the octree cells */
   for ( i=0; i<ncells; ++i )
   {
@@ -1316,13 +1486,9 @@ int _MMG3D_octreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
       d2 = ux*ux + uy*uy + uz*uz;
 
       if ( d2 < hp1 || d2 < hpi2*hpi2 )
-      {
-        _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
         return(0);
-      }
     }
   }
-  _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
   return(1);
 }
 
@@ -1347,6 +1513,8 @@ int _MMG3D_octreein_ani(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
   int             ncells;
   // double          dmax;
 
+  _MMG5_STAT_INC(mesh,noctree);
+
   lococ = NULL;
   ppt = &mesh->point[ip];
 
@@ -1388,13 +1556,11 @@ int _MMG3D_octreein_ani(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
   methalo[4] = 2*dy;
   methalo[5] = 2*dz;
 
-  // this function allocates lococ, it has to be deleted after the call
+  // lococ points toward the work array of the octree (nothing to free)
   ncells = _MMG3D_getListSquare(mesh,ma,octree, methalo, &lococ);
   if (ncells < 0)
-  {
-    _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
     return(0);
-  }
+
   /* Check the octree cells */
   for ( i=0; i<ncells; ++i )
   {
@@ -1410,24 +1576,18 @@ int _MMG3D_octreein_ani(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
       d2 = ma[0]*ux*ux + ma[3]*uy*uy + ma[5]*uz*uz
         + 2.0*(ma[1]*ux*uy + ma[2]*ux*uz + ma[4]*uy*uz);
       if ( d2 < dmi )
-      {
-        _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
         return 0;
-      }
       else
       {
         iadr = ip1*sol->size;
         mb   = &sol->m[iadr];
         d2   = mb[0]*ux*ux + mb[3]*uy*uy + mb[5]*uz*uz
           + 2.0*(mb[1]*ux*uy + mb[2]*ux*uz + mb[4]*uy*uz);
-        if ( d2 < dmi ) {
-          _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
+        if ( d2 < dmi )
           return(0);
-        }
       }
     }
   }
 
-  _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
   return(1);
 }
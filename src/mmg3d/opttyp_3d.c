@@ -466,7 +466,7 @@ int MMG3D_opttyp(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
   double         crit;
   int            k,ityp,cs[10],ds[10],item[2];
   int            ier,i,nd,ne,npeau;
-  int            it,maxit,ntot,base;
+  int            it,maxit,ntot,base,l,n,nact;
 //  double         OCRIT = 1.01;
   int            nbdy,nbdy2 ;
 
@@ -483,7 +483,12 @@ int MMG3D_opttyp(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
     memset(cs,0,10*sizeof(int));
     memset(ds,0,10*sizeof(int));
 
-    for (k=1 ; k<=ne ; k++) {
+    nact = _MMG3D_startSweep(mesh,base-2);
+    n    = nact < 0 ? ne : nact;
+    mesh->stats.nvisit += n;
+
+    for (l=1 ; l<=n ; l++) {
+      k  = _MMG3D_SWEEPELT(mesh,nact,l);
       pt = &mesh->tetra[k];
       if(!MG_EOK(pt)  || (pt->tag & MG_REQ) ) continue;
       else if ( pt->mark < base-2 )  continue;
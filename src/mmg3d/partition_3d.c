@@ -0,0 +1,1607 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mmg3d/partition_3d.c
+ * \brief Partitioned remeshing of mmg3d (\ref MMG3D_IPARAM_npart).
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * The tetra are split into partitions by a recursive coordinate bisection of
+ * their barycenters. Each partition is copied in its own mesh structure, with
+ * the faces shared with the other partitions given as parallel triangles
+ * (\ref MMG3D_Set_parallelTriangle): they are required during the remeshing.
+ * The partitions are remeshed concurrently by \ref MMG3D_mmg3dlib, so each of
+ * them has its own scratch state (free lists, arena, octree...). The
+ * partitions are then merged back in the input mesh structure.
+ *
+ * The bisection axes are rotated at each iteration, so the interfaces of an
+ * iteration are remeshed by the next one. The iterations stop once the number
+ * of tetra is stable. The badly shaped tetra left along the last interfaces are
+ * then remeshed by a last pass on their neighbourhood only.
+ *
+ */
+
+#include "mmg3d.h"
+
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+/** Minimal number of iterations (one by bisection axis) */
+#define _MMG3D_PARTMINIT 3
+
+/** Maximal number of iterations */
+#define _MMG3D_PARTMAXIT 6
+
+/** Relative variation of the number of tetra under which the iterations stop */
+#define _MMG3D_PARTCONV  0.02
+
+/** Minimal number of tetra by partition */
+#define _MMG3D_PARTMINNE 1000
+
+/** Number of layers of tetra added around the bad tetra by the last pass */
+#define _MMG3D_PARTNLAY  2
+
+/** Maximal number of passes making the partitions manifold */
+#define _MMG3D_PARTMAXFIX 10
+
+/** Sort key of the bisection */
+typedef struct {
+  double key; /*!< coordinate of the barycenter along the bisection axis */
+  int    k; /*!< tetra index */
+} _MMG3D_partKey;
+
+/** Face of a tetra holding a triangle of the mesh */
+typedef struct {
+  int k; /*!< tetra index */
+  int i; /*!< face index in the tetra */
+  int kt; /*!< triangle index */
+} _MMG3D_partFace;
+
+/** Entity lying on the interfaces (the vertices are interface numbers) */
+typedef struct {
+  int     v[3]; /*!< vertices (v[2] unused for the edges) */
+  int     ref; /*!< reference */
+  int16_t tag[3]; /*!< tags (tag[0] only for the edges) */
+} _MMG3D_partEnt;
+
+/** Relative tolerance on the coordinates of the interface vertices returned
+ * by the remeshing of a partition */
+#define _MMG3D_PARTTOL   1.e-10
+
+/** Partition of the mesh for one iteration of the partitioned remeshing */
+typedef struct {
+  int  npart; /*!< number of partitions */
+  int  nrem; /*!< number of remeshed partitions (the next ones are copied) */
+  int  ne,np,nt,na; /*!< sizes of the mesh when the partition is built */
+  int  *part; /*!< partition of each tetra */
+  int  *tbeg,*tlist; /*!< tetra of the partition p: tlist[tbeg[p]..tbeg[p+1]-1] */
+  int  *pown; /*!< partition (+1) of the vertices used by only one partition */
+  int  *ishr; /*!< interface number of the vertices used by several
+                partitions, 0 otherwise */
+  int  nI; /*!< number of interface vertices */
+  int  *pbeg,*plist,npl; /*!< vertices of the partition p (interface vertices
+                           first, sorted): plist[pbeg[p]..pbeg[p+1]-1] */
+  int  *nshr; /*!< number of interface vertices of each partition */
+  int  *rbeg,*rlist; /*!< triangles of the partition p that don't lie on an
+                       interface: rlist[rbeg[p]..rbeg[p+1]-1] */
+  int  *ebeg,*elist,nel; /*!< edges of the partition p:
+                           elist[ebeg[p]..ebeg[p+1]-1] */
+  _MMG3D_partFace *fac; /*!< sorted faces of tetra holding an interface
+                          triangle */
+  int  nfac;
+  int  *ifac,nifac; /*!< sorted triples of the interface faces */
+  int  *iedg,niedg; /*!< sorted pairs of the edges of the interface faces */
+  char *ireq; /*!< 1 if an edge of the interface faces is required */
+  _MMG3D_partEnt *itri; /*!< triangles lying on the interfaces */
+  int  nitri;
+  _MMG3D_partEnt *iedge; /*!< edges lying on the interfaces */
+  int  niedge;
+  int  *cnt,*pball,*tface,*scr; /*!< scratch tables of the analysis */
+} _MMG3D_Partition;
+
+/** Submesh of a partition */
+typedef struct {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  int        ier; /*!< return value of the remeshing */
+  int        nt,na; /*!< number of triangles and edges kept by the merge */
+} _MMG3D_partMesh;
+
+static int _MMG3D_partKeyCompare(const void *a,const void *b) {
+  const _MMG3D_partKey *ka = (const _MMG3D_partKey*)a;
+  const _MMG3D_partKey *kb = (const _MMG3D_partKey*)b;
+
+  if ( ka->key < kb->key )  return(-1);
+  if ( ka->key > kb->key )  return(1);
+  return( (ka->k > kb->k) - (ka->k < kb->k) );
+}
+
+static int _MMG3D_partFaceCompare(const void *a,const void *b) {
+  const _MMG3D_partFace *fa = (const _MMG3D_partFace*)a;
+  const _MMG3D_partFace *fb = (const _MMG3D_partFace*)b;
+
+  if ( fa->k != fb->k )  return( (fa->k > fb->k) - (fa->k < fb->k) );
+  return( fa->i - fb->i );
+}
+
+static int _MMG3D_partTriCompare(const void *a,const void *b) {
+  const int *ta = (const int*)a;
+  const int *tb = (const int*)b;
+  int        i;
+
+  for ( i=0; i<3; i++ )
+    if ( ta[i] != tb[i] )  return( (ta[i] > tb[i]) - (ta[i] < tb[i]) );
+  return(0);
+}
+
+static int _MMG3D_partPairCompare(const void *a,const void *b) {
+  const int *ea = (const int*)a;
+  const int *eb = (const int*)b;
+
+  if ( ea[0] != eb[0] )  return( (ea[0] > eb[0]) - (ea[0] < eb[0]) );
+  return( (ea[1] > eb[1]) - (ea[1] < eb[1]) );
+}
+
+static int _MMG3D_partIntCompare(const void *a,const void *b) {
+  int ia = *(const int*)a;
+  int ib = *(const int*)b;
+
+  return( (ia > ib) - (ia < ib) );
+}
+
+/**
+ * \param v table of 3 integers.
+ *
+ * Sort the 3 integers of \a v in increasing order.
+ *
+ */
+static inline void _MMG3D_partSort3(int *v) {
+  int tmp;
+
+  if ( v[0] > v[1] ) { tmp = v[0]; v[0] = v[1]; v[1] = tmp; }
+  if ( v[1] > v[2] ) { tmp = v[1]; v[1] = v[2]; v[2] = tmp; }
+  if ( v[0] > v[1] ) { tmp = v[0]; v[0] = v[1]; v[1] = tmp; }
+}
+
+/**
+ * \param pa pointer toward the partition.
+ * \param v interface numbers of the 3 vertices of a face.
+ * \return 1 if the face is an interface face, 0 otherwise.
+ *
+ */
+static inline int _MMG3D_partIsIfac(_MMG3D_Partition *pa,int *v) {
+  _MMG3D_partSort3(v);
+  return( bsearch(v,pa->ifac,pa->nifac,3*sizeof(int),_MMG3D_partTriCompare)
+          != NULL );
+}
+
+/**
+ * \param pa pointer toward the partition.
+ * \param a interface number of the first vertex of an edge.
+ * \param b interface number of the second vertex of the edge.
+ * \return the index (plus 1) of the edge in the edges of the interface faces,
+ * 0 if it is not an edge of an interface face.
+ *
+ */
+static inline int _MMG3D_partIedg(_MMG3D_Partition *pa,int a,int b) {
+  int e[2],*pe;
+
+  e[0] = MG_MIN(a,b);
+  e[1] = MG_MAX(a,b);
+  pe   = bsearch(e,pa->iedg,pa->niedg,2*sizeof(int),_MMG3D_partPairCompare);
+  return( pe ? (int)(pe-pa->iedg)/2+1 : 0 );
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pa pointer toward the partition.
+ * \param p partition index.
+ * \param ip vertex of the partition \a p.
+ * \return the index of \a ip in the submesh of \a p, 0 if \a ip doesn't
+ * belong to \a p.
+ *
+ */
+static inline int _MMG3D_partLocal(MMG5_pMesh mesh,_MMG3D_Partition *pa,
+                                   int p,int ip) {
+  int *ptr;
+
+  if ( !pa->ishr[ip] )
+    return( pa->pown[ip] == p+1 ? mesh->point[ip].tmp : 0 );
+
+  ptr = (int*)bsearch(&ip,&pa->plist[pa->pbeg[p]],pa->nshr[p],sizeof(int),
+                      _MMG3D_partIntCompare);
+  return( ptr ? (int)(ptr-&pa->plist[pa->pbeg[p]])+1 : 0 );
+}
+
+/**
+ * \param keys sort keys of the tetra to split.
+ * \param bar barycenters of the tetra.
+ * \param n number of tetra to split.
+ * \param p0 index of the first partition.
+ * \param np number of partitions.
+ * \param axis bisection axis.
+ * \param part partition of each tetra (to fill).
+ *
+ * Recursive coordinate bisection: sort the tetra along \a axis and split them
+ * in two sets proportional to the number of partitions of each half.
+ *
+ */
+static void _MMG3D_partBisect(_MMG3D_partKey *keys,double *bar,int n,int p0,
+                              int np,int axis,int *part) {
+  int i,np1,n1;
+
+  if ( np == 1 ) {
+    for ( i=0; i<n; i++ )  part[keys[i].k] = p0;
+    return;
+  }
+
+  for ( i=0; i<n; i++ )  keys[i].key = bar[3*keys[i].k+axis];
+  qsort(keys,n,sizeof(_MMG3D_partKey),_MMG3D_partKeyCompare);
+
+  np1 = np/2;
+  n1  = (int)(((long long)n*np1)/np);
+  _MMG3D_partBisect(keys,bar,n1,p0,np1,(axis+1)%3,part);
+  _MMG3D_partBisect(keys+n1,bar,n-n1,p0+np1,np-np1,(axis+1)%3,part);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pa pointer toward the partition.
+ *
+ * Free the scratch tables of the analysis of the partition.
+ *
+ */
+static void _MMG3D_partFreeScratch(MMG5_pMesh mesh,_MMG3D_Partition *pa) {
+
+  if ( pa->cnt )   _MMG5_DEL_MEM(mesh,pa->cnt,2*(pa->npart+1)*sizeof(int));
+  if ( pa->pball ) _MMG5_DEL_MEM(mesh,pa->pball,(pa->np+1)*sizeof(int));
+  if ( pa->tface ) _MMG5_DEL_MEM(mesh,pa->tface,(pa->nt+1)*sizeof(int));
+  if ( pa->scr )   _MMG5_DEL_MEM(mesh,pa->scr,8*(MMG3D_LMAX+2)*sizeof(int));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pa pointer toward the partition.
+ *
+ * Free the tables of the partition.
+ *
+ */
+static void _MMG3D_partFree(MMG5_pMesh mesh,_MMG3D_Partition *pa) {
+  int np;
+
+  np = pa->npart;
+  _MMG3D_partFreeScratch(mesh,pa);
+  if ( pa->part )  _MMG5_DEL_MEM(mesh,pa->part,(pa->ne+1)*sizeof(int));
+  if ( pa->tbeg )  _MMG5_DEL_MEM(mesh,pa->tbeg,(np+1)*sizeof(int));
+  if ( pa->tlist ) _MMG5_DEL_MEM(mesh,pa->tlist,(pa->ne+1)*sizeof(int));
+  if ( pa->pown )  _MMG5_DEL_MEM(mesh,pa->pown,(pa->np+1)*sizeof(int));
+  if ( pa->ishr )  _MMG5_DEL_MEM(mesh,pa->ishr,(pa->np+1)*sizeof(int));
+  if ( pa->pbeg )  _MMG5_DEL_MEM(mesh,pa->pbeg,(np+1)*sizeof(int));
+  if ( pa->plist ) _MMG5_DEL_MEM(mesh,pa->plist,(pa->npl+1)*sizeof(int));
+  if ( pa->nshr )  _MMG5_DEL_MEM(mesh,pa->nshr,(np+1)*sizeof(int));
+  if ( pa->rbeg )  _MMG5_DEL_MEM(mesh,pa->rbeg,(np+1)*sizeof(int));
+  if ( pa->rlist ) _MMG5_DEL_MEM(mesh,pa->rlist,(pa->nt+1)*sizeof(int));
+  if ( pa->ebeg )  _MMG5_DEL_MEM(mesh,pa->ebeg,(np+1)*sizeof(int));
+  if ( pa->elist ) _MMG5_DEL_MEM(mesh,pa->elist,(pa->nel+1)*sizeof(int));
+  if ( pa->fac )
+    _MMG5_DEL_MEM(mesh,pa->fac,(2*pa->nt+1)*sizeof(_MMG3D_partFace));
+  if ( pa->ifac )  _MMG5_DEL_MEM(mesh,pa->ifac,(3*pa->nifac+3)*sizeof(int));
+  if ( pa->iedg )  _MMG5_DEL_MEM(mesh,pa->iedg,(6*pa->nifac+2)*sizeof(int));
+  if ( pa->ireq )  _MMG5_DEL_MEM(mesh,pa->ireq,(pa->niedg+1)*sizeof(char));
+  if ( pa->itri )
+    _MMG5_DEL_MEM(mesh,pa->itri,(pa->nitri+1)*sizeof(_MMG3D_partEnt));
+  if ( pa->iedge )
+    _MMG5_DEL_MEM(mesh,pa->iedge,(pa->niedge+1)*sizeof(_MMG3D_partEnt));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param k tetra index.
+ * \param a first vertex.
+ * \param b second vertex (or 0).
+ * \param c third vertex (or 0).
+ * \return the index of the vertex of \a k that is not in the face \a abc if
+ * \a k contains \a a, \a b and \a c, 4 if \a k contains \a a and \a b but
+ * \a c is 0, -1 otherwise.
+ *
+ */
+static inline int _MMG3D_partFind(MMG5_pMesh mesh,int k,int a,int b,int c) {
+  MMG5_pTetra pt;
+  int         i,nf,iout;
+
+  pt   = &mesh->tetra[k];
+  nf   = 0;
+  iout = -1;
+  for ( i=0; i<4; i++ ) {
+    if ( pt->v[i] == a || pt->v[i] == b || (c && pt->v[i] == c) )  nf++;
+    else  iout = i;
+  }
+  if ( !c )  return( nf == 2 ? 4 : -1 );
+  return( nf == 3 ? iout : -1 );
+}
+
+static inline int _MMG3D_partRoot(int *comp,int l) {
+
+  while ( comp[l] != l )  l = comp[l] = comp[comp[l]];
+  return(l);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pa pointer toward the partition.
+ * \param list ball of a vertex (see \ref _MMG5_boulevolp).
+ * \param sel positions in \a list of the tetra to check.
+ * \param ns number of tetra to check.
+ * \param ip0 vertex of the ball.
+ * \param ip1 vertex of the tetra to check (\a ip0 for the whole ball).
+ * \return the number of tetra given to another partition.
+ *
+ * The tetra of each partition around the vertex \a ip0 (resp. the edge
+ * \a ip0 \a ip1) must be connected through the faces containing the vertex
+ * (resp. the edge), otherwise the boundary of the partition is non-manifold.
+ * The tetra of the smaller components are given to a neighbouring partition.
+ *
+ */
+static int _MMG3D_partConnect(MMG5_pMesh mesh,_MMG3D_Partition *pa,int *list,
+                              int *sel,int ns,int ip0,int ip1) {
+  MMG5_pTetra pt;
+  int         *comp,*siz,*cp,k,kk,l,m,r,j,adj,target,moved;
+
+  comp = pa->scr + 2*(MMG3D_LMAX+2);
+  siz  = pa->scr + 3*(MMG3D_LMAX+2);
+  cp   = pa->scr + 4*(MMG3D_LMAX+2);
+
+  for ( l=0; l<ns; l++ ) {
+    comp[l] = l;
+    siz[l]  = 0;
+    cp[l]   = pa->part[list[sel[l]]/4];
+  }
+  for ( l=0; l<ns; l++ ) {
+    k  = list[sel[l]]/4;
+    pt = &mesh->tetra[k];
+    for ( j=0; j<4; j++ ) {
+      if ( pt->v[j] == ip0 || pt->v[j] == ip1 )  continue;
+      adj = mesh->adja[4*(k-1)+1+j]/4;
+      if ( !adj || pa->part[adj] != cp[l] )  continue;
+      for ( m=0; m<ns; m++ )
+        if ( list[sel[m]]/4 == adj )  break;
+      if ( m < ns )  comp[_MMG3D_partRoot(comp,m)] = _MMG3D_partRoot(comp,l);
+    }
+  }
+  for ( l=0; l<ns; l++ )  siz[_MMG3D_partRoot(comp,l)]++;
+
+  moved = 0;
+  for ( l=0; l<ns; l++ ) {
+    if ( comp[l] != l )  continue;
+
+    /* the largest component of a partition is kept */
+    for ( m=0; m<ns; m++ ) {
+      if ( m == l || comp[m] != m || cp[m] != cp[l] )  continue;
+      if ( siz[m] > siz[l] || (siz[m] == siz[l] && m < l) )  break;
+    }
+    if ( m == ns )  continue;
+
+    target = -1;
+    for ( m=0; m<ns && target<0; m++ ) {
+      if ( _MMG3D_partRoot(comp,m) != l )  continue;
+      k  = list[sel[m]]/4;
+      pt = &mesh->tetra[k];
+      for ( j=0; j<4; j++ ) {
+        if ( pt->v[j] == ip0 || pt->v[j] == ip1 )  continue;
+        adj = mesh->adja[4*(k-1)+1+j]/4;
+        if ( adj && pa->part[adj] != cp[l] ) {
+          target = pa->part[adj];
+          break;
+        }
+      }
+    }
+    if ( target < 0 )  continue;
+
+    for ( m=0; m<ns; m++ ) {
+      r = _MMG3D_partRoot(comp,m);
+      if ( r != l )  continue;
+      kk = list[sel[m]]/4;
+      if ( pa->part[kk] != target ) {
+        pa->part[kk] = target;
+        moved++;
+      }
+    }
+  }
+  return(moved);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pa pointer toward the partition.
+ * \return 1 if success, 0 if fail.
+ *
+ * Make the partitions manifold around the interface vertices and edges (the
+ * bisection may give partitions touching themselves along an edge or at a
+ * vertex, whose boundary can't be oriented by the surface analysis).
+ *
+ */
+static int _MMG3D_partManifold(MMG5_pMesh mesh,_MMG3D_Partition *pa) {
+  MMG5_pTetra pt;
+  MMG5_pPoint ppt;
+  int         *list,*sel,*ws,k,l,m,i,j,ip,iw,w,ilist,ns,nw,pass,moved;
+
+  _MMG5_ADD_MEM(mesh,8*(MMG3D_LMAX+2)*sizeof(int),"partition scratch",
+                return(0));
+  _MMG5_SAFE_CALLOC(pa->scr,8*(MMG3D_LMAX+2),int,0);
+  list = pa->scr;
+  sel  = pa->scr + (MMG3D_LMAX+2);
+  ws   = pa->scr + 5*(MMG3D_LMAX+2);
+
+  for ( pass=0; pass<_MMG3D_PARTMAXFIX; pass++ ) {
+    /* interface vertices: flag -1 */
+    for ( ip=1; ip<=mesh->np; ip++ )  mesh->point[ip].flag = 0;
+    for ( k=1; k<=mesh->ne; k++ ) {
+      pt = &mesh->tetra[k];
+      for ( i=0; i<4; i++ ) {
+        ppt = &mesh->point[pt->v[i]];
+        if ( !ppt->flag )  ppt->flag = pa->part[k]+1;
+        else if ( ppt->flag != pa->part[k]+1 )  ppt->flag = -1;
+      }
+    }
+
+    moved = 0;
+    for ( ip=1; ip<=mesh->np; ip++ ) {
+      if ( mesh->point[ip].flag != -1 )  continue;
+      ilist = _MMG5_boulevolp(mesh,pa->pball[ip]/4,pa->pball[ip]%4,list);
+      if ( !ilist )  continue;
+
+      for ( l=0; l<ilist; l++ )  sel[l] = l;
+      moved += _MMG3D_partConnect(mesh,pa,list,sel,ilist,ip,ip);
+
+      /* edges ip-w, w > ip */
+      nw = 0;
+      for ( l=0; l<ilist; l++ ) {
+        pt = &mesh->tetra[list[l]/4];
+        for ( j=0; j<4; j++ ) {
+          w = pt->v[j];
+          if ( w <= ip )  continue;
+          for ( iw=0; iw<nw; iw++ )
+            if ( ws[iw] == w )  break;
+          if ( iw < nw )  continue;
+          ws[nw++] = w;
+
+          ns = 0;
+          for ( m=0; m<ilist; m++ ) {
+            if ( _MMG3D_partFind(mesh,list[m]/4,ip,w,0) < 0 )  continue;
+            sel[ns++] = m;
+          }
+          moved += _MMG3D_partConnect(mesh,pa,list,sel,ns,ip,w);
+        }
+      }
+    }
+    if ( !moved )  break;
+  }
+  for ( ip=1; ip<=mesh->np; ip++ )  mesh->point[ip].flag = 0;
+
+  if ( (mesh->info.imprim > 4 || mesh->info.ddebug) && pass == _MMG3D_PARTMAXFIX )
+    fprintf(stdout,"  ## Warning: %s: non-manifold partitions.\n",__func__);
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pa pointer toward the partition (npart must be set).
+ * \param it iteration index (gives the first bisection axis), -1 if the
+ * partition of the tetra is already given in \a pa->part.
+ * \return 1 if success, 0 if fail, -1 if the mesh can't be partitioned (a
+ * triangle or an edge of the mesh is not found in the tetra).
+ *
+ * Partition the tetra of the mesh and compute the vertices, triangles, edges
+ * and interface faces of each partition.
+ *
+ */
+static int _MMG3D_partSet(MMG5_pMesh mesh,_MMG3D_Partition *pa,int it) {
+  MMG5_pTetra     pt,pt1;
+  MMG5_pTria      ptt;
+  MMG5_pEdge      pe;
+  MMG5_pPoint     ppt;
+  _MMG3D_partKey  *keys;
+  _MMG3D_partFace key;
+  _MMG3D_partEnt  *pent;
+  double          *bar;
+  int             *cnt,*stamp,*adja,list[MMG3D_LMAX+2];
+  int             npart,k,kk,kt,i,j,l,p,ip,ilist,adj,pass,n,nr,nsyn,i1,i2,v[3];
+
+  npart  = pa->npart;
+  pa->ne = mesh->ne;
+  pa->np = mesh->np;
+  pa->nt = mesh->nt;
+  pa->na = mesh->na;
+
+  _MMG5_ADD_MEM(mesh,2*(npart+1)*sizeof(int),"partition",return(0));
+  _MMG5_SAFE_CALLOC(pa->cnt,2*(npart+1),int,0);
+  cnt   = pa->cnt;
+  stamp = pa->cnt+npart+1;
+
+  /* recursive bisection of the barycenters of the tetra */
+  if ( it >= 0 ) {
+    _MMG5_ADD_MEM(mesh,(pa->ne+1)*sizeof(int),"partition",return(0));
+    _MMG5_SAFE_CALLOC(pa->part,pa->ne+1,int,0);
+
+    _MMG5_ADD_MEM(mesh,pa->ne*sizeof(_MMG3D_partKey)+3*(pa->ne+1)*sizeof(double),
+                  "bisection keys",return(0));
+    _MMG5_SAFE_MALLOC(keys,pa->ne,_MMG3D_partKey,0);
+    _MMG5_SAFE_MALLOC(bar,3*(pa->ne+1),double,0);
+
+    for ( k=1; k<=mesh->ne; k++ ) {
+      pt = &mesh->tetra[k];
+      for ( j=0; j<3; j++ )
+        bar[3*k+j] = 0.25*( mesh->point[pt->v[0]].c[j]+mesh->point[pt->v[1]].c[j]
+                           +mesh->point[pt->v[2]].c[j]+mesh->point[pt->v[3]].c[j]);
+      keys[k-1].k = k;
+    }
+    _MMG3D_partBisect(keys,bar,mesh->ne,0,npart,it%3,pa->part);
+
+    _MMG5_DEL_MEM(mesh,keys,pa->ne*sizeof(_MMG3D_partKey));
+    _MMG5_DEL_MEM(mesh,bar,3*(pa->ne+1)*sizeof(double));
+  }
+
+  /* manifold partitions */
+  if ( !MMG3D_hashTetra(mesh,0) )  return(0);
+
+  _MMG5_ADD_MEM(mesh,(pa->np+1)*sizeof(int),"partition balls",return(0));
+  _MMG5_SAFE_CALLOC(pa->pball,pa->np+1,int,0);
+
+  for ( k=1; k<=mesh->ne; k++ ) {
+    pt = &mesh->tetra[k];
+    for ( i=0; i<4; i++ )  pa->pball[pt->v[i]] = 4*k+i;
+  }
+  if ( !_MMG3D_partManifold(mesh,pa) )  return(0);
+
+  /* tetra of each partition */
+  _MMG5_ADD_MEM(mesh,(npart+1)*sizeof(int),"partition",return(0));
+  _MMG5_SAFE_CALLOC(pa->tbeg,npart+1,int,0);
+  _MMG5_ADD_MEM(mesh,(pa->ne+1)*sizeof(int),"partition",return(0));
+  _MMG5_SAFE_CALLOC(pa->tlist,pa->ne+1,int,0);
+
+  for ( k=1; k<=mesh->ne; k++ )  pa->tbeg[pa->part[k]+1]++;
+  for ( p=0; p<npart; p++ ) {
+    pa->tbeg[p+1] += pa->tbeg[p];
+    cnt[p]         = pa->tbeg[p];
+  }
+  for ( k=1; k<=mesh->ne; k++ )  pa->tlist[cnt[pa->part[k]]++] = k;
+
+  /* vertices used by only one partition and interface vertices */
+  _MMG5_ADD_MEM(mesh,(pa->np+1)*sizeof(int),"partition",return(0));
+  _MMG5_SAFE_CALLOC(pa->pown,pa->np+1,int,0);
+  _MMG5_ADD_MEM(mesh,(pa->np+1)*sizeof(int),"partition",return(0));
+  _MMG5_SAFE_CALLOC(pa->ishr,pa->np+1,int,0);
+
+  for ( k=1; k<=mesh->ne; k++ ) {
+    pt = &mesh->tetra[k];
+    for ( i=0; i<4; i++ ) {
+      ip = pt->v[i];
+      if ( !pa->pown[ip] )  pa->pown[ip] = pa->part[k]+1;
+      else if ( pa->pown[ip] != pa->part[k]+1 )  pa->pown[ip] = -1;
+    }
+  }
+  pa->nI = 0;
+  for ( ip=1; ip<=mesh->np; ip++ ) {
+    mesh->point[ip].flag = 0;
+    if ( pa->pown[ip] < 0 ) {
+      pa->ishr[ip] = ++pa->nI;
+      pa->pown[ip] = 0;
+    }
+  }
+
+  /* vertices of each partition: interface vertices first */
+  _MMG5_ADD_MEM(mesh,(npart+1)*sizeof(int),"partition",return(0));
+  _MMG5_SAFE_CALLOC(pa->nshr,npart+1,int,0);
+  _MMG5_ADD_MEM(mesh,(npart+1)*sizeof(int),"partition",return(0));
+  _MMG5_SAFE_CALLOC(pa->pbeg,npart+1,int,0);
+
+  for ( p=0; p<npart; p++ ) {
+    cnt[p] = 0;
+    for ( l=pa->tbeg[p]; l<pa->tbeg[p+1]; l++ ) {
+      pt = &mesh->tetra[pa->tlist[l]];
+      for ( i=0; i<4; i++ ) {
+        ppt = &mesh->point[pt->v[i]];
+        if ( pa->ishr[pt->v[i]] && ppt->flag != p+1 ) {
+          ppt->flag = p+1;
+          pa->nshr[p]++;
+        }
+      }
+    }
+  }
+  for ( ip=1; ip<=mesh->np; ip++ ) {
+    mesh->point[ip].flag = 0;
+    if ( pa->pown[ip] )  cnt[pa->pown[ip]-1]++;
+  }
+  for ( p=0; p<npart; p++ )
+    pa->pbeg[p+1] = pa->pbeg[p] + pa->nshr[p] + cnt[p];
+  pa->npl = pa->pbeg[npart];
+
+  _MMG5_ADD_MEM(mesh,(pa->npl+1)*sizeof(int),"partition vertices",return(0));
+  _MMG5_SAFE_CALLOC(pa->plist,pa->npl+1,int,0);
+
+  for ( p=0; p<npart; p++ ) {
+    n = pa->pbeg[p];
+    for ( l=pa->tbeg[p]; l<pa->tbeg[p+1]; l++ ) {
+      pt = &mesh->tetra[pa->tlist[l]];
+      for ( i=0; i<4; i++ ) {
+        ppt = &mesh->point[pt->v[i]];
+        if ( pa->ishr[pt->v[i]] && ppt->flag != p+1 ) {
+          ppt->flag       = p+1;
+          pa->plist[n++] = pt->v[i];
+        }
+      }
+    }
+    qsort(&pa->plist[pa->pbeg[p]],pa->nshr[p],sizeof(int),_MMG3D_partIntCompare);
+    cnt[p] = n;
+  }
+  for ( ip=1; ip<=mesh->np; ip++ ) {
+    ppt       = &mesh->point[ip];
+    ppt->flag = 0;
+    if ( !pa->pown[ip] )  continue;
+    p = pa->pown[ip]-1;
+    pa->plist[cnt[p]] = ip;
+    ppt->tmp          = cnt[p]-pa->pbeg[p]+1;
+    cnt[p]++;
+  }
+
+  /* tetra faces holding the triangles */
+  _MMG5_ADD_MEM(mesh,(pa->nt+1)*sizeof(int),"partition triangles",return(0));
+  _MMG5_SAFE_CALLOC(pa->tface,pa->nt+1,int,0);
+
+  for ( kt=1; kt<=mesh->nt; kt++ ) {
+    ptt = &mesh->tria[kt];
+    ip  = pa->pball[ptt->v[0]];
+    if ( !ip )  return(-1);
+    ilist = _MMG5_boulevolp(mesh,ip/4,ip%4,list);
+    if ( !ilist )  return(-1);
+    for ( l=0; l<ilist; l++ ) {
+      i = _MMG3D_partFind(mesh,list[l]/4,ptt->v[0],ptt->v[1],ptt->v[2]);
+      if ( i >= 0 ) {
+        pa->tface[kt] = 4*(list[l]/4)+i;
+        break;
+      }
+    }
+    if ( !pa->tface[kt] )  return(-1);
+  }
+
+  /* triangles of each partition and interface triangles */
+  _MMG5_ADD_MEM(mesh,(npart+1)*sizeof(int),"partition",return(0));
+  _MMG5_SAFE_CALLOC(pa->rbeg,npart+1,int,0);
+  _MMG5_ADD_MEM(mesh,(pa->nt+1)*sizeof(int),"partition triangles",return(0));
+  _MMG5_SAFE_CALLOC(pa->rlist,pa->nt+1,int,0);
+  _MMG5_ADD_MEM(mesh,(2*pa->nt+1)*sizeof(_MMG3D_partFace),"partition triangles",
+                return(0));
+  _MMG5_SAFE_CALLOC(pa->fac,2*pa->nt+1,_MMG3D_partFace,0);
+
+  for ( kt=1; kt<=mesh->nt; kt++ ) {
+    k   = pa->tface[kt]/4;
+    i   = pa->tface[kt]%4;
+    adj = mesh->adja[4*(k-1)+1+i];
+    if ( !adj || pa->part[adj/4] == pa->part[k] ) {
+      pa->rbeg[pa->part[k]+1]++;
+      continue;
+    }
+    pa->fac[pa->nfac].k    = k;
+    pa->fac[pa->nfac].i    = i;
+    pa->fac[pa->nfac++].kt = kt;
+    pa->fac[pa->nfac].k    = adj/4;
+    pa->fac[pa->nfac].i    = adj%4;
+    pa->fac[pa->nfac++].kt = kt;
+  }
+  qsort(pa->fac,pa->nfac,sizeof(_MMG3D_partFace),_MMG3D_partFaceCompare);
+
+  nr = 0;
+  for ( p=0; p<npart; p++ ) {
+    pa->rbeg[p+1] += pa->rbeg[p];
+    cnt[p]         = pa->rbeg[p];
+  }
+
+  /* interface faces: counted once, from the partition of lower index */
+  nsyn = 0;
+  for ( k=1; k<=mesh->ne; k++ ) {
+    pt   = &mesh->tetra[k];
+    adja = &mesh->adja[4*(k-1)+1];
+    for ( i=0; i<4; i++ ) {
+      if ( !adja[i] || pa->part[k] >= pa->part[adja[i]/4] )  continue;
+      pa->nifac++;
+      key.k = k;
+      key.i = i;
+      if ( pt->ref != mesh->tetra[adja[i]/4].ref &&
+           !bsearch(&key,pa->fac,pa->nfac,sizeof(_MMG3D_partFace),
+                    _MMG3D_partFaceCompare) )  nsyn++;
+    }
+  }
+
+  pa->nitri = pa->nfac/2 + nsyn;
+  _MMG5_ADD_MEM(mesh,(3*pa->nifac+3)*sizeof(int),"interface faces",return(0));
+  _MMG5_SAFE_CALLOC(pa->ifac,3*pa->nifac+3,int,0);
+  _MMG5_ADD_MEM(mesh,(6*pa->nifac+2)*sizeof(int),"interface faces",return(0));
+  _MMG5_SAFE_CALLOC(pa->iedg,6*pa->nifac+2,int,0);
+  _MMG5_ADD_MEM(mesh,(pa->nitri+1)*sizeof(_MMG3D_partEnt),"interface triangles",
+                return(0));
+  _MMG5_SAFE_CALLOC(pa->itri,pa->nitri+1,_MMG3D_partEnt,0);
+
+  n = 0;
+  for ( kt=1; kt<=mesh->nt; kt++ ) {
+    ptt = &mesh->tria[kt];
+    k   = pa->tface[kt]/4;
+    adj = mesh->adja[4*(k-1)+1+pa->tface[kt]%4];
+    if ( !adj || pa->part[adj/4] == pa->part[k] ) {
+      pa->rlist[cnt[pa->part[k]]++] = kt;
+      nr++;
+      continue;
+    }
+    pent = &pa->itri[n++];
+    for ( j=0; j<3; j++ ) {
+      pent->v[j]   = pa->ishr[ptt->v[j]];
+      pent->tag[j] = ptt->tag[j];
+    }
+    pent->ref = ptt->ref;
+  }
+  assert ( nr == pa->rbeg[npart] );
+
+  l = 0;
+  for ( k=1; k<=mesh->ne; k++ ) {
+    pt   = &mesh->tetra[k];
+    adja = &mesh->adja[4*(k-1)+1];
+    for ( i=0; i<4; i++ ) {
+      if ( !adja[i] || pa->part[k] >= pa->part[adja[i]/4] )  continue;
+      pt1 = &mesh->tetra[adja[i]/4];
+      for ( j=0; j<3; j++ )  v[j] = pa->ishr[pt->v[_MMG5_idir[i][j]]];
+
+      key.k = k;
+      key.i = i;
+      if ( pt->ref != pt1->ref &&
+           !bsearch(&key,pa->fac,pa->nfac,sizeof(_MMG3D_partFace),
+                    _MMG3D_partFaceCompare) ) {
+        pent = &pa->itri[n++];
+        for ( j=0; j<3; j++ )  pent->v[j] = v[j];
+        pent->ref = MG_MIN(pt->ref,pt1->ref);
+      }
+
+      _MMG3D_partSort3(v);
+      memcpy(&pa->ifac[3*l],v,3*sizeof(int));
+      pa->iedg[6*l]   = v[0]; pa->iedg[6*l+1] = v[1];
+      pa->iedg[6*l+2] = v[0]; pa->iedg[6*l+3] = v[2];
+      pa->iedg[6*l+4] = v[1]; pa->iedg[6*l+5] = v[2];
+      l++;
+    }
+  }
+  qsort(pa->ifac,pa->nifac,3*sizeof(int),_MMG3D_partTriCompare);
+  qsort(pa->iedg,3*pa->nifac,2*sizeof(int),_MMG3D_partPairCompare);
+
+  pa->niedg = 0;
+  for ( l=0; l<3*pa->nifac; l++ ) {
+    if ( pa->niedg &&
+         !_MMG3D_partPairCompare(&pa->iedg[2*l],&pa->iedg[2*(pa->niedg-1)]) )
+      continue;
+    pa->iedg[2*pa->niedg]   = pa->iedg[2*l];
+    pa->iedg[2*pa->niedg+1] = pa->iedg[2*l+1];
+    pa->niedg++;
+  }
+
+  /* required edges of the interface faces (the remeshing of the partitions
+   * marks all of them as required) */
+  _MMG5_ADD_MEM(mesh,(pa->niedg+1)*sizeof(char),"interface edges",return(0));
+  _MMG5_SAFE_CALLOC(pa->ireq,pa->niedg+1,char,0);
+  for ( kt=1; kt<=mesh->nt; kt++ ) {
+    ptt = &mesh->tria[kt];
+    for ( j=0; j<3; j++ ) {
+      if ( !(ptt->tag[j] & MG_REQ) )  continue;
+      i1 = pa->ishr[ptt->v[_MMG5_inxt2[j]]];
+      i2 = pa->ishr[ptt->v[_MMG5_iprv2[j]]];
+      if ( !i1 || !i2 )  continue;
+      l = _MMG3D_partIedg(pa,i1,i2);
+      if ( l )  pa->ireq[l-1] = 1;
+    }
+  }
+  for ( k=1; k<=mesh->na; k++ ) {
+    pe = &mesh->edge[k];
+    if ( !(pe->tag & MG_REQ) || !pa->ishr[pe->a] || !pa->ishr[pe->b] )
+      continue;
+    l = _MMG3D_partIedg(pa,pa->ishr[pe->a],pa->ishr[pe->b]);
+    if ( l )  pa->ireq[l-1] = 1;
+  }
+
+  /* edges: given to each partition whose tetra contain them */
+  _MMG5_ADD_MEM(mesh,(npart+1)*sizeof(int),"partition",return(0));
+  _MMG5_SAFE_CALLOC(pa->ebeg,npart+1,int,0);
+
+  for ( pass=0; pass<2; pass++ ) {
+    if ( pass ) {
+      for ( p=0; p<npart; p++ ) {
+        pa->ebeg[p+1] += pa->ebeg[p];
+        cnt[p]         = pa->ebeg[p];
+      }
+      pa->nel = pa->ebeg[npart];
+      _MMG5_ADD_MEM(mesh,(pa->nel+1)*sizeof(int),"partition edges",return(0));
+      _MMG5_SAFE_CALLOC(pa->elist,pa->nel+1,int,0);
+      _MMG5_ADD_MEM(mesh,(pa->niedge+1)*sizeof(_MMG3D_partEnt),
+                    "interface edges",return(0));
+      _MMG5_SAFE_CALLOC(pa->iedge,pa->niedge+1,_MMG3D_partEnt,0);
+    }
+    n = 0;
+    for ( p=0; p<npart; p++ )  stamp[p] = 0;
+
+    for ( k=1; k<=mesh->na; k++ ) {
+      pe = &mesh->edge[k];
+      ip = pa->pball[pe->a];
+      if ( !ip )  continue;
+      ilist = _MMG5_boulevolp(mesh,ip/4,ip%4,list);
+      if ( !ilist )  return(-1);
+      for ( l=0; l<ilist; l++ ) {
+        kk = list[l]/4;
+        if ( _MMG3D_partFind(mesh,kk,pe->a,pe->b,0) < 0 )  continue;
+        p = pa->part[kk];
+        if ( stamp[p] == k )  continue;
+        stamp[p] = k;
+        if ( pass )  pa->elist[cnt[p]++] = k;
+        else  pa->ebeg[p+1]++;
+      }
+
+      if ( !pa->ishr[pe->a] || !pa->ishr[pe->b] ||
+           !_MMG3D_partIedg(pa,pa->ishr[pe->a],pa->ishr[pe->b]) )  continue;
+      if ( pass ) {
+        pent         = &pa->iedge[n];
+        pent->v[0]   = pa->ishr[pe->a];
+        pent->v[1]   = pa->ishr[pe->b];
+        pent->ref    = pe->ref;
+        pent->tag[0] = pe->tag;
+      }
+      n++;
+    }
+    pa->niedge = n;
+  }
+
+  _MMG3D_partFreeScratch(mesh,pa);
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param pa pointer toward the partition.
+ * \param p partition index.
+ * \param sm pointer toward the submesh of the partition (to fill).
+ * \param tbudget time budget of the remeshing of the partition.
+ * \return 1 if success, 0 if fail.
+ *
+ * Copy the partition \a p in a new mesh structure, with its interface faces
+ * given as parallel triangles, and remesh it (if \a p < \a pa->nrem). The mesh
+ * and the metric are only read, so the partitions may be remeshed
+ * concurrently. The triangles
+ * and edges of the result lying on the interfaces are flagged (they are
+ * given by the input mesh) and the required tags that the freezing of the
+ * interfaces put on the other triangles are removed.
+ *
+ */
+static int _MMG3D_partRemesh(MMG5_pMesh mesh,MMG5_pSol met,
+                             _MMG3D_Partition *pa,int p,_MMG3D_partMesh *sm,
+                             double tbudget) {
+  MMG5_pMesh      sub;
+  MMG5_pSol       smet;
+  MMG5_pTetra     pt,pt1;
+  MMG5_pTria      ptt;
+  MMG5_pEdge      pe;
+  MMG5_pPoint     ppt,ppts;
+  _MMG3D_partFace key,*pf;
+  double          tol;
+  int             *plist,*adja,np,ne,nt,na,nshr,k,kt,l,i,j,v[3],ok;
+
+  sm->ier  = MMG5_STRONGFAILURE;
+  sm->mesh = NULL;
+  sm->met  = NULL;
+
+  if ( !MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&sm->mesh,
+                        MMG5_ARG_ppMet,&sm->met,MMG5_ARG_end) )  return(0);
+  sub  = sm->mesh;
+  smet = sm->met;
+
+  /* parameters of the run */
+  sub->info           = mesh->info;
+  sub->info.par       = NULL;
+  sub->info.mat       = NULL;
+  sub->info.nmat      = 0;
+  sub->info.imprim    = 0;
+  sub->info.npart     = 0;
+  sub->info.nthreads  = 1;
+  sub->info.renum     = 0;
+  sub->info.renumit   = 0;
+  sub->info.warmstart = 0;
+  sub->info.keepsrc   = 0;
+  sub->info.tbudget   = tbudget;
+  if ( mesh->info.mem > 0 )
+    sub->info.mem = MG_MAX(mesh->info.mem/pa->npart,1);
+
+  if ( mesh->info.npar ) {
+    _MMG5_ADD_MEM(sub,mesh->info.npar*sizeof(MMG5_Par),"parameters",return(0));
+    _MMG5_SAFE_CALLOC(sub->info.par,mesh->info.npar,MMG5_Par,0);
+    memcpy(sub->info.par,mesh->info.par,mesh->info.npar*sizeof(MMG5_Par));
+  }
+
+  /* sizes */
+  plist = &pa->plist[pa->pbeg[p]];
+  nshr  = pa->nshr[p];
+  np    = pa->pbeg[p+1] - pa->pbeg[p];
+  ne    = pa->tbeg[p+1] - pa->tbeg[p];
+  nt    = pa->rbeg[p+1] - pa->rbeg[p];
+  na    = pa->ebeg[p+1] - pa->ebeg[p];
+  for ( l=pa->tbeg[p]; l<pa->tbeg[p+1]; l++ ) {
+    k    = pa->tlist[l];
+    adja = &mesh->adja[4*(k-1)+1];
+    for ( i=0; i<4; i++ )
+      if ( adja[i] && pa->part[adja[i]/4] != p )  nt++;
+  }
+
+  if ( !MMG3D_Set_meshSize(sub,np,ne,0,nt,0,na) )  return(0);
+
+  for ( l=0; l<np; l++ ) {
+    ppt  = &mesh->point[plist[l]];
+    ppts = &sub->point[l+1];
+    memcpy(ppts->c,ppt->c,3*sizeof(double));
+    ppts->ref = ppt->ref;
+    ppts->tag = p < pa->nrem ? ppt->tag & (MG_CRN | MG_REQ) : ppt->tag;
+  }
+
+  /* tetra and interface faces (parallel triangles) */
+  kt = 0;
+  for ( l=pa->tbeg[p]; l<pa->tbeg[p+1]; l++ ) {
+    k  = pa->tlist[l];
+    pt = &mesh->tetra[k];
+    pt1 = &sub->tetra[l-pa->tbeg[p]+1];
+    for ( i=0; i<4; i++ )  pt1->v[i] = _MMG3D_partLocal(mesh,pa,p,pt->v[i]);
+    pt1->ref = pt->ref;
+    pt1->tag = pt->tag & MG_REQ;
+
+    adja = &mesh->adja[4*(k-1)+1];
+    for ( i=0; i<4; i++ ) {
+      if ( !adja[i] || pa->part[adja[i]/4] == p )  continue;
+      ptt = &sub->tria[++kt];
+      for ( j=0; j<3; j++ ) {
+        ptt->v[j]   = pt1->v[_MMG5_idir[i][j]];
+        ptt->tag[j] = MG_PARBDY;
+      }
+      key.k = k;
+      key.i = i;
+      pf = (_MMG3D_partFace*)bsearch(&key,pa->fac,pa->nfac,
+                                     sizeof(_MMG3D_partFace),
+                                     _MMG3D_partFaceCompare);
+      if ( pf )
+        ptt->ref = mesh->tria[pf->kt].ref;
+      else if ( pt->ref != mesh->tetra[adja[i]/4].ref )
+        ptt->ref = MG_MIN(pt->ref,mesh->tetra[adja[i]/4].ref);
+    }
+  }
+
+  for ( l=pa->rbeg[p]; l<pa->rbeg[p+1]; l++ ) {
+    ptt = &mesh->tria[pa->rlist[l]];
+    sub->tria[++kt].ref = ptt->ref;
+    for ( j=0; j<3; j++ ) {
+      sub->tria[kt].v[j]   = _MMG3D_partLocal(mesh,pa,p,ptt->v[j]);
+      sub->tria[kt].tag[j] = ptt->tag[j] & MG_REQ;
+    }
+  }
+
+  for ( l=pa->ebeg[p]; l<pa->ebeg[p+1]; l++ ) {
+    pe = &sub->edge[l-pa->ebeg[p]+1];
+    pe->a   = _MMG3D_partLocal(mesh,pa,p,mesh->edge[pa->elist[l]].a);
+    pe->b   = _MMG3D_partLocal(mesh,pa,p,mesh->edge[pa->elist[l]].b);
+    pe->ref = mesh->edge[pa->elist[l]].ref;
+    pe->tag = mesh->edge[pa->elist[l]].tag & (MG_REF | MG_GEO | MG_REQ);
+  }
+
+  /* metric and user fields */
+  if ( met->m && met->np == mesh->np &&
+       ( mesh->info.hsiz <= 0. || p >= pa->nrem ) ) {
+    if ( !MMG3D_Set_solSize(sub,smet,MMG5_Vertex,np,
+                            met->size == 6 ? MMG5_Tensor : MMG5_Scalar) )
+      return(0);
+    for ( l=0; l<np; l++ )
+      memcpy(&smet->m[met->size*(l+1)],&met->m[met->size*plist[l]],
+             met->size*sizeof(double));
+  }
+  else  smet->size = met->size;
+
+  if ( mesh->nfield ) {
+    sub->nfield = mesh->nfield;
+    sub->fsize  = mesh->fsize;
+    _MMG5_ADD_MEM(sub,(sub->fsize*(sub->npmax+1))*sizeof(double),"user fields",
+                  return(0));
+    _MMG5_SAFE_CALLOC(sub->field,sub->fsize*(sub->npmax+1),double,0);
+    for ( l=0; l<np; l++ )
+      memcpy(&sub->field[sub->fsize*(l+1)],&mesh->field[mesh->fsize*plist[l]],
+             mesh->fsize*sizeof(double));
+  }
+
+  if ( p < pa->nrem ) {
+    sm->ier = MMG3D_mmg3dlib(sub,smet);
+    if ( sm->ier == MMG5_STRONGFAILURE )  return(0);
+  }
+  else  sm->ier = MMG5_SUCCESS;
+
+  /* the interface vertices must be unchanged */
+  if ( sub->np < nshr )  return(0);
+  tol = _MMG3D_PARTTOL*mesh->info.delta;
+  for ( l=0; l<nshr; l++ ) {
+    ppt = &mesh->point[plist[l]];
+    for ( j=0; j<3; j++ )
+      if ( fabs(sub->point[l+1].c[j]-ppt->c[j]) > tol )  return(0);
+  }
+
+  /* triangles and edges lying on the interfaces */
+  sm->nt = sm->na = 0;
+  for ( k=1; k<=sub->nt; k++ ) {
+    ptt       = &sub->tria[k];
+    ptt->flag = 0;
+    ok        = 1;
+    for ( j=0; j<3; j++ ) {
+      if ( ptt->v[j] > nshr ) { ok = 0; break; }
+      v[j] = pa->ishr[plist[ptt->v[j]-1]];
+    }
+    if ( ok && _MMG3D_partIsIfac(pa,v) ) {
+      ptt->flag = 1;
+      continue;
+    }
+    sm->nt++;
+    for ( j=0; j<3; j++ ) {
+      i = _MMG5_inxt2[j];
+      l = _MMG5_iprv2[j];
+      if ( !(ptt->tag[j] & MG_REQ) || ptt->v[i] > nshr || ptt->v[l] > nshr )
+        continue;
+      l = _MMG3D_partIedg(pa,pa->ishr[plist[ptt->v[i]-1]],
+                          pa->ishr[plist[ptt->v[l]-1]]);
+      if ( l && !pa->ireq[l-1] )  ptt->tag[j] &= ~MG_REQ;
+    }
+  }
+  for ( k=1; k<=sub->na; k++ ) {
+    pe       = &sub->edge[k];
+    pe->base = 0;
+    if ( pe->a <= nshr && pe->b <= nshr &&
+         _MMG3D_partIedg(pa,pa->ishr[plist[pe->a-1]],pa->ishr[plist[pe->b-1]]) )
+      pe->base = 1;
+    else  sm->na++;
+  }
+
+  return(1);
+}
+
+/**
+ * \param pa pointer toward the partition.
+ * \param poff index (minus 1) of the first vertex of each partition that
+ * is not an interface vertex in the merged mesh.
+ * \param p partition index.
+ * \param l index of a vertex in the submesh of \a p.
+ * \return the index of the vertex in the merged mesh.
+ *
+ */
+static inline int _MMG3D_partGlobal(_MMG3D_Partition *pa,int *poff,int p,
+                                    int l) {
+
+  if ( l <= pa->nshr[p] )  return( pa->ishr[pa->plist[pa->pbeg[p]+l-1]] );
+  return( poff[p] + l - pa->nshr[p] );
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param pa pointer toward the partition.
+ * \param sm submeshes of the partitions.
+ * \return 1 if success, 0 if fail.
+ *
+ * Replace the mesh by the merge of the remeshed partitions. The interface
+ * vertices are numbered first, with the data of the input mesh.
+ *
+ */
+static int _MMG3D_partMerge(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_Partition *pa,
+                            _MMG3D_partMesh *sm) {
+  MMG5_pMesh     sub;
+  MMG5_pSol      smet;
+  MMG5_pPoint    ipt,ppt;
+  MMG5_pTetra    pt;
+  MMG5_pTria     ptt;
+  MMG5_pEdge     pe;
+  _MMG3D_partEnt *pent;
+  double         *imet,*ifld;
+  long long      memi;
+  int            *poff,np,ne,nt,na,nfield,fsize,msiz,hasmet,npart,p,k,l,j,ip;
+
+  npart  = pa->npart;
+  nfield = mesh->nfield;
+  fsize  = mesh->fsize;
+  hasmet = ( met->m && met->np == mesh->np );
+  msiz   = hasmet ? met->size : 0;
+  for ( p=0; p<npart && !msiz; p++ )
+    if ( sm[p].met->m && sm[p].met->np )  msiz = sm[p].met->size;
+
+  /* data of the interface vertices */
+  memi = (pa->nI+1)*sizeof(MMG5_Point) + (npart+1)*sizeof(int)
+    + (pa->nI+1)*(msiz+fsize)*sizeof(double);
+  _MMG5_ADD_MEM(mesh,memi,"interface vertices",return(0));
+  _MMG5_SAFE_CALLOC(ipt,pa->nI+1,MMG5_Point,0);
+  _MMG5_SAFE_CALLOC(poff,npart+1,int,0);
+  _MMG5_SAFE_CALLOC(imet,(pa->nI+1)*msiz+1,double,0);
+  _MMG5_SAFE_CALLOC(ifld,(pa->nI+1)*fsize+1,double,0);
+
+  for ( ip=1; ip<=mesh->np; ip++ ) {
+    k = pa->ishr[ip];
+    if ( !k )  continue;
+    ipt[k] = mesh->point[ip];
+    if ( hasmet )
+      memcpy(&imet[msiz*k],&met->m[msiz*ip],msiz*sizeof(double));
+    if ( fsize )
+      memcpy(&ifld[fsize*k],&mesh->field[fsize*ip],fsize*sizeof(double));
+  }
+
+  /* sizes of the merged mesh */
+  np = pa->nI;
+  ne = 0;
+  nt = pa->nitri;
+  na = pa->niedge;
+  for ( p=0; p<npart; p++ ) {
+    poff[p] = np;
+    np += sm[p].mesh->np - pa->nshr[p];
+    ne += sm[p].mesh->ne;
+    nt += sm[p].nt;
+    na += sm[p].na;
+  }
+
+  _MMG3D_Free_topoTables(mesh);
+  if ( mesh->adjt )
+    _MMG5_DEL_MEM(mesh,mesh->adjt,(3*mesh->nt+4)*sizeof(int));
+  if ( !MMG3D_Set_meshSize(mesh,np,ne,0,nt,0,na) )  return(0);
+
+  if ( msiz ) {
+    if ( !MMG3D_Set_solSize(mesh,met,MMG5_Vertex,np,
+                            msiz == 6 ? MMG5_Tensor : MMG5_Scalar) )
+      return(0);
+  }
+  if ( nfield ) {
+    mesh->nfield = nfield;
+    mesh->fsize  = fsize;
+    _MMG5_ADD_MEM(mesh,(fsize*(mesh->npmax+1))*sizeof(double),"user fields",
+                  return(0));
+    _MMG5_SAFE_CALLOC(mesh->field,fsize*(mesh->npmax+1),double,0);
+  }
+
+  /* interface vertices */
+  for ( k=1; k<=pa->nI; k++ ) {
+    ppt       = &mesh->point[k];
+    *ppt      = ipt[k];
+    ppt->tag &= ~(MG_PARBDY | MG_NOSURF);
+    ppt->xp   = 0;
+    ppt->tmp  = 0;
+    ppt->flag = hasmet;
+    if ( hasmet )
+      memcpy(&met->m[msiz*k],&imet[msiz*k],msiz*sizeof(double));
+    if ( fsize )
+      memcpy(&mesh->field[fsize*k],&ifld[fsize*k],fsize*sizeof(double));
+  }
+
+  ne = nt = na = 0;
+  for ( p=0; p<npart; p++ ) {
+    sub  = sm[p].mesh;
+    smet = sm[p].met;
+
+    for ( l=1; l<=sub->np; l++ ) {
+      k   = _MMG3D_partGlobal(pa,poff,p,l);
+      ppt = &mesh->point[k];
+      if ( l > pa->nshr[p] ) {
+        memcpy(ppt->c,sub->point[l].c,3*sizeof(double));
+        ppt->ref = sub->point[l].ref;
+        ppt->tag = sub->point[l].tag & ~(MG_PARBDY | MG_NOSURF);
+        if ( fsize )
+          memcpy(&mesh->field[fsize*k],&sub->field[fsize*l],
+                 fsize*sizeof(double));
+      }
+      else if ( ppt->flag )  continue;
+      ppt->flag = 1;
+      if ( msiz && smet->m && smet->np )
+        memcpy(&met->m[msiz*k],&smet->m[msiz*l],msiz*sizeof(double));
+    }
+
+    for ( l=1; l<=sub->ne; l++ ) {
+      pt = &mesh->tetra[++ne];
+      for ( j=0; j<4; j++ )
+        pt->v[j] = _MMG3D_partGlobal(pa,poff,p,sub->tetra[l].v[j]);
+      pt->ref = sub->tetra[l].ref;
+      pt->tag = sub->tetra[l].tag & MG_REQ;
+    }
+
+    for ( l=1; l<=sub->nt; l++ ) {
+      if ( sub->tria[l].flag )  continue;
+      ptt = &mesh->tria[++nt];
+      for ( j=0; j<3; j++ ) {
+        ptt->v[j]   = _MMG3D_partGlobal(pa,poff,p,sub->tria[l].v[j]);
+        ptt->tag[j] = sub->tria[l].tag[j] & ~(MG_PARBDY | MG_NOSURF);
+      }
+      ptt->ref = sub->tria[l].ref;
+    }
+
+    for ( l=1; l<=sub->na; l++ ) {
+      if ( sub->edge[l].base )  continue;
+      pe = &mesh->edge[++na];
+      pe->a   = _MMG3D_partGlobal(pa,poff,p,sub->edge[l].a);
+      pe->b   = _MMG3D_partGlobal(pa,poff,p,sub->edge[l].b);
+      pe->ref = sub->edge[l].ref;
+      pe->tag = sub->edge[l].tag & ~(MG_PARBDY | MG_NOSURF);
+    }
+  }
+
+  /* triangles and edges of the interfaces */
+  for ( l=0; l<pa->nitri; l++ ) {
+    pent = &pa->itri[l];
+    ptt  = &mesh->tria[++nt];
+    for ( j=0; j<3; j++ ) {
+      ptt->v[j]   = pent->v[j];
+      ptt->tag[j] = pent->tag[j] & ~(MG_PARBDY | MG_NOSURF);
+    }
+    ptt->ref = pent->ref;
+  }
+  for ( l=0; l<pa->niedge; l++ ) {
+    pent    = &pa->iedge[l];
+    pe      = &mesh->edge[++na];
+    pe->a   = pent->v[0];
+    pe->b   = pent->v[1];
+    pe->ref = pent->ref;
+    pe->tag = pent->tag[0] & ~(MG_PARBDY | MG_NOSURF);
+  }
+
+  for ( k=1; k<=mesh->np; k++ )  mesh->point[k].flag = 0;
+
+  _MMG5_SAFE_FREE(ipt);
+  _MMG5_SAFE_FREE(poff);
+  _MMG5_SAFE_FREE(imet);
+  _MMG5_SAFE_FREE(ifld);
+  mesh->memCur -= memi;
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sub pointer toward the submesh of a partition.
+ *
+ * Add the performance counters of the remeshing of a partition to the ones
+ * of the mesh.
+ *
+ */
+static void _MMG3D_partStats(MMG5_pMesh mesh,MMG5_pMesh sub) {
+  MMG5_pStats st,sst;
+  int         k;
+
+  st  = &mesh->stats;
+  sst = &sub->stats;
+  for ( k=0; k<MMG5_NOPERATORS; k++ ) {
+    st->otim[k]  += sst->otim[k];
+    st->ncall[k] += sst->ncall[k];
+    st->nsucc[k] += sst->nsucc[k];
+  }
+  st->ncav    += sst->ncav;
+  st->cavsiz  += sst->cavsiz;
+  st->noctree += sst->noctree;
+  st->nbcand  += sst->nbcand;
+  st->nbstale += sst->nbstale;
+  st->nbfilt  += sst->nbfilt;
+  st->nbrej   += sst->nbrej;
+  st->nbins   += sst->nbins;
+  st->btim    += sst->btim;
+  st->nsweep  += sst->nsweep;
+  st->nvisit  += sst->nvisit;
+  st->cavmax   = MG_MAX(st->cavmax,sst->cavmax);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pa pointer toward the partition.
+ * \param sm submeshes of the partitions (may be NULL).
+ *
+ * Free the partition, the submeshes and the adjacency of the mesh.
+ *
+ */
+static void _MMG3D_partClean(MMG5_pMesh mesh,_MMG3D_Partition *pa,
+                             _MMG3D_partMesh *sm) {
+  int p;
+
+  if ( sm ) {
+    for ( p=0; p<pa->npart; p++ ) {
+      if ( !sm[p].mesh )  continue;
+      MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&sm[p].mesh,
+                     MMG5_ARG_ppMet,&sm[p].met,MMG5_ARG_end);
+    }
+    _MMG5_DEL_MEM(mesh,sm,pa->npart*sizeof(_MMG3D_partMesh));
+  }
+  _MMG3D_partFree(mesh,pa);
+  if ( mesh->adja )
+    _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(int));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param pa pointer toward the partition (npart and nrem must be set).
+ * \param it iteration index (see \ref _MMG3D_partSet).
+ * \return \ref MMG5_SUCCESS, \ref MMG5_LOWFAILURE, \ref MMG5_STRONGFAILURE or
+ * \ref MMG5_INTERRUPTED, -1 if the mesh can't be partitioned.
+ *
+ * Partition the mesh, remesh the partitions concurrently and merge them. If a
+ * partition can't be remeshed, the mesh is unchanged. The partition is freed.
+ *
+ */
+static int _MMG3D_partPass(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_Partition *pa,
+                           int it) {
+  _MMG3D_partMesh  *sm;
+  long long        mempart;
+  double           tbudget;
+  int              npart,p,ier,ret,fail;
+
+  npart = pa->npart;
+  sm    = NULL;
+
+  ret = _MMG3D_partSet(mesh,pa,it);
+  if ( ret <= 0 ) {
+    _MMG3D_partClean(mesh,pa,sm);
+    if ( ret < 0 )  return(-1);
+    fprintf(stderr,"\n  ## Error: %s: unable to partition the mesh.\n",
+            __func__);
+    return(MMG5_LOWFAILURE);
+  }
+
+  _MMG5_ADD_MEM(mesh,npart*sizeof(_MMG3D_partMesh),"partitions",
+                _MMG3D_partClean(mesh,pa,NULL);
+                return(MMG5_LOWFAILURE));
+  _MMG5_SAFE_CALLOC(sm,npart,_MMG3D_partMesh,MMG5_LOWFAILURE);
+
+  tbudget = 0.;
+  if ( mesh->info.tbudget > 0. )
+    tbudget = MG_MAX(mesh->info.tbudget-(_MMG5_wtime()-mesh->tstart),_MMG5_EPS);
+
+  /* remeshing of the partitions */
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic,1) num_threads(_MMG5_NTHREADS(mesh))
+#endif
+  for ( p=0; p<npart; p++ ) {
+    if ( !_MMG3D_partRemesh(mesh,met,pa,p,&sm[p],tbudget) )
+      sm[p].ier = MMG5_STRONGFAILURE;
+  }
+  MMG3D_setfunc(mesh,met);
+
+  ier     = MMG5_SUCCESS;
+  fail    = 0;
+  mempart = 0;
+  for ( p=0; p<npart; p++ ) {
+    if ( sm[p].mesh )  mempart += sm[p].mesh->stats.memPeak;
+    if ( sm[p].ier == MMG5_STRONGFAILURE )  fail = 1;
+    else if ( sm[p].ier == MMG5_LOWFAILURE )  ier = MMG5_LOWFAILURE;
+    else if ( sm[p].ier == MMG5_INTERRUPTED && ier == MMG5_SUCCESS )
+      ier = MMG5_INTERRUPTED;
+  }
+  mesh->stats.memPeak = MG_MAX(mesh->stats.memPeak,mesh->memCur+mempart);
+
+  /* a partition can't be remeshed: keep the mesh of the last iteration */
+  if ( fail ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to remesh a partition.\n",
+            __func__);
+    _MMG3D_partClean(mesh,pa,sm);
+    return(MMG5_LOWFAILURE);
+  }
+
+  for ( p=0; p<pa->nrem; p++ )  _MMG3D_partStats(mesh,sm[p].mesh);
+  if ( !_MMG3D_partMerge(mesh,met,pa,sm) ) {
+    _MMG3D_partClean(mesh,pa,sm);
+    return(MMG5_STRONGFAILURE);
+  }
+  _MMG3D_partClean(mesh,pa,sm);
+
+  return(ier);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param pa pointer toward the partition (to fill).
+ * \return the number of bad tetra, -1 if fail.
+ *
+ * Put the tetra of quality lower than \ref _MMG3D_BADKAL and
+ * \ref _MMG3D_PARTNLAY layers of tetra around them in the partition 0, the
+ * other tetra in the partition 1.
+ *
+ */
+static int _MMG3D_partBad(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_Partition *pa) {
+  MMG5_pTetra pt;
+  int         k,i,l,nbad;
+
+  if ( met->size == 6 && !met->m )  return(0);
+
+  pa->ne = mesh->ne;
+  _MMG5_ADD_MEM(mesh,(pa->ne+1)*sizeof(int),"partition",return(-1));
+  _MMG5_SAFE_CALLOC(pa->part,pa->ne+1,int,-1);
+
+  if ( !_MMG5_scaleMesh(mesh,met) )  return(-1);
+  MMG3D_setfunc(mesh,met);
+
+  nbad = 0;
+  for ( k=1; k<=mesh->ne; k++ ) {
+    pt = &mesh->tetra[k];
+    if ( _MMG3D_ALPHAD*_MMG5_caltet(mesh,met,pt) < _MMG3D_BADKAL )  nbad++;
+    else  pa->part[k] = 1;
+  }
+  if ( !_MMG5_unscaleMesh(mesh,met) )  return(-1);
+  if ( !nbad )  return(0);
+
+  for ( l=0; l<_MMG3D_PARTNLAY; l++ ) {
+    for ( k=1; k<=mesh->np; k++ )  mesh->point[k].flag = 0;
+    for ( k=1; k<=mesh->ne; k++ ) {
+      if ( pa->part[k] )  continue;
+      pt = &mesh->tetra[k];
+      for ( i=0; i<4; i++ )  mesh->point[pt->v[i]].flag = 1;
+    }
+    for ( k=1; k<=mesh->ne; k++ ) {
+      pt = &mesh->tetra[k];
+      for ( i=0; i<4; i++ )
+        if ( mesh->point[pt->v[i]].flag )  pa->part[k] = 0;
+    }
+  }
+  for ( k=1; k<=mesh->np; k++ )  mesh->point[k].flag = 0;
+
+  return(nbad);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \return \ref MMG5_SUCCESS, \ref MMG5_LOWFAILURE, \ref MMG5_STRONGFAILURE or
+ * \ref MMG5_INTERRUPTED (see \ref MMG3D_mmg3dlib), -1 if the mesh can't be
+ * remeshed by partitions (the mesh is unchanged and must be remeshed by the
+ * serial path).
+ *
+ * Partitioned remeshing (\ref MMG3D_IPARAM_npart): at each iteration, the
+ * tetra are split in partitions that are remeshed concurrently with frozen
+ * interfaces, then merged. The bisection axes are rotated between the
+ * iterations so the interfaces are moved. A last pass remeshes the bad tetra
+ * left along the last interfaces, with their neighbourhood.
+ *
+ * \warning the user callback (\ref MMG3D_Set_interruptFunc) is only checked
+ * between the iterations.
+ *
+ */
+int _MMG3D_mmg3dpart(MMG5_pMesh mesh,MMG5_pSol met) {
+  _MMG3D_Partition pa;
+  int              npart,it,k,ier,ne0,nbad;
+
+  npart = mesh->info.npart;
+
+#ifdef PATTERN
+  if ( mesh->info.imprim > 0 )
+    fprintf(stdout,"\n  ## Warning: %s: partitioned remeshing unavailable"
+            " with the pattern mode.\n",__func__);
+  return(-1);
+#endif
+
+  if ( mesh->nprism || mesh->nquad || mesh->info.optim ) {
+    if ( mesh->info.imprim > 0 )
+      fprintf(stdout,"\n  ## Warning: %s: partitioned remeshing unavailable"
+              " with prisms, quadrilaterals or the optim mode.\n",__func__);
+    return(-1);
+  }
+  npart = MG_MIN(npart,mesh->ne/_MMG3D_PARTMINNE);
+  if ( npart < 2 ) {
+    if ( mesh->info.imprim > 4 )
+      fprintf(stdout,"\n  ## Warning: %s: mesh too small for the partitioned"
+              " remeshing.\n",__func__);
+    return(-1);
+  }
+
+  /* default sizes and quality of the input mesh, copy of the input mesh */
+  if ( !_MMG5_scaleMesh(mesh,met) )  return(MMG5_STRONGFAILURE);
+  MMG3D_setfunc(mesh,met);
+  if ( abs(mesh->info.imprim) > 0 && !_MMG3D_inqua(mesh,met) ) {
+    if ( !_MMG5_unscaleMesh(mesh,met) )  return(MMG5_STRONGFAILURE);
+    return(MMG5_LOWFAILURE);
+  }
+  if ( mesh->info.keepsrc &&
+       ( !MMG3D_hashTetra(mesh,0) || !_MMG3D_saveSource(mesh) ) )
+    fprintf(stderr,"\n  ## Warning: unable to keep a copy of the input mesh:"
+            " the solutions can't be interpolated.\n");
+  if ( !_MMG5_unscaleMesh(mesh,met) )  return(MMG5_STRONGFAILURE);
+
+  if ( mesh->info.imprim > 0 )
+    fprintf(stdout,"\n  -- PHASE 2 : PARTITIONED %s MESHING (%d PARTITIONS)\n",
+            met->size < 6 ? "ISOTROPIC" : "ANISOTROPIC",npart);
+
+  ier = MMG5_SUCCESS;
+  for ( it=0; it<_MMG3D_PARTMAXIT; it++ ) {
+    if ( it && _MMG5_interrupt(mesh) ) {
+      ier = MMG5_INTERRUPTED;
+      break;
+    }
+
+    memset(&pa,0,sizeof(_MMG3D_Partition));
+    pa.npart = npart;
+    pa.nrem  = npart;
+    ne0      = mesh->ne;
+
+    ier = _MMG3D_partPass(mesh,met,&pa,it);
+    if ( ier < 0 ) {
+      if ( !it ) {
+        if ( mesh->info.imprim > 0 )
+          fprintf(stdout,"\n  ## Warning: %s: triangles or edges out of the"
+                  " tetra: partitioned remeshing unavailable.\n",__func__);
+        return(-1);
+      }
+      fprintf(stderr,"\n  ## Error: %s: unable to partition the mesh.\n",
+              __func__);
+      ier = MMG5_LOWFAILURE;
+    }
+    if ( ier == MMG5_STRONGFAILURE )  return(ier);
+
+    if ( mesh->info.imprim > 0 )
+      fprintf(stdout,"     ITERATION %d: %8d INTERFACE VERTICES, %8d VERTICES,"
+              " %8d TETRAHEDRA\n",it,pa.nI,mesh->np,mesh->ne);
+
+    if ( ier != MMG5_SUCCESS )  break;
+    if ( it+1 >= _MMG3D_PARTMINIT &&
+         abs(mesh->ne-ne0) <= _MMG3D_PARTCONV*ne0 )  break;
+  }
+
+  /* remeshing of the bad tetra left along the last interfaces */
+  if ( ier == MMG5_SUCCESS && !_MMG5_interrupt(mesh) ) {
+    memset(&pa,0,sizeof(_MMG3D_Partition));
+    pa.npart = 2;
+    pa.nrem  = 1;
+
+    nbad = _MMG3D_partBad(mesh,met,&pa);
+    if ( nbad > 0 ) {
+      ne0 = 0;
+      for ( k=1; k<=mesh->ne; k++ )
+        if ( !pa.part[k] )  ne0++;
+
+      ier = _MMG3D_partPass(mesh,met,&pa,-1);
+      if ( ier < 0 )  ier = MMG5_LOWFAILURE;
+      if ( ier == MMG5_STRONGFAILURE )  return(ier);
+      if ( mesh->info.imprim > 0 )
+        fprintf(stdout,"     LAST PASS: %8d BAD ELEMENTS, %8d TETRAHEDRA"
+                " REMESHED\n",nbad,ne0);
+    }
+    else {
+      _MMG3D_partClean(mesh,&pa,NULL);
+      if ( nbad < 0 )  ier = MMG5_LOWFAILURE;
+    }
+  }
+  if ( ier == MMG5_INTERRUPTED )  mesh->stats.interrupted = 1;
+
+  /* quality of the output mesh */
+  if ( abs(mesh->info.imprim) > 0 ) {
+    if ( !_MMG5_scaleMesh(mesh,met) )  return(MMG5_STRONGFAILURE);
+    MMG3D_setfunc(mesh,met);
+    if ( !_MMG3D_outqua(mesh,met) && ier == MMG5_SUCCESS )
+      ier = MMG5_LOWFAILURE;
+    if ( !_MMG5_unscaleMesh(mesh,met) )  return(MMG5_STRONGFAILURE);
+  }
+  mesh->warm = 0;
+
+  return(ier);
+}
@@ -34,7 +34,405 @@
 
 #include "inlined_functions_3d.h"
 
-extern char ddb;
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Statistics of the qualities of the tetra printed by \ref _MMG3D_inqua and
+ * \ref _MMG3D_outqua.
+ */
+typedef struct {
+  double rapmin,rapmax,rapavg; /*!< Worst, best and sum of the qualities */
+  double med,good; /*!< Numbers of qualities greater than 0.5 and 0.12 */
+  int    his[5]; /*!< Histogram of the qualities */
+  int    iel; /*!< Position of the worst tetra among the used ones */
+  int    nex; /*!< Number of unused tetra */
+  int    nrid; /*!< Number of tetra with 4 ridge vertices (skipped) */
+  char   neg; /*!< 1 if at least 1 tetra has a negative volume */
+  char   bad; /*!< 1 if at least 1 quality is lower than _MMG3D_BADKAL */
+} _MMG3D_QualStats;
+
+/**
+ * \param pk pointer toward the pack of tetra.
+ * \param qual qualities of the tetra of the pack.
+ *
+ * Isotropic quality of the tetra of the pack: same computation as
+ * \ref _MMG5_caltet_iso_4pt, performed on all the tetra of the pack at once.
+ *
+ */
+_MMG5_SIMD_KERNEL
+void _MMG3D_caltetPack_iso(_MMG3D_QualPack *pk,double *qual) {
+  _MMG5_SIMD_NOCONTRACT
+  double abx,aby,abz,acx,acy,acz,adx,ady,adz,bcx,bcy,bcz,bdx,bdy,bdz;
+  double cdx,cdy,cdz,vol,v1,v2,v3,rap;
+  int    j,n;
+
+  n = pk->n;
+#ifdef USE_OPENMP
+#pragma omp simd private(abx,aby,abz,acx,acy,acz,adx,ady,adz,bcx,bcy,bcz,bdx,bdy,bdz,cdx,cdy,cdz,vol,v1,v2,v3,rap)
+#endif
+  for ( j=0; j<n; j++ ) {
+    abx = pk->c[3][j] - pk->c[0][j];
+    aby = pk->c[4][j] - pk->c[1][j];
+    abz = pk->c[5][j] - pk->c[2][j];
+    rap = abx*abx + aby*aby + abz*abz;
+
+    acx = pk->c[6][j] - pk->c[0][j];
+    acy = pk->c[7][j] - pk->c[1][j];
+    acz = pk->c[8][j] - pk->c[2][j];
+    rap += acx*acx + acy*acy + acz*acz;
+
+    adx = pk->c[9][j]  - pk->c[0][j];
+    ady = pk->c[10][j] - pk->c[1][j];
+    adz = pk->c[11][j] - pk->c[2][j];
+    rap += adx*adx + ady*ady + adz*adz;
+
+    v1  = acy*adz - acz*ady;
+    v2  = acz*adx - acx*adz;
+    v3  = acx*ady - acy*adx;
+    vol = abx * v1 + aby * v2 + abz * v3;
+
+    bcx = pk->c[6][j] - pk->c[3][j];
+    bcy = pk->c[7][j] - pk->c[4][j];
+    bcz = pk->c[8][j] - pk->c[5][j];
+    rap += bcx*bcx + bcy*bcy + bcz*bcz;
+
+    bdx = pk->c[9][j]  - pk->c[3][j];
+    bdy = pk->c[10][j] - pk->c[4][j];
+    bdz = pk->c[11][j] - pk->c[5][j];
+    rap += bdx*bdx + bdy*bdy + bdz*bdz;
+
+    cdx = pk->c[9][j]  - pk->c[6][j];
+    cdy = pk->c[10][j] - pk->c[7][j];
+    cdz = pk->c[11][j] - pk->c[8][j];
+    rap += cdx*cdx + cdy*cdy + cdz*cdz;
+
+    /* quality = vol / len^3/2 (the null qualities are selected after the
+     * division to keep the loop free of branches) */
+    qual[j] = vol / (rap * sqrt(rap));
+    qual[j] = ( vol < _MMG5_EPSD2 || rap < _MMG5_EPSD2 ) ? 0.0 : qual[j];
+  }
+}
+
+/**
+ * \param pk pointer toward the pack of tetra.
+ * \param qual qualities of the tetra of the pack.
+ *
+ * Anisotropic quality of the tetra of the pack with respect to their mean
+ * metrics: same computation as \ref _MMG5_caltet_ani, performed on all the
+ * tetra of the pack at once.
+ *
+ */
+_MMG5_SIMD_KERNEL
+void _MMG3D_caltetPack_ani(_MMG3D_QualPack *pk,double *qual) {
+  _MMG5_SIMD_NOCONTRACT
+  double abx,aby,abz,acx,acy,acz,adx,ady,adz,bcx,bcy,bcz,bdx,bdy,bdz;
+  double cdx,cdy,cdz,h1,h2,h3,h4,h5,h6,det,vol,rap,v1,v2,v3,num;
+  double m0,m1,m2,m3,m4,m5;
+  int    j,n;
+
+  n = pk->n;
+#ifdef USE_OPENMP
+#pragma omp simd private(abx,aby,abz,acx,acy,acz,adx,ady,adz,bcx,bcy,bcz,bdx,bdy,bdz,cdx,cdy,cdz,h1,h2,h3,h4,h5,h6,det,vol,rap,v1,v2,v3,num,m0,m1,m2,m3,m4,m5)
+#endif
+  for ( j=0; j<n; j++ ) {
+    m0 = pk->m[0][j];  m1 = pk->m[1][j];  m2 = pk->m[2][j];
+    m3 = pk->m[3][j];  m4 = pk->m[4][j];  m5 = pk->m[5][j];
+
+    abx = pk->c[3][j] - pk->c[0][j];
+    aby = pk->c[4][j] - pk->c[1][j];
+    abz = pk->c[5][j] - pk->c[2][j];
+
+    acx = pk->c[6][j] - pk->c[0][j];
+    acy = pk->c[7][j] - pk->c[1][j];
+    acz = pk->c[8][j] - pk->c[2][j];
+
+    adx = pk->c[9][j]  - pk->c[0][j];
+    ady = pk->c[10][j] - pk->c[1][j];
+    adz = pk->c[11][j] - pk->c[2][j];
+
+    bcx = pk->c[6][j] - pk->c[3][j];
+    bcy = pk->c[7][j] - pk->c[4][j];
+    bcz = pk->c[8][j] - pk->c[5][j];
+
+    bdx = pk->c[9][j]  - pk->c[3][j];
+    bdy = pk->c[10][j] - pk->c[4][j];
+    bdz = pk->c[11][j] - pk->c[5][j];
+
+    cdx = pk->c[9][j]  - pk->c[6][j];
+    cdy = pk->c[10][j] - pk->c[7][j];
+    cdz = pk->c[11][j] - pk->c[8][j];
+
+    v1  = acy*adz - acz*ady;
+    v2  = acz*adx - acx*adz;
+    v3  = acx*ady - acy*adx;
+    vol = abx * v1 + aby * v2 + abz * v3;
+
+    det = m0 * ( m3*m5 - m4*m4) - m1 * ( m1*m5 - m2*m4) + m2 * ( m1*m4 - m2*m3);
+
+    /* edge lengths */
+    h1 = m0*abx*abx + m3*aby*aby + m5*abz*abz
+      + 2.0*(m1*abx*aby + m2*abx*abz + m4*aby*abz);
+    h2 = m0*acx*acx + m3*acy*acy + m5*acz*acz
+      + 2.0*(m1*acx*acy + m2*acx*acz + m4*acy*acz);
+    h3 = m0*adx*adx + m3*ady*ady + m5*adz*adz
+      + 2.0*(m1*adx*ady + m2*adx*adz + m4*ady*adz);
+    h4 = m0*bcx*bcx + m3*bcy*bcy + m5*bcz*bcz
+      + 2.0*(m1*bcx*bcy + m2*bcx*bcz + m4*bcy*bcz);
+    h5 = m0*bdx*bdx + m3*bdy*bdy + m5*bdz*bdz
+      + 2.0*(m1*bdx*bdy + m2*bdx*bdz + m4*bdy*bdz);
+    h6 = m0*cdx*cdx + m3*cdy*cdy + m5*cdz*cdz
+      + 2.0*(m1*cdx*cdy + m2*cdx*cdz + m4*cdy*cdz);
+
+    /* quality */
+    rap = h1 + h2 + h3 + h4 + h5 + h6;
+    num = sqrt(rap) * rap;
+
+    qual[j] = ( sqrt(det) * vol ) / num;
+    qual[j] = ( vol <= 0. || det < _MMG5_EPSD2 ) ? 0.0 : qual[j];
+  }
+}
+
+/**
+ * \param pk pointer toward the edges of the tetra.
+ * \param len lengths of the 6 edges.
+ *
+ * Lengths of the 6 edges of a tetra with respect to the anisotropic metrics at
+ * their extremities: same computation as \ref _MMG5_lenedgCoor_ani, performed
+ * on the 6 edges at once.
+ *
+ */
+_MMG5_SIMD_KERNEL
+void _MMG3D_lenedgPack_ani(_MMG3D_EdgPack *pk,double *len) {
+  _MMG5_SIMD_NOCONTRACT
+  double ux,uy,uz,dd1,dd2,ll;
+  int    ia;
+
+#ifdef USE_OPENMP
+#pragma omp simd private(ux,uy,uz,dd1,dd2,ll)
+#endif
+  for ( ia=0; ia<6; ia++ ) {
+    ux = pk->b[0][ia] - pk->a[0][ia];
+    uy = pk->b[1][ia] - pk->a[1][ia];
+    uz = pk->b[2][ia] - pk->a[2][ia];
+
+    dd1 =      pk->ma[0][ia]*ux*ux + pk->ma[3][ia]*uy*uy + pk->ma[5][ia]*uz*uz
+      + 2.0*(pk->ma[1][ia]*ux*uy + pk->ma[2][ia]*ux*uz + pk->ma[4][ia]*uy*uz);
+    dd1 = ( dd1 <= 0.0 ) ? 0.0 : dd1;
+
+    dd2 =      pk->mb[0][ia]*ux*ux + pk->mb[3][ia]*uy*uy + pk->mb[5][ia]*uz*uz
+      + 2.0*(pk->mb[1][ia]*ux*uy + pk->mb[2][ia]*ux*uz + pk->mb[4][ia]*uy*uz);
+    dd2 = ( dd2 <= 0.0 ) ? 0.0 : dd2;
+
+    /* approximated length (3.5e-3 accuracy) */
+    ll      = sqrt(0.5*(dd1+dd2));
+    len[ia] = ( fabs(dd1-dd2) < 0.05 ) ? ll :
+      (sqrt(dd1)+sqrt(dd2)+4.0*ll) / 6.0;
+  }
+}
+
+/**
+ * \param pk pointer toward the pack of tetra.
+ * \param typ quality function (\ref _MMG3D_QUALISO, \ref _MMG3D_QUALANI or
+ * \ref _MMG3D_QUALANI33).
+ * \param qual qualities of the tetra of the pack.
+ * \return the worst quality of the pack (1 for an empty pack).
+ *
+ * Compute the qualities of the tetra of the pack and empty it.
+ *
+ */
+double _MMG3D_caltetPack(_MMG3D_QualPack *pk,int typ,double *qual) {
+  double calmin;
+  int    j;
+
+  if ( typ == _MMG3D_QUALISO )
+    _MMG3D_caltetPack_iso(pk,qual);
+  else
+    _MMG3D_caltetPack_ani(pk,qual);
+
+  calmin = 1.0;
+  for ( j=0; j<pk->n; j++ )
+    calmin = MG_MIN(calmin,qual[j]);
+  pk->n = 0;
+
+  return(calmin);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param typ quality function (\ref _MMG3D_QUALISO, \ref _MMG3D_QUALANI or
+ * \ref _MMG3D_QUALANI33).
+ * \param minqual worst quality.
+ * \return the index of the worst tetra (the first one in case of equality).
+ *
+ * Compute the quality of the tetras over the mesh by packs of
+ * \ref _MMG3D_QPACK tetra, in parallel.
+ *
+ */
+static int _MMG3D_packQual(MMG5_pMesh mesh,MMG5_pSol met,int typ,
+                           double *minqual) {
+  int k,iel;
+
+  iel = 0;
+  *minqual = 2./_MMG3D_ALPHAD;
+
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(_MMG5_NTHREADS(mesh))
+#endif
+  {
+    _MMG3D_QualPack pk;
+    MMG5_pTetra     pt;
+    double          qual[_MMG3D_QPACK],qmin;
+    int             idx[_MMG3D_QPACK],kk,kmin,j,n;
+
+    pk.n = 0;
+    qmin = 2./_MMG3D_ALPHAD;
+    kmin = 0;
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for ( k=1; k<=mesh->ne; k+=_MMG3D_QPACK ) {
+      for ( kk=k; kk<k+_MMG3D_QPACK && kk<=mesh->ne; kk++ ) {
+        pt = &mesh->tetra[kk];
+        if ( !MG_EOK(pt) )  continue;
+        idx[pk.n] = kk;
+        _MMG3D_packTetra(mesh,met,&pk,pt,typ);
+      }
+      if ( !pk.n )  continue;
+
+      n = pk.n;
+      _MMG3D_caltetPack(&pk,typ,qual);
+      for ( j=0; j<n; j++ ) {
+        mesh->tetra[idx[j]].qual = qual[j];
+        if ( qual[j] < qmin ) {
+          qmin = qual[j];
+          kmin = idx[j];
+        }
+      }
+    }
+
+#ifdef USE_OPENMP
+#pragma omp critical
+#endif
+    {
+      if ( kmin && ( qmin < *minqual || ( qmin == *minqual && (!iel || kmin < iel) ) ) ) {
+        *minqual = qmin;
+        iel      = kmin;
+      }
+    }
+  }
+  return(iel);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ridge 1 to skip the tetra with 4 ridge vertices.
+ * \param chkvol 1 to check the orientation of the tetra.
+ * \param st statistics of the qualities.
+ *
+ * Compute the statistics of the qualities of the tetras in parallel. The worst
+ * tetra is the first one in case of equality, as in a serial loop.
+ *
+ * \remark The sum of the qualities is reduced over the threads, so the average
+ * may change in its last digits with the number of threads (and the order in
+ * which the threads end).
+ *
+ */
+static void _MMG3D_qualStats(MMG5_pMesh mesh,char ridge,char chkvol,
+                             _MMG3D_QualStats *st) {
+  int k,kmin,nok;
+
+  memset(st,0,sizeof(_MMG3D_QualStats));
+  st->rapmin = 2.0;
+  kmin       = 0;
+
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(_MMG5_NTHREADS(mesh))
+#endif
+  {
+    MMG5_pTetra pt;
+    MMG5_pPoint ppt;
+    double      rap,rapmin,rapmax,rapavg,med,good;
+    int         i,n,ir,kloc,nex,nrid,his[5];
+    char        neg,bad;
+
+    rapmin = 2.0;
+    rapmax = rapavg = med = good = 0.0;
+    kloc   = nex = nrid = 0;
+    neg    = bad = 0;
+    for (i=0; i<5; i++)  his[i] = 0;
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (k=1; k<=mesh->ne; k++) {
+      pt = &mesh->tetra[k];
+      if( !MG_EOK(pt) ) {
+        nex++;
+        continue;
+      }
+      if ( chkvol && !neg && (_MMG5_orvol(mesh->point,pt->v) < 0.0) )  neg = 1;
+
+      if ( ridge ) {
+        n = 0;
+        for(i=0 ; i<4 ; i++) {
+          ppt = &mesh->point[pt->v[i]];
+          if(!(MG_SIN(ppt->tag) || MG_NOM & ppt->tag) && (ppt->tag & MG_GEO)) continue;
+          n++;
+        }
+        if(!n) {
+          nrid++;
+          continue;
+        }
+      }
+      rap = _MMG3D_ALPHAD * pt->qual;
+      if ( rap < rapmin ) {
+        rapmin = rap;
+        kloc   = k;
+      }
+      if ( rap > 0.5 )  med++;
+      if ( rap > 0.12 ) good++;
+      if ( rap < _MMG3D_BADKAL )  bad = 1;
+      rapavg += rap;
+      rapmax  = MG_MAX(rapmax,rap);
+      ir = MG_MIN(4,(int)(5.0*rap));
+      his[ir] += 1;
+    }
+
+#ifdef USE_OPENMP
+#pragma omp critical
+#endif
+    {
+      if ( kloc && ( rapmin < st->rapmin || (rapmin == st->rapmin && kloc < kmin) ) ) {
+        st->rapmin = rapmin;
+        kmin       = kloc;
+      }
+      st->rapmax  = MG_MAX(st->rapmax,rapmax);
+      st->rapavg += rapavg;
+      st->med    += med;
+      st->good   += good;
+      for (i=0; i<5; i++)  st->his[i] += his[i];
+      st->nex    += nex;
+      st->nrid   += nrid;
+      st->neg    |= neg;
+      st->bad    |= bad;
+    }
+  }
+
+  /* position of the worst tetra among the used ones */
+  nok = 0;
+  if ( kmin ) {
+#ifdef USE_OPENMP
+#pragma omp parallel for reduction(+:nok) num_threads(_MMG5_NTHREADS(mesh))
+#endif
+    for (k=1; k<=kmin; k++)
+      if ( MG_EOK(&mesh->tetra[k]) )  nok++;
+  }
+  st->iel = nok;
+}
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -48,7 +446,15 @@ extern char ddb;
 int _MMG3D_tetraQual(MMG5_pMesh mesh, MMG5_pSol met,char metRidTyp) {
   MMG5_pTetra pt;
   double      minqual;
-  int         k,iel;
+  int         k,iel,typ;
+
+  typ = ( !metRidTyp && met->size == 6 && met->m ) ?
+    _MMG3D_QUALANI33 : _MMG3D_qualType(mesh,met);
+
+  if ( typ != _MMG3D_QUALNONE ) {
+    iel = _MMG3D_packQual(mesh,met,typ,&minqual);
+    return ( _MMG5_minQualCheck(iel,minqual,_MMG3D_ALPHAD) );
+  }
 
   minqual = 2./_MMG3D_ALPHAD;
 
@@ -57,11 +463,7 @@ int _MMG3D_tetraQual(MMG5_pMesh mesh, MMG5_pSol met,char metRidTyp) {
     pt = &mesh->tetra[k];
      if( !MG_EOK(pt) )   continue;
 
-     if ( !metRidTyp && met->size == 6 && met->m ) {
-       pt->qual = _MMG5_caltet33_ani(mesh,met,pt);
-     }
-     else
-       pt->qual = _MMG5_orcal(mesh,met,k);
+     pt->qual = _MMG5_orcal(mesh,met,k);
 
     if ( pt->qual < minqual ) {
       minqual = pt->qual;
@@ -190,9 +592,9 @@ int _MMG3D_prilen(MMG5_pMesh mesh, MMG5_pSol met, char metRidTyp) {
   MMG5_pTetra     pt;
   MMG5_pPoint     ppt;
   _MMG5_Hash      hash;
-  double          len,avlen,lmin,lmax;
-  int             k,np,nq,amin,bmin,amax,bmax,ned,hl[9],nullEdge,n;
-  char            ia,i0,i1,ier,i;
+  double          len,avlen,lmin,lmax,lent[6];
+  int             k,np,nq,amin,bmin,amax,bmax,ned,hl[9],nullEdge,n,msk;
+  char            ia,i0,i1,i;
   static double   bd[9]= {0.0, 0.3, 0.6, 0.7071, 0.9, 1.3, 1.4142, 2.0, 5.0};
 
   memset(hl,0,9*sizeof(int));
@@ -237,20 +639,25 @@ int _MMG3D_prilen(MMG5_pMesh mesh, MMG5_pSol met, char metRidTyp) {
     if(!n) {
       continue;
     }
+    /* Remove edges from hash ; bit ia of msk = 1 if edge ia has been found */
+    msk = 0;
+    for(ia=0; ia<6; ia++) {
+      np = pt->v[_MMG5_iare[ia][0]];
+      nq = pt->v[_MMG5_iare[ia][1]];
+      if ( _MMG5_hashPop(&hash,np,nq) )  msk |= (1<<ia);
+    }
+    if ( !msk ) continue;
+
+    _MMG3D_lenedgTet(mesh,met,pt,msk,metRidTyp,lent,NULL,NULL);
+
     for(ia=0; ia<6; ia++) {
       i0 = _MMG5_iare[ia][0];
       i1 = _MMG5_iare[ia][1];
       np = pt->v[i0];
       nq = pt->v[i1];
 
-      /* Remove edge from hash ; ier = 1 if edge has been found */
-      ier = _MMG5_hashPop(&hash,np,nq);
-      if( ier ) {
-        if ( (!metRidTyp) && met->size==6 && met->m ) {
-          len = _MMG5_lenedg33_ani(mesh,met,ia,pt);
-        }
-        else
-          len = _MMG5_lenedg(mesh,met,ia,pt);
+      if( msk & (1<<ia) ) {
+        len = lent[ia];
 
 
         if ( !len ) {
@@ -305,7 +712,7 @@ static int _MMG3D_printquaLES(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTetra    pt;
   double         rap,rapmin,rapmax,rapavg,med,good;
   int            k,iel,ok,nex,his[5];
-  static char    mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char    mmgWarn0=0;
 
   /*compute tet quality*/
   for (k=1; k<=mesh->ne; k++) {
@@ -404,61 +811,45 @@ static int _MMG3D_printquaLES(MMG5_pMesh mesh,MMG5_pSol met) {
  */
 int _MMG3D_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTetra pt;
-  double      rap,rapmin,rapmax,rapavg,med,good;
-  int         i,k,iel,ok,ir,imax,nex,his[5];
-  static char mmgWarn0 = 0;
+  _MMG3D_QualStats st;
+  double      rapmin,rapmax,rapavg,med,good,minqual;
+  int         i,k,iel,imax,nex,typ,*his;
+  static MMG5_THREAD_LOCAL char mmgWarn0 = 0;
 
   if( mesh->info.optimLES ) return(_MMG3D_printquaLES(mesh,met));
 
   /*compute tet quality*/
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-     if( !MG_EOK(pt) )   continue;
-
-     if ( met->m ) {
-       if ( met->size == 6) {
-         pt->qual = _MMG5_caltet33_ani(mesh,met,pt);
-       }
-       else
-         pt->qual = _MMG5_orcal(mesh,met,k);
-     }
-     else // -A option
-       pt->qual = _MMG5_caltet_iso(mesh,met,pt);
+  if ( met->m )
+    typ = ( met->size == 6 ) ? _MMG3D_QUALANI33 : _MMG3D_qualType(mesh,met);
+  else // -A option
+    typ = _MMG3D_QUALISO;
+
+  if ( typ != _MMG3D_QUALNONE )
+    _MMG3D_packQual(mesh,met,typ,&minqual);
+  else {
+    for (k=1; k<=mesh->ne; k++) {
+      pt = &mesh->tetra[k];
+      if( !MG_EOK(pt) )   continue;
+      pt->qual = _MMG5_orcal(mesh,met,k);
+    }
   }
   if ( abs(mesh->info.imprim) <= 0 ) return(1);
 
-  rapmin  = 2.0;
-  rapmax  = 0.0;
-  rapavg  = med = good = 0.0;
-  iel     = 0;
-
-  for (k=0; k<5; k++)  his[k] = 0;
-
-  nex = ok = 0;
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) ) {
-      nex++;
-      continue;
-    }
-    ok++;
-    if ( (!mmgWarn0) && (_MMG5_orvol(mesh->point,pt->v) < 0.0) ) {
-      mmgWarn0 = 1;
-      fprintf(stderr,"  ## Warning: %s: at least 1 negative volume\n",__func__);
-    }
-    rap = _MMG3D_ALPHAD * pt->qual;
-    if ( rap < rapmin ) {
-      rapmin = rap;
-      iel    = ok;
-    }
-    if ( rap > 0.5 )  med++;
-    if ( rap > 0.12 ) good++;
-    if ( rap < _MMG3D_BADKAL )  mesh->info.badkal = 1;
-    rapavg += rap;
-    rapmax  = MG_MAX(rapmax,rap);
-    ir = MG_MIN(4,(int)(5.0*rap));
-    his[ir] += 1;
+  _MMG3D_qualStats(mesh,0,!mmgWarn0,&st);
+  if ( st.neg ) {
+    mmgWarn0 = 1;
+    fprintf(stderr,"  ## Warning: %s: at least 1 negative volume\n",__func__);
   }
+  if ( st.bad )  mesh->info.badkal = 1;
+
+  rapmin = st.rapmin;
+  rapmax = st.rapmax;
+  rapavg = st.rapavg;
+  med    = st.med;
+  good   = st.good;
+  iel    = st.iel;
+  nex    = st.nex;
+  his    = st.his;
 
   fprintf(stdout,"\n  -- MESH QUALITY");
   fprintf(stdout,"  %d\n",mesh->ne - nex);
@@ -501,65 +892,44 @@ int _MMG3D_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
  */
 int _MMG3D_outqua(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTetra pt;
-  MMG5_pPoint ppt;
-  double      rap,rapmin,rapmax,rapavg,med,good;
-  int         i,k,iel,ok,ir,imax,nex,his[5],n,nrid;
-  static char mmgWarn0 = 0;
+  _MMG3D_QualStats st;
+  double      rapmin,rapmax,rapavg,med,good,minqual;
+  int         i,k,iel,imax,nex,nrid,typ,*his;
+  static MMG5_THREAD_LOCAL char mmgWarn0 = 0;
 
   if( mesh->info.optimLES ) return(_MMG3D_printquaLES(mesh,met));
 
   /*compute tet quality*/
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) )   continue;
-    pt->qual = _MMG5_orcal(mesh,met,k);
+  typ = _MMG3D_qualType(mesh,met);
+  if ( typ != _MMG3D_QUALNONE )
+    _MMG3D_packQual(mesh,met,typ,&minqual);
+  else {
+    for (k=1; k<=mesh->ne; k++) {
+      pt = &mesh->tetra[k];
+      if( !MG_EOK(pt) )   continue;
+      pt->qual = _MMG5_orcal(mesh,met,k);
+    }
   }
 
   if ( abs(mesh->info.imprim) <= 0 ) return(1);
 
-  rapmin  = 2.0;
-  rapmax  = 0.0;
-  rapavg  = med = good = 0.0;
-  iel     = 0;
-
-  for (k=0; k<5; k++)  his[k] = 0;
-
-  nex = ok = nrid = 0;
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) ) {
-      nex++;
-      continue;
-    }
-    ok++;
-    if ( (!mmgWarn0) && (_MMG5_orvol(mesh->point,pt->v) < 0.0) ) {
-      mmgWarn0 = 1;
-      fprintf(stderr,"  ## Warning: %s: at least 1 negative volume.\n",
-              __func__);
-    }
-    n = 0;
-    for(i=0 ; i<4 ; i++) {
-      ppt = &mesh->point[pt->v[i]];
-      if(!(MG_SIN(ppt->tag) || MG_NOM & ppt->tag) && (ppt->tag & MG_GEO)) continue;
-      n++;
-    }
-    if(!n) {
-      nrid++;
-      continue;
-    }
-    rap = _MMG3D_ALPHAD * pt->qual;
-    if ( rap < rapmin ) {
-      rapmin = rap;
-      iel    = ok;
-    }
-    if ( rap > 0.5 )  med++;
-    if ( rap > 0.12 ) good++;
-    if ( rap < _MMG3D_BADKAL )  mesh->info.badkal = 1;
-    rapavg += rap;
-    rapmax  = MG_MAX(rapmax,rap);
-    ir = MG_MIN(4,(int)(5.0*rap));
-    his[ir] += 1;
+  _MMG3D_qualStats(mesh,1,!mmgWarn0,&st);
+  if ( st.neg ) {
+    mmgWarn0 = 1;
+    fprintf(stderr,"  ## Warning: %s: at least 1 negative volume.\n",
+            __func__);
   }
+  if ( st.bad )  mesh->info.badkal = 1;
+
+  rapmin = st.rapmin;
+  rapmax = st.rapmax;
+  rapavg = st.rapavg;
+  med    = st.med;
+  good   = st.good;
+  iel    = st.iel;
+  nex    = st.nex;
+  nrid   = st.nrid;
+  his    = st.his;
 
   fprintf(stdout,"\n  -- MESH QUALITY");
   fprintf(stdout,"  %d\n",mesh->ne - nex);
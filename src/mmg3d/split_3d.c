@@ -35,7 +35,6 @@
 
 #include "inlined_functions_3d.h"
 
-extern char  ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -122,6 +121,8 @@ int _MMG5_split1(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
   unsigned char       tau[4];
   const unsigned char *taued;
 
+  _MMG5_STAT_START(t0);
+
   /* create a new tetra */
   pt  = &mesh->tetra[k];
   iel = _MMG3D_newElt(mesh);
@@ -239,7 +240,7 @@ nextstep1:
     pt->qual=_MMG5_orcal(mesh,met,k);
     pt1->qual=_MMG5_orcal(mesh,met,iel);
   }
-  return 1;
+  _MMG5_STAT_RETURN(mesh,MMG5_OperSplit,t0,1);
 }
 /**
  * \param mesh  pointer toward the mesh structure
@@ -509,6 +510,8 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
   char                 ie,tau[4],isxt,isxt1,i,voy;
   const unsigned char *taued;
 
+  _MMG5_STAT_START(t0);
+
   ilist = ret / 2;
   open  = ret % 2;
 
@@ -596,7 +599,7 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
         len = _MMG5_lenedgspl(mesh,met,taued[5],pt0);
       if ( len < lmin )  break;
     }
-    if ( j < ilist )  return(0);
+    if ( j < ilist )  _MMG5_STAT_RETURN(mesh,MMG5_OperSplit,t0,0);
   }
 
   _MMG5_SAFE_CALLOC(newtet,ilist,int,-1);
@@ -640,7 +643,7 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
                           _MMG5_INCREASE_MEM_MESSAGE();
                           k--;
                           for ( ; k>=0 ; --k ) {
-                            if ( !_MMG3D_delElt(mesh,abs(newtet[k])) ) return -1;
+                            if ( !_MMG3D_delElt(mesh,abs(newtet[k])) ) _MMG5_STAT_RETURN(mesh,MMG5_OperSplit,t0,-1);
                           }
                           return(-1),-1);
       pt  = &mesh->tetra[iel];
@@ -783,12 +786,12 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
       pt->qual=_MMG5_orcal(mesh,met,iel);
       pt1->qual=_MMG5_orcal(mesh,met,jel);
     }
-    pt->mark  = mesh->mark;
-    pt1->mark = mesh->mark;
+    _MMG3D_MARK(mesh,iel);
+    _MMG3D_MARK(mesh,jel);
 
 
     _MMG5_SAFE_FREE(newtet);
-    return(1);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperSplit,t0,1);
   }
 
   /* General case : update each element of the shell */
@@ -1082,12 +1085,12 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
       pt->qual=_MMG5_orcal(mesh,met,iel);
       pt1->qual=_MMG5_orcal(mesh,met,jel);
     }
-    pt->mark  = mesh->mark;
-    pt1->mark = mesh->mark;
+    _MMG3D_MARK(mesh,iel);
+    _MMG3D_MARK(mesh,jel);
   }
 
   _MMG5_SAFE_FREE(newtet);
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperSplit,t0,1);
 }
 
 /**
@@ -3330,6 +3333,7 @@ int _MMG5_split4bar(MMG5_pMesh mesh, MMG5_pSol met, int k,char metRidTyp) {
     else
       _MMG5_interp4bar(mesh,met,k,ib,cb);
   }
+  if ( mesh->field )  _MMG3D_intfield4bar(mesh,k,ib,cb);
 
   /* create 3 new tetras */
   iel = _MMG3D_newElt(mesh);
@@ -5268,6 +5272,7 @@ int _MMG5_splitedg(MMG5_pMesh mesh, MMG5_pSol met,int iel, int iar, double crit)
     _MMG3D_delPt(mesh,ip);
     return(0);
   }
+  if ( mesh->field )  _MMG3D_intfield(mesh,iel,iar,ip,0.5);
 
   ier = _MMG3D_simbulgept(mesh,met,list,lon,ip);
   if (!ier) return(0);
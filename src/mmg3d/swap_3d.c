@@ -34,7 +34,6 @@
 
 #include "inlined_functions_3d.h"
 
-extern char ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -490,6 +489,7 @@ int _MMG5_swpbdy(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ret,int it1,
       if ( _MMG5_intmet(mesh,met,iel,ia,nm,0.5)<=0 )  return(0);
     }
   }
+  if ( mesh->field )  _MMG3D_intfield(mesh,iel,ia,nm,0.5);
 
   ier = _MMG5_split1b(mesh,met,list,ret,nm,0,typchk-1,0);
   /* pointer adress may change if we need to realloc memory during split */
@@ -54,7 +54,37 @@
  */
 int _MMG5_chkswpgen(MMG5_pMesh mesh,MMG5_pSol met,int start,int ia,
                     int *ilist,int *list,double crit,char typchk) {
-  MMG5_pTetra    pt,pt0;
+
+  return(_MMG3D_chkswpgenTet(mesh,met,start,ia,ilist,list,crit,typchk,
+                             &mesh->tetra[0],_MMG5_caltet));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure
+ * \param met pointer toward the metric structure.
+ * \param start tetrahedra in which the swap should be performed
+ * \param ia edge that we want to swap
+ * \param ilist pointer to store the size of the shell of the edge
+ * \param list pointer to store the shell of the edge
+ * \param crit improvment coefficient
+ * \param typchk type of checking permformed for edge length (hmin or LSHORT
+ * criterion).
+ * \param pt0 work tetra used to store the tested configurations.
+ * \param caltet function computing the quality of a tetra.
+ * \return 0 if fail, the index of point corresponding to the swapped
+ * configuration otherwise (\f$4*k+i\f$).
+ *
+ * Same as \ref _MMG5_chkswpgen but the work tetra and the quality function
+ * are given by the caller: the mesh is only read so the function can be
+ * called concurrently with one work tetra per thread (\ref _MMG5_caltet is
+ * local to each thread).
+ *
+ */
+int _MMG3D_chkswpgenTet(MMG5_pMesh mesh,MMG5_pSol met,int start,int ia,
+                        int *ilist,int *list,double crit,char typchk,
+                        MMG5_pTetra pt0,
+                        double (*caltet)(MMG5_pMesh,MMG5_pSol,MMG5_pTetra)) {
+  MMG5_pTetra    pt;
   MMG5_pPoint    p0;
   double         calold,calnew,caltmp;
   int            na,nb,np,adj,piv,npol,refdom,k,l,iel;
@@ -64,7 +94,6 @@ int _MMG5_chkswpgen(MMG5_pMesh mesh,MMG5_pSol met,int start,int ia,
   pt  = &mesh->tetra[start];
   refdom = pt->ref;
 
-  pt0 = &mesh->tetra[0];
   na  = pt->v[_MMG5_iare[ia][0]];
   nb  = pt->v[_MMG5_iare[ia][1]];
   calold = pt->qual;
@@ -205,7 +234,7 @@ int _MMG5_chkswpgen(MMG5_pMesh mesh,MMG5_pSol met,int start,int ia,
       if ( typchk==1 && met->size > 1 && met->m )
         caltmp = _MMG5_caltet33_ani(mesh,met,pt0);
       else
-        caltmp = _MMG5_orcal(mesh,met,0);
+        caltmp = caltet(mesh,met,pt0);
 
       calnew = MG_MIN(calnew,caltmp);
 
@@ -219,7 +248,7 @@ int _MMG5_chkswpgen(MMG5_pMesh mesh,MMG5_pSol met,int start,int ia,
       if ( typchk==1 && met->size > 1 && met->m )
         caltmp = _MMG5_caltet33_ani(mesh,met,pt0);
       else
-        caltmp = _MMG5_orcal(mesh,met,0);
+        caltmp = caltet(mesh,met,pt0);
 
       calnew = MG_MIN(calnew,caltmp);
 
@@ -256,6 +285,8 @@ int _MMG5_swpgen(MMG5_pMesh mesh,MMG5_pSol met,int nconf,int ilist,int *list,
   char      ia,ip,iq;
   int       ier;
 
+  _MMG5_STAT_START(t0);
+
   iel = list[0] / 6;
   ia  = list[0] % 6;
 
@@ -281,12 +312,13 @@ int _MMG5_swpgen(MMG5_pMesh mesh,MMG5_pSol met,int nconf,int ilist,int *list,
   }
   if ( met->m ) {
     if ( typchk == 1 && (met->size>1) ) {
-      if ( _MMG3D_intmet33_ani(mesh,met,iel,ia,np,0.5)<=0 )  return(0);
+      if ( _MMG3D_intmet33_ani(mesh,met,iel,ia,np,0.5)<=0 )  _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,0);
     }
     else {
-      if ( _MMG5_intmet(mesh,met,iel,ia,np,0.5)<=0 ) return(0);
+      if ( _MMG5_intmet(mesh,met,iel,ia,np,0.5)<=0 ) _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,0);
     }
   }
+  if ( mesh->field )  _MMG3D_intfield(mesh,iel,ia,np,0.5);
 
   /** First step : split of edge (na,nb) */
   ret = 2*ilist + 0;
@@ -297,11 +329,11 @@ int _MMG5_swpgen(MMG5_pMesh mesh,MMG5_pSol met,int nconf,int ilist,int *list,
   if ( ier < 0 ) {
     fprintf(stderr,"\n  ## Warning: %s: unable to swap internal edge.\n",
       __func__);
-    return(-1);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,-1);
   }
   else if ( !ier )  {
     _MMG3D_delPt(mesh,np);
-    return(0);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,0);
   }
 
   /** Second step : collapse of np towards enhancing configuration */
@@ -321,11 +353,11 @@ int _MMG5_swpgen(MMG5_pMesh mesh,MMG5_pSol met,int nconf,int ilist,int *list,
   if ( ier < 0 ) {
     fprintf(stderr,"\n  ## Warning: %s: unable to swap internal edge.\n",
       __func__);
-    return(-1);
+    _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,-1);
   }
   else if ( ier ) _MMG3D_delPt(mesh,ier);
 
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,1);
 }
 
 /**
@@ -800,9 +832,9 @@ int MMG3D_swap23(MMG5_pMesh mesh,MMG5_pSol met,int k,char metRidTyp) {
       pt1->qual   = _MMG5_orcal(mesh,met,k1);
       ptnew->qual = _MMG5_orcal(mesh,met,iel);
     }
-    pt0->mark   = mesh->mark;
-    pt1->mark   = mesh->mark;
-    ptnew->mark = mesh->mark;
+    _MMG3D_MARK(mesh,k);
+    _MMG3D_MARK(mesh,k1);
+    _MMG3D_MARK(mesh,iel);
 
     return 1;
   }
@@ -35,7 +35,6 @@
 
 #include "mmg3d.h"
 
-extern char ddb;
 
 /** naive (increasing) sorting algorithm, for very small tabs ; permutation is stored in perm */
 inline void _MMG5_nsort(int n,double *val,char *perm){
@@ -997,7 +996,7 @@ int _MMG3D_localParamNm(MMG5_pMesh mesh,int iel,int iface,int ia,
   double       hausd, hmin, hmax;
   int          l,k,isloc,ifac1,ifac2;
   int          listv[MMG3D_LMAX+2],ilistv;
-  static char  mmgWarn0;
+  static MMG5_THREAD_LOCAL char  mmgWarn0;
 
 
   hausd = mesh->info.hausd;
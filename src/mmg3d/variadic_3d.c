@@ -451,6 +451,12 @@ int _MMG3D_Free_structures_var(va_list argptr)
   if ( (*mesh)->xprism )
     _MMG5_DEL_MEM((*mesh),(*mesh)->xprism,((*mesh)->xpr+1)*sizeof(MMG5_xPrism));
 
+  if ( (*mesh)->field )
+    _MMG5_DEL_MEM((*mesh),(*mesh)->field,((*mesh)->fsize*((*mesh)->npmax+1))*sizeof(double));
+
+  _MMG3D_freeSource(*mesh);
+  _MMG5_freeMetFac(*mesh);
+
   /* disp */
   if ( disp && (*disp) && (*disp)->m )
     _MMG5_DEL_MEM((*mesh),(*disp)->m,((*disp)->size*((*disp)->npmax+1))*sizeof(double));
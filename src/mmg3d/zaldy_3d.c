@@ -100,7 +100,7 @@ int _MMG3D_newElt(MMG5_pMesh mesh) {
   if ( mesh->nenil > mesh->ne )  mesh->ne = mesh->nenil;
   mesh->nenil = mesh->tetra[curiel].v[3];
   mesh->tetra[curiel].v[3] = 0;
-  mesh->tetra[curiel].mark=mesh->mark;
+  _MMG3D_MARK(mesh,curiel);
 
   return(curiel);
 }
@@ -135,6 +135,104 @@ int _MMG3D_delElt(MMG5_pMesh mesh,int iel) {
   return 1;
 }
 
+/**
+ * \param mesh pointer toward the mesh
+ *
+ * \return 1 if success, 0 if fail
+ *
+ * Allocate the active set of the sweeps if the \a actset option is set. The
+ * set is empty but overflowed, so the first sweep visits all the tetra.
+ *
+ */
+int _MMG3D_initActive(MMG5_pMesh mesh) {
+  MMG5_Arena *arena;
+
+  arena = &mesh->arena;
+  if ( !mesh->info.actset || arena->act )  return(1);
+
+  _MMG5_ADD_MEM(mesh,(mesh->nemax+1)*sizeof(int),"active set",return(0));
+  _MMG5_SAFE_MALLOC(arena->act,mesh->nemax+1,int,0);
+  arena->amax = mesh->nemax;
+  arena->nact = 0;
+  arena->aovf = 1;
+
+  return(1);
+}
+
+/**
+ * \param a pointer toward the index of a tetra.
+ * \param b pointer toward the index of a tetra.
+ *
+ * \return -1, 0 or 1 if the first index is lower, equal or greater than the
+ * second one.
+ *
+ * Comparison of two tetra indices (for qsort).
+ *
+ */
+static int _MMG3D_eltCompare(const void *a,const void *b) {
+  int ia,ib;
+
+  ia = *(const int*)a;
+  ib = *(const int*)b;
+
+  return ( (ia > ib) - (ia < ib) );
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param mark oldest mark of the tetra to visit.
+ *
+ * \return the number of tetra of the active set, -1 if all the tetra have to
+ * be visited.
+ *
+ * Start a sweep over the tetra whose mark is at least \a mark. The active set
+ * stores the tetra marked since the last sweep (\ref _MMG3D_MARK): the
+ * deleted and the too old tetra as well as the duplicates are removed and the
+ * set is sorted, so the tetra are visited in the order of a full sweep. If
+ * too many tetra have been marked, the set is rebuilt by a scan of the mesh.
+ *
+ */
+int _MMG3D_startSweep(MMG5_pMesh mesh,int mark) {
+  MMG5_Arena  *arena;
+  MMG5_pTetra pt;
+  int         k,l,n,base;
+
+  arena = &mesh->arena;
+  ++mesh->stats.nsweep;
+  if ( !arena->act )  return(-1);
+
+  n = 0;
+  if ( arena->aovf || 4*arena->nact > mesh->ne ) {
+    if ( arena->amax < mesh->ne ) {
+      /* the tetra table has grown */
+      _MMG5_DEL_MEM(mesh,arena->act,(arena->amax+1)*sizeof(int));
+      arena->amax = arena->nact = 0;
+      _MMG5_ADD_MEM(mesh,(mesh->nemax+1)*sizeof(int),"active set",return(-1));
+      _MMG5_SAFE_MALLOC(arena->act,mesh->nemax+1,int,-1);
+      arena->amax = mesh->nemax;
+    }
+    for (k=1; k<=mesh->ne; k++) {
+      pt = &mesh->tetra[k];
+      if ( MG_EOK(pt) && pt->mark >= mark )  arena->act[++n] = k;
+    }
+  }
+  else {
+    base = ++mesh->base;
+    for (l=1; l<=arena->nact; l++) {
+      k  = arena->act[l];
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) || pt->mark < mark || pt->flag == base )  continue;
+      pt->flag = base;
+      arena->act[++n] = k;
+    }
+    qsort(&arena->act[1],n,sizeof(int),_MMG3D_eltCompare);
+  }
+  arena->nact = n;
+  arena->aovf = 0;
+
+  return(n);
+}
+
 /** memory repartition for the -m option */
 int _MMG3D_memOption(MMG5_pMesh mesh) {
   long long  million = 1048576L,memtmp,reservedMem;
@@ -240,6 +338,8 @@ int _MMG3D_memOption(MMG5_pMesh mesh) {
 int _MMG3D_zaldy(MMG5_pMesh mesh) {
   int     k;
 
+  mesh->warm = 0;
+
   if ( !_MMG3D_memOption(mesh) )  return 0;
 
   _MMG5_ADD_MEM(mesh,(mesh->npmax+1)*sizeof(MMG5_Point),"initial vertices",
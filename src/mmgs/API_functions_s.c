@@ -82,6 +82,7 @@ void MMGS_Init_parameters(MMG5_pMesh mesh) {
   _MMG5_Init_parameters(mesh);
 
   mesh->info.renum    = 0;   /* [0/1], Turn off/on the renumbering using SCOTCH; */
+  mesh->info.renumit  = 0;   /* [n]  , Renumbering frequency in the remeshing loop; */
 
 }
 
@@ -1098,11 +1099,20 @@ int MMGS_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam, int val){
     }
 
     break;
-#ifdef USE_SCOTCH
   case MMGS_IPARAM_renum :
     mesh->info.renum    = val;
     break;
-#endif
+  case MMGS_IPARAM_renumit :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: the renumbering frequency must be"
+              " positive.\n",__func__);
+      return(0);
+    }
+    mesh->info.renumit  = val;
+    break;
+  case MMGS_IPARAM_stats :
+    mesh->info.stats    = val;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return(0);
@@ -1148,17 +1158,34 @@ int MMGS_Get_iparameter(MMG5_pMesh mesh, int iparam) {
   case MMGS_IPARAM_numberOfLocalParam :
     return ( mesh->info.npar );
     break;
-#ifdef USE_SCOTCH
   case MMGS_IPARAM_renum :
     return ( mesh->info.renum );
     break;
-#endif
+  case MMGS_IPARAM_renumit :
+    return ( mesh->info.renumit );
+    break;
+  case MMGS_IPARAM_stats :
+    return ( mesh->info.stats );
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return 0;
   }
 }
 
+int MMGS_Get_stats(MMG5_pMesh mesh, MMG5_pStats stats) {
+
+  memcpy(stats,&mesh->stats,sizeof(MMG5_Stats));
+  return(1);
+}
+
+int MMGS_Set_interruptFunc(MMG5_pMesh mesh, MMG5_Interrupt func, void *data) {
+
+  mesh->interruptFunc = func;
+  mesh->interruptData = data;
+  return(1);
+}
+
 int MMGS_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val){
 
   switch ( dparam ) {
@@ -1196,6 +1223,13 @@ int MMGS_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val){
   case MMGS_DPARAM_ls :
     mesh->info.ls       = val;
     break;
+  case MMGS_DPARAM_timeBudget :
+    if ( val < 0. ) {
+      fprintf(stderr,"\n  ## Error: %s: negative time budget.\n",__func__);
+      return(0);
+    }
+    mesh->info.tbudget  = val;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return(0);
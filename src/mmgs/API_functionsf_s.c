@@ -771,3 +771,22 @@ FORTRAN_NAME(MMGS_SAVEALLSOLS,mmgs_saveallsols,
 
   return;
 }
+
+/**
+ * See \ref MMGS_saveStats function in \ref mmgs/libmmgs.h file.
+ */
+FORTRAN_NAME(MMGS_SAVESTATS,mmgs_savestats,
+             (MMG5_pMesh *mesh,char* filename, int *strlen,int* retval),
+             (mesh,filename,strlen, retval)){
+  char *tmp = NULL;
+
+  tmp = (char*)malloc((*strlen+1)*sizeof(char));
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = MMGS_saveStats(*mesh,tmp);
+
+  _MMG5_SAFE_FREE(tmp);
+
+  return;
+}
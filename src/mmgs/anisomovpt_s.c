@@ -54,7 +54,9 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   double         calold,calnew,caltmp;
   int            k,iel,kel,nump,nbeg,nend;
   char           i0,i1,i2,ier;
-  static int     warn=0;
+  static MMG5_THREAD_LOCAL int     warn=0;
+  _MMG5_STAT_START(t0);
+
   step = 0.1;
 
   /* Make sure ball of point is closed */
@@ -75,11 +77,11 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
 
   pt   = &mesh->tria[iel];
   nend = pt->v[i2];
-  if ( nbeg != nend )  return(0);
+  if ( nbeg != nend )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
 
   /** Step 1 : Rotation matrix that sends normal at p0 to e_z */
   n = &(p0->n[0]);
-  if ( !_MMG5_rotmatrix(n,r) )  return(0);
+  if ( !_MMG5_rotmatrix(n,r) )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
 
   /* Apply rotation \circ translation to the whole ball */
   for (k=0; k<ilist; k++) {
@@ -106,10 +108,10 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   /* Check all projections over tangent plane. */
   for (k=0; k<ilist-1; k++) {
     area = lispoi[3*k+1]*lispoi[3*(k+1)+2] - lispoi[3*k+2]*lispoi[3*(k+1)+1];
-    if ( area < 0.0 )  return(0);
+    if ( area < 0.0 )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   area = lispoi[3*(ilist-1)+1]*lispoi[3*0+2] - lispoi[3*(ilist-1)+2]*lispoi[3*0+1];
-  if ( area < 0.0 )  return(0);
+  if ( area < 0.0 )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
 
   /** Step 2 : Compute gradient towards optimal position = centre of mass of the
      ball, projected to tangent plane */
@@ -119,7 +121,7 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   for (k=0; k<ilist; k++) {
     iel = list[k] / 3;
     pt = &mesh->tria[iel];
-    if ( !_MMG5_bezierCP(mesh,pt,&pb,1) )  return(0);
+    if ( !_MMG5_bezierCP(mesh,pt,&pb,1) )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
 
     /* Compute integral of sqrt(T^J(xi)  M(P(xi)) J(xi)) * P(xi) over the triangle */
     if ( !_MMG5_elementWeight(mesh,met,pt,p0,&pb,r,gv) ) {
@@ -128,7 +130,7 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
         fprintf(stderr,"\n  ## Warning: %s: unable to compute optimal position for at least"
                 " 1 point.\n",__func__ );
       }
-      return(0);
+      _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
     }
   }
 
@@ -144,7 +146,7 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
         break;
       }
     }
-    if ( k == ilist )  return(0);
+    if ( k == ilist )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   else {
     for (k=ilist-1; k>=0; k--) {
@@ -154,13 +156,13 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
         break;
       }
     }
-    if ( k == -1 )  return(0);
+    if ( k == -1 )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
 
   /* Sizing of time step : make sure point does not go out corresponding triangle. */
   area = - gv[1]*(lispoi[3*(kel+1)+1] - lispoi[3*(kel)+1]) \
     + gv[0]*(lispoi[3*(kel+1)+2] - lispoi[3*(kel)+2]);
-  if ( fabs(area) < _MMG5_EPSD2 )  return(0);
+  if ( fabs(area) < _MMG5_EPSD2 )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   area = 1.0 / area;
   step *= area;
 
@@ -173,7 +175,7 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
 
   /* Computation of the barycentric coordinates of the new point in the corresponding triangle. */
   area = lispoi[3*kel+1]*lispoi[3*(kel+1)+2] - lispoi[3*kel+2]*lispoi[3*(kel+1)+1];
-  if ( area < _MMG5_EPSD2 )  return(0);
+  if ( area < _MMG5_EPSD2 )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   area = 1.0 / area;
   lambda[1] = lispoi[3*(kel+1)+2]*gv[0] - lispoi[3*(kel+1)+1]*gv[1];
   lambda[2] = -lispoi[3*(kel)+2]*gv[0] + lispoi[3*(kel)+1]*gv[1];
@@ -236,13 +238,13 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
     if ( caltmp < _MMG5_EPSD2 )  {
       /* We don't check the input triangle qualities, thus we may have a very
        * bad triangle in our mesh */
-      return(0);
+      _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
     }
     calnew = MG_MIN(calnew,caltmp);
 
-    if ( calold < _MMG5_EPSOK && calnew <= calold )  return(0);
-    else if (calnew < _MMG5_EPSOK)  return(0);
-    else if ( calnew < 0.3*calold )      return(0);
+    if ( calold < _MMG5_EPSOK && calnew <= calold )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+    else if (calnew < _MMG5_EPSOK)  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+    else if ( calnew < 0.3*calold )      _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
     /* if ( chkedg(mesh,0) )  return(0); */
   }
 
@@ -257,7 +259,7 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
 
   memcpy(m0,&met->m[0],6*sizeof(double));
 
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,1);
 }
 
 /* Compute movement of a ref, or ridge point whose ball is passed */
@@ -271,7 +273,7 @@ int movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   double        psn11,psn12,ps2,l1new,l2new,dd1,dd2,ddt,calold,calnew;
   int           it1,it2,ip0,ip1,ip2,k,iel,ier;
   char          voy1,voy2,isrid,isrid1,isrid2,i0,i1,i2;
-  static char   mmgWarn0 = 0;
+  static MMG5_THREAD_LOCAL char   mmgWarn0 = 0;
 
   step  = 0.2;
   isrid1 = isrid2 = 0;
@@ -191,7 +191,7 @@ static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
   double         r[3][3],lispoi[3*_MMGS_LMAX+1],ux,uy,uz,det,bcu[3];
   double         detg,detd;
   unsigned char  i,i0,i1,i2;
-  static char    mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char    mmgWarn0=0;
 
   pt  = &mesh->tria[it];
   idp = pt->v[ip];
@@ -368,7 +368,7 @@ static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
   double             ux,uy,uz,det2d,intm[3],c[3];
   double             tAA[6],tAb[3],hausd;
   unsigned char      i0,i1,i2;
-  static char        mmgWarn0=0;
+  static MMG5_THREAD_LOCAL char        mmgWarn0=0;
 
   ipref[0] = ipref[1] = 0;
   pt  = &mesh->tria[it];
@@ -727,7 +727,7 @@ int _MMGS_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   double        mm[6];
   int           k;
   char          i,ismet;
-  static char   mmgErr=0;
+  static MMG5_THREAD_LOCAL char   mmgErr=0;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** Defining anisotropic map\n");
@@ -35,7 +35,6 @@
 
 #include "mmgs.h"
 
-extern char ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -51,8 +51,8 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
     int                 adj,adj1,k,kk,l,nk,i,j,ip,lon,len;
     int                 *adja,*adjb,list[_MMGS_LMAX+2];
     char                voy,voy1,i1,i2,j1,j2;
-    static char         mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0;
-    static char         mmgErr5=0,mmgErr6=0,mmgErr7=0;
+    static MMG5_THREAD_LOCAL char         mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0;
+    static MMG5_THREAD_LOCAL char         mmgErr5=0,mmgErr6=0,mmgErr7=0;
 
     for (k=1; k<=mesh->nt; k++) {
         pt1 = &mesh->tria[k];
@@ -235,7 +235,7 @@ int chkeigen(MMG5_pMesh mesh,MMG5_pSol met,int k,double lambda[3]) {
     MMG5_pxPoint   go;
     int            ord;
     double         *m,*n,r[3][3],mr[6],mtan[3],vp[2][2];
-    static char    mmgWarn=0;
+    static MMG5_THREAD_LOCAL char    mmgWarn=0;
 
     p0 = &mesh->point[k];
     assert( MG_VOK(p0) );
@@ -294,7 +294,7 @@ int chkmet(MMG5_pMesh mesh,MMG5_pSol met) {
     double         vp[2][2],lambda[2];
     int            k;
     char           i;
-    static char    mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
+    static MMG5_THREAD_LOCAL char    mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
 
     isqhmin = 1.0 / (mesh->info.hmin*mesh->info.hmin);
     isqhmax = 1.0 / (mesh->info.hmax*mesh->info.hmax);
@@ -407,7 +407,7 @@ int chknor(MMG5_pMesh mesh) {
     double   dd,ps,*n,nt[3];
     int      k;
     char     i;
-    static char mmgWarn0=0, mmgWarn1=0;
+    static MMG5_THREAD_LOCAL char mmgWarn0=0, mmgWarn1=0;
 
     /* First test : check that all normal vectors at points are non 0 */
     for (k=1; k<=mesh->np; k++) {
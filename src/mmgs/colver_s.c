@@ -263,6 +263,8 @@ int colver(MMG5_pMesh mesh,int *list,int ilist) {
   int     *adja,k,iel,jel,kel,ip1,ip2;
   char     i,i1,i2,j,jj,open;
 
+  _MMG5_STAT_START(t0);
+
   iel = list[0] / 3;
   i1  = list[0] % 3;
   i   = _MMG5_iprv2[i1];
@@ -330,12 +332,12 @@ int colver(MMG5_pMesh mesh,int *list,int ilist) {
   }
 
   _MMGS_delPt(mesh,ip1);
-  if ( !_MMGS_delElt(mesh,list[0] / 3) ) return 0;
+  if ( !_MMGS_delElt(mesh,list[0] / 3) ) _MMG5_STAT_RETURN(mesh,MMG5_OperCollapse,t0,0);
   if ( !open ) {
-    if ( !_MMGS_delElt(mesh,list[ilist-1] / 3) )  return 0;
+    if ( !_MMGS_delElt(mesh,list[ilist-1] / 3) )  _MMG5_STAT_RETURN(mesh,MMG5_OperCollapse,t0,0);
   }
 
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperCollapse,t0,1);
 }
 
 
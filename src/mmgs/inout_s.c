@@ -110,6 +110,7 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   int         ncor,bin,iswp,nedreq,posnedreq,bdim,binch,bpos;
   int         na,*ina,a,b,ref;
   char        *ptr,*data,chaine[128];
+  _MMG5_Mmap  mm;
 
 
   posnp = posnt = posne = posncor = posnq = 0;
@@ -119,6 +120,7 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   bin = 0;
   iswp = 0;
   mesh->np = mesh->nt = mesh->nti = mesh->npi = 0;
+  memset(&mm,0,sizeof(_MMG5_Mmap));
 
   _MMG5_SAFE_CALLOC(data,strlen(filename)+7,char,0);
 
@@ -153,57 +155,62 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   _MMG5_SAFE_FREE(data);
 
   if (!bin) {
+    if ( !_MMG5_mmapOpen(&mm,inm) ) {
+      fclose(inm);
+      return(-1);
+    }
     strcpy(chaine,"D");
-    while(fscanf(inm,"%127s",&chaine[0])!=EOF && strncmp(chaine,"End",strlen("End")) ) {
+    while(_MMG5_mmapKeyword(&mm,chaine,128) && strncmp(chaine,"End",strlen("End")) ) {
       if(!strncmp(chaine,"MeshVersionFormatted",strlen("MeshVersionFormatted"))) {
-        fscanf(inm,"%d",&mesh->ver);
+        _MMG5_mmapInt(&mm,&mesh->ver);
         continue;
       } else if(!strncmp(chaine,"Dimension",strlen("Dimension"))) {
-        fscanf(inm,"%d",&mesh->dim);
+        _MMG5_mmapInt(&mm,&mesh->dim);
         if(mesh->dim!=3) {
           fprintf(stderr,"BAD DIMENSION : %d\n",mesh->dim);
+          _MMG5_mmapClose(&mm);
           return(0);
         }
         continue;
       } else if(!strncmp(chaine,"Vertices",strlen("Vertices"))) {
-        fscanf(inm,"%d",&mesh->npi);
-        posnp = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->npi);
+        posnp = mm.pos;
         continue;
       } else if(!strncmp(chaine,"RequiredVertices",strlen("RequiredVertices"))) {
-        fscanf(inm,"%d",&npreq);
-        posnpreq = ftell(inm);
+        _MMG5_mmapInt(&mm,&npreq);
+        posnpreq = mm.pos;
         continue;
       } else if(!strncmp(chaine,"Triangles",strlen("Triangles"))) {
-        fscanf(inm,"%d",&mesh->nti);
-        posnt = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->nti);
+        posnt = mm.pos;
         continue;
       } else if(!strncmp(chaine,"Quadrilaterals",strlen("Quadrilaterals"))) {
-        fscanf(inm,"%d",&nq);
-        posnq = ftell(inm);
+        _MMG5_mmapInt(&mm,&nq);
+        posnq = mm.pos;
         continue;
       } else if(!strncmp(chaine,"Corners",strlen("Corners"))) {
-        fscanf(inm,"%d",&ncor);
-        posncor = ftell(inm);
+        _MMG5_mmapInt(&mm,&ncor);
+        posncor = mm.pos;
         continue;
       } else if(!strncmp(chaine,"Edges",strlen("Edges"))) {
-        fscanf(inm,"%d",&mesh->na);
-        posned = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->na);
+        posned = mm.pos;
         continue;
       } else if(!strncmp(chaine,"RequiredEdges",strlen("RequiredEdges"))) {
-        fscanf(inm,"%d",&nedreq);
-        posnedreq = ftell(inm);
+        _MMG5_mmapInt(&mm,&nedreq);
+        posnedreq = mm.pos;
         continue;
       } else if(!strncmp(chaine,"Ridges",strlen("Ridges"))) {
-        fscanf(inm,"%d",&nri);
-        posnr = ftell(inm);
+        _MMG5_mmapInt(&mm,&nri);
+        posnr = mm.pos;
         continue;
       } else if(!ng && !strncmp(chaine,"Normals",strlen("Normals"))) {
-        fscanf(inm,"%d",&ng);
-        posnormal = ftell(inm);
+        _MMG5_mmapInt(&mm,&ng);
+        posnormal = mm.pos;
         continue;
       } else if(!strncmp(chaine,"NormalAtVertices",strlen("NormalAtVertices"))) {
-        fscanf(inm,"%d",&mesh->nc1);
-        posnc1 = ftell(inm);
+        _MMG5_mmapInt(&mm,&mesh->nc1);
+        posnc1 = mm.pos;
         continue;
       }
     }
@@ -218,6 +225,12 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
     }
     fread(&mesh->ver,sw,1,inm);
     if(iswp) mesh->ver = swapbin(mesh->ver);
+    if ( mesh->ver > 2 ) {
+      fprintf(stderr,"  ** UNSUPPORTED MESH VERSION %d: mmgs only reads the"
+              " versions 1 and 2 of the binary files.\n",mesh->ver);
+      fclose(inm);
+      return(-1);
+    }
     while(fread(&binch,sw,1,inm)!=0 && binch!=54 ) {
       if(iswp) binch=swapbin(binch);
       if(binch==54) break;
@@ -333,13 +346,30 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
 
   if ( !mesh->npi || !mesh->nti ) {
     fprintf(stdout,"  ** MISSING DATA\n");
+    _MMG5_mmapClose(&mm);
     return(0);
   }
   mesh->np = mesh->npi;
   mesh->nt = mesh->nti + 2*nq;
 
   /* mem alloc */
-  if ( !_MMGS_zaldy(mesh) )  return(0);
+  if ( !_MMGS_zaldy(mesh) ) {
+    _MMG5_mmapClose(&mm);
+    return(0);
+  }
+
+  if ( !bin ) {
+    /* Parallel reading of the vertices and triangles of the ASCII file (the
+     * triangles built from the quadrilaterals are read after) */
+    if ( !_MMG5_mmapPoints(&mm,mesh,posnp,3,0) ||
+         !_MMG5_mmapElts(&mm,posnt,mesh->nti,3,(char*)&mesh->tria[1],
+                         sizeof(MMG5_Tria),offsetof(MMG5_Tria,v),
+                         offsetof(MMG5_Tria,ref)) ) {
+      _MMG5_mmapClose(&mm);
+      fclose(inm);
+      return(-1);
+    }
+  }
 
   /* read vertices */
 
@@ -347,33 +377,21 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   fseek(inm,posnp,SEEK_SET);
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
-    if (mesh->ver < 2) { /*float*/
-      if (!bin) {
-        for (i=0 ; i<3 ; i++) {
-          fscanf(inm,"%f",&fc);
-          ppt->c[i] = (double) fc;
-        }
-        fscanf(inm,"%d",&ppt->ref);
-      } else {
+    if ( bin ) {
+      if (mesh->ver < 2) { /*float*/
         for (i=0 ; i<3 ; i++) {
           fread(&fc,sw,1,inm);
           if(iswp) fc=swapf(fc);
           ppt->c[i] = (double) fc;
         }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=swapbin(ppt->ref);
-      }
-    } else {
-      if (!bin)
-        fscanf(inm,"%lf %lf %lf %d",&ppt->c[0],&ppt->c[1],&ppt->c[2],&ppt->ref);
-      else {
+      } else {
         for (i=0 ; i<3 ; i++) {
           fread(&ppt->c[i],sd,1,inm);
           if(iswp) ppt->c[i]=swapd(ppt->c[i]);
         }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=swapbin(ppt->ref);
       }
+      fread(&ppt->ref,sw,1,inm);
+      if(iswp) ppt->ref=swapbin(ppt->ref);
     }
     ppt->tag = MG_NUL;
   }
@@ -383,9 +401,7 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   fseek(inm,posnt,SEEK_SET);
   for (k=1; k<=mesh->nt; k++) {
     pt1 = &mesh->tria[k];
-    if (!bin)
-      fscanf(inm,"%d %d %d %d",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt1->ref);
-    else {
+    if ( bin ) {
       for (i=0 ; i<3 ; i++) {
         fread(&pt1->v[i],sw,1,inm);
         if(iswp) pt1->v[i]=swapbin(pt1->v[i]);
@@ -666,6 +682,7 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
     if ( mesh->na )
       fprintf(stdout,"     NUMBER OF EDGES      %8d  RIDGES %6d\n",mesh->na,nri);
   }
+  _MMG5_mmapClose(&mm);
   fclose(inm);
   return(1);
 }
@@ -1240,6 +1257,7 @@ int MMGS_saveMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *file
 int MMGS_loadSol(MMG5_pMesh mesh,MMG5_pSol met,const char* filename) {
 
   FILE       *inm;
+  _MMG5_Mmap  mm;
   long        posnp;
   int         iswp,ier,dim;
   int         k,ver,bin,np,nsols,*type;
@@ -1279,20 +1297,36 @@ int MMGS_loadSol(MMG5_pMesh mesh,MMG5_pSol met,const char* filename) {
   if ( ver ) met->ver = ver;
 
   /* Read mesh solutions */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
-
-  /* isotropic metric */
-  if ( met->ver == 1 ) {
-    /* Simple precision */
-    for (k=1; k<=mesh->np; k++) {
-      MMG5_readFloatSol3D(met,inm,bin,iswp,k);
+  if ( !bin ) {
+    if ( !_MMG5_mmapOpen(&mm,inm) ) {
+      fclose(inm);
+      _MMG5_SAFE_FREE(type);
+      return(-1);
+    }
+    ier = _MMG5_mmapSol(&mm,met,posnp);
+    _MMG5_mmapClose(&mm);
+    if ( !ier ) {
+      fclose(inm);
+      _MMG5_SAFE_FREE(type);
+      return(-1);
     }
   }
   else {
-    /* Double precision */
-    for (k=1; k<=mesh->np; k++) {
-      MMG5_readDoubleSol3D(met,inm,bin,iswp,k);
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+
+    /* isotropic metric */
+    if ( met->ver == 1 ) {
+      /* Simple precision */
+      for (k=1; k<=mesh->np; k++) {
+        MMG5_readFloatSol3D(met,inm,bin,iswp,k);
+      }
+    }
+    else {
+      /* Double precision */
+      for (k=1; k<=mesh->np; k++) {
+        MMG5_readDoubleSol3D(met,inm,bin,iswp,k);
+      }
     }
   }
 
@@ -1320,7 +1354,7 @@ int MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   int         iswp,ier,dim;
   int         j,k,ver,bin,np,nsols,*type;
   char        data[10];
-  static char mmgWarn = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn = 0;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,3,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -1507,3 +1541,8 @@ int MMGS_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   fclose(inm);
   return(1);
 }
+
+int MMGS_saveStats(MMG5_pMesh mesh, const char *filename) {
+
+  return(_MMG5_saveStats(mesh,filename,"mmgs"));
+}
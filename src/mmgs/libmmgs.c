@@ -270,6 +270,7 @@ int MMGS_mmgsls(MMG5_pMesh mesh,MMG5_pSol met)
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  _MMG5_initStats(mesh);
 
 #ifdef USE_SCOTCH
   _MMG5_warnScotch(mesh);
@@ -392,9 +393,11 @@ int MMGS_mmgsls(MMG5_pMesh mesh,MMG5_pSol met)
 
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
+  _MMG5_statTimes(mesh,ctim);
   if ( mesh->info.imprim )
     fprintf(stdout,"\n   MMGSLS: ELAPSED TIME  %s\n",stim);
-  _LIBMMG5_RETURN(mesh,met,MMG5_SUCCESS);
+  _LIBMMG5_RETURN(mesh,met,
+                  mesh->stats.interrupted ? MMG5_INTERRUPTED : MMG5_SUCCESS);
 }
 
 int MMGS_mmgslib(MMG5_pMesh mesh,MMG5_pSol met)
@@ -422,6 +425,7 @@ int MMGS_mmgslib(MMG5_pMesh mesh,MMG5_pSol met)
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  _MMG5_initStats(mesh);
 
   if ( mesh->info.iso ) {
     fprintf(stderr,"\n  ## ERROR: LEVEL-SET DISCRETISATION UNAVAILABLe"
@@ -550,7 +554,9 @@ int MMGS_mmgslib(MMG5_pMesh mesh,MMG5_pSol met)
 
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
+  _MMG5_statTimes(mesh,ctim);
   if ( mesh->info.imprim )
     fprintf(stdout,"\n   MMGSLIB: ELAPSED TIME  %s\n",stim);
-  _LIBMMG5_RETURN(mesh,met,MMG5_SUCCESS);
+  _LIBMMG5_RETURN(mesh,met,
+                  mesh->stats.interrupted ? MMG5_INTERRUPTED : MMG5_SUCCESS);
 }
@@ -69,7 +69,9 @@ enum MMGS_Param {
   MMGS_IPARAM_nomove,            /*!< [1/0], Avoid/allow point relocation */
   MMGS_IPARAM_nreg,              /*!< [0/1], Disabled/enabled normal regularization */
   MMGS_IPARAM_numberOfLocalParam,/*!< [n], Number of local parameters */
-  MMGS_IPARAM_renum,             /*!< [1/0], Turn on/off point relocation with Scotch */
+  MMGS_IPARAM_renum,             /*!< [1/0], Turn on/off point relocation with Scotch (with a space filling curve if Scotch is not available) */
+  MMGS_IPARAM_renumit,           /*!< [n], Renumber the mesh along a space filling curve every n iterations of the remeshing loop (0: never) */
+  MMGS_IPARAM_stats,             /*!< [1/0], Turn on/off the output of the performance counters of the run */
   MMGS_DPARAM_angleDetection,    /*!< [val], Value for angle detection */
   MMGS_DPARAM_hmin,              /*!< [val], Minimal mesh size */
   MMGS_DPARAM_hmax,              /*!< [val], Maximal mesh size */
@@ -77,6 +79,7 @@ enum MMGS_Param {
   MMGS_DPARAM_hausd,             /*!< [val], Control global Hausdorff distance (on all the boundary surfaces of the mesh) */
   MMGS_DPARAM_hgrad,             /*!< [val], Control gradation */
   MMGS_DPARAM_ls,                /*!< [val], Value of level-set */
+  MMGS_DPARAM_timeBudget,         /*!< [val], Wall clock budget (s) of the remeshing: the remeshing is interrupted once it is exceeded (0: no budget) */
   MMGS_PARAM_size,               /*!< [n], Number of parameters */
 };
 
@@ -968,6 +971,38 @@ int MMGS_Get_tensorSols(MMG5_pSol met, double *sols);
  */
 int MMGS_Get_iparameter(MMG5_pMesh mesh, int iparam);
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param stats pointer toward the structure that receives the counters.
+ * \return 1.
+ *
+ * Get the performance counters of the last library call (phase times, memory
+ * high-water mark and, if the library is built with the USE_STATS option,
+ * calls, successes and time of the local operators).
+ *
+ * \remark No Fortran interface (use the MMGS_saveStats function).
+ *
+ */
+int MMGS_Get_stats(MMG5_pMesh mesh, MMG5_pStats stats);
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param func progress/cancel callback (NULL to remove the callback).
+ * \param data pointer toward the user data given to the callback.
+ * \return 1.
+ *
+ * Set the progress/cancel callback of the remeshing. The callback is called
+ * between the sweeps of the remeshing with \a data and the elapsed time of
+ * the library call and returns a non zero value to interrupt the remeshing.
+ * An interrupted remeshing stops cleanly: the library returns a conform,
+ * packed and partially remeshed mesh with the \ref MMG5_INTERRUPTED value.
+ *
+ * \remark No Fortran interface (use the MMGS_DPARAM_timeBudget parameter to
+ * bound the remeshing time).
+ *
+ */
+int MMGS_Set_interruptFunc(MMG5_pMesh mesh, MMG5_Interrupt func, void *data);
+
 /* input/output functions */
 /**
  * \param mesh pointer toward the mesh structure.
@@ -1136,6 +1171,25 @@ int  MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char* filename);
  *
  */
 int  MMGS_saveSol(MMG5_pMesh mesh, MMG5_pSol met, const char *filename);
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param filename name of the JSON file (if NULL, the name of the output
+ * mesh with the \a .stats.json extension).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Save the performance counters of the last library call in a JSON file.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMGS_SAVESTATS(mesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: mesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int MMGS_saveStats(MMG5_pMesh mesh, const char *filename);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param sol pointer toward the solutions array
@@ -71,7 +71,10 @@ int MMGS_usage(char *prog) {
   fprintf(stdout,"-nreg        normal regul.\n");
 #ifdef USE_SCOTCH
   fprintf(stdout,"-rn [n]      Turn on or off the renumbering using SCOTCH [0/1] \n");
+#else
+  fprintf(stdout,"-rn [n]      Turn on or off the space filling curve renumbering [0/1] \n");
 #endif
+  fprintf(stdout,"-rnit [n]    Renumber along a space filling curve every n iterations of the remeshing loop\n");
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -84,6 +87,8 @@ int MMGS_defaultValues(MMG5_pMesh mesh) {
   fprintf(stdout,"SCOTCH renumbering                  : enabled\n");
 #else
   fprintf(stdout,"SCOTCH renumbering                  : disabled\n");
+  fprintf(stdout,"Space filling curve renumbering (-rn): %s\n",
+          mesh->info.renum ? "enabled" : "disabled");
 #endif
   fprintf(stdout,"\n\n");
 
@@ -247,7 +252,6 @@ int MMGS_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
           return 0;
         }
         break;
-#ifdef USE_SCOTCH
       case 'r':
         if ( !strcmp(argv[i],"-rn") ) {
           if ( ++i < argc ) {
@@ -267,8 +271,18 @@ int MMGS_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
             return 0;
           }
         }
+        else if ( !strcmp(argv[i],"-rnit") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMGS_Set_iparameter(mesh,met,MMGS_IPARAM_renumit,atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MMGS_usage(argv[0]);
+            return 0;
+          }
+        }
         break;
-#endif
       case 's':
         if ( !strcmp(argv[i],"-sol") ) {
           if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
@@ -281,6 +295,22 @@ int MMGS_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
             return 0;
           }
         }
+        else if ( !strcmp(argv[i],"-stats") ) {
+          if ( !MMGS_Set_iparameter(mesh,met,MMGS_IPARAM_stats,1) )
+            return 0;
+        }
+        break;
+      case 't':
+        if ( !strcmp(argv[i],"-tbudget") && ++i < argc ) {
+          if ( !MMGS_Set_dparameter(mesh,met,MMGS_DPARAM_timeBudget,
+                                   atof(argv[i])) )
+            return 0;
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MMGS_usage(argv[0]);
+          return 0;
+        }
         break;
       case 'v':
         if ( ++i < argc ) {
@@ -357,6 +357,9 @@ int main(int argc,char *argv[]) {
     if ( !msh && !MMGS_saveSol(mesh,met,met->nameout) )
       _MMGS_RETURN_AND_FREE(mesh,met,MMG5_STRONGFAILURE);
 
+    if ( mesh->info.stats && !MMGS_saveStats(mesh,NULL) )
+      _MMGS_RETURN_AND_FREE(mesh,met,MMG5_STRONGFAILURE);
+
     chrono(OFF,&MMG5_ctim[1]);
     if ( mesh->info.imprim )  fprintf(stdout,"  -- WRITING COMPLETED\n");
   }
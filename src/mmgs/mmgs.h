@@ -199,12 +199,12 @@ int    movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
 int    movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
 int    _MMGS_prilen(MMG5_pMesh mesh,MMG5_pSol met,int);
 
-double (*_MMG5_calelt)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt);
-int    (*_MMG5_defsiz)(MMG5_pMesh mesh,MMG5_pSol met);
-int    (*gradsiz)(MMG5_pMesh mesh,MMG5_pSol met);
-int    (*intmet)(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s);
-int    (*movridpt)(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
-int    (*movintpt)(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
+/* function pointers (defined in mmgsexterns.c) */
+extern MMG5_THREAD_LOCAL double (*_MMG5_calelt)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt);
+extern MMG5_THREAD_LOCAL int    (*gradsiz)(MMG5_pMesh mesh,MMG5_pSol met);
+extern MMG5_THREAD_LOCAL int    (*intmet)(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s);
+extern MMG5_THREAD_LOCAL int    (*movridpt)(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
+extern MMG5_THREAD_LOCAL int    (*movintpt)(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
 
 /**
  * Set common pointer functions between mmgs and mmg3d to the matching mmgs
@@ -219,6 +219,7 @@ void _MMGS_Set_commonFunc() {
 #ifdef USE_SCOTCH
   _MMG5_renumbering       = _MMG5_mmgsRenumbering;
 #endif
+  _MMG5_sfcRenumbering    = _MMG5_sfcRenumberingTria;
 }
 
 #ifdef __cplusplus
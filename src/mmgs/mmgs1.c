@@ -35,7 +35,6 @@
 #include "mmgs.h"
 
 
-char ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -211,7 +210,7 @@ int chkedg(MMG5_pMesh mesh,int iel) {
   double   ps,ps2,cosn,ux,uy,uz,ll,li,dd,hausd,hmax;
   int      l,isloc;
   char     i,i1,i2;
-  static char mmgWarn0 = 0, mmgWarn1 = 0;
+  static MMG5_THREAD_LOCAL char mmgWarn0 = 0, mmgWarn1 = 0;
 
   pt   = &mesh->tria[iel];
   p[0] = &mesh->point[pt->v[0]];
@@ -395,6 +394,7 @@ static int swpmsh(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   maxit = 2;
   mesh->base++;
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     ns = 0;
     for (k=1; k<=mesh->nt; k++) {
       pt = &mesh->tria[k];
@@ -432,6 +432,7 @@ static int movtri(MMG5_pMesh mesh,MMG5_pSol met,int maxit) {
 
   it = nnm = 0;
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     base++;
     nm = ns = 0;
     for (k=1; k<=mesh->nt; k++) {
@@ -530,7 +531,7 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   int           vx[3],i,j,ip,ip1,ip2,ier,k,ns,nc,ni,ic,nt,it;
   char          i1,i2;
   static double uv[3][2] = { {0.5,0.5}, {0.,0.5}, {0.5,0.} };
-  static char   mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
+  static MMG5_THREAD_LOCAL char   mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
 
   if ( !_MMG5_hashNew(mesh,&hash,mesh->np,3*mesh->np) ) return -1;
   ns = 0;
@@ -1173,6 +1174,7 @@ static int adptri(MMG5_pMesh mesh,MMG5_pSol met) {
   it = nnc = nns = nnf = nnm = 0;
   maxit = 10;
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
     if ( !mesh->info.noinsert ) {
       ns = adpspl(mesh,met);
       if ( ns < 0 ) {
@@ -1184,6 +1186,12 @@ static int adptri(MMG5_pMesh mesh,MMG5_pSol met) {
       if ( it==1 && !_MMG5_scotchCall(mesh,met) )
         return(0);
 
+      /* renumbering along a space filling curve */
+      if ( mesh->info.renumit && it && !(it%mesh->info.renumit) ) {
+        if ( !_MMG5_sfcRenumberingTria(mesh,met) )
+          return(0);
+      }
+
       nc = adpcol(mesh,met);
       if ( nc < 0 ) {
         fprintf(stderr,"\n  ## Unable to complete mesh. Exit program.\n");
@@ -1232,6 +1240,7 @@ static int adptri(MMG5_pMesh mesh,MMG5_pSol met) {
   it  = 0;
   maxit = 2;
   do {
+    if ( _MMG5_interrupt(mesh) )  break;
 
     if ( !mesh->info.nomove ) {
       nm = movtri(mesh,met,5);
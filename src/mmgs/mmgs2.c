@@ -56,7 +56,7 @@ _MMGS_ismaniball(MMG5_pMesh mesh, MMG5_pSol sol, int start, char istart) {
   double           v1, v2;
   int              *adja,k,ip1,ip2,end1;
   char             i,i1,smsgn;
-  static char      mmgWarn=0;
+  static MMG5_THREAD_LOCAL char      mmgWarn=0;
 
   k = start;
   i = _MMG5_inxt2[istart];
@@ -316,7 +316,7 @@ int _MMGS_chkmanimesh(MMG5_pMesh mesh) {
   MMG5_pTria      pt;
   int             *adja,k,cnt,iel;
   char            i,i1;
-  static char     mmgWarn0 = 0;
+  static MMG5_THREAD_LOCAL char     mmgWarn0 = 0;
 
 
   /* First check: check whether one triangle in the mesh has 3 boundary faces */
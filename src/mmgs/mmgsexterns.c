@@ -0,0 +1,40 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mmgs/mmgsexterns.c
+ * \brief Definition of the mmgs function pointers.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * The pointers are thread-local and are set by \ref MMGS_setfunc at the
+ * beginning of each library call.
+ **/
+
+#include "mmgs.h"
+
+MMG5_THREAD_LOCAL double (*_MMG5_calelt)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt);
+MMG5_THREAD_LOCAL int    (*gradsiz)(MMG5_pMesh mesh,MMG5_pSol met);
+MMG5_THREAD_LOCAL int    (*intmet)(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s);
+MMG5_THREAD_LOCAL int    (*movridpt)(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
+MMG5_THREAD_LOCAL int    (*movintpt)(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
@@ -47,6 +47,8 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   int      ier,iel,ipp,k,kel,npt,ibeg,iend;
   char     i0,i1,i2;
 
+  _MMG5_STAT_START(t0);
+
   step = 0.1;
   Vold = 0.0;
   Vnew = 0.0;
@@ -67,7 +69,7 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   iend = pt->v[i2];
 
   /* check for open ball */
-  if ( iend != ibeg )  return(0);
+  if ( iend != ibeg )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
 
   npt = ilist; // number of POINTS in the ball = number of triangles. Each point is counted as the
   // i1 of its associated triangle
@@ -183,10 +185,10 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   /* Check all projections over tangent plane. */
   for (k=0; k<ilist-1; k++) {
     det2d = lispoi[3*k+1]*lispoi[3*(k+1)+2] - lispoi[3*k+2]*lispoi[3*(k+1)+1];
-    if ( det2d < 0.0 )  return(0);
+    if ( det2d < 0.0 )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   det2d = lispoi[3*(ilist-1)+1]*lispoi[3*0+2] - lispoi[3*(ilist-1)+2]*lispoi[3*0+1];
-  if ( det2d < 0.0 )  return(0);
+  if ( det2d < 0.0 )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
 
   /* Step 3 : locate new point in the ball, and compute its barycentric coordinates */
   det2d = lispoi[1]*gv[1] - lispoi[2]*gv[0];
@@ -199,7 +201,7 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
         break;
       }
     }
-    if ( k == ilist )  return(0);
+    if ( k == ilist )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
   else {
     for (k=ilist-1; k>=0; k--) {
@@ -209,13 +211,13 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
         break;
       }
     }
-    if ( k == -1 )  return(0);
+    if ( k == -1 )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   }
 
   /* Sizing of time step : make sure point does not go out corresponding triangle. */
   det2d = -gv[1]*(lispoi[3*(kel+1)+1] - lispoi[3*(kel)+1]) \
     +  gv[0]*(lispoi[3*(kel+1)+2] - lispoi[3*(kel)+2]);
-  if ( fabs(det2d) < _MMG5_EPSD )  return(0);
+  if ( fabs(det2d) < _MMG5_EPSD )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
 
   det2d = 1/det2d;
   step *= det2d;
@@ -228,7 +230,7 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
 
   /* Computation of the barycentric coordinates of the new point in the corresponding triangle. */
   det2d = lispoi[3*kel+1]*lispoi[3*(kel+1)+2] - lispoi[3*kel+2]*lispoi[3*(kel+1)+1];
-  if ( det2d < _MMG5_EPSD )  return(0);
+  if ( det2d < _MMG5_EPSD )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
   det2d = 1.0 / det2d;
   lambda[1] = lispoi[3*(kel+1)+2]*gv[0] - lispoi[3*(kel+1)+1]*gv[1];
   lambda[2] = -lispoi[3*(kel)+2]*gv[0] + lispoi[3*(kel)+1]*gv[1];
@@ -309,12 +311,12 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
     caltmp = caleltsig_iso(mesh,NULL,iel);
     calold = MG_MIN(calold,caltmp);
     caltmp = caleltsig_iso(mesh,NULL,0);
-    if ( caltmp < _MMG5_NULKAL )        return(0);
+    if ( caltmp < _MMG5_NULKAL )        _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
     calnew = MG_MIN(calnew,caltmp);
   }
-  if ( calold < _MMG5_EPSOK && calnew <= calold ) return(0);
-  else if (calnew < _MMG5_EPSOK)    return(0);
-  else if ( calnew < 0.3*calold )  return(0);
+  if ( calold < _MMG5_EPSOK && calnew <= calold ) _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+  else if (calnew < _MMG5_EPSOK)    _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
+  else if ( calnew < 0.3*calold )  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,0);
 
   /* Finally, update coordinates and normals of point, if new position is accepted : */
   p0->c[0] = o[0];
@@ -325,7 +327,7 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   p0->n[1] = no[1];
   p0->n[2] = no[2];
 
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperMove,t0,1);
 }
 
 /* compute movement of a ridge point whose ball (consisting of triangles) is passed */
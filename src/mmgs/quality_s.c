@@ -36,7 +36,6 @@
 #include "mmgs.h"
 #include "inlined_functions.h"
 
-extern char  ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
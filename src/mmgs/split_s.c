@@ -226,6 +226,8 @@ int split1b(MMG5_pMesh mesh,int k,char i,int ip) {
   int            *adja,iel,jel,kel,mel,ier;
   char           i1,i2,j,j1,j2,m;
 
+  _MMG5_STAT_START(t0);
+
   iel = _MMGS_newElt(mesh);
   if ( !iel )  {
     _MMGS_TRIA_REALLOC(mesh,iel,mesh->gap,
@@ -287,7 +289,7 @@ int split1b(MMG5_pMesh mesh,int k,char i,int ip) {
     if ( !kel )  {
       _MMGS_TRIA_REALLOC(mesh,kel,mesh->gap,
                          _MMG5_INCREASE_MEM_MESSAGE();
-                         if ( !_MMGS_delElt(mesh,iel) )  return 0;
+                         if ( !_MMGS_delElt(mesh,iel) )  _MMG5_STAT_RETURN(mesh,MMG5_OperSplit,t0,0);
                          return(0),0);
     }
     pt  = &mesh->tria[jel];
@@ -320,7 +322,7 @@ int split1b(MMG5_pMesh mesh,int k,char i,int ip) {
     mesh->adja[3*(kel-1)+1+j]  = 3*iel+i;
   }
 
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperSplit,t0,1);
 }
 
 /**
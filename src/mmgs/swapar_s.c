@@ -298,8 +298,10 @@ int swapar(MMG5_pMesh mesh,int k,int i) {
   int     *adja,adj,k11,k21;
   char     i1,i2,j,jj,j2,v11,v21;
 
+  _MMG5_STAT_START(t0);
+
   pt   = &mesh->tria[k];
-  if ( MG_EDG(pt->tag[i]) || MS_SIN(pt->tag[i]) )  return(0);
+  if ( MG_EDG(pt->tag[i]) || MS_SIN(pt->tag[i]) )  _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,0);
 
   adja = &mesh->adja[3*(k-1)+1];
   assert(adja[i]);
@@ -315,13 +317,13 @@ int swapar(MMG5_pMesh mesh,int k,int i) {
   /* update structure */
   k11 = adja[i1] / 3;
   v11 = adja[i1] % 3;
-  if ( k11 < 1 )  return(0);
+  if ( k11 < 1 )  _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,0);
   adja = &mesh->adja[3*(adj-1)+1];
   jj  = _MMG5_inxt2[j];
   j2  = _MMG5_iprv2[j];
   k21 = adja[jj] / 3;
   v21 = adja[jj] % 3;
-  if ( k21 < 1 )  return(0);
+  if ( k21 < 1 )  _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,0);
 
   pt->v[i2]  = pt1->v[j];
   pt1->v[j2] = pt->v[i];
@@ -346,7 +348,7 @@ int swapar(MMG5_pMesh mesh,int k,int i) {
   mesh->adja[3*(k11-1)+1+v11] = 3*adj+j;
   mesh->adja[3*(adj-1)+1+j]   = 3*k11+v11;
 
-  return(1);
+  _MMG5_STAT_RETURN(mesh,MMG5_OperSwap,t0,1);
 }
 
 